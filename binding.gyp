@@ -1,7 +1,8 @@
 {
   "targets": [
     {
-      "target_name": "talib_binding",
+      "target_name": "talib_engine",
+      "type": "static_library",
       "sources": [
         "ta-lib/c/src/ta_abstract/frames/ta_frame.c",
         "ta-lib/c/src/ta_abstract/ta_abstract.c",
@@ -55,6 +56,7 @@
         "ta-lib/c/src/ta_func/ta_BBANDS.c",
         "ta-lib/c/src/ta_func/ta_BETA.c",
         "ta-lib/c/src/ta_func/ta_BOP.c",
+        "ta-lib/c/src/ta_func/ta_candle.c",
         "ta-lib/c/src/ta_func/ta_CCI.c",
         "ta-lib/c/src/ta_func/ta_CDL2CROWS.c",
         "ta-lib/c/src/ta_func/ta_CDL3BLACKCROWS.c",
@@ -201,7 +203,7 @@
         "ta-lib/c/src/ta_func/ta_WCLPRICE.c",
         "ta-lib/c/src/ta_func/ta_WILLR.c",
         "ta-lib/c/src/ta_func/ta_WMA.c",
-        "src/talib-binding.generated.cc"
+        "src/talib-engine.cc"
       ],
       "include_dirs": [
         "ta-lib/c/include/",
@@ -210,9 +212,53 @@
         "ta-lib/c/src/ta_abstract/tables/",
         "ta-lib/c/src/ta_abstract/templates/",
         "ta-lib/c/src/ta_common/",
-        "ta-lib/c/src/ta_func/",
+        "ta-lib/c/src/ta_func/"
+      ],
+      "direct_dependent_settings": {
+        "include_dirs": [
+          "ta-lib/c/include/",
+          "src/"
+        ]
+      },
+      "conditions": [
+        ["OS!='win'", {
+          "cflags": ["-fPIC"]
+        }]
+      ]
+    },
+    {
+      "target_name": "talib_binding",
+      "dependencies": [
+        "talib_engine"
+      ],
+      "sources": [
+        "src/talib-arrow.cc",
+        "src/talib-bars.cc",
+        "src/talib-batch.cc",
+        "src/talib-binding.generated.cc",
+        "src/talib-context.cc",
+        "src/talib-csv.cc",
+        "src/talib-extensions.cc",
+        "src/talib-fused.cc",
+        "src/talib-series.cc",
+        "src/talib-settings.cc",
+        "src/talib-store.cc",
+        "src/talib-stream.cc",
+        "src/talib-timeframes.cc"
+      ],
+      "include_dirs": [
         "<!(node -e \"require('nan')\")"
       ]
+    },
+    {
+      "target_name": "talib_backfill",
+      "type": "executable",
+      "dependencies": [
+        "talib_engine"
+      ],
+      "sources": [
+        "src/talib-backfill.cc"
+      ]
     }
   ]
 }
\ No newline at end of file
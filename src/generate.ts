@@ -284,19 +284,22 @@ export function generateBindings({ _ }: Arguments) {
     "",
     "#include <nan.h>",
     '#include "../ta-lib/c/include/ta_libc.h"',
+    '#include "talib-extensions.h"',
     ""
   );
   const footer = new ContentBuilder();
   footer
     .normal("")
     .normal(
-      "void Init(v8::Local<v8::Object> exports, v8::Local<v8::Object> module) {"
+      "void Init(v8::Local<v8::Object> exports) {"
     )
-    .indent("TA_RetCode retCode = TA_Initialize();")
+    .indent("TA_RetCode retCode = talib::Initialize();")
     .normal("if (retCode != TA_SUCCESS) {")
     .indent('Nan::ThrowError("TA initialize failed!");')
     .normal("return;")
-    .undent("}");
+    .undent("}")
+    // the state of this instance of the addon, one per thread
+    .normal("v8::Local<v8::Value> data = AddonData::New();");
   const config: TaFuncApiXml = require("./ta_func_api.generated.json");
   config.FinancialFunctions.FinancialFunction.filter(
     func => _.length === 0 || _.indexOf(func.Abbreviation[0]) > -1
@@ -366,10 +369,10 @@ export function generateBindings({ _ }: Arguments) {
         "v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();"
       )
       .normal(
-        "v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);"
+        "v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);"
       )
       // input length
-      .normal("int inLength = inFirst->Length();")
+      .normal("int inLength = InputLength(info[0]);")
       // output length
       .normal("int outLength = 0;")
       // check input length, if is 0, return empty result, avoid check parameters
@@ -383,12 +386,8 @@ export function generateBindings({ _ }: Arguments) {
       .normal("if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {")
       .indent("firstIsRecord = 1;")
       .undent("}")
-      // declare required input
-      .normal(
-        ...required.map(
-          argv => `double *${inName(argv)} = new double[inLength];`
-        )
-      )
+      // declare required input, a Float64Array is used in place
+      .normal(...required.map(argv => `RealInput ${inName(argv)};`))
       // declare optional input
       .normal(
         ...optional.map(argv => {
@@ -409,23 +408,20 @@ export function generateBindings({ _ }: Arguments) {
       .normal("int argc = info.Length();")
       // init inputs
       .normal("if (firstIsRecord == 0) {")
-      .indent(
-        ...required.map((argv, index) => {
-          return `v8::Local<v8::Array> ${jsInName(
-            argv
-          )} = v8::Local<v8::Array>::Cast(info[${index}]);`;
-        })
-      )
       // init required
-      .normal("for (i = 0; i < (uint32_t) inLength; i++) {")
       .indent(
-        ...required.map(
-          argv =>
-            `${inName(argv)}[i] = Nan::Get(${jsInName(
-              argv
-            )}, i).ToLocalChecked()->NumberValue(context).FromJust();`
-        )
+        "if (" +
+          required
+            .map(
+              (argv, index) =>
+                `!${inName(argv)}.Init(info[${index}], "${inName(
+                  argv
+                )}", inLength)`
+            )
+            .join(" || ") +
+          ") {"
       )
+      .indent("return;")
       .undent("}")
       // init optional
       .normal(
@@ -455,11 +451,12 @@ export function generateBindings({ _ }: Arguments) {
         ...required.map((argv, index) => {
           const ctor =
             doubleRequired.indexOf(argv) === -1
-              ? `Nan::New("${argv.Type[0]}").ToLocalChecked()`
+              ? `Nan::New(AddonData::From(info)->recordFields[RECORD_${argv.Type[0].toUpperCase()}])`
               : `info[${index + 1}]->ToString(context).ToLocalChecked();`;
           return `v8::Local<v8::String> ${inName(argv)}Name = ${ctor};`;
         })
       )
+      .normal(...required.map(argv => `${inName(argv)}.Alloc(inLength);`))
       .normal(`v8::Local<v8::Object> inObject;`)
       .normal("for (i = 0; i < (uint32_t) inLength; i++) {")
       .indent(
@@ -467,7 +464,7 @@ export function generateBindings({ _ }: Arguments) {
       )
       .normal(
         ...required.map(argv => {
-          return `${inName(argv)}[i] = Nan::Get(inObject, ${inName(
+          return `${inName(argv)}.data[i] = Nan::Get(inObject, ${inName(
             argv
           )}Name).ToLocalChecked()->NumberValue(context).FromJust();`;
         })
@@ -522,7 +519,7 @@ export function generateBindings({ _ }: Arguments) {
       )
       .normal(
         `TA_RetCode result = TA_${name}(startIdx, endIdx, ` +
-          required.map(argv => inName(argv)).join(", ") +
+          required.map(argv => `${inName(argv)}.data`).join(", ") +
           (required.length > 0 ? ", " : "") +
           optional.map(argv => optName(argv)).join(", ") +
           (optional.length > 0 ? ", " : "") +
@@ -531,8 +528,7 @@ export function generateBindings({ _ }: Arguments) {
           ");"
       )
       .normal("if (result != TA_SUCCESS) {")
-      .indent(...required.map(argv => `delete[] ${inName(argv)};`))
-      .normal(...output.map(argv => `delete[] ${outName(argv)};`))
+      .indent(...output.map(argv => `delete[] ${outName(argv)};`))
       .normal("TA_RetCodeInfo retCodeInfo;")
       .normal("TA_SetRetCodeInfo(result, &retCodeInfo);")
       .normal("char error[100];")
@@ -554,11 +550,10 @@ export function generateBindings({ _ }: Arguments) {
       )
       .undent("}")
       .normal(returnStatement)
-      .normal(...required.map(argv => `delete[] ${inName(argv)};`))
       .normal(...output.map(argv => `delete[] ${outName(argv)};`))
       .undent("}", "", "");
     footer.normal(
-      `Nan::Set(exports, Nan::New("${name}").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_${name})->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());`
+      `Nan::Set(exports, Nan::New("${name}").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_${name}, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());`
     );
   });
 
@@ -571,9 +566,10 @@ export function generateBindings({ _ }: Arguments) {
       })
     )
     .normal('Nan::Set(exports, Nan::New("MATypes").ToLocalChecked(), MATypes);')
+    .normal("InitExtensions(exports, data);")
     .undent("}")
     .normal("")
-    .normal("NODE_MODULE(talib_binding, Init)", "");
+    .normal("NAN_MODULE_WORKER_ENABLED(talib_binding, Init)", "");
   fs.writeFileSync(
     __dirname + "/talib-binding.generated.cc",
     body.build() + footer.build()
@@ -590,6 +586,7 @@ export function generateTypes() {
       " */",
       ""
     )
+    .normal('export * from "./talib-extensions";', "")
     .normal("export declare enum MATypes {")
     .indent(
       ...Object.keys(TA_MATypes).map(value => {
@@ -647,7 +644,7 @@ export function generateTypes() {
       .normal("/**", ` * ${name} - ${func.ShortDescription[0]}`, " *")
       .normal(
         ...required.map(argv => {
-          return ` * @param {number[]} ${inName(argv)} - ${argv.Type[0]}`;
+          return ` * @param {number[] | Float64Array} ${inName(argv)} - ${argv.Type[0]}`;
         })
       )
       .normal(
@@ -674,7 +671,9 @@ export function generateTypes() {
       .normal(" */")
       .normal(
         `export declare function ${name}(` +
-          required.map(argv => inName(argv) + ": number[]").join(", ") +
+          required
+            .map(argv => inName(argv) + ": number[] | Float64Array")
+            .join(", ") +
           (required.length > 0 ? ", " : "") +
           optional
             .map(argv => optName(argv) + "?: " + optType(argv, true))
@@ -754,7 +753,12 @@ export function generateGyp() {
       nodir: false
     }
   );
-  sources.push("src/talib-binding.generated.cc");
+  sources.push(
+    ...G.sync("src/*.cc", {
+      cwd: __dirname + "/..",
+      nodir: true
+    })
+  );
   includes.push("<!(node -e \"require('nan')\")");
   const config: any = {
     targets: [
@@ -0,0 +1,336 @@
+/*!
+ * Arrow C Data Interface bindings, the TA functions run on the buffers of
+ * float64 Arrow arrays and write their outputs to new Arrow arrays, without
+ * going through JS values and without an Arrow library.
+ *
+ * See https://arrow.apache.org/docs/format/CDataInterface.html
+ */
+
+#include "talib-extensions.h"
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+/**
+ * An `ArrowArray`/`ArrowSchema` pair, from the `{array, schema}` addresses
+ * given by JS.
+ */
+struct ArrowColumn {
+    struct ArrowArray *array;
+    struct ArrowSchema *schema;
+};
+
+/**
+ * The buffers of an output array, freed by its release callback.
+ */
+struct ArrowOutputData {
+    const void *buffers[2];
+};
+
+static void ReleaseOutputArray(struct ArrowArray *array) {
+    ArrowOutputData *data = static_cast<ArrowOutputData *>(array->private_data);
+    free(const_cast<void *>(data->buffers[0]));
+    free(const_cast<void *>(data->buffers[1]));
+    delete data;
+    array->release = NULL;
+}
+
+static void ReleaseOutputSchema(struct ArrowSchema *schema) {
+    // The format and the name are static strings.
+    schema->release = NULL;
+}
+
+/**
+ * Release the imported inputs, the consumer of an exported array owns it.
+ */
+static void ReleaseInputs(ArrowColumn *columns, int count) {
+    for (int c = 0; c < count; c++) {
+        if (columns[c].array->release != NULL) {
+            columns[c].array->release(columns[c].array);
+        }
+        if (columns[c].schema->release != NULL) {
+            columns[c].schema->release(columns[c].schema);
+        }
+    }
+}
+
+/**
+ * Read the `{array, schema}` addresses of the column at `index` of `list`.
+ */
+static bool ReadColumn(v8::Local<v8::Array> list, uint32_t index, const char *name, ArrowColumn *column) {
+    v8::Local<v8::Value> value = Nan::Get(list, index).ToLocalChecked();
+    if (value->IsObject()) {
+        v8::Local<v8::Object> object = value.As<v8::Object>();
+        v8::Local<v8::Value> array = Nan::Get(object, Nan::New("array").ToLocalChecked()).ToLocalChecked();
+        v8::Local<v8::Value> schema = Nan::Get(object, Nan::New("schema").ToLocalChecked()).ToLocalChecked();
+        if (array->IsBigInt() && schema->IsBigInt()) {
+            column->array = reinterpret_cast<struct ArrowArray *>(array.As<v8::BigInt>()->Uint64Value());
+            column->schema = reinterpret_cast<struct ArrowSchema *>(schema.As<v8::BigInt>()->Uint64Value());
+            if (column->array != NULL && column->schema != NULL) {
+                return true;
+            }
+        }
+    }
+    char error[100];
+    snprintf(error, sizeof(error), "`%s[%u]` must be `{array: bigint, schema: bigint}`", name, index);
+    Nan::ThrowTypeError(error);
+    return false;
+}
+
+/**
+ * The values of an imported column of `format`, throws and returns NULL if
+ * the column is released, of another type, or has nulls.
+ */
+static const void *ImportValues(const ArrowColumn &column, const char *format, size_t size, uint32_t index) {
+    const struct ArrowArray *array = column.array;
+    char error[100];
+    if (array->release == NULL || column.schema->release == NULL) {
+        snprintf(error, sizeof(error), "`inputs[%u]` is released", index);
+        Nan::ThrowTypeError(error);
+        return NULL;
+    }
+    if (strcmp(column.schema->format, format) != 0 || array->n_buffers != 2 || array->buffers[1] == NULL ||
+        array->length > 0x7fffffff) {
+        snprintf(error, sizeof(error), "`inputs[%u]` must be an Arrow array of format \"%s\"", index, format);
+        Nan::ThrowTypeError(error);
+        return NULL;
+    }
+    const uint8_t *validity = static_cast<const uint8_t *>(array->buffers[0]);
+    if (validity != NULL && array->null_count != 0) {
+        for (int64_t i = array->offset; i < array->offset + array->length; i++) {
+            if ((validity[i >> 3] & (1 << (i & 7))) == 0) {
+                snprintf(error, sizeof(error), "`inputs[%u]` has null values", index);
+                Nan::ThrowRangeError(error);
+                return NULL;
+            }
+        }
+    }
+    return static_cast<const char *>(array->buffers[1]) + array->offset * size;
+}
+
+/**
+ * Fill `column` with a new nullable array of `length` values of `size`
+ * bytes, returns its values, the validity bitmap is all null.
+ */
+static void *ExportValues(const ArrowColumn &column, const char *format, const char *name, size_t size,
+                          int length, uint8_t **validity) {
+    ArrowOutputData *data = new ArrowOutputData();
+    *validity = static_cast<uint8_t *>(calloc((length + 7) / 8 + 1, 1));
+    void *values = calloc(length + 1, size);
+    data->buffers[0] = *validity;
+    data->buffers[1] = values;
+
+    struct ArrowArray *array = column.array;
+    array->length = length;
+    array->null_count = length;
+    array->offset = 0;
+    array->n_buffers = 2;
+    array->n_children = 0;
+    array->buffers = data->buffers;
+    array->children = NULL;
+    array->dictionary = NULL;
+    array->release = ReleaseOutputArray;
+    array->private_data = data;
+
+    struct ArrowSchema *schema = column.schema;
+    schema->format = format;
+    schema->name = name;
+    schema->metadata = NULL;
+    schema->flags = ARROW_FLAG_NULLABLE;
+    schema->n_children = 0;
+    schema->children = NULL;
+    schema->dictionary = NULL;
+    schema->release = ReleaseOutputSchema;
+    schema->private_data = NULL;
+    return values;
+}
+
+/**
+ * callArrow(name: string, inputs: ArrowColumn[], outputs: ArrowColumn[],
+ *           optInputs?: (number | undefined)[]) => number
+ *
+ * `inputs` are the input series of the function in order, a price input
+ * takes one column for each of its open, high, low, close, volume and open
+ * interest. They are moved: they are released once the call is done, as
+ * the Arrow C Data Interface requires from a consumer. `outputs` are empty
+ * structs which are filled with one array per output, as long as the
+ * inputs, with the lookback region null. Returns the length of the lookback
+ * region.
+ */
+void TA_FUNC_callArrow(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    if (info.Length() < 1 || !info[0]->IsString()) {
+        Nan::ThrowTypeError("`name` must be a TA function name");
+        return;
+    }
+    if (info.Length() < 3 || !info[1]->IsArray() || !info[2]->IsArray()) {
+        Nan::ThrowTypeError("`inputs` and `outputs` must be arrays of Arrow columns");
+        return;
+    }
+    v8::Local<v8::Array> inputList = info[1].As<v8::Array>();
+    v8::Local<v8::Array> outputList = info[2].As<v8::Array>();
+    int nbInputColumn = (int) inputList->Length();
+    ArrowColumn *inputs = new ArrowColumn[nbInputColumn > 0 ? nbInputColumn : 1];
+    for (int c = 0; c < nbInputColumn; c++) {
+        if (!ReadColumn(inputList, c, "inputs", &inputs[c])) {
+            ReleaseInputs(inputs, c);
+            delete[] inputs;
+            return;
+        }
+    }
+
+    Nan::Utf8String name(info[0]);
+    talib::Function function;
+    TA_RetCode retCode = function.Init(*name);
+    if (retCode != TA_SUCCESS) {
+        ReleaseInputs(inputs, nbInputColumn);
+        delete[] inputs;
+        ThrowRetCode("TA_GetFuncHandle", retCode);
+        return;
+    }
+
+    // Set the inputs, one column per real or integer input, one per
+    // component of a price input.
+    bool ok = true;
+    int length = 0;
+    if (nbInputColumn != function.InputColumnCount()) {
+        char error[100];
+        snprintf(error, sizeof(error), "%s takes %d input columns", *name, function.InputColumnCount());
+        Nan::ThrowRangeError(error);
+        ok = false;
+    }
+    for (int c = 0; ok && c < nbInputColumn; c++) {
+        bool integer = function.IsIntegerInput(c);
+        const void *values = ImportValues(inputs[c], integer ? "i" : "g", integer ? sizeof(int) : sizeof(double), c);
+        if (values == NULL) {
+            ok = false;
+        } else if (c > 0 && inputs[c].array->length != length) {
+            Nan::ThrowRangeError("the input columns must have the same length");
+            ok = false;
+        }
+        length = (int) inputs[c].array->length;
+        function.SetInput(c, values);
+    }
+    int nbOutput = function.OutputCount();
+    if (ok && (int) outputList->Length() != nbOutput) {
+        char error[100];
+        snprintf(error, sizeof(error), "%s has %d outputs", *name, nbOutput);
+        Nan::ThrowRangeError(error);
+        ok = false;
+    }
+
+    // Set the optional inputs, the missing ones keep their default.
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    bool hasOptInputs = info.Length() > 3 && info[3]->IsArray();
+    for (int p = 0; ok && hasOptInputs && p < function.OptInputCount(); p++) {
+        v8::Local<v8::Value> value = Nan::Get(info[3].As<v8::Array>(), p).ToLocalChecked();
+        if (!value->IsNumber()) {
+            continue;
+        }
+        retCode = function.SetOptInput(p, value->NumberValue(context).FromJust());
+        if (retCode != TA_SUCCESS) {
+            ThrowRetCode("TA_SetOptInputParam", retCode);
+            ok = false;
+        }
+    }
+
+    // Export the outputs, the values are written after the lookback.
+    int lookback = 0;
+    if (ok) {
+        retCode = function.Lookback(&lookback);
+        if (retCode != TA_SUCCESS) {
+            ThrowRetCode("TA_GetLookback", retCode);
+            ok = false;
+        }
+    }
+    ArrowColumn *outputs = new ArrowColumn[nbOutput > 0 ? nbOutput : 1];
+    uint8_t **validity = new uint8_t *[nbOutput > 0 ? nbOutput : 1];
+    void **outValues = new void *[nbOutput > 0 ? nbOutput : 1];
+    for (int p = 0; ok && p < nbOutput; p++) {
+        ok = ReadColumn(outputList, p, "outputs", &outputs[p]);
+    }
+    int begin = lookback < length ? lookback : length;
+    for (int p = 0; ok && p < nbOutput; p++) {
+        if (function.IsIntegerOutput(p)) {
+            int *values = (int *) ExportValues(outputs[p], "i", function.OutputName(p), sizeof(int), length,
+                                               &validity[p]);
+            outValues[p] = values + begin;
+        } else {
+            double *values = (double *) ExportValues(outputs[p], "g", function.OutputName(p), sizeof(double),
+                                                     length, &validity[p]);
+            outValues[p] = values + begin;
+        }
+    }
+    if (ok && begin < length) {
+        int outBegIdx = 0, outNBElement = 0;
+        retCode = function.Call(0, length - 1, outValues, &outBegIdx, &outNBElement);
+        if (retCode != TA_SUCCESS) {
+            for (int p = 0; p < nbOutput; p++) {
+                outputs[p].array->release(outputs[p].array);
+                outputs[p].schema->release(outputs[p].schema);
+            }
+            ThrowRetCode(*name, retCode);
+            ok = false;
+        }
+        for (int p = 0; ok && p < nbOutput; p++) {
+            for (int i = begin; i < begin + outNBElement; i++) {
+                validity[p][i >> 3] |= (uint8_t) (1 << (i & 7));
+            }
+            outputs[p].array->null_count = length - outNBElement;
+        }
+    }
+
+    delete[] outValues;
+    delete[] validity;
+    delete[] outputs;
+    ReleaseInputs(inputs, nbInputColumn);
+    delete[] inputs;
+    if (ok) {
+        info.GetReturnValue().Set(Nan::New<v8::Number>(begin));
+    }
+}
+
+void InitArrow(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    Nan::Set(exports, Nan::New("callArrow").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_callArrow, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+}
@@ -0,0 +1,441 @@
+/*!
+ * talib-backfill, evaluate a list of indicators over a directory of series,
+ * in parallel, one file per task:
+ *
+ *   talib-backfill [-j threads] [--schema a,b,...] [--delimiter c] <input-dir> <spec-file> <output-dir>
+ *
+ * The inputs are CSV files, `*.csv`, whose first line holds the names of the
+ * columns, and series files, `*.series`, see `talib::SeriesFile`, whose
+ * columns are named by `--schema`, the other files are ignored. The spec file has one indicator per line:
+ *
+ *   # label = FUNCTION(input, ...; optInput, ...)
+ *   sma20 = SMA(close; 20)
+ *   bb = BBANDS(close; 20, 2.5, 2.5)
+ *   atr = ATR(high, low, close)
+ *
+ * The inputs are column names, a price input takes one column for each of
+ * its components. The optional inputs are numbers in order, the missing or
+ * empty ones keep their default.
+ *
+ * For each input, a series file `<name>.series` is written to the output
+ * directory with one column per output, as long as the input, NaN in the
+ * lookback. The columns are `label` for a function with one output and
+ * `label.outputName` otherwise, their names are written to `columns.txt`.
+ * The throughput of each stage is reported on stderr.
+ */
+
+#include "talib-engine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * One line of the spec file.
+ */
+struct Indicator {
+    std::string label;
+    std::string function;
+    std::vector<std::string> inputs;
+    std::vector<std::pair<int, double> > optInputs;
+    std::vector<std::string> outputs;
+};
+
+/**
+ * The time spent and the amount of work done by a stage, summed over the
+ * threads.
+ */
+struct Stage {
+    Stage() : nanoseconds(0), items(0), values(0), bytes(0) {}
+
+    std::atomic<int64_t> nanoseconds;
+    std::atomic<int64_t> items;
+    std::atomic<int64_t> values;
+    std::atomic<int64_t> bytes;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+static int64_t Since(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+static std::string Trim(const std::string &text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    size_t end = text.find_last_not_of(" \t\r");
+    return begin == std::string::npos ? std::string() : text.substr(begin, end - begin + 1);
+}
+
+static std::vector<std::string> Split(const std::string &text, char separator) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, separator)) {
+        parts.push_back(Trim(part));
+    }
+    if (!text.empty() && text[text.size() - 1] == separator) {
+        parts.push_back(std::string());
+    }
+    return parts;
+}
+
+/**
+ * Read the spec file, checks the functions and their arguments. Prints the
+ * error and returns false if it is invalid.
+ */
+static bool ReadSpec(const char *path, std::vector<Indicator> *indicators) {
+    std::ifstream file(path);
+    if (!file) {
+        fprintf(stderr, "talib-backfill: cannot read `%s`\n", path);
+        return false;
+    }
+    std::string line;
+    for (int number = 1; std::getline(file, line); number++) {
+        line = Trim(line.substr(0, line.find('#')));
+        if (line.empty()) {
+            continue;
+        }
+        size_t equal = line.find('='), open = line.find('('), close = line.rfind(')');
+        if (equal == std::string::npos || open == std::string::npos || close == std::string::npos ||
+            open < equal || close < open || !Trim(line.substr(close + 1)).empty()) {
+            fprintf(stderr, "talib-backfill: %s:%d: expected `label = FUNCTION(inputs; optInputs)`\n", path,
+                    number);
+            return false;
+        }
+        Indicator indicator;
+        indicator.label = Trim(line.substr(0, equal));
+        indicator.function = Trim(line.substr(equal + 1, open - equal - 1));
+        std::string arguments = line.substr(open + 1, close - open - 1);
+        size_t semicolon = arguments.find(';');
+        indicator.inputs = Split(arguments.substr(0, semicolon), ',');
+        talib::Function function;
+        TA_RetCode retCode = function.Init(indicator.function.c_str());
+        if (retCode != TA_SUCCESS) {
+            fprintf(stderr, "talib-backfill: %s:%d: unknown function `%s`\n", path, number,
+                    indicator.function.c_str());
+            return false;
+        }
+        if ((int) indicator.inputs.size() != function.InputColumnCount()) {
+            fprintf(stderr, "talib-backfill: %s:%d: %s takes %d input columns\n", path, number,
+                    indicator.function.c_str(), function.InputColumnCount());
+            return false;
+        }
+        std::vector<std::string> optInputs;
+        if (semicolon != std::string::npos) {
+            optInputs = Split(arguments.substr(semicolon + 1), ',');
+        }
+        if ((int) optInputs.size() > function.OptInputCount()) {
+            fprintf(stderr, "talib-backfill: %s:%d: %s takes %d optional inputs\n", path, number,
+                    indicator.function.c_str(), function.OptInputCount());
+            return false;
+        }
+        for (size_t o = 0; o < optInputs.size(); o++) {
+            if (optInputs[o].empty()) {
+                continue;
+            }
+            char *end;
+            double value = strtod(optInputs[o].c_str(), &end);
+            if (*end != '\0' || function.SetOptInput((int) o, value) != TA_SUCCESS) {
+                fprintf(stderr, "talib-backfill: %s:%d: invalid optional input `%s`\n", path, number,
+                        optInputs[o].c_str());
+                return false;
+            }
+            indicator.optInputs.push_back(std::make_pair((int) o, value));
+        }
+        for (int o = 0; o < function.OutputCount(); o++) {
+            indicator.outputs.push_back(function.OutputCount() == 1 ? indicator.label
+                                                                    : indicator.label + "." + function.OutputName(o));
+        }
+        indicators->push_back(indicator);
+    }
+    if (indicators->empty()) {
+        fprintf(stderr, "talib-backfill: `%s` has no indicator\n", path);
+        return false;
+    }
+    return true;
+}
+
+static bool EndsWith(const std::string &text, const char *suffix) {
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+static bool IsInput(const std::string &name) {
+    return EndsWith(name, ".csv") || EndsWith(name, ".series");
+}
+
+/**
+ * The CSV and series files of `directory`, sorted by name.
+ */
+static bool ListFiles(const char *directory, std::vector<std::string> *files) {
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileA((std::string(directory) + "\\*").c_str(), &data);
+    if (find == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    do {
+        if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && IsInput(data.cFileName)) {
+            files->push_back(data.cFileName);
+        }
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+#else
+    DIR *dir = opendir(directory);
+    if (dir == NULL) {
+        return false;
+    }
+    while (struct dirent *entry = readdir(dir)) {
+        struct stat st;
+        std::string path = std::string(directory) + "/" + entry->d_name;
+        if (IsInput(entry->d_name) && stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+            files->push_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+#endif
+    std::sort(files->begin(), files->end());
+    return true;
+}
+
+static void MakeDirectory(const char *path) {
+#ifdef _WIN32
+    _mkdir(path);
+#else
+    mkdir(path, 0777);
+#endif
+}
+
+/**
+ * The options and the totals of a run.
+ */
+struct Backfill {
+    std::string inputDirectory;
+    std::string outputDirectory;
+    std::vector<std::string> schema;
+    char delimiter;
+    std::vector<Indicator> indicators;
+    std::vector<std::string> outputs;
+    Stage read, compute, write;
+    std::mutex errors;
+    int failures;
+
+    void Fail(const std::string &file, const std::string &message) {
+        std::lock_guard<std::mutex> lock(errors);
+        fprintf(stderr, "talib-backfill: %s: %s\n", file.c_str(), message.c_str());
+        failures++;
+    }
+};
+
+/**
+ * Read, evaluate and write one input file, returns false on failure.
+ */
+static bool RunFile(Backfill &run, const std::string &name) {
+    std::string path = run.inputDirectory + "/" + name;
+    std::string error;
+
+    // Read the columns, by name.
+    Clock::time_point start = Clock::now();
+    std::vector<std::string> names;
+    std::vector<std::vector<double> > csvColumns;
+    talib::SeriesFile *series = NULL;
+    std::vector<const double *> columns;
+    int rows;
+    int64_t bytes;
+    if (EndsWith(name, ".csv")) {
+        talib::CsvReader reader;
+        talib::CsvReader::Options options;
+        options.delimiter = run.delimiter;
+        options.threads = 1;
+        if (reader.Open(path.c_str(), options, &error) != talib::CsvReader::OK) {
+            run.Fail(name, error);
+            return false;
+        }
+        rows = reader.RowCount();
+        names = reader.ColumnNames();
+        csvColumns.resize(names.size(), std::vector<double>(rows > 0 ? rows : 1));
+        std::vector<double *> buffers;
+        for (size_t c = 0; c < csvColumns.size(); c++) {
+            buffers.push_back(csvColumns[c].data());
+            columns.push_back(csvColumns[c].data());
+        }
+        reader.Parse(buffers.data());
+        std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+        bytes = (int64_t) file.tellg();
+    } else {
+        series = talib::SeriesFile::Open(path.c_str(), &error);
+        if (series == NULL) {
+            run.Fail(name, error);
+            return false;
+        }
+        if ((size_t) series->ColumnCount() != run.schema.size()) {
+            char message[100];
+            snprintf(message, sizeof(message), "has %d columns, the schema has %d", series->ColumnCount(),
+                     (int) run.schema.size());
+            series->Release();
+            run.Fail(name, message);
+            return false;
+        }
+        rows = series->RowCount();
+        names = run.schema;
+        for (int c = 0; c < series->ColumnCount(); c++) {
+            columns.push_back(series->Column(c));
+        }
+        bytes = (int64_t) rows * series->ColumnCount() * sizeof(double);
+    }
+    run.read.nanoseconds += Since(start);
+    run.read.items++;
+    run.read.values += (int64_t) rows * columns.size();
+    run.read.bytes += bytes;
+
+    // Evaluate the indicators, the outputs are aligned with the input rows.
+    start = Clock::now();
+    std::vector<double> outputs(run.outputs.size() * (size_t) rows, NAN);
+    size_t output = 0;
+    bool ok = true;
+    for (size_t i = 0; ok && i < run.indicators.size(); i++) {
+        const Indicator &indicator = run.indicators[i];
+        talib::Function function;
+        function.Init(indicator.function.c_str());
+        for (size_t c = 0; ok && c < indicator.inputs.size(); c++) {
+            size_t column = std::find(names.begin(), names.end(), indicator.inputs[c]) - names.begin();
+            if (column == names.size()) {
+                run.Fail(name, "has no column `" + indicator.inputs[c] + "`");
+                ok = false;
+            } else {
+                function.SetInput((int) c, columns[column]);
+            }
+        }
+        for (size_t o = 0; o < indicator.optInputs.size(); o++) {
+            function.SetOptInput(indicator.optInputs[o].first, indicator.optInputs[o].second);
+        }
+        if (!ok) {
+            continue;
+        }
+        std::vector<double *> buffers;
+        for (int o = 0; o < function.OutputCount(); o++) {
+            buffers.push_back(outputs.data() + (output + o) * rows);
+        }
+        TA_RetCode retCode = function.CallFull(rows, buffers.data());
+        if (retCode != TA_SUCCESS) {
+            TA_RetCodeInfo info;
+            TA_SetRetCodeInfo(retCode, &info);
+            run.Fail(name, indicator.label + ": " + info.enumStr);
+            ok = false;
+        }
+        run.compute.items++;
+        run.compute.values += rows;
+        output += indicator.outputs.size();
+    }
+    if (series != NULL) {
+        series->Release();
+    }
+    run.compute.nanoseconds += Since(start);
+    if (!ok) {
+        return false;
+    }
+
+    // Write the outputs.
+    start = Clock::now();
+    std::vector<const double *> outColumns;
+    for (size_t o = 0; o < run.outputs.size(); o++) {
+        outColumns.push_back(outputs.data() + o * rows);
+    }
+    std::string outPath = run.outputDirectory + "/" + name.substr(0, name.rfind('.')) + ".series";
+    if (!talib::WriteSeriesFile(outPath.c_str(), outColumns.data(), (int) outColumns.size(), rows, &error)) {
+        run.Fail(name, error);
+        return false;
+    }
+    run.write.nanoseconds += Since(start);
+    run.write.items++;
+    run.write.values += (int64_t) rows * outColumns.size();
+    run.write.bytes += 32 + (int64_t) rows * outColumns.size() * sizeof(double);
+    return true;
+}
+
+static void Report(const char *name, const Stage &stage, const char *items) {
+    double seconds = stage.nanoseconds / 1e9;
+    fprintf(stderr, "%-8s %8lld %-6s %12lld values %10.1f MB %9.2f s  %8.1f M values/s  %8.1f MB/s\n", name,
+            (long long) stage.items, items, (long long) stage.values, stage.bytes / 1e6, seconds,
+            seconds > 0 ? stage.values / seconds / 1e6 : 0.0, seconds > 0 ? stage.bytes / seconds / 1e6 : 0.0);
+}
+
+static int Usage() {
+    fprintf(stderr, "usage: talib-backfill [-j threads] [--schema a,b,...] [--delimiter c] "
+                    "<input-dir> <spec-file> <output-dir>\n");
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    Backfill run;
+    run.delimiter = ',';
+    run.failures = 0;
+    int threads = 0;
+    std::vector<const char *> paths;
+    for (int a = 1; a < argc; a++) {
+        std::string arg = argv[a];
+        if ((arg == "-j" || arg == "--threads") && a + 1 < argc) {
+            threads = atoi(argv[++a]);
+        } else if (arg == "--schema" && a + 1 < argc) {
+            run.schema = Split(argv[++a], ',');
+        } else if (arg == "--delimiter" && a + 1 < argc && strlen(argv[a + 1]) == 1) {
+            run.delimiter = argv[++a][0];
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            return Usage();
+        } else {
+            paths.push_back(argv[a]);
+        }
+    }
+    if (paths.size() != 3) {
+        return Usage();
+    }
+    run.inputDirectory = paths[0];
+    run.outputDirectory = paths[2];
+    if (talib::Initialize() != TA_SUCCESS || !ReadSpec(paths[1], &run.indicators)) {
+        return 1;
+    }
+    for (size_t i = 0; i < run.indicators.size(); i++) {
+        run.outputs.insert(run.outputs.end(), run.indicators[i].outputs.begin(), run.indicators[i].outputs.end());
+    }
+    std::vector<std::string> files;
+    if (!ListFiles(paths[0], &files)) {
+        fprintf(stderr, "talib-backfill: cannot list `%s`\n", paths[0]);
+        return 1;
+    }
+    MakeDirectory(paths[2]);
+    std::ofstream columns((run.outputDirectory + "/columns.txt").c_str());
+    for (size_t o = 0; o < run.outputs.size(); o++) {
+        columns << run.outputs[o] << "\n";
+    }
+    if (!columns.flush()) {
+        fprintf(stderr, "talib-backfill: cannot write to `%s`\n", paths[2]);
+        return 1;
+    }
+
+    // The files are taken in order by the threads as they get free, a large
+    // file does not hold back the others.
+    Clock::time_point start = Clock::now();
+    talib::ParallelFor((int) files.size(), threads, [&run, &files](int f) { RunFile(run, files[f]); });
+    double seconds = Since(start) / 1e9;
+
+    Report("read", run.read, "files");
+    Report("compute", run.compute, "calls");
+    Report("write", run.write, "files");
+    fprintf(stderr, "total    %8d files, %d failed, %.2f s, %.1f M input values/s\n", (int) files.size(),
+            run.failures, seconds, seconds > 0 ? run.read.values / seconds / 1e6 : 0.0);
+    return run.failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,142 @@
+/*!
+ * The bar aggregator, trades are aggregated natively into time, tick,
+ * volume or dollar bars, returned as the `Float64Array` columns which the TA
+ * functions read in place, see `talib::BarAggregator`.
+ */
+
+#include "talib-extensions.h"
+#include <cmath>
+
+class BarAggregatorWrap : public Nan::ObjectWrap {
+public:
+    /**
+     * new BarAggregator(type: BarType, barSize: number) => BarAggregator
+     */
+    static void New(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        if (!info.IsConstructCall()) {
+            Nan::ThrowTypeError("`BarAggregator` must be called with `new`");
+            return;
+        }
+        talib::BarAggregator::Type type;
+        double barSize;
+        if (!ReadBarType(info, 0, &type, &barSize)) {
+            return;
+        }
+        BarAggregatorWrap *wrap = new BarAggregatorWrap(type, barSize);
+        wrap->Wrap(info.This());
+        info.GetReturnValue().Set(info.This());
+    }
+
+    /**
+     * Read the bar type and size at `index` and `index + 1`, throws and
+     * returns false if they are invalid.
+     */
+    static bool ReadBarType(const Nan::FunctionCallbackInfo<v8::Value> &info, int index,
+                            talib::BarAggregator::Type *type, double *barSize) {
+        if (info.Length() <= index || !info[index]->IsInt32()) {
+            Nan::ThrowTypeError("`type` must be one of `BarType`");
+            return false;
+        }
+        int value = info[index]->Int32Value(Nan::GetCurrentContext()).FromJust();
+        if (value < talib::BarAggregator::TIME || value > talib::BarAggregator::DOLLAR) {
+            Nan::ThrowRangeError("`type` must be one of `BarType`");
+            return false;
+        }
+        if (info.Length() <= index + 1 || !info[index + 1]->IsNumber()) {
+            Nan::ThrowTypeError("`barSize` must be a number");
+            return false;
+        }
+        *type = (talib::BarAggregator::Type) value;
+        *barSize = info[index + 1]->NumberValue(Nan::GetCurrentContext()).FromJust();
+        if (!(*barSize > 0) || std::isinf(*barSize)) {
+            Nan::ThrowRangeError("`barSize` must be positive");
+            return false;
+        }
+        return true;
+    }
+
+    static BarAggregatorWrap *Unwrap(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        return Nan::ObjectWrap::Unwrap<BarAggregatorWrap>(info.This());
+    }
+
+    talib::BarAggregator aggregator;
+
+private:
+    BarAggregatorWrap(talib::BarAggregator::Type type, double barSize) : aggregator(type, barSize) {}
+};
+
+/**
+ * Add the trades of the arguments at `index` to `aggregator`, throws and
+ * returns false if they are invalid.
+ */
+static bool AddTrades(const Nan::FunctionCallbackInfo<v8::Value> &info, int index,
+                      talib::BarAggregator &aggregator, talib::Bars *bars) {
+    RealInput price, size, time;
+    if (!price.Init(info[index], "price") || !size.Init(info[index + 1], "size", price.length) ||
+        !time.Init(info[index + 2], "time", price.length)) {
+        return false;
+    }
+    aggregator.Add(price.data, size.data, time.data, price.length, bars);
+    return true;
+}
+
+/**
+ * aggregator.push(price, size, time) => Bars
+ *
+ * The bars completed by the trades, the incomplete one is kept.
+ */
+void TA_FUNC_BarAggregator_push(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    talib::Bars bars;
+    if (!AddTrades(info, 0, BarAggregatorWrap::Unwrap(info)->aggregator, &bars)) {
+        return;
+    }
+    info.GetReturnValue().Set(NewBars(bars));
+}
+
+/**
+ * aggregator.flush() => Bars
+ *
+ * The incomplete bar, if any, the next trade starts a new one.
+ */
+void TA_FUNC_BarAggregator_flush(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    talib::Bars bars;
+    BarAggregatorWrap::Unwrap(info)->aggregator.Flush(&bars);
+    info.GetReturnValue().Set(NewBars(bars));
+}
+
+/**
+ * aggregateBars(price, size, time, type: BarType, barSize: number) => Bars
+ *
+ * All the bars of the trades, the last one may be incomplete.
+ */
+void TA_FUNC_aggregateBars(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    talib::BarAggregator::Type type;
+    double barSize;
+    if (!BarAggregatorWrap::ReadBarType(info, 3, &type, &barSize)) {
+        return;
+    }
+    talib::BarAggregator aggregator(type, barSize);
+    talib::Bars bars;
+    if (!AddTrades(info, 0, aggregator, &bars)) {
+        return;
+    }
+    aggregator.Flush(&bars);
+    info.GetReturnValue().Set(NewBars(bars));
+}
+
+void InitBars(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    v8::Local<v8::FunctionTemplate> tpl = Nan::New<v8::FunctionTemplate>(BarAggregatorWrap::New);
+    tpl->SetClassName(Nan::New("BarAggregator").ToLocalChecked());
+    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(tpl, "push", TA_FUNC_BarAggregator_push);
+    Nan::SetPrototypeMethod(tpl, "flush", TA_FUNC_BarAggregator_flush);
+    Nan::Set(exports, Nan::New("BarAggregator").ToLocalChecked(), tpl->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("aggregateBars").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_aggregateBars, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+
+    v8::Local<v8::Object> BarType = Nan::New<v8::Object>();
+    Nan::Set(BarType, Nan::New("Time").ToLocalChecked(), Nan::New<v8::Number>(talib::BarAggregator::TIME));
+    Nan::Set(BarType, Nan::New("Tick").ToLocalChecked(), Nan::New<v8::Number>(talib::BarAggregator::TICK));
+    Nan::Set(BarType, Nan::New("Volume").ToLocalChecked(), Nan::New<v8::Number>(talib::BarAggregator::VOLUME));
+    Nan::Set(BarType, Nan::New("Dollar").ToLocalChecked(), Nan::New<v8::Number>(talib::BarAggregator::DOLLAR));
+    Nan::Set(exports, Nan::New("BarType").ToLocalChecked(), BarType);
+}
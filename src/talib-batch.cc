@@ -0,0 +1,67 @@
+/*!
+ * Batch functions, they evaluate one TA function at several parameters
+ * over the same input.
+ */
+
+#include "talib-extensions.h"
+#include <cmath>
+
+/**
+ * maRibbon(inReal, periods, optMA_Type?, startIdx?, endIdx?) => Float64Array
+ *
+ * The result is a periods.length x (endIdx - startIdx + 1) matrix in row
+ * major order, the row `r` is the MA at `periods[r]`, the values in the
+ * lookback of the period are NaN.
+ */
+void TA_FUNC_maRibbon(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    RealInput inReal;
+    if (!inReal.Init(info[0], "inReal")) {
+        return;
+    }
+    RealInput periods;
+    if (!periods.Init(info[1], "periods")) {
+        return;
+    }
+    int optMA_Type = OptionalInt(info, 2, 0);
+    int nbPeriod = periods.length;
+    if (nbPeriod == 0) {
+        Nan::ThrowRangeError("`periods` must not be empty");
+        return;
+    }
+    int *optTime_Periods = new int[nbPeriod];
+    for (int i = 0; i < nbPeriod; i++) {
+        // The range of the period of TA_MA, checked before the cast.
+        double period = periods.data[i];
+        if (!(period >= 1 && period <= 100000) || period != std::floor(period)) {
+            char error[200];
+            snprintf(error, sizeof(error), "`periods` must be integers from 1 to 100000, `periods[%d]` is %g", i,
+                     period);
+            Nan::ThrowRangeError(error);
+            delete[] optTime_Periods;
+            return;
+        }
+        optTime_Periods[i] = (int) period;
+    }
+    int startIdx, endIdx, outLength;
+    if (!ReadRange(info, 3, inReal.length, 0, &startIdx, &endIdx, &outLength)) {
+        delete[] optTime_Periods;
+        return;
+    }
+    double *outReal;
+    v8::Local<v8::Float64Array> outReal_JS = NewFloat64Array(nbPeriod * outLength, &outReal);
+    if (outLength > 0) {
+        TA_RetCode result = talib::MaRibbon(startIdx, endIdx, inReal.data, nbPeriod, optTime_Periods,
+                                            (TA_MAType) optMA_Type, outReal);
+        if (result != TA_SUCCESS) {
+            delete[] optTime_Periods;
+            ThrowRetCode("TA_MA_RIBBON", result);
+            return;
+        }
+    }
+    delete[] optTime_Periods;
+    info.GetReturnValue().Set(outReal_JS);
+}
+
+void InitBatch(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    Nan::Set(exports, Nan::New("maRibbon").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_maRibbon, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+}
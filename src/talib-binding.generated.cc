@@ -4,11 +4,12 @@
 
 #include <nan.h>
 #include "../ta-lib/c/include/ta_libc.h"
+#include "talib-extensions.h"
 
 void TA_FUNC_ACCBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -26,9 +27,9 @@ void TA_FUNC_ACCBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 20;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -37,27 +38,25 @@ void TA_FUNC_ACCBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -85,11 +84,8 @@ void TA_FUNC_ACCBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     double *outRealUpperBand = new double[outLength];
     double *outRealMiddleBand = new double[outLength];
     double *outRealLowerBand = new double[outLength];
-    TA_RetCode result = TA_ACCBANDS(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand);
+    TA_RetCode result = TA_ACCBANDS(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outRealUpperBand;
         delete[] outRealMiddleBand;
         delete[] outRealLowerBand;
@@ -117,9 +113,6 @@ void TA_FUNC_ACCBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outRealLowerBand_JS, i, Nan::New<v8::Number>(outRealLowerBand[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outRealUpperBand;
     delete[] outRealMiddleBand;
     delete[] outRealLowerBand;
@@ -128,8 +121,8 @@ void TA_FUNC_ACCBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_ACOS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -142,7 +135,7 @@ void TA_FUNC_ACOS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -150,18 +143,18 @@ void TA_FUNC_ACOS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -181,9 +174,8 @@ void TA_FUNC_ACOS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ACOS(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ACOS(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -202,15 +194,14 @@ void TA_FUNC_ACOS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_AD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -223,10 +214,10 @@ void TA_FUNC_AD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
-    double *inVolume = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
+    RealInput inVolume;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -234,30 +225,27 @@ void TA_FUNC_AD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inVolume_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inVolume_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength) || !inVolume.Init(info[3], "inVolume", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
-        v8::Local<v8::String> inVolumeName = Nan::New("Volume").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        v8::Local<v8::String> inVolumeName = Nan::New(AddonData::From(info)->recordFields[RECORD_VOLUME]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
+        inVolume.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inVolume.data[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -277,12 +265,8 @@ void TA_FUNC_AD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_AD(startIdx, endIdx, inHigh, inLow, inClose, inVolume, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_AD(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, inVolume.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
-        delete[] inVolume;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -301,18 +285,14 @@ void TA_FUNC_AD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
-    delete[] inVolume;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ADD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -325,8 +305,8 @@ void TA_FUNC_ADD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal0 = new double[inLength];
-    double *inReal1 = new double[inLength];
+    RealInput inReal0;
+    RealInput inReal1;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -334,22 +314,21 @@ void TA_FUNC_ADD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal0_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inReal1_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal0[i] = Nan::Get(inReal0_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inReal1_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal0.Init(info[0], "inReal0", inLength) || !inReal1.Init(info[1], "inReal1", inLength)) {
+            return;
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inReal0Name = info[1]->ToString(context).ToLocalChecked();;
         v8::Local<v8::String> inReal1Name = info[2]->ToString(context).ToLocalChecked();;
+        inReal0.Alloc(inLength);
+        inReal1.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal0[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal0.data[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal1.data[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
@@ -369,10 +348,8 @@ void TA_FUNC_ADD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ADD(startIdx, endIdx, inReal0, inReal1, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ADD(startIdx, endIdx, inReal0.data, inReal1.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal0;
-        delete[] inReal1;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -391,16 +368,14 @@ void TA_FUNC_ADD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal0;
-    delete[] inReal1;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ADOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -413,10 +388,10 @@ void TA_FUNC_ADOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
-    double *inVolume = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
+    RealInput inVolume;
     int optFast_Period = 3;
     int optSlow_Period = 10;
     int startIdx = 0;
@@ -426,32 +401,29 @@ void TA_FUNC_ADOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inVolume_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inVolume_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength) || !inVolume.Init(info[3], "inVolume", inLength)) {
+            return;
         }
         optFast_Period = argc > 4 && info[4]->IsInt32() ?  info[4]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 5 && info[5]->IsInt32() ?  info[5]->Int32Value(context).FromJust() : optSlow_Period;
         startIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 7 && info[7]->IsInt32() ? info[7]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
-        v8::Local<v8::String> inVolumeName = Nan::New("Volume").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        v8::Local<v8::String> inVolumeName = Nan::New(AddonData::From(info)->recordFields[RECORD_VOLUME]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
+        inVolume.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inVolume.data[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFast_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optSlow_Period;
@@ -473,12 +445,8 @@ void TA_FUNC_ADOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ADOSC(startIdx, endIdx, inHigh, inLow, inClose, inVolume, optFast_Period, optSlow_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ADOSC(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, inVolume.data, optFast_Period, optSlow_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
-        delete[] inVolume;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -497,18 +465,14 @@ void TA_FUNC_ADOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
-    delete[] inVolume;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ADX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -521,9 +485,9 @@ void TA_FUNC_ADX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -532,27 +496,25 @@ void TA_FUNC_ADX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -573,11 +535,8 @@ void TA_FUNC_ADX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ADX(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ADX(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -596,17 +555,14 @@ void TA_FUNC_ADX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ADXR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -619,9 +575,9 @@ void TA_FUNC_ADXR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -630,27 +586,25 @@ void TA_FUNC_ADXR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -671,11 +625,8 @@ void TA_FUNC_ADXR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ADXR(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ADXR(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -694,17 +645,14 @@ void TA_FUNC_ADXR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_APO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -717,7 +665,7 @@ void TA_FUNC_APO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optFast_Period = 12;
     int optSlow_Period = 26;
     TA_MAType optMA_Type = TA_MAType_SMA;
@@ -728,9 +676,8 @@ void TA_FUNC_APO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optFast_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optSlow_Period;
@@ -739,10 +686,11 @@ void TA_FUNC_APO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFast_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optSlow_Period;
@@ -765,9 +713,8 @@ void TA_FUNC_APO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_APO(startIdx, endIdx, inReal, optFast_Period, optSlow_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_APO(startIdx, endIdx, inReal.data, optFast_Period, optSlow_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -786,15 +733,14 @@ void TA_FUNC_APO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_AROON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -810,8 +756,8 @@ void TA_FUNC_AROON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -820,23 +766,22 @@ void TA_FUNC_AROON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -861,10 +806,8 @@ void TA_FUNC_AROON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outAroonDown = new double[outLength];
     double *outAroonUp = new double[outLength];
-    TA_RetCode result = TA_AROON(startIdx, endIdx, inHigh, inLow, optTime_Period, &outBegIdx, &outNBElement, outAroonDown, outAroonUp);
+    TA_RetCode result = TA_AROON(startIdx, endIdx, inHigh.data, inLow.data, optTime_Period, &outBegIdx, &outNBElement, outAroonDown, outAroonUp);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outAroonDown;
         delete[] outAroonUp;
         TA_RetCodeInfo retCodeInfo;
@@ -888,8 +831,6 @@ void TA_FUNC_AROON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outAroonUp_JS, i, Nan::New<v8::Number>(outAroonUp[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outAroonDown;
     delete[] outAroonUp;
 }
@@ -897,8 +838,8 @@ void TA_FUNC_AROON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_AROONOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -911,8 +852,8 @@ void TA_FUNC_AROONOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -921,23 +862,22 @@ void TA_FUNC_AROONOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -958,10 +898,8 @@ void TA_FUNC_AROONOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_AROONOSC(startIdx, endIdx, inHigh, inLow, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_AROONOSC(startIdx, endIdx, inHigh.data, inLow.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -980,16 +918,14 @@ void TA_FUNC_AROONOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ASIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1002,7 +938,7 @@ void TA_FUNC_ASIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -1010,18 +946,18 @@ void TA_FUNC_ASIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -1041,9 +977,8 @@ void TA_FUNC_ASIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ASIN(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ASIN(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1062,15 +997,14 @@ void TA_FUNC_ASIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ATAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1083,7 +1017,7 @@ void TA_FUNC_ATAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -1091,18 +1025,18 @@ void TA_FUNC_ATAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -1122,9 +1056,8 @@ void TA_FUNC_ATAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ATAN(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ATAN(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1143,15 +1076,14 @@ void TA_FUNC_ATAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1164,9 +1096,9 @@ void TA_FUNC_ATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -1175,27 +1107,25 @@ void TA_FUNC_ATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -1216,11 +1146,8 @@ void TA_FUNC_ATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ATR(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ATR(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1239,17 +1166,14 @@ void TA_FUNC_ATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_AVGPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1262,10 +1186,10 @@ void TA_FUNC_AVGPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -1273,30 +1197,27 @@ void TA_FUNC_AVGPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -1316,12 +1237,8 @@ void TA_FUNC_AVGPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_AVGPRICE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_AVGPRICE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1340,18 +1257,14 @@ void TA_FUNC_AVGPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_AVGDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1364,7 +1277,7 @@ void TA_FUNC_AVGDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -1373,19 +1286,19 @@ void TA_FUNC_AVGDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -1406,9 +1319,8 @@ void TA_FUNC_AVGDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_AVGDEV(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_AVGDEV(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1427,15 +1339,14 @@ void TA_FUNC_AVGDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_BBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1453,7 +1364,7 @@ void TA_FUNC_BBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 5;
     double optDeviations_up = 2.000000e+0;
     double optDeviations_down = 2.000000e+0;
@@ -1465,9 +1376,8 @@ void TA_FUNC_BBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         optDeviations_up = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optDeviations_up;
@@ -1477,10 +1387,11 @@ void TA_FUNC_BBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         optDeviations_up = argc > 3 && info[3]->IsNumber() ?  info[3]->NumberValue(context).FromJust() : optDeviations_up;
@@ -1511,9 +1422,8 @@ void TA_FUNC_BBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     double *outRealUpperBand = new double[outLength];
     double *outRealMiddleBand = new double[outLength];
     double *outRealLowerBand = new double[outLength];
-    TA_RetCode result = TA_BBANDS(startIdx, endIdx, inReal, optTime_Period, optDeviations_up, optDeviations_down, optMA_Type, &outBegIdx, &outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand);
+    TA_RetCode result = TA_BBANDS(startIdx, endIdx, inReal.data, optTime_Period, optDeviations_up, optDeviations_down, optMA_Type, &outBegIdx, &outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outRealUpperBand;
         delete[] outRealMiddleBand;
         delete[] outRealLowerBand;
@@ -1541,7 +1451,6 @@ void TA_FUNC_BBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outRealLowerBand_JS, i, Nan::New<v8::Number>(outRealLowerBand[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outRealUpperBand;
     delete[] outRealMiddleBand;
     delete[] outRealLowerBand;
@@ -1550,8 +1459,8 @@ void TA_FUNC_BBANDS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_BETA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1564,8 +1473,8 @@ void TA_FUNC_BETA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal0 = new double[inLength];
-    double *inReal1 = new double[inLength];
+    RealInput inReal0;
+    RealInput inReal1;
     int optTime_Period = 5;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -1574,11 +1483,8 @@ void TA_FUNC_BETA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal0_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inReal1_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal0[i] = Nan::Get(inReal0_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inReal1_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal0.Init(info[0], "inReal0", inLength) || !inReal1.Init(info[1], "inReal1", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -1586,11 +1492,13 @@ void TA_FUNC_BETA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     } else {
         v8::Local<v8::String> inReal0Name = info[1]->ToString(context).ToLocalChecked();;
         v8::Local<v8::String> inReal1Name = info[2]->ToString(context).ToLocalChecked();;
+        inReal0.Alloc(inLength);
+        inReal1.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal0[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal0.data[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal1.data[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
@@ -1611,10 +1519,8 @@ void TA_FUNC_BETA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_BETA(startIdx, endIdx, inReal0, inReal1, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_BETA(startIdx, endIdx, inReal0.data, inReal1.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal0;
-        delete[] inReal1;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1633,16 +1539,14 @@ void TA_FUNC_BETA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal0;
-    delete[] inReal1;
     delete[] outReal;
 }
 
 
 void TA_FUNC_BOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1655,10 +1559,10 @@ void TA_FUNC_BOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -1666,30 +1570,27 @@ void TA_FUNC_BOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -1709,12 +1610,8 @@ void TA_FUNC_BOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_BOP(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_BOP(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1733,18 +1630,14 @@ void TA_FUNC_BOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_CCI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1757,9 +1650,9 @@ void TA_FUNC_CCI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -1768,27 +1661,25 @@ void TA_FUNC_CCI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -1809,11 +1700,8 @@ void TA_FUNC_CCI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_CCI(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_CCI(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1832,17 +1720,14 @@ void TA_FUNC_CCI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_CDL2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1855,10 +1740,10 @@ void TA_FUNC_CDL2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -1866,30 +1751,27 @@ void TA_FUNC_CDL2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -1909,12 +1791,8 @@ void TA_FUNC_CDL2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDL2CROWS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDL2CROWS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -1933,18 +1811,14 @@ void TA_FUNC_CDL2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDL3BLACKCROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -1957,10 +1831,10 @@ void TA_FUNC_CDL3BLACKCROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -1968,30 +1842,27 @@ void TA_FUNC_CDL3BLACKCROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2011,12 +1882,8 @@ void TA_FUNC_CDL3BLACKCROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDL3BLACKCROWS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDL3BLACKCROWS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2035,18 +1902,14 @@ void TA_FUNC_CDL3BLACKCROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDL3INSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2059,10 +1922,10 @@ void TA_FUNC_CDL3INSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2070,30 +1933,27 @@ void TA_FUNC_CDL3INSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2113,12 +1973,8 @@ void TA_FUNC_CDL3INSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDL3INSIDE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDL3INSIDE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2137,18 +1993,14 @@ void TA_FUNC_CDL3INSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDL3LINESTRIKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2161,10 +2013,10 @@ void TA_FUNC_CDL3LINESTRIKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2172,30 +2024,27 @@ void TA_FUNC_CDL3LINESTRIKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2215,12 +2064,8 @@ void TA_FUNC_CDL3LINESTRIKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDL3LINESTRIKE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDL3LINESTRIKE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2239,18 +2084,14 @@ void TA_FUNC_CDL3LINESTRIKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDL3OUTSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2263,10 +2104,10 @@ void TA_FUNC_CDL3OUTSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2274,30 +2115,27 @@ void TA_FUNC_CDL3OUTSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2317,12 +2155,8 @@ void TA_FUNC_CDL3OUTSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDL3OUTSIDE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDL3OUTSIDE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2341,18 +2175,14 @@ void TA_FUNC_CDL3OUTSIDE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDL3STARSINSOUTH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2365,10 +2195,10 @@ void TA_FUNC_CDL3STARSINSOUTH(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2376,30 +2206,27 @@ void TA_FUNC_CDL3STARSINSOUTH(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2419,12 +2246,8 @@ void TA_FUNC_CDL3STARSINSOUTH(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDL3STARSINSOUTH(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDL3STARSINSOUTH(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2443,18 +2266,14 @@ void TA_FUNC_CDL3STARSINSOUTH(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDL3WHITESOLDIERS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2467,10 +2286,10 @@ void TA_FUNC_CDL3WHITESOLDIERS(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2478,30 +2297,27 @@ void TA_FUNC_CDL3WHITESOLDIERS(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2521,12 +2337,8 @@ void TA_FUNC_CDL3WHITESOLDIERS(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDL3WHITESOLDIERS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDL3WHITESOLDIERS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2545,18 +2357,14 @@ void TA_FUNC_CDL3WHITESOLDIERS(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLABANDONEDBABY(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2569,10 +2377,10 @@ void TA_FUNC_CDLABANDONEDBABY(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     double optPenetration = 3.000000e-1;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -2581,31 +2389,28 @@ void TA_FUNC_CDLABANDONEDBABY(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         optPenetration = argc > 4 && info[4]->IsNumber() ?  info[4]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optPenetration = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -2626,12 +2431,8 @@ void TA_FUNC_CDLABANDONEDBABY(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLABANDONEDBABY(startIdx, endIdx, inOpen, inHigh, inLow, inClose, optPenetration, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLABANDONEDBABY(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, optPenetration, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2650,18 +2451,14 @@ void TA_FUNC_CDLABANDONEDBABY(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLADVANCEBLOCK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2674,10 +2471,10 @@ void TA_FUNC_CDLADVANCEBLOCK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2685,30 +2482,27 @@ void TA_FUNC_CDLADVANCEBLOCK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2728,12 +2522,8 @@ void TA_FUNC_CDLADVANCEBLOCK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLADVANCEBLOCK(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLADVANCEBLOCK(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2752,18 +2542,14 @@ void TA_FUNC_CDLADVANCEBLOCK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLBELTHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2776,10 +2562,10 @@ void TA_FUNC_CDLBELTHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2787,30 +2573,27 @@ void TA_FUNC_CDLBELTHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2830,12 +2613,8 @@ void TA_FUNC_CDLBELTHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLBELTHOLD(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLBELTHOLD(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2854,18 +2633,14 @@ void TA_FUNC_CDLBELTHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLBREAKAWAY(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2878,10 +2653,10 @@ void TA_FUNC_CDLBREAKAWAY(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2889,30 +2664,27 @@ void TA_FUNC_CDLBREAKAWAY(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -2932,12 +2704,8 @@ void TA_FUNC_CDLBREAKAWAY(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLBREAKAWAY(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLBREAKAWAY(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -2956,18 +2724,14 @@ void TA_FUNC_CDLBREAKAWAY(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLCLOSINGMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -2980,10 +2744,10 @@ void TA_FUNC_CDLCLOSINGMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -2991,30 +2755,27 @@ void TA_FUNC_CDLCLOSINGMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -3034,12 +2795,8 @@ void TA_FUNC_CDLCLOSINGMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLCLOSINGMARUBOZU(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLCLOSINGMARUBOZU(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3058,18 +2815,14 @@ void TA_FUNC_CDLCLOSINGMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLCONCEALBABYSWALL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3082,10 +2835,10 @@ void TA_FUNC_CDLCONCEALBABYSWALL(const Nan::FunctionCallbackInfo<v8::Value> &inf
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -3093,30 +2846,27 @@ void TA_FUNC_CDLCONCEALBABYSWALL(const Nan::FunctionCallbackInfo<v8::Value> &inf
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -3136,12 +2886,8 @@ void TA_FUNC_CDLCONCEALBABYSWALL(const Nan::FunctionCallbackInfo<v8::Value> &inf
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLCONCEALBABYSWALL(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLCONCEALBABYSWALL(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3160,18 +2906,14 @@ void TA_FUNC_CDLCONCEALBABYSWALL(const Nan::FunctionCallbackInfo<v8::Value> &inf
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLCOUNTERATTACK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3184,10 +2926,10 @@ void TA_FUNC_CDLCOUNTERATTACK(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -3195,30 +2937,27 @@ void TA_FUNC_CDLCOUNTERATTACK(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -3238,12 +2977,8 @@ void TA_FUNC_CDLCOUNTERATTACK(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLCOUNTERATTACK(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLCOUNTERATTACK(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3262,18 +2997,14 @@ void TA_FUNC_CDLCOUNTERATTACK(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLDARKCLOUDCOVER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3286,10 +3017,10 @@ void TA_FUNC_CDLDARKCLOUDCOVER(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     double optPenetration = 5.000000e-1;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -3298,31 +3029,28 @@ void TA_FUNC_CDLDARKCLOUDCOVER(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         optPenetration = argc > 4 && info[4]->IsNumber() ?  info[4]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optPenetration = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -3343,12 +3071,8 @@ void TA_FUNC_CDLDARKCLOUDCOVER(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLDARKCLOUDCOVER(startIdx, endIdx, inOpen, inHigh, inLow, inClose, optPenetration, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLDARKCLOUDCOVER(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, optPenetration, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3367,18 +3091,14 @@ void TA_FUNC_CDLDARKCLOUDCOVER(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3391,10 +3111,10 @@ void TA_FUNC_CDLDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -3402,30 +3122,27 @@ void TA_FUNC_CDLDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -3445,12 +3162,8 @@ void TA_FUNC_CDLDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLDOJI(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLDOJI(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3469,18 +3182,14 @@ void TA_FUNC_CDLDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3493,10 +3202,10 @@ void TA_FUNC_CDLDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -3504,30 +3213,27 @@ void TA_FUNC_CDLDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -3547,12 +3253,8 @@ void TA_FUNC_CDLDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLDOJISTAR(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLDOJISTAR(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3571,18 +3273,14 @@ void TA_FUNC_CDLDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLDRAGONFLYDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3595,10 +3293,10 @@ void TA_FUNC_CDLDRAGONFLYDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -3606,30 +3304,27 @@ void TA_FUNC_CDLDRAGONFLYDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -3649,12 +3344,8 @@ void TA_FUNC_CDLDRAGONFLYDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLDRAGONFLYDOJI(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLDRAGONFLYDOJI(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3673,18 +3364,14 @@ void TA_FUNC_CDLDRAGONFLYDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLENGULFING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3697,10 +3384,10 @@ void TA_FUNC_CDLENGULFING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -3708,30 +3395,27 @@ void TA_FUNC_CDLENGULFING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -3751,12 +3435,8 @@ void TA_FUNC_CDLENGULFING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLENGULFING(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLENGULFING(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3775,18 +3455,14 @@ void TA_FUNC_CDLENGULFING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLEVENINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3799,10 +3475,10 @@ void TA_FUNC_CDLEVENINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     double optPenetration = 3.000000e-1;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -3811,31 +3487,28 @@ void TA_FUNC_CDLEVENINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         optPenetration = argc > 4 && info[4]->IsNumber() ?  info[4]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optPenetration = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -3856,12 +3529,8 @@ void TA_FUNC_CDLEVENINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLEVENINGDOJISTAR(startIdx, endIdx, inOpen, inHigh, inLow, inClose, optPenetration, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLEVENINGDOJISTAR(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, optPenetration, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3880,18 +3549,14 @@ void TA_FUNC_CDLEVENINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLEVENINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -3904,10 +3569,10 @@ void TA_FUNC_CDLEVENINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     double optPenetration = 3.000000e-1;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -3916,31 +3581,28 @@ void TA_FUNC_CDLEVENINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         optPenetration = argc > 4 && info[4]->IsNumber() ?  info[4]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optPenetration = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -3961,12 +3623,8 @@ void TA_FUNC_CDLEVENINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLEVENINGSTAR(startIdx, endIdx, inOpen, inHigh, inLow, inClose, optPenetration, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLEVENINGSTAR(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, optPenetration, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -3985,18 +3643,14 @@ void TA_FUNC_CDLEVENINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLGAPSIDESIDEWHITE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4009,10 +3663,10 @@ void TA_FUNC_CDLGAPSIDESIDEWHITE(const Nan::FunctionCallbackInfo<v8::Value> &inf
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4020,30 +3674,27 @@ void TA_FUNC_CDLGAPSIDESIDEWHITE(const Nan::FunctionCallbackInfo<v8::Value> &inf
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4063,12 +3714,8 @@ void TA_FUNC_CDLGAPSIDESIDEWHITE(const Nan::FunctionCallbackInfo<v8::Value> &inf
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLGAPSIDESIDEWHITE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLGAPSIDESIDEWHITE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4087,18 +3734,14 @@ void TA_FUNC_CDLGAPSIDESIDEWHITE(const Nan::FunctionCallbackInfo<v8::Value> &inf
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLGRAVESTONEDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4111,10 +3754,10 @@ void TA_FUNC_CDLGRAVESTONEDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4122,30 +3765,27 @@ void TA_FUNC_CDLGRAVESTONEDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4165,12 +3805,8 @@ void TA_FUNC_CDLGRAVESTONEDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLGRAVESTONEDOJI(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLGRAVESTONEDOJI(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4189,18 +3825,14 @@ void TA_FUNC_CDLGRAVESTONEDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4213,10 +3845,10 @@ void TA_FUNC_CDLHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4224,30 +3856,27 @@ void TA_FUNC_CDLHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4267,12 +3896,8 @@ void TA_FUNC_CDLHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHAMMER(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHAMMER(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4291,18 +3916,14 @@ void TA_FUNC_CDLHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHANGINGMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4315,10 +3936,10 @@ void TA_FUNC_CDLHANGINGMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4326,30 +3947,27 @@ void TA_FUNC_CDLHANGINGMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4369,12 +3987,8 @@ void TA_FUNC_CDLHANGINGMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHANGINGMAN(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHANGINGMAN(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4393,18 +4007,14 @@ void TA_FUNC_CDLHANGINGMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHARAMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4417,10 +4027,10 @@ void TA_FUNC_CDLHARAMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4428,30 +4038,27 @@ void TA_FUNC_CDLHARAMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4471,12 +4078,8 @@ void TA_FUNC_CDLHARAMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHARAMI(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHARAMI(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4495,18 +4098,14 @@ void TA_FUNC_CDLHARAMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHARAMICROSS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4519,10 +4118,10 @@ void TA_FUNC_CDLHARAMICROSS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4530,30 +4129,27 @@ void TA_FUNC_CDLHARAMICROSS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4573,12 +4169,8 @@ void TA_FUNC_CDLHARAMICROSS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHARAMICROSS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHARAMICROSS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4597,18 +4189,14 @@ void TA_FUNC_CDLHARAMICROSS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHIGHWAVE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4621,10 +4209,10 @@ void TA_FUNC_CDLHIGHWAVE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4632,30 +4220,27 @@ void TA_FUNC_CDLHIGHWAVE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4675,12 +4260,8 @@ void TA_FUNC_CDLHIGHWAVE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHIGHWAVE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHIGHWAVE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4699,18 +4280,14 @@ void TA_FUNC_CDLHIGHWAVE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHIKKAKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4723,10 +4300,10 @@ void TA_FUNC_CDLHIKKAKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4734,30 +4311,27 @@ void TA_FUNC_CDLHIKKAKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4777,12 +4351,8 @@ void TA_FUNC_CDLHIKKAKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHIKKAKE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHIKKAKE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4801,18 +4371,14 @@ void TA_FUNC_CDLHIKKAKE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHIKKAKEMOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4825,10 +4391,10 @@ void TA_FUNC_CDLHIKKAKEMOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4836,30 +4402,27 @@ void TA_FUNC_CDLHIKKAKEMOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4879,12 +4442,8 @@ void TA_FUNC_CDLHIKKAKEMOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHIKKAKEMOD(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHIKKAKEMOD(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -4903,18 +4462,14 @@ void TA_FUNC_CDLHIKKAKEMOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLHOMINGPIGEON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -4927,10 +4482,10 @@ void TA_FUNC_CDLHOMINGPIGEON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -4938,30 +4493,27 @@ void TA_FUNC_CDLHOMINGPIGEON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -4981,12 +4533,8 @@ void TA_FUNC_CDLHOMINGPIGEON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLHOMINGPIGEON(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLHOMINGPIGEON(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5005,18 +4553,14 @@ void TA_FUNC_CDLHOMINGPIGEON(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLIDENTICAL3CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5029,10 +4573,10 @@ void TA_FUNC_CDLIDENTICAL3CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5040,30 +4584,27 @@ void TA_FUNC_CDLIDENTICAL3CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5083,12 +4624,8 @@ void TA_FUNC_CDLIDENTICAL3CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLIDENTICAL3CROWS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLIDENTICAL3CROWS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5107,18 +4644,14 @@ void TA_FUNC_CDLIDENTICAL3CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLINNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5131,10 +4664,10 @@ void TA_FUNC_CDLINNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5142,30 +4675,27 @@ void TA_FUNC_CDLINNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5185,12 +4715,8 @@ void TA_FUNC_CDLINNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLINNECK(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLINNECK(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5209,18 +4735,14 @@ void TA_FUNC_CDLINNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLINVERTEDHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5233,10 +4755,10 @@ void TA_FUNC_CDLINVERTEDHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5244,30 +4766,27 @@ void TA_FUNC_CDLINVERTEDHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5287,12 +4806,8 @@ void TA_FUNC_CDLINVERTEDHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLINVERTEDHAMMER(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLINVERTEDHAMMER(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5311,18 +4826,14 @@ void TA_FUNC_CDLINVERTEDHAMMER(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLKICKING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5335,10 +4846,10 @@ void TA_FUNC_CDLKICKING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5346,30 +4857,27 @@ void TA_FUNC_CDLKICKING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5389,12 +4897,8 @@ void TA_FUNC_CDLKICKING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLKICKING(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLKICKING(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5413,18 +4917,14 @@ void TA_FUNC_CDLKICKING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLKICKINGBYLENGTH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5437,10 +4937,10 @@ void TA_FUNC_CDLKICKINGBYLENGTH(const Nan::FunctionCallbackInfo<v8::Value> &info
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5448,30 +4948,27 @@ void TA_FUNC_CDLKICKINGBYLENGTH(const Nan::FunctionCallbackInfo<v8::Value> &info
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5491,12 +4988,8 @@ void TA_FUNC_CDLKICKINGBYLENGTH(const Nan::FunctionCallbackInfo<v8::Value> &info
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLKICKINGBYLENGTH(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLKICKINGBYLENGTH(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5515,18 +5008,14 @@ void TA_FUNC_CDLKICKINGBYLENGTH(const Nan::FunctionCallbackInfo<v8::Value> &info
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLLADDERBOTTOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5539,10 +5028,10 @@ void TA_FUNC_CDLLADDERBOTTOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5550,30 +5039,27 @@ void TA_FUNC_CDLLADDERBOTTOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5593,12 +5079,8 @@ void TA_FUNC_CDLLADDERBOTTOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLLADDERBOTTOM(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLLADDERBOTTOM(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5617,18 +5099,14 @@ void TA_FUNC_CDLLADDERBOTTOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLLONGLEGGEDDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5641,10 +5119,10 @@ void TA_FUNC_CDLLONGLEGGEDDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5652,30 +5130,27 @@ void TA_FUNC_CDLLONGLEGGEDDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5695,12 +5170,8 @@ void TA_FUNC_CDLLONGLEGGEDDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLLONGLEGGEDDOJI(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLLONGLEGGEDDOJI(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5719,18 +5190,14 @@ void TA_FUNC_CDLLONGLEGGEDDOJI(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLLONGLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5743,10 +5210,10 @@ void TA_FUNC_CDLLONGLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5754,30 +5221,27 @@ void TA_FUNC_CDLLONGLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5797,12 +5261,8 @@ void TA_FUNC_CDLLONGLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLLONGLINE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLLONGLINE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5821,18 +5281,14 @@ void TA_FUNC_CDLLONGLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5845,10 +5301,10 @@ void TA_FUNC_CDLMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5856,30 +5312,27 @@ void TA_FUNC_CDLMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -5899,12 +5352,8 @@ void TA_FUNC_CDLMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLMARUBOZU(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLMARUBOZU(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -5923,18 +5372,14 @@ void TA_FUNC_CDLMARUBOZU(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLMATCHINGLOW(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -5947,10 +5392,10 @@ void TA_FUNC_CDLMATCHINGLOW(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -5958,30 +5403,27 @@ void TA_FUNC_CDLMATCHINGLOW(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -6001,12 +5443,8 @@ void TA_FUNC_CDLMATCHINGLOW(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLMATCHINGLOW(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLMATCHINGLOW(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6025,18 +5463,14 @@ void TA_FUNC_CDLMATCHINGLOW(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLMATHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6049,10 +5483,10 @@ void TA_FUNC_CDLMATHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     double optPenetration = 5.000000e-1;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -6061,31 +5495,28 @@ void TA_FUNC_CDLMATHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         optPenetration = argc > 4 && info[4]->IsNumber() ?  info[4]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optPenetration = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -6106,12 +5537,8 @@ void TA_FUNC_CDLMATHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLMATHOLD(startIdx, endIdx, inOpen, inHigh, inLow, inClose, optPenetration, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLMATHOLD(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, optPenetration, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6130,18 +5557,14 @@ void TA_FUNC_CDLMATHOLD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLMORNINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6154,10 +5577,10 @@ void TA_FUNC_CDLMORNINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     double optPenetration = 3.000000e-1;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -6166,31 +5589,28 @@ void TA_FUNC_CDLMORNINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         optPenetration = argc > 4 && info[4]->IsNumber() ?  info[4]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optPenetration = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -6211,12 +5631,8 @@ void TA_FUNC_CDLMORNINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLMORNINGDOJISTAR(startIdx, endIdx, inOpen, inHigh, inLow, inClose, optPenetration, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLMORNINGDOJISTAR(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, optPenetration, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6235,18 +5651,14 @@ void TA_FUNC_CDLMORNINGDOJISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLMORNINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6259,10 +5671,10 @@ void TA_FUNC_CDLMORNINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     double optPenetration = 3.000000e-1;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -6271,31 +5683,28 @@ void TA_FUNC_CDLMORNINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         optPenetration = argc > 4 && info[4]->IsNumber() ?  info[4]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optPenetration = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optPenetration;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -6316,12 +5725,8 @@ void TA_FUNC_CDLMORNINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLMORNINGSTAR(startIdx, endIdx, inOpen, inHigh, inLow, inClose, optPenetration, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLMORNINGSTAR(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, optPenetration, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6340,18 +5745,14 @@ void TA_FUNC_CDLMORNINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLONNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6364,10 +5765,10 @@ void TA_FUNC_CDLONNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -6375,30 +5776,27 @@ void TA_FUNC_CDLONNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -6418,12 +5816,8 @@ void TA_FUNC_CDLONNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLONNECK(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLONNECK(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6442,18 +5836,14 @@ void TA_FUNC_CDLONNECK(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLPIERCING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6466,10 +5856,10 @@ void TA_FUNC_CDLPIERCING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -6477,30 +5867,27 @@ void TA_FUNC_CDLPIERCING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -6520,12 +5907,8 @@ void TA_FUNC_CDLPIERCING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLPIERCING(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLPIERCING(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6544,18 +5927,14 @@ void TA_FUNC_CDLPIERCING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLRICKSHAWMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6568,10 +5947,10 @@ void TA_FUNC_CDLRICKSHAWMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -6579,30 +5958,27 @@ void TA_FUNC_CDLRICKSHAWMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -6622,12 +5998,8 @@ void TA_FUNC_CDLRICKSHAWMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLRICKSHAWMAN(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLRICKSHAWMAN(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6646,18 +6018,14 @@ void TA_FUNC_CDLRICKSHAWMAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLRISEFALL3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6670,10 +6038,10 @@ void TA_FUNC_CDLRISEFALL3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -6681,30 +6049,27 @@ void TA_FUNC_CDLRISEFALL3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -6724,12 +6089,8 @@ void TA_FUNC_CDLRISEFALL3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLRISEFALL3METHODS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLRISEFALL3METHODS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6748,18 +6109,14 @@ void TA_FUNC_CDLRISEFALL3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLSEPARATINGLINES(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6772,10 +6129,10 @@ void TA_FUNC_CDLSEPARATINGLINES(const Nan::FunctionCallbackInfo<v8::Value> &info
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -6783,30 +6140,27 @@ void TA_FUNC_CDLSEPARATINGLINES(const Nan::FunctionCallbackInfo<v8::Value> &info
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -6826,12 +6180,8 @@ void TA_FUNC_CDLSEPARATINGLINES(const Nan::FunctionCallbackInfo<v8::Value> &info
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLSEPARATINGLINES(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLSEPARATINGLINES(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6850,18 +6200,14 @@ void TA_FUNC_CDLSEPARATINGLINES(const Nan::FunctionCallbackInfo<v8::Value> &info
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLSHOOTINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6874,10 +6220,10 @@ void TA_FUNC_CDLSHOOTINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -6885,30 +6231,27 @@ void TA_FUNC_CDLSHOOTINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -6928,12 +6271,8 @@ void TA_FUNC_CDLSHOOTINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLSHOOTINGSTAR(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLSHOOTINGSTAR(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -6952,18 +6291,14 @@ void TA_FUNC_CDLSHOOTINGSTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLSHORTLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -6976,10 +6311,10 @@ void TA_FUNC_CDLSHORTLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -6987,30 +6322,27 @@ void TA_FUNC_CDLSHORTLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7030,12 +6362,8 @@ void TA_FUNC_CDLSHORTLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLSHORTLINE(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLSHORTLINE(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7054,18 +6382,14 @@ void TA_FUNC_CDLSHORTLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLSPINNINGTOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7078,10 +6402,10 @@ void TA_FUNC_CDLSPINNINGTOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7089,30 +6413,27 @@ void TA_FUNC_CDLSPINNINGTOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7132,12 +6453,8 @@ void TA_FUNC_CDLSPINNINGTOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLSPINNINGTOP(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLSPINNINGTOP(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7156,18 +6473,14 @@ void TA_FUNC_CDLSPINNINGTOP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLSTALLEDPATTERN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7180,10 +6493,10 @@ void TA_FUNC_CDLSTALLEDPATTERN(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7191,30 +6504,27 @@ void TA_FUNC_CDLSTALLEDPATTERN(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7234,12 +6544,8 @@ void TA_FUNC_CDLSTALLEDPATTERN(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLSTALLEDPATTERN(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLSTALLEDPATTERN(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7258,18 +6564,14 @@ void TA_FUNC_CDLSTALLEDPATTERN(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLSTICKSANDWICH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7282,10 +6584,10 @@ void TA_FUNC_CDLSTICKSANDWICH(const Nan::FunctionCallbackInfo<v8::Value> &info)
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7293,30 +6595,27 @@ void TA_FUNC_CDLSTICKSANDWICH(const Nan::FunctionCallbackInfo<v8::Value> &info)
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7336,12 +6635,8 @@ void TA_FUNC_CDLSTICKSANDWICH(const Nan::FunctionCallbackInfo<v8::Value> &info)
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLSTICKSANDWICH(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLSTICKSANDWICH(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7360,18 +6655,14 @@ void TA_FUNC_CDLSTICKSANDWICH(const Nan::FunctionCallbackInfo<v8::Value> &info)
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLTAKURI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7384,10 +6675,10 @@ void TA_FUNC_CDLTAKURI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7395,30 +6686,27 @@ void TA_FUNC_CDLTAKURI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7438,12 +6726,8 @@ void TA_FUNC_CDLTAKURI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLTAKURI(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLTAKURI(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7462,18 +6746,14 @@ void TA_FUNC_CDLTAKURI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLTASUKIGAP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7486,10 +6766,10 @@ void TA_FUNC_CDLTASUKIGAP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7497,30 +6777,27 @@ void TA_FUNC_CDLTASUKIGAP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7540,12 +6817,8 @@ void TA_FUNC_CDLTASUKIGAP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLTASUKIGAP(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLTASUKIGAP(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7564,18 +6837,14 @@ void TA_FUNC_CDLTASUKIGAP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLTHRUSTING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7588,10 +6857,10 @@ void TA_FUNC_CDLTHRUSTING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7599,30 +6868,27 @@ void TA_FUNC_CDLTHRUSTING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7642,12 +6908,8 @@ void TA_FUNC_CDLTHRUSTING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLTHRUSTING(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLTHRUSTING(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7666,18 +6928,14 @@ void TA_FUNC_CDLTHRUSTING(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLTRISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7690,10 +6948,10 @@ void TA_FUNC_CDLTRISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7701,30 +6959,27 @@ void TA_FUNC_CDLTRISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7744,12 +6999,8 @@ void TA_FUNC_CDLTRISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLTRISTAR(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLTRISTAR(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7768,18 +7019,14 @@ void TA_FUNC_CDLTRISTAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLUNIQUE3RIVER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7792,10 +7039,10 @@ void TA_FUNC_CDLUNIQUE3RIVER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7803,30 +7050,27 @@ void TA_FUNC_CDLUNIQUE3RIVER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7846,12 +7090,8 @@ void TA_FUNC_CDLUNIQUE3RIVER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLUNIQUE3RIVER(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLUNIQUE3RIVER(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7870,18 +7110,14 @@ void TA_FUNC_CDLUNIQUE3RIVER(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLUPSIDEGAP2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7894,10 +7130,10 @@ void TA_FUNC_CDLUPSIDEGAP2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -7905,30 +7141,27 @@ void TA_FUNC_CDLUPSIDEGAP2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -7948,12 +7181,8 @@ void TA_FUNC_CDLUPSIDEGAP2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLUPSIDEGAP2CROWS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLUPSIDEGAP2CROWS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -7972,18 +7201,14 @@ void TA_FUNC_CDLUPSIDEGAP2CROWS(const Nan::FunctionCallbackInfo<v8::Value> &info
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CDLXSIDEGAP3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -7996,10 +7221,10 @@ void TA_FUNC_CDLXSIDEGAP3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -8007,30 +7232,27 @@ void TA_FUNC_CDLXSIDEGAP3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inHigh.Init(info[1], "inHigh", inLength) || !inLow.Init(info[2], "inLow", inLength) || !inClose.Init(info[3], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -8050,12 +7272,8 @@ void TA_FUNC_CDLXSIDEGAP3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_CDLXSIDEGAP3METHODS(startIdx, endIdx, inOpen, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_CDLXSIDEGAP3METHODS(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8074,18 +7292,14 @@ void TA_FUNC_CDLXSIDEGAP3METHODS(const Nan::FunctionCallbackInfo<v8::Value> &inf
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_CEIL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8098,7 +7312,7 @@ void TA_FUNC_CEIL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -8106,18 +7320,18 @@ void TA_FUNC_CEIL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -8137,9 +7351,8 @@ void TA_FUNC_CEIL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_CEIL(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_CEIL(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8158,15 +7371,14 @@ void TA_FUNC_CEIL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_CMO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8179,7 +7391,7 @@ void TA_FUNC_CMO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -8188,19 +7400,19 @@ void TA_FUNC_CMO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -8221,9 +7433,8 @@ void TA_FUNC_CMO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_CMO(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_CMO(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8242,15 +7453,14 @@ void TA_FUNC_CMO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_CORREL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8263,8 +7473,8 @@ void TA_FUNC_CORREL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal0 = new double[inLength];
-    double *inReal1 = new double[inLength];
+    RealInput inReal0;
+    RealInput inReal1;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -8273,11 +7483,8 @@ void TA_FUNC_CORREL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal0_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inReal1_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal0[i] = Nan::Get(inReal0_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inReal1_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal0.Init(info[0], "inReal0", inLength) || !inReal1.Init(info[1], "inReal1", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -8285,11 +7492,13 @@ void TA_FUNC_CORREL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     } else {
         v8::Local<v8::String> inReal0Name = info[1]->ToString(context).ToLocalChecked();;
         v8::Local<v8::String> inReal1Name = info[2]->ToString(context).ToLocalChecked();;
+        inReal0.Alloc(inLength);
+        inReal1.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal0[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal0.data[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal1.data[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
@@ -8310,10 +7519,8 @@ void TA_FUNC_CORREL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_CORREL(startIdx, endIdx, inReal0, inReal1, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_CORREL(startIdx, endIdx, inReal0.data, inReal1.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal0;
-        delete[] inReal1;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8332,16 +7539,14 @@ void TA_FUNC_CORREL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal0;
-    delete[] inReal1;
     delete[] outReal;
 }
 
 
 void TA_FUNC_COS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8354,7 +7559,7 @@ void TA_FUNC_COS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -8362,18 +7567,18 @@ void TA_FUNC_COS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -8393,9 +7598,8 @@ void TA_FUNC_COS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_COS(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_COS(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8414,15 +7618,14 @@ void TA_FUNC_COS(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_COSH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8435,7 +7638,7 @@ void TA_FUNC_COSH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -8443,18 +7646,18 @@ void TA_FUNC_COSH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -8474,9 +7677,8 @@ void TA_FUNC_COSH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_COSH(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_COSH(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8495,15 +7697,14 @@ void TA_FUNC_COSH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_DEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8516,7 +7717,7 @@ void TA_FUNC_DEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -8525,19 +7726,19 @@ void TA_FUNC_DEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -8558,9 +7759,8 @@ void TA_FUNC_DEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_DEMA(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_DEMA(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8579,15 +7779,14 @@ void TA_FUNC_DEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_DIV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8600,8 +7799,8 @@ void TA_FUNC_DIV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal0 = new double[inLength];
-    double *inReal1 = new double[inLength];
+    RealInput inReal0;
+    RealInput inReal1;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -8609,22 +7808,21 @@ void TA_FUNC_DIV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal0_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inReal1_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal0[i] = Nan::Get(inReal0_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inReal1_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal0.Init(info[0], "inReal0", inLength) || !inReal1.Init(info[1], "inReal1", inLength)) {
+            return;
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inReal0Name = info[1]->ToString(context).ToLocalChecked();;
         v8::Local<v8::String> inReal1Name = info[2]->ToString(context).ToLocalChecked();;
+        inReal0.Alloc(inLength);
+        inReal1.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal0[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal0.data[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal1.data[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
@@ -8644,10 +7842,8 @@ void TA_FUNC_DIV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_DIV(startIdx, endIdx, inReal0, inReal1, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_DIV(startIdx, endIdx, inReal0.data, inReal1.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal0;
-        delete[] inReal1;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8666,16 +7862,14 @@ void TA_FUNC_DIV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal0;
-    delete[] inReal1;
     delete[] outReal;
 }
 
 
 void TA_FUNC_DX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8688,9 +7882,9 @@ void TA_FUNC_DX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -8699,27 +7893,25 @@ void TA_FUNC_DX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -8740,11 +7932,8 @@ void TA_FUNC_DX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_DX(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_DX(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8763,17 +7952,14 @@ void TA_FUNC_DX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_EMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8786,7 +7972,7 @@ void TA_FUNC_EMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -8795,19 +7981,19 @@ void TA_FUNC_EMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -8828,9 +8014,8 @@ void TA_FUNC_EMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_EMA(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_EMA(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8849,15 +8034,14 @@ void TA_FUNC_EMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_EXP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8870,7 +8054,7 @@ void TA_FUNC_EXP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -8878,18 +8062,18 @@ void TA_FUNC_EXP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -8909,9 +8093,8 @@ void TA_FUNC_EXP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_EXP(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_EXP(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -8930,15 +8113,14 @@ void TA_FUNC_EXP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_FLOOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -8951,7 +8133,7 @@ void TA_FUNC_FLOOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -8959,18 +8141,18 @@ void TA_FUNC_FLOOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -8990,9 +8172,8 @@ void TA_FUNC_FLOOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_FLOOR(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_FLOOR(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9011,15 +8192,14 @@ void TA_FUNC_FLOOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_HT_DCPERIOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9032,7 +8212,7 @@ void TA_FUNC_HT_DCPERIOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -9040,18 +8220,18 @@ void TA_FUNC_HT_DCPERIOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -9071,9 +8251,8 @@ void TA_FUNC_HT_DCPERIOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_HT_DCPERIOD(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_HT_DCPERIOD(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9092,15 +8271,14 @@ void TA_FUNC_HT_DCPERIOD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_HT_DCPHASE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9113,7 +8291,7 @@ void TA_FUNC_HT_DCPHASE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -9121,18 +8299,18 @@ void TA_FUNC_HT_DCPHASE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -9152,9 +8330,8 @@ void TA_FUNC_HT_DCPHASE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_HT_DCPHASE(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_HT_DCPHASE(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9173,15 +8350,14 @@ void TA_FUNC_HT_DCPHASE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_HT_PHASOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9197,7 +8373,7 @@ void TA_FUNC_HT_PHASOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -9205,18 +8381,18 @@ void TA_FUNC_HT_PHASOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -9240,9 +8416,8 @@ void TA_FUNC_HT_PHASOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outInPhase = new double[outLength];
     double *outQuadrature = new double[outLength];
-    TA_RetCode result = TA_HT_PHASOR(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outInPhase, outQuadrature);
+    TA_RetCode result = TA_HT_PHASOR(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outInPhase, outQuadrature);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outInPhase;
         delete[] outQuadrature;
         TA_RetCodeInfo retCodeInfo;
@@ -9266,7 +8441,6 @@ void TA_FUNC_HT_PHASOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outQuadrature_JS, i, Nan::New<v8::Number>(outQuadrature[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outInPhase;
     delete[] outQuadrature;
 }
@@ -9274,8 +8448,8 @@ void TA_FUNC_HT_PHASOR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_HT_SINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9291,7 +8465,7 @@ void TA_FUNC_HT_SINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -9299,18 +8473,18 @@ void TA_FUNC_HT_SINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -9334,9 +8508,8 @@ void TA_FUNC_HT_SINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outSine = new double[outLength];
     double *outLeadSine = new double[outLength];
-    TA_RetCode result = TA_HT_SINE(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outSine, outLeadSine);
+    TA_RetCode result = TA_HT_SINE(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outSine, outLeadSine);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outSine;
         delete[] outLeadSine;
         TA_RetCodeInfo retCodeInfo;
@@ -9360,7 +8533,6 @@ void TA_FUNC_HT_SINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outLeadSine_JS, i, Nan::New<v8::Number>(outLeadSine[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outSine;
     delete[] outLeadSine;
 }
@@ -9368,8 +8540,8 @@ void TA_FUNC_HT_SINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_HT_TRENDLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9382,7 +8554,7 @@ void TA_FUNC_HT_TRENDLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -9390,18 +8562,18 @@ void TA_FUNC_HT_TRENDLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -9421,9 +8593,8 @@ void TA_FUNC_HT_TRENDLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_HT_TRENDLINE(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_HT_TRENDLINE(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9442,15 +8613,14 @@ void TA_FUNC_HT_TRENDLINE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_HT_TRENDMODE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9463,7 +8633,7 @@ void TA_FUNC_HT_TRENDMODE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -9471,18 +8641,18 @@ void TA_FUNC_HT_TRENDMODE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -9502,9 +8672,8 @@ void TA_FUNC_HT_TRENDMODE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_HT_TRENDMODE(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_HT_TRENDMODE(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9523,15 +8692,14 @@ void TA_FUNC_HT_TRENDMODE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_IMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9544,8 +8712,8 @@ void TA_FUNC_IMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inOpen = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inOpen;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -9554,23 +8722,22 @@ void TA_FUNC_IMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inOpen_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inOpen[i] = Nan::Get(inOpen_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inOpen.Init(info[0], "inOpen", inLength) || !inClose.Init(info[1], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inOpenName = Nan::New("Open").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inOpenName = Nan::New(AddonData::From(info)->recordFields[RECORD_OPEN]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inOpen.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inOpen[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inOpen.data[i] = Nan::Get(inObject, inOpenName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -9591,10 +8758,8 @@ void TA_FUNC_IMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_IMI(startIdx, endIdx, inOpen, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_IMI(startIdx, endIdx, inOpen.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inOpen;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9613,16 +8778,14 @@ void TA_FUNC_IMI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inOpen;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_KAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9635,7 +8798,7 @@ void TA_FUNC_KAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -9644,19 +8807,19 @@ void TA_FUNC_KAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -9677,9 +8840,8 @@ void TA_FUNC_KAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_KAMA(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_KAMA(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9698,15 +8860,14 @@ void TA_FUNC_KAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_LINEARREG(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9719,7 +8880,7 @@ void TA_FUNC_LINEARREG(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -9728,19 +8889,19 @@ void TA_FUNC_LINEARREG(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -9761,9 +8922,8 @@ void TA_FUNC_LINEARREG(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_LINEARREG(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_LINEARREG(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9782,15 +8942,14 @@ void TA_FUNC_LINEARREG(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_LINEARREG_ANGLE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9803,7 +8962,7 @@ void TA_FUNC_LINEARREG_ANGLE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -9812,19 +8971,19 @@ void TA_FUNC_LINEARREG_ANGLE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -9845,9 +9004,8 @@ void TA_FUNC_LINEARREG_ANGLE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_LINEARREG_ANGLE(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_LINEARREG_ANGLE(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9866,15 +9024,14 @@ void TA_FUNC_LINEARREG_ANGLE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_LINEARREG_INTERCEPT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9887,7 +9044,7 @@ void TA_FUNC_LINEARREG_INTERCEPT(const Nan::FunctionCallbackInfo<v8::Value> &inf
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -9896,19 +9053,19 @@ void TA_FUNC_LINEARREG_INTERCEPT(const Nan::FunctionCallbackInfo<v8::Value> &inf
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -9929,9 +9086,8 @@ void TA_FUNC_LINEARREG_INTERCEPT(const Nan::FunctionCallbackInfo<v8::Value> &inf
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_LINEARREG_INTERCEPT(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_LINEARREG_INTERCEPT(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -9950,15 +9106,14 @@ void TA_FUNC_LINEARREG_INTERCEPT(const Nan::FunctionCallbackInfo<v8::Value> &inf
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_LINEARREG_SLOPE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -9971,7 +9126,7 @@ void TA_FUNC_LINEARREG_SLOPE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -9980,19 +9135,19 @@ void TA_FUNC_LINEARREG_SLOPE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -10013,9 +9168,8 @@ void TA_FUNC_LINEARREG_SLOPE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_LINEARREG_SLOPE(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_LINEARREG_SLOPE(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -10034,15 +9188,14 @@ void TA_FUNC_LINEARREG_SLOPE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_LN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10055,7 +9208,7 @@ void TA_FUNC_LN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -10063,18 +9216,18 @@ void TA_FUNC_LN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -10094,9 +9247,8 @@ void TA_FUNC_LN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_LN(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_LN(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -10115,15 +9267,14 @@ void TA_FUNC_LN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_LOG10(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10136,7 +9287,7 @@ void TA_FUNC_LOG10(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -10144,18 +9295,18 @@ void TA_FUNC_LOG10(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -10175,9 +9326,8 @@ void TA_FUNC_LOG10(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_LOG10(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_LOG10(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -10196,15 +9346,14 @@ void TA_FUNC_LOG10(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10217,7 +9366,7 @@ void TA_FUNC_MA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     TA_MAType optMA_Type = TA_MAType_SMA;
     int startIdx = 0;
@@ -10227,9 +9376,8 @@ void TA_FUNC_MA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         optMA_Type = argc > 2 && info[2]->IsInt32() ? (TA_MAType)  info[2]->Int32Value(context).FromJust() : optMA_Type;
@@ -10237,10 +9385,11 @@ void TA_FUNC_MA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         optMA_Type = argc > 3 && info[3]->IsInt32() ? (TA_MAType)  info[3]->Int32Value(context).FromJust() : optMA_Type;
@@ -10262,9 +9411,8 @@ void TA_FUNC_MA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MA(startIdx, endIdx, inReal, optTime_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MA(startIdx, endIdx, inReal.data, optTime_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -10283,15 +9431,14 @@ void TA_FUNC_MA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MACD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10309,7 +9456,7 @@ void TA_FUNC_MACD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optFast_Period = 12;
     int optSlow_Period = 26;
     int optSignal_Period = 9;
@@ -10320,9 +9467,8 @@ void TA_FUNC_MACD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optFast_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optSlow_Period;
@@ -10331,10 +9477,11 @@ void TA_FUNC_MACD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFast_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optSlow_Period;
@@ -10364,9 +9511,8 @@ void TA_FUNC_MACD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     double *outMACD = new double[outLength];
     double *outMACDSignal = new double[outLength];
     double *outMACDHist = new double[outLength];
-    TA_RetCode result = TA_MACD(startIdx, endIdx, inReal, optFast_Period, optSlow_Period, optSignal_Period, &outBegIdx, &outNBElement, outMACD, outMACDSignal, outMACDHist);
+    TA_RetCode result = TA_MACD(startIdx, endIdx, inReal.data, optFast_Period, optSlow_Period, optSignal_Period, &outBegIdx, &outNBElement, outMACD, outMACDSignal, outMACDHist);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outMACD;
         delete[] outMACDSignal;
         delete[] outMACDHist;
@@ -10394,7 +9540,6 @@ void TA_FUNC_MACD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outMACDHist_JS, i, Nan::New<v8::Number>(outMACDHist[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outMACD;
     delete[] outMACDSignal;
     delete[] outMACDHist;
@@ -10403,8 +9548,8 @@ void TA_FUNC_MACD(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_MACDEXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10422,7 +9567,7 @@ void TA_FUNC_MACDEXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optFast_Period = 12;
     TA_MAType optFast_MA = TA_MAType_SMA;
     int optSlow_Period = 26;
@@ -10436,9 +9581,8 @@ void TA_FUNC_MACDEXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optFast_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFast_Period;
         optFast_MA = argc > 2 && info[2]->IsInt32() ? (TA_MAType)  info[2]->Int32Value(context).FromJust() : optFast_MA;
@@ -10450,10 +9594,11 @@ void TA_FUNC_MACDEXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 8 && info[8]->IsInt32() ? info[8]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFast_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optFast_Period;
         optFast_MA = argc > 3 && info[3]->IsInt32() ? (TA_MAType)  info[3]->Int32Value(context).FromJust() : optFast_MA;
@@ -10486,9 +9631,8 @@ void TA_FUNC_MACDEXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     double *outMACD = new double[outLength];
     double *outMACDSignal = new double[outLength];
     double *outMACDHist = new double[outLength];
-    TA_RetCode result = TA_MACDEXT(startIdx, endIdx, inReal, optFast_Period, optFast_MA, optSlow_Period, optSlow_MA, optSignal_Period, optSignal_MA, &outBegIdx, &outNBElement, outMACD, outMACDSignal, outMACDHist);
+    TA_RetCode result = TA_MACDEXT(startIdx, endIdx, inReal.data, optFast_Period, optFast_MA, optSlow_Period, optSlow_MA, optSignal_Period, optSignal_MA, &outBegIdx, &outNBElement, outMACD, outMACDSignal, outMACDHist);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outMACD;
         delete[] outMACDSignal;
         delete[] outMACDHist;
@@ -10516,7 +9660,6 @@ void TA_FUNC_MACDEXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outMACDHist_JS, i, Nan::New<v8::Number>(outMACDHist[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outMACD;
     delete[] outMACDSignal;
     delete[] outMACDHist;
@@ -10525,8 +9668,8 @@ void TA_FUNC_MACDEXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_MACDFIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10544,7 +9687,7 @@ void TA_FUNC_MACDFIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optSignal_Period = 9;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -10553,19 +9696,19 @@ void TA_FUNC_MACDFIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optSignal_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optSignal_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optSignal_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optSignal_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -10593,9 +9736,8 @@ void TA_FUNC_MACDFIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     double *outMACD = new double[outLength];
     double *outMACDSignal = new double[outLength];
     double *outMACDHist = new double[outLength];
-    TA_RetCode result = TA_MACDFIX(startIdx, endIdx, inReal, optSignal_Period, &outBegIdx, &outNBElement, outMACD, outMACDSignal, outMACDHist);
+    TA_RetCode result = TA_MACDFIX(startIdx, endIdx, inReal.data, optSignal_Period, &outBegIdx, &outNBElement, outMACD, outMACDSignal, outMACDHist);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outMACD;
         delete[] outMACDSignal;
         delete[] outMACDHist;
@@ -10623,7 +9765,6 @@ void TA_FUNC_MACDFIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outMACDHist_JS, i, Nan::New<v8::Number>(outMACDHist[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outMACD;
     delete[] outMACDSignal;
     delete[] outMACDHist;
@@ -10632,8 +9773,8 @@ void TA_FUNC_MACDFIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_MAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10649,7 +9790,7 @@ void TA_FUNC_MAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     double optFast_Limit = 5.000000e-1;
     double optSlow_Limit = 5.000000e-2;
     int startIdx = 0;
@@ -10659,9 +9800,8 @@ void TA_FUNC_MAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optFast_Limit = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optFast_Limit;
         optSlow_Limit = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optSlow_Limit;
@@ -10669,10 +9809,11 @@ void TA_FUNC_MAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFast_Limit = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optFast_Limit;
         optSlow_Limit = argc > 3 && info[3]->IsNumber() ?  info[3]->NumberValue(context).FromJust() : optSlow_Limit;
@@ -10698,9 +9839,8 @@ void TA_FUNC_MAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outMAMA = new double[outLength];
     double *outFAMA = new double[outLength];
-    TA_RetCode result = TA_MAMA(startIdx, endIdx, inReal, optFast_Limit, optSlow_Limit, &outBegIdx, &outNBElement, outMAMA, outFAMA);
+    TA_RetCode result = TA_MAMA(startIdx, endIdx, inReal.data, optFast_Limit, optSlow_Limit, &outBegIdx, &outNBElement, outMAMA, outFAMA);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outMAMA;
         delete[] outFAMA;
         TA_RetCodeInfo retCodeInfo;
@@ -10724,7 +9864,6 @@ void TA_FUNC_MAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outFAMA_JS, i, Nan::New<v8::Number>(outFAMA[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outMAMA;
     delete[] outFAMA;
 }
@@ -10732,8 +9871,8 @@ void TA_FUNC_MAMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_MAVP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10746,8 +9885,8 @@ void TA_FUNC_MAVP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
-    double *inPeriods = new double[inLength];
+    RealInput inReal;
+    RealInput inPeriods;
     int optMinimum_Period = 2;
     int optMaximum_Period = 30;
     TA_MAType optMA_Type = TA_MAType_SMA;
@@ -10758,11 +9897,8 @@ void TA_FUNC_MAVP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inPeriods_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inPeriods[i] = Nan::Get(inPeriods_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength) || !inPeriods.Init(info[1], "inPeriods", inLength)) {
+            return;
         }
         optMinimum_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optMinimum_Period;
         optMaximum_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optMaximum_Period;
@@ -10772,11 +9908,13 @@ void TA_FUNC_MAVP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
         v8::Local<v8::String> inPeriodsName = info[2]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
+        inPeriods.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
-            inPeriods[i] = Nan::Get(inObject, inPeriodsName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inPeriods.data[i] = Nan::Get(inObject, inPeriodsName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optMinimum_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optMinimum_Period;
         optMaximum_Period = argc > 4 && info[4]->IsInt32() ?  info[4]->Int32Value(context).FromJust() : optMaximum_Period;
@@ -10799,10 +9937,8 @@ void TA_FUNC_MAVP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MAVP(startIdx, endIdx, inReal, inPeriods, optMinimum_Period, optMaximum_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MAVP(startIdx, endIdx, inReal.data, inPeriods.data, optMinimum_Period, optMaximum_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
-        delete[] inPeriods;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -10821,16 +9957,14 @@ void TA_FUNC_MAVP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
-    delete[] inPeriods;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10843,7 +9977,7 @@ void TA_FUNC_MAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -10852,19 +9986,19 @@ void TA_FUNC_MAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -10885,9 +10019,8 @@ void TA_FUNC_MAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MAX(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MAX(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -10906,15 +10039,14 @@ void TA_FUNC_MAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -10927,7 +10059,7 @@ void TA_FUNC_MAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -10936,19 +10068,19 @@ void TA_FUNC_MAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -10969,9 +10101,8 @@ void TA_FUNC_MAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_MAXINDEX(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_MAXINDEX(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -10990,15 +10121,14 @@ void TA_FUNC_MAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_MEDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11011,8 +10141,8 @@ void TA_FUNC_MEDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -11020,22 +10150,21 @@ void TA_FUNC_MEDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -11055,10 +10184,8 @@ void TA_FUNC_MEDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MEDPRICE(startIdx, endIdx, inHigh, inLow, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MEDPRICE(startIdx, endIdx, inHigh.data, inLow.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11077,16 +10204,14 @@ void TA_FUNC_MEDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MFI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11099,10 +10224,10 @@ void TA_FUNC_MFI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
-    double *inVolume = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
+    RealInput inVolume;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11111,31 +10236,28 @@ void TA_FUNC_MFI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        v8::Local<v8::Array> inVolume_JS = v8::Local<v8::Array>::Cast(info[3]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inVolume_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength) || !inVolume.Init(info[3], "inVolume", inLength)) {
+            return;
         }
         optTime_Period = argc > 4 && info[4]->IsInt32() ?  info[4]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
-        v8::Local<v8::String> inVolumeName = Nan::New("Volume").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        v8::Local<v8::String> inVolumeName = Nan::New(AddonData::From(info)->recordFields[RECORD_VOLUME]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
+        inVolume.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inVolume.data[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -11156,12 +10278,8 @@ void TA_FUNC_MFI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MFI(startIdx, endIdx, inHigh, inLow, inClose, inVolume, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MFI(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, inVolume.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
-        delete[] inVolume;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11180,18 +10298,14 @@ void TA_FUNC_MFI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
-    delete[] inVolume;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MIDPOINT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11204,7 +10318,7 @@ void TA_FUNC_MIDPOINT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11213,19 +10327,19 @@ void TA_FUNC_MIDPOINT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -11246,9 +10360,8 @@ void TA_FUNC_MIDPOINT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MIDPOINT(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MIDPOINT(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11267,15 +10380,14 @@ void TA_FUNC_MIDPOINT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MIDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11288,8 +10400,8 @@ void TA_FUNC_MIDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11298,23 +10410,22 @@ void TA_FUNC_MIDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -11335,10 +10446,8 @@ void TA_FUNC_MIDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MIDPRICE(startIdx, endIdx, inHigh, inLow, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MIDPRICE(startIdx, endIdx, inHigh.data, inLow.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11357,16 +10466,14 @@ void TA_FUNC_MIDPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11379,7 +10486,7 @@ void TA_FUNC_MIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11388,19 +10495,19 @@ void TA_FUNC_MIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -11421,9 +10528,8 @@ void TA_FUNC_MIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MIN(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MIN(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11442,15 +10548,14 @@ void TA_FUNC_MIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MININDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11463,7 +10568,7 @@ void TA_FUNC_MININDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11472,19 +10577,19 @@ void TA_FUNC_MININDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -11505,9 +10610,8 @@ void TA_FUNC_MININDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     int *outInteger = new int[outLength];
-    TA_RetCode result = TA_MININDEX(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outInteger);
+    TA_RetCode result = TA_MININDEX(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outInteger);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outInteger;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11526,15 +10630,14 @@ void TA_FUNC_MININDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outInteger_JS, i, Nan::New<v8::Number>(outInteger[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outInteger;
 }
 
 
 void TA_FUNC_MINMAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11550,7 +10653,7 @@ void TA_FUNC_MINMAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11559,19 +10662,19 @@ void TA_FUNC_MINMAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -11596,9 +10699,8 @@ void TA_FUNC_MINMAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outMin = new double[outLength];
     double *outMax = new double[outLength];
-    TA_RetCode result = TA_MINMAX(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outMin, outMax);
+    TA_RetCode result = TA_MINMAX(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outMin, outMax);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outMin;
         delete[] outMax;
         TA_RetCodeInfo retCodeInfo;
@@ -11622,7 +10724,6 @@ void TA_FUNC_MINMAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outMax_JS, i, Nan::New<v8::Number>(outMax[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outMin;
     delete[] outMax;
 }
@@ -11630,8 +10731,8 @@ void TA_FUNC_MINMAX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_MINMAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11647,7 +10748,7 @@ void TA_FUNC_MINMAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11656,19 +10757,19 @@ void TA_FUNC_MINMAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -11693,9 +10794,8 @@ void TA_FUNC_MINMAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     int *outMinIdx = new int[outLength];
     int *outMaxIdx = new int[outLength];
-    TA_RetCode result = TA_MINMAXINDEX(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outMinIdx, outMaxIdx);
+    TA_RetCode result = TA_MINMAXINDEX(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outMinIdx, outMaxIdx);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outMinIdx;
         delete[] outMaxIdx;
         TA_RetCodeInfo retCodeInfo;
@@ -11719,7 +10819,6 @@ void TA_FUNC_MINMAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outMaxIdx_JS, i, Nan::New<v8::Number>(outMaxIdx[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outMinIdx;
     delete[] outMaxIdx;
 }
@@ -11727,8 +10826,8 @@ void TA_FUNC_MINMAXINDEX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_MINUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11741,9 +10840,9 @@ void TA_FUNC_MINUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11752,27 +10851,25 @@ void TA_FUNC_MINUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -11793,11 +10890,8 @@ void TA_FUNC_MINUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MINUS_DI(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MINUS_DI(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11816,17 +10910,14 @@ void TA_FUNC_MINUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MINUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11839,8 +10930,8 @@ void TA_FUNC_MINUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11849,23 +10940,22 @@ void TA_FUNC_MINUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -11886,10 +10976,8 @@ void TA_FUNC_MINUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MINUS_DM(startIdx, endIdx, inHigh, inLow, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MINUS_DM(startIdx, endIdx, inHigh.data, inLow.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11908,16 +10996,14 @@ void TA_FUNC_MINUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -11930,7 +11016,7 @@ void TA_FUNC_MOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 10;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -11939,19 +11025,19 @@ void TA_FUNC_MOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -11972,9 +11058,8 @@ void TA_FUNC_MOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MOM(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MOM(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -11993,15 +11078,14 @@ void TA_FUNC_MOM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_MULT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12014,8 +11098,8 @@ void TA_FUNC_MULT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal0 = new double[inLength];
-    double *inReal1 = new double[inLength];
+    RealInput inReal0;
+    RealInput inReal1;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -12023,22 +11107,21 @@ void TA_FUNC_MULT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal0_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inReal1_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal0[i] = Nan::Get(inReal0_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inReal1_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal0.Init(info[0], "inReal0", inLength) || !inReal1.Init(info[1], "inReal1", inLength)) {
+            return;
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inReal0Name = info[1]->ToString(context).ToLocalChecked();;
         v8::Local<v8::String> inReal1Name = info[2]->ToString(context).ToLocalChecked();;
+        inReal0.Alloc(inLength);
+        inReal1.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal0[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal0.data[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal1.data[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
@@ -12058,10 +11141,8 @@ void TA_FUNC_MULT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_MULT(startIdx, endIdx, inReal0, inReal1, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_MULT(startIdx, endIdx, inReal0.data, inReal1.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal0;
-        delete[] inReal1;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12080,16 +11161,14 @@ void TA_FUNC_MULT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal0;
-    delete[] inReal1;
     delete[] outReal;
 }
 
 
 void TA_FUNC_NATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12102,9 +11181,9 @@ void TA_FUNC_NATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12113,27 +11192,25 @@ void TA_FUNC_NATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -12154,11 +11231,8 @@ void TA_FUNC_NATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_NATR(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_NATR(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12177,17 +11251,14 @@ void TA_FUNC_NATR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_OBV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12200,8 +11271,8 @@ void TA_FUNC_OBV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
-    double *inVolume = new double[inLength];
+    RealInput inReal;
+    RealInput inVolume;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -12209,22 +11280,21 @@ void TA_FUNC_OBV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inVolume_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inVolume_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength) || !inVolume.Init(info[1], "inVolume", inLength)) {
+            return;
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
-        v8::Local<v8::String> inVolumeName = Nan::New("Volume").ToLocalChecked();
+        v8::Local<v8::String> inVolumeName = Nan::New(AddonData::From(info)->recordFields[RECORD_VOLUME]);
+        inReal.Alloc(inLength);
+        inVolume.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
-            inVolume[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inVolume.data[i] = Nan::Get(inObject, inVolumeName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -12244,10 +11314,8 @@ void TA_FUNC_OBV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_OBV(startIdx, endIdx, inReal, inVolume, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_OBV(startIdx, endIdx, inReal.data, inVolume.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
-        delete[] inVolume;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12266,16 +11334,14 @@ void TA_FUNC_OBV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
-    delete[] inVolume;
     delete[] outReal;
 }
 
 
 void TA_FUNC_PLUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12288,9 +11354,9 @@ void TA_FUNC_PLUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12299,27 +11365,25 @@ void TA_FUNC_PLUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -12340,11 +11404,8 @@ void TA_FUNC_PLUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_PLUS_DI(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_PLUS_DI(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12363,17 +11424,14 @@ void TA_FUNC_PLUS_DI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_PLUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12386,8 +11444,8 @@ void TA_FUNC_PLUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12396,23 +11454,22 @@ void TA_FUNC_PLUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -12433,10 +11490,8 @@ void TA_FUNC_PLUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_PLUS_DM(startIdx, endIdx, inHigh, inLow, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_PLUS_DM(startIdx, endIdx, inHigh.data, inLow.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12455,16 +11510,14 @@ void TA_FUNC_PLUS_DM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outReal;
 }
 
 
 void TA_FUNC_PPO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12477,7 +11530,7 @@ void TA_FUNC_PPO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optFast_Period = 12;
     int optSlow_Period = 26;
     TA_MAType optMA_Type = TA_MAType_SMA;
@@ -12488,9 +11541,8 @@ void TA_FUNC_PPO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optFast_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optSlow_Period;
@@ -12499,10 +11551,11 @@ void TA_FUNC_PPO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFast_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optFast_Period;
         optSlow_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optSlow_Period;
@@ -12525,9 +11578,8 @@ void TA_FUNC_PPO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_PPO(startIdx, endIdx, inReal, optFast_Period, optSlow_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_PPO(startIdx, endIdx, inReal.data, optFast_Period, optSlow_Period, optMA_Type, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12546,15 +11598,14 @@ void TA_FUNC_PPO(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ROC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12567,7 +11618,7 @@ void TA_FUNC_ROC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 10;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12576,19 +11627,19 @@ void TA_FUNC_ROC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -12609,9 +11660,8 @@ void TA_FUNC_ROC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ROC(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ROC(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12630,15 +11680,14 @@ void TA_FUNC_ROC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ROCP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12651,7 +11700,7 @@ void TA_FUNC_ROCP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 10;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12660,19 +11709,19 @@ void TA_FUNC_ROCP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -12693,9 +11742,8 @@ void TA_FUNC_ROCP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ROCP(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ROCP(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12714,15 +11762,14 @@ void TA_FUNC_ROCP(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ROCR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12735,7 +11782,7 @@ void TA_FUNC_ROCR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 10;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12744,19 +11791,19 @@ void TA_FUNC_ROCR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -12777,9 +11824,8 @@ void TA_FUNC_ROCR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ROCR(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ROCR(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12798,15 +11844,14 @@ void TA_FUNC_ROCR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ROCR100(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12819,7 +11864,7 @@ void TA_FUNC_ROCR100(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 10;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12828,19 +11873,19 @@ void TA_FUNC_ROCR100(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -12861,9 +11906,8 @@ void TA_FUNC_ROCR100(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ROCR100(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ROCR100(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12882,15 +11926,14 @@ void TA_FUNC_ROCR100(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_RSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12903,7 +11946,7 @@ void TA_FUNC_RSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -12912,19 +11955,19 @@ void TA_FUNC_RSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -12945,9 +11988,8 @@ void TA_FUNC_RSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_RSI(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_RSI(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -12966,15 +12008,14 @@ void TA_FUNC_RSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_SAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -12987,8 +12028,8 @@ void TA_FUNC_SAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     double optAcceleration_Factor = 2.000000e-2;
     double optAF_Maximum = 2.000000e-1;
     int startIdx = 0;
@@ -12998,24 +12039,23 @@ void TA_FUNC_SAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         optAcceleration_Factor = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optAcceleration_Factor;
         optAF_Maximum = argc > 3 && info[3]->IsNumber() ?  info[3]->NumberValue(context).FromJust() : optAF_Maximum;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optAcceleration_Factor = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optAcceleration_Factor;
         optAF_Maximum = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optAF_Maximum;
@@ -13037,10 +12077,8 @@ void TA_FUNC_SAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SAR(startIdx, endIdx, inHigh, inLow, optAcceleration_Factor, optAF_Maximum, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SAR(startIdx, endIdx, inHigh.data, inLow.data, optAcceleration_Factor, optAF_Maximum, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -13059,16 +12097,14 @@ void TA_FUNC_SAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outReal;
 }
 
 
 void TA_FUNC_SAREXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13081,8 +12117,8 @@ void TA_FUNC_SAREXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
     double optStart_Value = 0.000000e+0;
     double optOffset_on_Reverse = 0.000000e+0;
     double optAF_Init_Long = 2.000000e-2;
@@ -13098,11 +12134,8 @@ void TA_FUNC_SAREXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength)) {
+            return;
         }
         optStart_Value = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optStart_Value;
         optOffset_on_Reverse = argc > 3 && info[3]->IsNumber() ?  info[3]->NumberValue(context).FromJust() : optOffset_on_Reverse;
@@ -13115,13 +12148,15 @@ void TA_FUNC_SAREXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         startIdx = argc > 10 && info[10]->IsInt32() ? info[10]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 11 && info[11]->IsInt32() ? info[11]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optStart_Value = argc > 1 && info[1]->IsNumber() ?  info[1]->NumberValue(context).FromJust() : optStart_Value;
         optOffset_on_Reverse = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optOffset_on_Reverse;
@@ -13149,10 +12184,8 @@ void TA_FUNC_SAREXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SAREXT(startIdx, endIdx, inHigh, inLow, optStart_Value, optOffset_on_Reverse, optAF_Init_Long, optAF_Long, optAF_Max_Long, optAF_Init_Short, optAF_Short, optAF_Max_Short, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SAREXT(startIdx, endIdx, inHigh.data, inLow.data, optStart_Value, optOffset_on_Reverse, optAF_Init_Long, optAF_Long, optAF_Max_Long, optAF_Init_Short, optAF_Short, optAF_Max_Short, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -13171,16 +12204,14 @@ void TA_FUNC_SAREXT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
     delete[] outReal;
 }
 
 
 void TA_FUNC_SIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13193,7 +12224,7 @@ void TA_FUNC_SIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -13201,18 +12232,18 @@ void TA_FUNC_SIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -13232,9 +12263,8 @@ void TA_FUNC_SIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SIN(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SIN(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -13253,15 +12283,14 @@ void TA_FUNC_SIN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_SINH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13274,7 +12303,7 @@ void TA_FUNC_SINH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -13282,18 +12311,18 @@ void TA_FUNC_SINH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -13313,9 +12342,8 @@ void TA_FUNC_SINH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SINH(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SINH(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -13334,15 +12362,14 @@ void TA_FUNC_SINH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_SMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13355,7 +12382,7 @@ void TA_FUNC_SMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -13364,19 +12391,19 @@ void TA_FUNC_SMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -13397,9 +12424,8 @@ void TA_FUNC_SMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SMA(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SMA(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -13418,15 +12444,14 @@ void TA_FUNC_SMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_SQRT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13439,7 +12464,7 @@ void TA_FUNC_SQRT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -13447,18 +12472,18 @@ void TA_FUNC_SQRT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -13478,9 +12503,8 @@ void TA_FUNC_SQRT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SQRT(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SQRT(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -13499,15 +12523,14 @@ void TA_FUNC_SQRT(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_STDDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13520,7 +12543,7 @@ void TA_FUNC_STDDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 5;
     double optDeviations = 1.000000e+0;
     int startIdx = 0;
@@ -13530,9 +12553,8 @@ void TA_FUNC_STDDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         optDeviations = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optDeviations;
@@ -13540,10 +12562,11 @@ void TA_FUNC_STDDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         optDeviations = argc > 3 && info[3]->IsNumber() ?  info[3]->NumberValue(context).FromJust() : optDeviations;
@@ -13565,9 +12588,8 @@ void TA_FUNC_STDDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_STDDEV(startIdx, endIdx, inReal, optTime_Period, optDeviations, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_STDDEV(startIdx, endIdx, inReal.data, optTime_Period, optDeviations, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -13586,15 +12608,14 @@ void TA_FUNC_STDDEV(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_STOCH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13610,9 +12631,9 @@ void TA_FUNC_STOCH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optFastK_Period = 5;
     int optSlowK_Period = 3;
     TA_MAType optSlowK_MA = TA_MAType_SMA;
@@ -13625,13 +12646,8 @@ void TA_FUNC_STOCH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optFastK_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optFastK_Period;
         optSlowK_Period = argc > 4 && info[4]->IsInt32() ?  info[4]->Int32Value(context).FromJust() : optSlowK_Period;
@@ -13641,15 +12657,18 @@ void TA_FUNC_STOCH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         startIdx = argc > 8 && info[8]->IsInt32() ? info[8]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 9 && info[9]->IsInt32() ? info[9]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFastK_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFastK_Period;
         optSlowK_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optSlowK_Period;
@@ -13678,11 +12697,8 @@ void TA_FUNC_STOCH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outSlowK = new double[outLength];
     double *outSlowD = new double[outLength];
-    TA_RetCode result = TA_STOCH(startIdx, endIdx, inHigh, inLow, inClose, optFastK_Period, optSlowK_Period, optSlowK_MA, optSlowD_Period, optSlowD_MA, &outBegIdx, &outNBElement, outSlowK, outSlowD);
+    TA_RetCode result = TA_STOCH(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optFastK_Period, optSlowK_Period, optSlowK_MA, optSlowD_Period, optSlowD_MA, &outBegIdx, &outNBElement, outSlowK, outSlowD);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outSlowK;
         delete[] outSlowD;
         TA_RetCodeInfo retCodeInfo;
@@ -13706,9 +12722,6 @@ void TA_FUNC_STOCH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outSlowD_JS, i, Nan::New<v8::Number>(outSlowD[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outSlowK;
     delete[] outSlowD;
 }
@@ -13716,8 +12729,8 @@ void TA_FUNC_STOCH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_STOCHF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13733,9 +12746,9 @@ void TA_FUNC_STOCHF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optFastK_Period = 5;
     int optFastD_Period = 3;
     TA_MAType optFastD_MA = TA_MAType_SMA;
@@ -13746,13 +12759,8 @@ void TA_FUNC_STOCHF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optFastK_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optFastK_Period;
         optFastD_Period = argc > 4 && info[4]->IsInt32() ?  info[4]->Int32Value(context).FromJust() : optFastD_Period;
@@ -13760,15 +12768,18 @@ void TA_FUNC_STOCHF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         startIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 7 && info[7]->IsInt32() ? info[7]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFastK_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFastK_Period;
         optFastD_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optFastD_Period;
@@ -13795,11 +12806,8 @@ void TA_FUNC_STOCHF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outFastK = new double[outLength];
     double *outFastD = new double[outLength];
-    TA_RetCode result = TA_STOCHF(startIdx, endIdx, inHigh, inLow, inClose, optFastK_Period, optFastD_Period, optFastD_MA, &outBegIdx, &outNBElement, outFastK, outFastD);
+    TA_RetCode result = TA_STOCHF(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optFastK_Period, optFastD_Period, optFastD_MA, &outBegIdx, &outNBElement, outFastK, outFastD);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outFastK;
         delete[] outFastD;
         TA_RetCodeInfo retCodeInfo;
@@ -13823,9 +12831,6 @@ void TA_FUNC_STOCHF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outFastD_JS, i, Nan::New<v8::Number>(outFastD[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outFastK;
     delete[] outFastD;
 }
@@ -13833,8 +12838,8 @@ void TA_FUNC_STOCHF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_STOCHRSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13850,7 +12855,7 @@ void TA_FUNC_STOCHRSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int optFastK_Period = 5;
     int optFastD_Period = 3;
@@ -13862,9 +12867,8 @@ void TA_FUNC_STOCHRSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         optFastK_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optFastK_Period;
@@ -13874,10 +12878,11 @@ void TA_FUNC_STOCHRSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         optFastK_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optFastK_Period;
@@ -13905,9 +12910,8 @@ void TA_FUNC_STOCHRSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     }
     double *outFastK = new double[outLength];
     double *outFastD = new double[outLength];
-    TA_RetCode result = TA_STOCHRSI(startIdx, endIdx, inReal, optTime_Period, optFastK_Period, optFastD_Period, optFastD_MA, &outBegIdx, &outNBElement, outFastK, outFastD);
+    TA_RetCode result = TA_STOCHRSI(startIdx, endIdx, inReal.data, optTime_Period, optFastK_Period, optFastD_Period, optFastD_MA, &outBegIdx, &outNBElement, outFastK, outFastD);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outFastK;
         delete[] outFastD;
         TA_RetCodeInfo retCodeInfo;
@@ -13931,7 +12935,6 @@ void TA_FUNC_STOCHRSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outFastD_JS, i, Nan::New<v8::Number>(outFastD[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outFastK;
     delete[] outFastD;
 }
@@ -13939,8 +12942,8 @@ void TA_FUNC_STOCHRSI(const Nan::FunctionCallbackInfo<v8::Value> &info) {
 
 void TA_FUNC_SUB(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -13953,8 +12956,8 @@ void TA_FUNC_SUB(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal0 = new double[inLength];
-    double *inReal1 = new double[inLength];
+    RealInput inReal0;
+    RealInput inReal1;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -13962,22 +12965,21 @@ void TA_FUNC_SUB(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal0_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inReal1_JS = v8::Local<v8::Array>::Cast(info[1]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal0[i] = Nan::Get(inReal0_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inReal1_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal0.Init(info[0], "inReal0", inLength) || !inReal1.Init(info[1], "inReal1", inLength)) {
+            return;
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inReal0Name = info[1]->ToString(context).ToLocalChecked();;
         v8::Local<v8::String> inReal1Name = info[2]->ToString(context).ToLocalChecked();;
+        inReal0.Alloc(inLength);
+        inReal1.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal0[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
-            inReal1[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal0.data[i] = Nan::Get(inObject, inReal0Name).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal1.data[i] = Nan::Get(inObject, inReal1Name).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
@@ -13997,10 +12999,8 @@ void TA_FUNC_SUB(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SUB(startIdx, endIdx, inReal0, inReal1, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SUB(startIdx, endIdx, inReal0.data, inReal1.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal0;
-        delete[] inReal1;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14019,16 +13019,14 @@ void TA_FUNC_SUB(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal0;
-    delete[] inReal1;
     delete[] outReal;
 }
 
 
 void TA_FUNC_SUM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14041,7 +13039,7 @@ void TA_FUNC_SUM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -14050,19 +13048,19 @@ void TA_FUNC_SUM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -14083,9 +13081,8 @@ void TA_FUNC_SUM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_SUM(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_SUM(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14104,15 +13101,14 @@ void TA_FUNC_SUM(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_T3(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14125,7 +13121,7 @@ void TA_FUNC_T3(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 5;
     double optVolume_Factor = 7.000000e-1;
     int startIdx = 0;
@@ -14135,9 +13131,8 @@ void TA_FUNC_T3(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         optVolume_Factor = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optVolume_Factor;
@@ -14145,10 +13140,11 @@ void TA_FUNC_T3(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         optVolume_Factor = argc > 3 && info[3]->IsNumber() ?  info[3]->NumberValue(context).FromJust() : optVolume_Factor;
@@ -14170,9 +13166,8 @@ void TA_FUNC_T3(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_T3(startIdx, endIdx, inReal, optTime_Period, optVolume_Factor, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_T3(startIdx, endIdx, inReal.data, optTime_Period, optVolume_Factor, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14191,15 +13186,14 @@ void TA_FUNC_T3(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14212,7 +13206,7 @@ void TA_FUNC_TAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -14220,18 +13214,18 @@ void TA_FUNC_TAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -14251,9 +13245,8 @@ void TA_FUNC_TAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TAN(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TAN(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14272,15 +13265,14 @@ void TA_FUNC_TAN(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TANH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14293,7 +13285,7 @@ void TA_FUNC_TANH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -14301,18 +13293,18 @@ void TA_FUNC_TANH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
@@ -14332,9 +13324,8 @@ void TA_FUNC_TANH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TANH(startIdx, endIdx, inReal, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TANH(startIdx, endIdx, inReal.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14353,15 +13344,14 @@ void TA_FUNC_TANH(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14374,7 +13364,7 @@ void TA_FUNC_TEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -14383,19 +13373,19 @@ void TA_FUNC_TEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -14416,9 +13406,8 @@ void TA_FUNC_TEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TEMA(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TEMA(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14437,15 +13426,14 @@ void TA_FUNC_TEMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TRANGE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14458,9 +13446,9 @@ void TA_FUNC_TRANGE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -14468,26 +13456,24 @@ void TA_FUNC_TRANGE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -14507,11 +13493,8 @@ void TA_FUNC_TRANGE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TRANGE(startIdx, endIdx, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TRANGE(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14530,17 +13513,14 @@ void TA_FUNC_TRANGE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TRIMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14553,7 +13533,7 @@ void TA_FUNC_TRIMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -14562,19 +13542,19 @@ void TA_FUNC_TRIMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -14595,9 +13575,8 @@ void TA_FUNC_TRIMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TRIMA(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TRIMA(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14616,15 +13595,14 @@ void TA_FUNC_TRIMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TRIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14637,7 +13615,7 @@ void TA_FUNC_TRIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -14646,19 +13624,19 @@ void TA_FUNC_TRIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -14679,9 +13657,8 @@ void TA_FUNC_TRIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TRIX(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TRIX(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14700,15 +13677,14 @@ void TA_FUNC_TRIX(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TSF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14721,7 +13697,7 @@ void TA_FUNC_TSF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -14730,19 +13706,19 @@ void TA_FUNC_TSF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -14763,9 +13739,8 @@ void TA_FUNC_TSF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TSF(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TSF(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14784,15 +13759,14 @@ void TA_FUNC_TSF(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_TYPPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14805,9 +13779,9 @@ void TA_FUNC_TYPPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -14815,26 +13789,24 @@ void TA_FUNC_TYPPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -14854,11 +13826,8 @@ void TA_FUNC_TYPPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_TYPPRICE(startIdx, endIdx, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_TYPPRICE(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14877,17 +13846,14 @@ void TA_FUNC_TYPPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_ULTOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -14900,9 +13866,9 @@ void TA_FUNC_ULTOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optFirst_Period = 7;
     int optSecond_Period = 14;
     int optThird_Period = 28;
@@ -14913,13 +13879,8 @@ void TA_FUNC_ULTOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optFirst_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optFirst_Period;
         optSecond_Period = argc > 4 && info[4]->IsInt32() ?  info[4]->Int32Value(context).FromJust() : optSecond_Period;
@@ -14927,15 +13888,18 @@ void TA_FUNC_ULTOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         startIdx = argc > 6 && info[6]->IsInt32() ? info[6]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 7 && info[7]->IsInt32() ? info[7]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optFirst_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optFirst_Period;
         optSecond_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optSecond_Period;
@@ -14958,11 +13922,8 @@ void TA_FUNC_ULTOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_ULTOSC(startIdx, endIdx, inHigh, inLow, inClose, optFirst_Period, optSecond_Period, optThird_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_ULTOSC(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optFirst_Period, optSecond_Period, optThird_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -14981,17 +13942,14 @@ void TA_FUNC_ULTOSC(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_VAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -15004,7 +13962,7 @@ void TA_FUNC_VAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 5;
     double optDeviations = 1.000000e+0;
     int startIdx = 0;
@@ -15014,9 +13972,8 @@ void TA_FUNC_VAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         optDeviations = argc > 2 && info[2]->IsNumber() ?  info[2]->NumberValue(context).FromJust() : optDeviations;
@@ -15024,10 +13981,11 @@ void TA_FUNC_VAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         optDeviations = argc > 3 && info[3]->IsNumber() ?  info[3]->NumberValue(context).FromJust() : optDeviations;
@@ -15049,9 +14007,8 @@ void TA_FUNC_VAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_VAR(startIdx, endIdx, inReal, optTime_Period, optDeviations, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_VAR(startIdx, endIdx, inReal.data, optTime_Period, optDeviations, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -15070,15 +14027,14 @@ void TA_FUNC_VAR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
 void TA_FUNC_WCLPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -15091,9 +14047,9 @@ void TA_FUNC_WCLPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int startIdx = 0;
     int endIdx = inLength - 1;
     int outBegIdx = 0;
@@ -15101,26 +14057,24 @@ void TA_FUNC_WCLPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         startIdx = argc > 1 && info[1]->IsInt32() ? info[1]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : endIdx;
@@ -15140,11 +14094,8 @@ void TA_FUNC_WCLPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_WCLPRICE(startIdx, endIdx, inHigh, inLow, inClose, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_WCLPRICE(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -15163,17 +14114,14 @@ void TA_FUNC_WCLPRICE(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_WILLR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -15186,9 +14134,9 @@ void TA_FUNC_WILLR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inHigh = new double[inLength];
-    double *inLow = new double[inLength];
-    double *inClose = new double[inLength];
+    RealInput inHigh;
+    RealInput inLow;
+    RealInput inClose;
     int optTime_Period = 14;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -15197,27 +14145,25 @@ void TA_FUNC_WILLR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inHigh_JS = v8::Local<v8::Array>::Cast(info[0]);
-        v8::Local<v8::Array> inLow_JS = v8::Local<v8::Array>::Cast(info[1]);
-        v8::Local<v8::Array> inClose_JS = v8::Local<v8::Array>::Cast(info[2]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inHigh[i] = Nan::Get(inHigh_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inLow_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inClose_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inHigh.Init(info[0], "inHigh", inLength) || !inLow.Init(info[1], "inLow", inLength) || !inClose.Init(info[2], "inClose", inLength)) {
+            return;
         }
         optTime_Period = argc > 3 && info[3]->IsInt32() ?  info[3]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 4 && info[4]->IsInt32() ? info[4]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 5 && info[5]->IsInt32() ? info[5]->Int32Value(context).FromJust() : endIdx;
     } else {
-        v8::Local<v8::String> inHighName = Nan::New("High").ToLocalChecked();
-        v8::Local<v8::String> inLowName = Nan::New("Low").ToLocalChecked();
-        v8::Local<v8::String> inCloseName = Nan::New("Close").ToLocalChecked();
+        v8::Local<v8::String> inHighName = Nan::New(AddonData::From(info)->recordFields[RECORD_HIGH]);
+        v8::Local<v8::String> inLowName = Nan::New(AddonData::From(info)->recordFields[RECORD_LOW]);
+        v8::Local<v8::String> inCloseName = Nan::New(AddonData::From(info)->recordFields[RECORD_CLOSE]);
+        inHigh.Alloc(inLength);
+        inLow.Alloc(inLength);
+        inClose.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inHigh[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
-            inLow[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
-            inClose[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
+            inHigh.data[i] = Nan::Get(inObject, inHighName).ToLocalChecked()->NumberValue(context).FromJust();
+            inLow.data[i] = Nan::Get(inObject, inLowName).ToLocalChecked()->NumberValue(context).FromJust();
+            inClose.data[i] = Nan::Get(inObject, inCloseName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
@@ -15238,11 +14184,8 @@ void TA_FUNC_WILLR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_WILLR(startIdx, endIdx, inHigh, inLow, inClose, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_WILLR(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inHigh;
-        delete[] inLow;
-        delete[] inClose;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -15261,17 +14204,14 @@ void TA_FUNC_WILLR(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inHigh;
-    delete[] inLow;
-    delete[] inClose;
     delete[] outReal;
 }
 
 
 void TA_FUNC_WMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
-    v8::Local<v8::Array> inFirst = v8::Local<v8::Array>::Cast(info[0]);
-    int inLength = inFirst->Length();
+    v8::Local<v8::Object> inFirst = v8::Local<v8::Object>::Cast(info[0]);
+    int inLength = InputLength(info[0]);
     int outLength = 0;
     if (inLength == 0) {
         v8::Local<v8::Array> outAll_JS;
@@ -15284,7 +14224,7 @@ void TA_FUNC_WMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     if (Nan::Get(inFirst, 0).ToLocalChecked()->IsObject()) {
         firstIsRecord = 1;
     }
-    double *inReal = new double[inLength];
+    RealInput inReal;
     int optTime_Period = 30;
     int startIdx = 0;
     int endIdx = inLength - 1;
@@ -15293,19 +14233,19 @@ void TA_FUNC_WMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
     uint32_t i = 0;
     int argc = info.Length();
     if (firstIsRecord == 0) {
-        v8::Local<v8::Array> inReal_JS = v8::Local<v8::Array>::Cast(info[0]);
-        for (i = 0; i < (uint32_t) inLength; i++) {
-            inReal[i] = Nan::Get(inReal_JS, i).ToLocalChecked()->NumberValue(context).FromJust();
+        if (!inReal.Init(info[0], "inReal", inLength)) {
+            return;
         }
         optTime_Period = argc > 1 && info[1]->IsInt32() ?  info[1]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 2 && info[2]->IsInt32() ? info[2]->Int32Value(context).FromJust() : startIdx;
         endIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : endIdx;
     } else {
         v8::Local<v8::String> inRealName = info[1]->ToString(context).ToLocalChecked();;
+        inReal.Alloc(inLength);
         v8::Local<v8::Object> inObject;
         for (i = 0; i < (uint32_t) inLength; i++) {
             inObject = Nan::Get(inFirst, i).ToLocalChecked()->ToObject(context).ToLocalChecked();
-            inReal[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
+            inReal.data[i] = Nan::Get(inObject, inRealName).ToLocalChecked()->NumberValue(context).FromJust();
         }
         optTime_Period = argc > 2 && info[2]->IsInt32() ?  info[2]->Int32Value(context).FromJust() : optTime_Period;
         startIdx = argc > 3 && info[3]->IsInt32() ? info[3]->Int32Value(context).FromJust() : startIdx;
@@ -15326,9 +14266,8 @@ void TA_FUNC_WMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         return;
     }
     double *outReal = new double[outLength];
-    TA_RetCode result = TA_WMA(startIdx, endIdx, inReal, optTime_Period, &outBegIdx, &outNBElement, outReal);
+    TA_RetCode result = TA_WMA(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx, &outNBElement, outReal);
     if (result != TA_SUCCESS) {
-        delete[] inReal;
         delete[] outReal;
         TA_RetCodeInfo retCodeInfo;
         TA_SetRetCodeInfo(result, &retCodeInfo);
@@ -15347,178 +14286,178 @@ void TA_FUNC_WMA(const Nan::FunctionCallbackInfo<v8::Value> &info) {
         Nan::Set(outReal_JS, i, Nan::New<v8::Number>(outReal[i]));
     }
     info.GetReturnValue().Set(outAll_JS);
-    delete[] inReal;
     delete[] outReal;
 }
 
 
-void Init(v8::Local<v8::Object> exports, v8::Local<v8::Object> module) {
-    TA_RetCode retCode = TA_Initialize();
+void Init(v8::Local<v8::Object> exports) {
+    TA_RetCode retCode = talib::Initialize();
     if (retCode != TA_SUCCESS) {
         Nan::ThrowError("TA initialize failed!");
         return;
     }
-    Nan::Set(exports, Nan::New("ACCBANDS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ACCBANDS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ACOS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ACOS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("AD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AD)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ADD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADD)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ADOSC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADOSC)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ADX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ADXR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADXR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("APO").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_APO)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("AROON").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AROON)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("AROONOSC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AROONOSC)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ASIN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ASIN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ATAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ATAN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ATR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ATR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("AVGPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AVGPRICE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("AVGDEV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AVGDEV)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("BBANDS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_BBANDS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("BETA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_BETA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("BOP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_BOP)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CCI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CCI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDL2CROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL2CROWS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDL3BLACKCROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3BLACKCROWS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDL3INSIDE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3INSIDE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDL3LINESTRIKE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3LINESTRIKE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDL3OUTSIDE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3OUTSIDE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDL3STARSINSOUTH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3STARSINSOUTH)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDL3WHITESOLDIERS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3WHITESOLDIERS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLABANDONEDBABY").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLABANDONEDBABY)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLADVANCEBLOCK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLADVANCEBLOCK)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLBELTHOLD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLBELTHOLD)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLBREAKAWAY").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLBREAKAWAY)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLCLOSINGMARUBOZU").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLCLOSINGMARUBOZU)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLCONCEALBABYSWALL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLCONCEALBABYSWALL)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLCOUNTERATTACK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLCOUNTERATTACK)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLDARKCLOUDCOVER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDARKCLOUDCOVER)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDOJI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLDOJISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDOJISTAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLDRAGONFLYDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDRAGONFLYDOJI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLENGULFING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLENGULFING)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLEVENINGDOJISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLEVENINGDOJISTAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLEVENINGSTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLEVENINGSTAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLGAPSIDESIDEWHITE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLGAPSIDESIDEWHITE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLGRAVESTONEDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLGRAVESTONEDOJI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHAMMER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHAMMER)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHANGINGMAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHANGINGMAN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHARAMI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHARAMI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHARAMICROSS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHARAMICROSS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHIGHWAVE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHIGHWAVE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHIKKAKE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHIKKAKE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHIKKAKEMOD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHIKKAKEMOD)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLHOMINGPIGEON").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHOMINGPIGEON)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLIDENTICAL3CROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLIDENTICAL3CROWS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLINNECK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLINNECK)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLINVERTEDHAMMER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLINVERTEDHAMMER)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLKICKING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLKICKING)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLKICKINGBYLENGTH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLKICKINGBYLENGTH)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLLADDERBOTTOM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLLADDERBOTTOM)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLLONGLEGGEDDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLLONGLEGGEDDOJI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLLONGLINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLLONGLINE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLMARUBOZU").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMARUBOZU)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLMATCHINGLOW").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMATCHINGLOW)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLMATHOLD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMATHOLD)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLMORNINGDOJISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMORNINGDOJISTAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLMORNINGSTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMORNINGSTAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLONNECK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLONNECK)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLPIERCING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLPIERCING)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLRICKSHAWMAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLRICKSHAWMAN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLRISEFALL3METHODS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLRISEFALL3METHODS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLSEPARATINGLINES").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSEPARATINGLINES)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLSHOOTINGSTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSHOOTINGSTAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLSHORTLINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSHORTLINE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLSPINNINGTOP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSPINNINGTOP)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLSTALLEDPATTERN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSTALLEDPATTERN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLSTICKSANDWICH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSTICKSANDWICH)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLTAKURI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTAKURI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLTASUKIGAP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTASUKIGAP)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLTHRUSTING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTHRUSTING)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLTRISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTRISTAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLUNIQUE3RIVER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLUNIQUE3RIVER)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLUPSIDEGAP2CROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLUPSIDEGAP2CROWS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CDLXSIDEGAP3METHODS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLXSIDEGAP3METHODS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CEIL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CEIL)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CMO").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CMO)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("CORREL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CORREL)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("COS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_COS)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("COSH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_COSH)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("DEMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_DEMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("DIV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_DIV)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("DX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_DX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("EMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_EMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("EXP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_EXP)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("FLOOR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_FLOOR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("HT_DCPERIOD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_DCPERIOD)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("HT_DCPHASE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_DCPHASE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("HT_PHASOR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_PHASOR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("HT_SINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_SINE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("HT_TRENDLINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_TRENDLINE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("HT_TRENDMODE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_TRENDMODE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("IMI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_IMI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("KAMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_KAMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("LINEARREG").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("LINEARREG_ANGLE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG_ANGLE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("LINEARREG_INTERCEPT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG_INTERCEPT)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("LINEARREG_SLOPE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG_SLOPE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("LN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("LOG10").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LOG10)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MACD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MACD)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MACDEXT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MACDEXT)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MACDFIX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MACDFIX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MAMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MAVP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAVP)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MAX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MAXINDEX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAXINDEX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MEDPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MEDPRICE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MFI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MFI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MIDPOINT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MIDPOINT)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MIDPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MIDPRICE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MIN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MIN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MININDEX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MININDEX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MINMAX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINMAX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MINMAXINDEX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINMAXINDEX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MINUS_DI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINUS_DI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MINUS_DM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINUS_DM)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MOM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MOM)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("MULT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MULT)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("NATR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_NATR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("OBV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_OBV)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("PLUS_DI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_PLUS_DI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("PLUS_DM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_PLUS_DM)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("PPO").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_PPO)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ROC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROC)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ROCP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROCP)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ROCR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROCR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ROCR100").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROCR100)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("RSI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_RSI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SAREXT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SAREXT)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SIN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SIN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SINH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SINH)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SQRT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SQRT)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("STDDEV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STDDEV)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("STOCH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STOCH)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("STOCHF").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STOCHF)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("STOCHRSI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STOCHRSI)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SUB").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SUB)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("SUM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SUM)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("T3").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_T3)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TAN)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TANH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TANH)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TEMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TEMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TRANGE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TRANGE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TRIMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TRIMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TRIX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TRIX)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TSF").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TSF)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("TYPPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TYPPRICE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("ULTOSC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ULTOSC)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("VAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_VAR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("WCLPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_WCLPRICE)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("WILLR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_WILLR)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
-    Nan::Set(exports, Nan::New("WMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_WMA)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    v8::Local<v8::Value> data = AddonData::New();
+    Nan::Set(exports, Nan::New("ACCBANDS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ACCBANDS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ACOS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ACOS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("AD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AD, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ADD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADD, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ADOSC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADOSC, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ADX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ADXR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ADXR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("APO").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_APO, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("AROON").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AROON, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("AROONOSC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AROONOSC, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ASIN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ASIN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ATAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ATAN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ATR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ATR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("AVGPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AVGPRICE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("AVGDEV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_AVGDEV, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("BBANDS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_BBANDS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("BETA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_BETA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("BOP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_BOP, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CCI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CCI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL2CROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL2CROWS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL3BLACKCROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3BLACKCROWS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL3INSIDE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3INSIDE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL3LINESTRIKE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3LINESTRIKE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL3OUTSIDE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3OUTSIDE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL3STARSINSOUTH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3STARSINSOUTH, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL3WHITESOLDIERS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL3WHITESOLDIERS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLABANDONEDBABY").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLABANDONEDBABY, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLADVANCEBLOCK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLADVANCEBLOCK, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLBELTHOLD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLBELTHOLD, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLBREAKAWAY").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLBREAKAWAY, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLCLOSINGMARUBOZU").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLCLOSINGMARUBOZU, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLCONCEALBABYSWALL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLCONCEALBABYSWALL, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLCOUNTERATTACK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLCOUNTERATTACK, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLDARKCLOUDCOVER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDARKCLOUDCOVER, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDOJI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLDOJISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDOJISTAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLDRAGONFLYDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLDRAGONFLYDOJI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLENGULFING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLENGULFING, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLEVENINGDOJISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLEVENINGDOJISTAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLEVENINGSTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLEVENINGSTAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLGAPSIDESIDEWHITE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLGAPSIDESIDEWHITE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLGRAVESTONEDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLGRAVESTONEDOJI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHAMMER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHAMMER, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHANGINGMAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHANGINGMAN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHARAMI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHARAMI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHARAMICROSS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHARAMICROSS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHIGHWAVE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHIGHWAVE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHIKKAKE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHIKKAKE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHIKKAKEMOD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHIKKAKEMOD, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLHOMINGPIGEON").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLHOMINGPIGEON, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLIDENTICAL3CROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLIDENTICAL3CROWS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLINNECK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLINNECK, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLINVERTEDHAMMER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLINVERTEDHAMMER, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLKICKING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLKICKING, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLKICKINGBYLENGTH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLKICKINGBYLENGTH, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLLADDERBOTTOM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLLADDERBOTTOM, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLLONGLEGGEDDOJI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLLONGLEGGEDDOJI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLLONGLINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLLONGLINE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLMARUBOZU").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMARUBOZU, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLMATCHINGLOW").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMATCHINGLOW, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLMATHOLD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMATHOLD, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLMORNINGDOJISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMORNINGDOJISTAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLMORNINGSTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLMORNINGSTAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLONNECK").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLONNECK, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLPIERCING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLPIERCING, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLRICKSHAWMAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLRICKSHAWMAN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLRISEFALL3METHODS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLRISEFALL3METHODS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLSEPARATINGLINES").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSEPARATINGLINES, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLSHOOTINGSTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSHOOTINGSTAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLSHORTLINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSHORTLINE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLSPINNINGTOP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSPINNINGTOP, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLSTALLEDPATTERN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSTALLEDPATTERN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLSTICKSANDWICH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLSTICKSANDWICH, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLTAKURI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTAKURI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLTASUKIGAP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTASUKIGAP, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLTHRUSTING").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTHRUSTING, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLTRISTAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLTRISTAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLUNIQUE3RIVER").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLUNIQUE3RIVER, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLUPSIDEGAP2CROWS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLUPSIDEGAP2CROWS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDLXSIDEGAP3METHODS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDLXSIDEGAP3METHODS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CEIL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CEIL, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CMO").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CMO, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CORREL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CORREL, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("COS").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_COS, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("COSH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_COSH, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("DEMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_DEMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("DIV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_DIV, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("DX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_DX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("EMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_EMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("EXP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_EXP, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("FLOOR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_FLOOR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("HT_DCPERIOD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_DCPERIOD, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("HT_DCPHASE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_DCPHASE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("HT_PHASOR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_PHASOR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("HT_SINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_SINE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("HT_TRENDLINE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_TRENDLINE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("HT_TRENDMODE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_TRENDMODE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("IMI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_IMI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("KAMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_KAMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("LINEARREG").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("LINEARREG_ANGLE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG_ANGLE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("LINEARREG_INTERCEPT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG_INTERCEPT, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("LINEARREG_SLOPE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG_SLOPE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("LN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("LOG10").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LOG10, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MACD").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MACD, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MACDEXT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MACDEXT, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MACDFIX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MACDFIX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MAMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MAVP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAVP, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MAX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MAXINDEX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MAXINDEX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MEDPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MEDPRICE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MFI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MFI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MIDPOINT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MIDPOINT, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MIDPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MIDPRICE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MIN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MIN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MININDEX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MININDEX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MINMAX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINMAX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MINMAXINDEX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINMAXINDEX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MINUS_DI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINUS_DI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MINUS_DM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MINUS_DM, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MOM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MOM, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("MULT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_MULT, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("NATR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_NATR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("OBV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_OBV, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("PLUS_DI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_PLUS_DI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("PLUS_DM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_PLUS_DM, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("PPO").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_PPO, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ROC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROC, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ROCP").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROCP, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ROCR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROCR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ROCR100").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ROCR100, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("RSI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_RSI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SAREXT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SAREXT, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SIN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SIN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SINH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SINH, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SQRT").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SQRT, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("STDDEV").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STDDEV, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("STOCH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STOCH, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("STOCHF").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STOCHF, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("STOCHRSI").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_STOCHRSI, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SUB").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SUB, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("SUM").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_SUM, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("T3").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_T3, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TAN").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TAN, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TANH").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TANH, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TEMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TEMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TRANGE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TRANGE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TRIMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TRIMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TRIX").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TRIX, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TSF").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TSF, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("TYPPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_TYPPRICE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("ULTOSC").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_ULTOSC, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("VAR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_VAR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("WCLPRICE").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_WCLPRICE, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("WILLR").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_WILLR, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("WMA").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_WMA, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
     v8::Local<v8::Object> MATypes = Nan::New<v8::Object>();
     Nan::Set(MATypes, Nan::New("SMA").ToLocalChecked(), Nan::New<v8::Number>(0));
     Nan::Set(MATypes, Nan::New("EMA").ToLocalChecked(), Nan::New<v8::Number>(1));
@@ -15530,6 +14469,7 @@ void Init(v8::Local<v8::Object> exports, v8::Local<v8::Object> module) {
     Nan::Set(MATypes, Nan::New("MAMA").ToLocalChecked(), Nan::New<v8::Number>(7));
     Nan::Set(MATypes, Nan::New("T3").ToLocalChecked(), Nan::New<v8::Number>(8));
     Nan::Set(exports, Nan::New("MATypes").ToLocalChecked(), MATypes);
+    InitExtensions(exports, data);
 }
 
-NODE_MODULE(talib_binding, Init)
+NAN_MODULE_WORKER_ENABLED(talib_binding, Init)
@@ -2,6 +2,8 @@
  * This file is generated by generate.ts, do not edit it.
  */
 
+export * from "./talib-extensions";
+
 export declare enum MATypes {
   SMA = 0,
   EMA = 1,
@@ -26,18 +28,18 @@ export declare interface Record {
 /**
  * ACCBANDS - Acceleration Bands
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=20] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {[number[], number[], number[]]} - [outRealUpperBand, outRealMiddleBand, outRealLowerBand]
  */
 export declare function ACCBANDS(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -61,13 +63,13 @@ export declare function ACCBANDS(
 /**
  * ACOS - Vector Trigonometric ACos
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ACOS(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -90,19 +92,19 @@ export declare function ACOS(
 /**
  * AD - Chaikin A/D Line
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
- * @param {number[]} inVolume - Volume
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
+ * @param {number[] | Float64Array} inVolume - Volume
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function AD(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
-  inVolume: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
+  inVolume: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -123,15 +125,15 @@ export declare function AD(
 /**
  * ADD - Vector Arithmetic Add
  *
- * @param {number[]} inReal0 - Double Array
- * @param {number[]} inReal1 - Double Array
+ * @param {number[] | Float64Array} inReal0 - Double Array
+ * @param {number[] | Float64Array} inReal1 - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ADD(
-  inReal0: number[],
-  inReal1: number[],
+  inReal0: number[] | Float64Array,
+  inReal1: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -156,10 +158,10 @@ export declare function ADD(
 /**
  * ADOSC - Chaikin A/D Oscillator
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
- * @param {number[]} inVolume - Volume
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
+ * @param {number[] | Float64Array} inVolume - Volume
  * @param {number} [optFast_Period=3] - Number of period for the fast MA
  * @param {number} [optSlow_Period=10] - Number of period for the slow MA
  * @param {number} [startIdx=0] - The start index to process
@@ -167,10 +169,10 @@ export declare function ADD(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ADOSC(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
-  inVolume: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
+  inVolume: number[] | Float64Array,
   optFast_Period?: number,
   optSlow_Period?: number,
   startIdx?: number,
@@ -197,18 +199,18 @@ export declare function ADOSC(
 /**
  * ADX - Average Directional Movement Index
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ADX(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -232,18 +234,18 @@ export declare function ADX(
 /**
  * ADXR - Average Directional Movement Index Rating
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ADXR(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -267,7 +269,7 @@ export declare function ADXR(
 /**
  * APO - Absolute Price Oscillator
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optFast_Period=12] - Number of period for the fast MA
  * @param {number} [optSlow_Period=26] - Number of period for the slow MA
  * @param {MATypes} [optMA_Type=SMA] - Type of Moving Average
@@ -276,7 +278,7 @@ export declare function ADXR(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function APO(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optFast_Period?: number,
   optSlow_Period?: number,
   optMA_Type?: MATypes,
@@ -308,16 +310,16 @@ export declare function APO(
 /**
  * AROON - Aroon
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {[number[], number[]]} - [outAroonDown, outAroonUp]
  */
 export declare function AROON(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -341,16 +343,16 @@ export declare function AROON(
 /**
  * AROONOSC - Aroon Oscillator
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function AROONOSC(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -374,13 +376,13 @@ export declare function AROONOSC(
 /**
  * ASIN - Vector Trigonometric ASin
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ASIN(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -403,13 +405,13 @@ export declare function ASIN(
 /**
  * ATAN - Vector Trigonometric ATan
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ATAN(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -432,18 +434,18 @@ export declare function ATAN(
 /**
  * ATR - Average True Range
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ATR(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -467,19 +469,19 @@ export declare function ATR(
 /**
  * AVGPRICE - Average Price
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function AVGPRICE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -500,14 +502,14 @@ export declare function AVGPRICE(
 /**
  * AVGDEV - Average Deviation
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function AVGDEV(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -533,7 +535,7 @@ export declare function AVGDEV(
 /**
  * BBANDS - Bollinger Bands
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=5] - Number of period
  * @param {number} [optDeviations_up=2.000000e+0] - Deviation multiplier for upper band
  * @param {number} [optDeviations_down=2.000000e+0] - Deviation multiplier for lower band
@@ -543,7 +545,7 @@ export declare function AVGDEV(
  * @returns {[number[], number[], number[]]} - [outRealUpperBand, outRealMiddleBand, outRealLowerBand]
  */
 export declare function BBANDS(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   optDeviations_up?: number,
   optDeviations_down?: number,
@@ -578,16 +580,16 @@ export declare function BBANDS(
 /**
  * BETA - Beta
  *
- * @param {number[]} inReal0 - Double Array
- * @param {number[]} inReal1 - Double Array
+ * @param {number[] | Float64Array} inReal0 - Double Array
+ * @param {number[] | Float64Array} inReal1 - Double Array
  * @param {number} [optTime_Period=5] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function BETA(
-  inReal0: number[],
-  inReal1: number[],
+  inReal0: number[] | Float64Array,
+  inReal1: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -615,19 +617,19 @@ export declare function BETA(
 /**
  * BOP - Balance Of Power
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function BOP(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -648,18 +650,18 @@ export declare function BOP(
 /**
  * CCI - Commodity Channel Index
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function CCI(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -683,19 +685,19 @@ export declare function CCI(
 /**
  * CDL2CROWS - Two Crows
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDL2CROWS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -716,19 +718,19 @@ export declare function CDL2CROWS(
 /**
  * CDL3BLACKCROWS - Three Black Crows
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDL3BLACKCROWS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -749,19 +751,19 @@ export declare function CDL3BLACKCROWS(
 /**
  * CDL3INSIDE - Three Inside Up/Down
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDL3INSIDE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -782,19 +784,19 @@ export declare function CDL3INSIDE(
 /**
  * CDL3LINESTRIKE - Three-Line Strike
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDL3LINESTRIKE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -815,19 +817,19 @@ export declare function CDL3LINESTRIKE(
 /**
  * CDL3OUTSIDE - Three Outside Up/Down
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDL3OUTSIDE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -848,19 +850,19 @@ export declare function CDL3OUTSIDE(
 /**
  * CDL3STARSINSOUTH - Three Stars In The South
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDL3STARSINSOUTH(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -881,19 +883,19 @@ export declare function CDL3STARSINSOUTH(
 /**
  * CDL3WHITESOLDIERS - Three Advancing White Soldiers
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDL3WHITESOLDIERS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -914,20 +916,20 @@ export declare function CDL3WHITESOLDIERS(
 /**
  * CDLABANDONEDBABY - Abandoned Baby
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optPenetration=3.000000e-1] - Percentage of penetration of a candle within another candle
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLABANDONEDBABY(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optPenetration?: number,
   startIdx?: number,
   endIdx?: number
@@ -951,19 +953,19 @@ export declare function CDLABANDONEDBABY(
 /**
  * CDLADVANCEBLOCK - Advance Block
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLADVANCEBLOCK(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -984,19 +986,19 @@ export declare function CDLADVANCEBLOCK(
 /**
  * CDLBELTHOLD - Belt-hold
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLBELTHOLD(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1017,19 +1019,19 @@ export declare function CDLBELTHOLD(
 /**
  * CDLBREAKAWAY - Breakaway
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLBREAKAWAY(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1050,19 +1052,19 @@ export declare function CDLBREAKAWAY(
 /**
  * CDLCLOSINGMARUBOZU - Closing Marubozu
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLCLOSINGMARUBOZU(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1083,19 +1085,19 @@ export declare function CDLCLOSINGMARUBOZU(
 /**
  * CDLCONCEALBABYSWALL - Concealing Baby Swallow
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLCONCEALBABYSWALL(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1116,19 +1118,19 @@ export declare function CDLCONCEALBABYSWALL(
 /**
  * CDLCOUNTERATTACK - Counterattack
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLCOUNTERATTACK(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1149,20 +1151,20 @@ export declare function CDLCOUNTERATTACK(
 /**
  * CDLDARKCLOUDCOVER - Dark Cloud Cover
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optPenetration=5.000000e-1] - Percentage of penetration of a candle within another candle
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLDARKCLOUDCOVER(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optPenetration?: number,
   startIdx?: number,
   endIdx?: number
@@ -1186,19 +1188,19 @@ export declare function CDLDARKCLOUDCOVER(
 /**
  * CDLDOJI - Doji
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLDOJI(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1219,19 +1221,19 @@ export declare function CDLDOJI(
 /**
  * CDLDOJISTAR - Doji Star
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLDOJISTAR(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1252,19 +1254,19 @@ export declare function CDLDOJISTAR(
 /**
  * CDLDRAGONFLYDOJI - Dragonfly Doji
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLDRAGONFLYDOJI(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1285,19 +1287,19 @@ export declare function CDLDRAGONFLYDOJI(
 /**
  * CDLENGULFING - Engulfing Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLENGULFING(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1318,20 +1320,20 @@ export declare function CDLENGULFING(
 /**
  * CDLEVENINGDOJISTAR - Evening Doji Star
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optPenetration=3.000000e-1] - Percentage of penetration of a candle within another candle
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLEVENINGDOJISTAR(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optPenetration?: number,
   startIdx?: number,
   endIdx?: number
@@ -1355,20 +1357,20 @@ export declare function CDLEVENINGDOJISTAR(
 /**
  * CDLEVENINGSTAR - Evening Star
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optPenetration=3.000000e-1] - Percentage of penetration of a candle within another candle
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLEVENINGSTAR(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optPenetration?: number,
   startIdx?: number,
   endIdx?: number
@@ -1392,19 +1394,19 @@ export declare function CDLEVENINGSTAR(
 /**
  * CDLGAPSIDESIDEWHITE - Up/Down-gap side-by-side white lines
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLGAPSIDESIDEWHITE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1425,19 +1427,19 @@ export declare function CDLGAPSIDESIDEWHITE(
 /**
  * CDLGRAVESTONEDOJI - Gravestone Doji
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLGRAVESTONEDOJI(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1458,19 +1460,19 @@ export declare function CDLGRAVESTONEDOJI(
 /**
  * CDLHAMMER - Hammer
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHAMMER(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1491,19 +1493,19 @@ export declare function CDLHAMMER(
 /**
  * CDLHANGINGMAN - Hanging Man
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHANGINGMAN(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1524,19 +1526,19 @@ export declare function CDLHANGINGMAN(
 /**
  * CDLHARAMI - Harami Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHARAMI(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1557,19 +1559,19 @@ export declare function CDLHARAMI(
 /**
  * CDLHARAMICROSS - Harami Cross Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHARAMICROSS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1590,19 +1592,19 @@ export declare function CDLHARAMICROSS(
 /**
  * CDLHIGHWAVE - High-Wave Candle
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHIGHWAVE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1623,19 +1625,19 @@ export declare function CDLHIGHWAVE(
 /**
  * CDLHIKKAKE - Hikkake Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHIKKAKE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1656,19 +1658,19 @@ export declare function CDLHIKKAKE(
 /**
  * CDLHIKKAKEMOD - Modified Hikkake Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHIKKAKEMOD(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1689,19 +1691,19 @@ export declare function CDLHIKKAKEMOD(
 /**
  * CDLHOMINGPIGEON - Homing Pigeon
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLHOMINGPIGEON(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1722,19 +1724,19 @@ export declare function CDLHOMINGPIGEON(
 /**
  * CDLIDENTICAL3CROWS - Identical Three Crows
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLIDENTICAL3CROWS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1755,19 +1757,19 @@ export declare function CDLIDENTICAL3CROWS(
 /**
  * CDLINNECK - In-Neck Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLINNECK(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1788,19 +1790,19 @@ export declare function CDLINNECK(
 /**
  * CDLINVERTEDHAMMER - Inverted Hammer
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLINVERTEDHAMMER(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1821,19 +1823,19 @@ export declare function CDLINVERTEDHAMMER(
 /**
  * CDLKICKING - Kicking
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLKICKING(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1854,19 +1856,19 @@ export declare function CDLKICKING(
 /**
  * CDLKICKINGBYLENGTH - Kicking - bull/bear determined by the longer marubozu
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLKICKINGBYLENGTH(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1887,19 +1889,19 @@ export declare function CDLKICKINGBYLENGTH(
 /**
  * CDLLADDERBOTTOM - Ladder Bottom
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLLADDERBOTTOM(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1920,19 +1922,19 @@ export declare function CDLLADDERBOTTOM(
 /**
  * CDLLONGLEGGEDDOJI - Long Legged Doji
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLLONGLEGGEDDOJI(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1953,19 +1955,19 @@ export declare function CDLLONGLEGGEDDOJI(
 /**
  * CDLLONGLINE - Long Line Candle
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLLONGLINE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -1986,19 +1988,19 @@ export declare function CDLLONGLINE(
 /**
  * CDLMARUBOZU - Marubozu
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLMARUBOZU(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2019,19 +2021,19 @@ export declare function CDLMARUBOZU(
 /**
  * CDLMATCHINGLOW - Matching Low
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLMATCHINGLOW(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2052,20 +2054,20 @@ export declare function CDLMATCHINGLOW(
 /**
  * CDLMATHOLD - Mat Hold
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optPenetration=5.000000e-1] - Percentage of penetration of a candle within another candle
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLMATHOLD(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optPenetration?: number,
   startIdx?: number,
   endIdx?: number
@@ -2089,20 +2091,20 @@ export declare function CDLMATHOLD(
 /**
  * CDLMORNINGDOJISTAR - Morning Doji Star
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optPenetration=3.000000e-1] - Percentage of penetration of a candle within another candle
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLMORNINGDOJISTAR(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optPenetration?: number,
   startIdx?: number,
   endIdx?: number
@@ -2126,20 +2128,20 @@ export declare function CDLMORNINGDOJISTAR(
 /**
  * CDLMORNINGSTAR - Morning Star
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optPenetration=3.000000e-1] - Percentage of penetration of a candle within another candle
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLMORNINGSTAR(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optPenetration?: number,
   startIdx?: number,
   endIdx?: number
@@ -2163,19 +2165,19 @@ export declare function CDLMORNINGSTAR(
 /**
  * CDLONNECK - On-Neck Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLONNECK(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2196,19 +2198,19 @@ export declare function CDLONNECK(
 /**
  * CDLPIERCING - Piercing Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLPIERCING(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2229,19 +2231,19 @@ export declare function CDLPIERCING(
 /**
  * CDLRICKSHAWMAN - Rickshaw Man
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLRICKSHAWMAN(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2262,19 +2264,19 @@ export declare function CDLRICKSHAWMAN(
 /**
  * CDLRISEFALL3METHODS - Rising/Falling Three Methods
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLRISEFALL3METHODS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2295,19 +2297,19 @@ export declare function CDLRISEFALL3METHODS(
 /**
  * CDLSEPARATINGLINES - Separating Lines
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLSEPARATINGLINES(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2328,19 +2330,19 @@ export declare function CDLSEPARATINGLINES(
 /**
  * CDLSHOOTINGSTAR - Shooting Star
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLSHOOTINGSTAR(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2361,19 +2363,19 @@ export declare function CDLSHOOTINGSTAR(
 /**
  * CDLSHORTLINE - Short Line Candle
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLSHORTLINE(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2394,19 +2396,19 @@ export declare function CDLSHORTLINE(
 /**
  * CDLSPINNINGTOP - Spinning Top
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLSPINNINGTOP(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2427,19 +2429,19 @@ export declare function CDLSPINNINGTOP(
 /**
  * CDLSTALLEDPATTERN - Stalled Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLSTALLEDPATTERN(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2460,19 +2462,19 @@ export declare function CDLSTALLEDPATTERN(
 /**
  * CDLSTICKSANDWICH - Stick Sandwich
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLSTICKSANDWICH(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2493,19 +2495,19 @@ export declare function CDLSTICKSANDWICH(
 /**
  * CDLTAKURI - Takuri (Dragonfly Doji with very long lower shadow)
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLTAKURI(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2526,19 +2528,19 @@ export declare function CDLTAKURI(
 /**
  * CDLTASUKIGAP - Tasuki Gap
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLTASUKIGAP(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2559,19 +2561,19 @@ export declare function CDLTASUKIGAP(
 /**
  * CDLTHRUSTING - Thrusting Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLTHRUSTING(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2592,19 +2594,19 @@ export declare function CDLTHRUSTING(
 /**
  * CDLTRISTAR - Tristar Pattern
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLTRISTAR(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2625,19 +2627,19 @@ export declare function CDLTRISTAR(
 /**
  * CDLUNIQUE3RIVER - Unique 3 River
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLUNIQUE3RIVER(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2658,19 +2660,19 @@ export declare function CDLUNIQUE3RIVER(
 /**
  * CDLUPSIDEGAP2CROWS - Upside Gap Two Crows
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLUPSIDEGAP2CROWS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2691,19 +2693,19 @@ export declare function CDLUPSIDEGAP2CROWS(
 /**
  * CDLXSIDEGAP3METHODS - Upside/Downside Gap Three Methods
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function CDLXSIDEGAP3METHODS(
-  inOpen: number[],
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2724,13 +2726,13 @@ export declare function CDLXSIDEGAP3METHODS(
 /**
  * CEIL - Vector Ceil
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function CEIL(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2753,14 +2755,14 @@ export declare function CEIL(
 /**
  * CMO - Chande Momentum Oscillator
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function CMO(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -2786,16 +2788,16 @@ export declare function CMO(
 /**
  * CORREL - Pearson's Correlation Coefficient (r)
  *
- * @param {number[]} inReal0 - Double Array
- * @param {number[]} inReal1 - Double Array
+ * @param {number[] | Float64Array} inReal0 - Double Array
+ * @param {number[] | Float64Array} inReal1 - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function CORREL(
-  inReal0: number[],
-  inReal1: number[],
+  inReal0: number[] | Float64Array,
+  inReal1: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -2823,13 +2825,13 @@ export declare function CORREL(
 /**
  * COS - Vector Trigonometric Cos
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function COS(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2852,13 +2854,13 @@ export declare function COS(
 /**
  * COSH - Vector Trigonometric Cosh
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function COSH(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2881,14 +2883,14 @@ export declare function COSH(
 /**
  * DEMA - Double Exponential Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function DEMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -2914,15 +2916,15 @@ export declare function DEMA(
 /**
  * DIV - Vector Arithmetic Div
  *
- * @param {number[]} inReal0 - Double Array
- * @param {number[]} inReal1 - Double Array
+ * @param {number[] | Float64Array} inReal0 - Double Array
+ * @param {number[] | Float64Array} inReal1 - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function DIV(
-  inReal0: number[],
-  inReal1: number[],
+  inReal0: number[] | Float64Array,
+  inReal1: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -2947,18 +2949,18 @@ export declare function DIV(
 /**
  * DX - Directional Movement Index
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function DX(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -2982,14 +2984,14 @@ export declare function DX(
 /**
  * EMA - Exponential Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function EMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3015,13 +3017,13 @@ export declare function EMA(
 /**
  * EXP - Vector Arithmetic Exp
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function EXP(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3044,13 +3046,13 @@ export declare function EXP(
 /**
  * FLOOR - Vector Floor
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function FLOOR(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3073,13 +3075,13 @@ export declare function FLOOR(
 /**
  * HT_DCPERIOD - Hilbert Transform - Dominant Cycle Period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function HT_DCPERIOD(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3102,13 +3104,13 @@ export declare function HT_DCPERIOD(
 /**
  * HT_DCPHASE - Hilbert Transform - Dominant Cycle Phase
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function HT_DCPHASE(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3131,13 +3133,13 @@ export declare function HT_DCPHASE(
 /**
  * HT_PHASOR - Hilbert Transform - Phasor Components
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {[number[], number[]]} - [outInPhase, outQuadrature]
  */
 export declare function HT_PHASOR(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): [number[], number[]];
@@ -3160,13 +3162,13 @@ export declare function HT_PHASOR(
 /**
  * HT_SINE - Hilbert Transform - SineWave
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {[number[], number[]]} - [outSine, outLeadSine]
  */
 export declare function HT_SINE(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): [number[], number[]];
@@ -3189,13 +3191,13 @@ export declare function HT_SINE(
 /**
  * HT_TRENDLINE - Hilbert Transform - Instantaneous Trendline
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function HT_TRENDLINE(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3218,13 +3220,13 @@ export declare function HT_TRENDLINE(
 /**
  * HT_TRENDMODE - Hilbert Transform - Trend vs Cycle Mode
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function HT_TRENDMODE(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3247,16 +3249,16 @@ export declare function HT_TRENDMODE(
 /**
  * IMI - Intraday Momentum Index
  *
- * @param {number[]} inOpen - Open
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function IMI(
-  inOpen: number[],
-  inClose: number[],
+  inOpen: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3280,14 +3282,14 @@ export declare function IMI(
 /**
  * KAMA - Kaufman Adaptive Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function KAMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3313,14 +3315,14 @@ export declare function KAMA(
 /**
  * LINEARREG - Linear Regression
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function LINEARREG(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3346,14 +3348,14 @@ export declare function LINEARREG(
 /**
  * LINEARREG_ANGLE - Linear Regression Angle
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function LINEARREG_ANGLE(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3379,14 +3381,14 @@ export declare function LINEARREG_ANGLE(
 /**
  * LINEARREG_INTERCEPT - Linear Regression Intercept
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function LINEARREG_INTERCEPT(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3412,14 +3414,14 @@ export declare function LINEARREG_INTERCEPT(
 /**
  * LINEARREG_SLOPE - Linear Regression Slope
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function LINEARREG_SLOPE(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3445,13 +3447,13 @@ export declare function LINEARREG_SLOPE(
 /**
  * LN - Vector Log Natural
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function LN(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3474,13 +3476,13 @@ export declare function LN(
 /**
  * LOG10 - Vector Log10
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function LOG10(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3503,7 +3505,7 @@ export declare function LOG10(
 /**
  * MA - Moving average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {MATypes} [optMA_Type=SMA] - Type of Moving Average
  * @param {number} [startIdx=0] - The start index to process
@@ -3511,7 +3513,7 @@ export declare function LOG10(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   optMA_Type?: MATypes,
   startIdx?: number,
@@ -3540,7 +3542,7 @@ export declare function MA(
 /**
  * MACD - Moving Average Convergence/Divergence
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optFast_Period=12] - Number of period for the fast MA
  * @param {number} [optSlow_Period=26] - Number of period for the slow MA
  * @param {number} [optSignal_Period=9] - Smoothing for the signal line (nb of period)
@@ -3549,7 +3551,7 @@ export declare function MA(
  * @returns {[number[], number[], number[]]} - [outMACD, outMACDSignal, outMACDHist]
  */
 export declare function MACD(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optFast_Period?: number,
   optSlow_Period?: number,
   optSignal_Period?: number,
@@ -3581,7 +3583,7 @@ export declare function MACD(
 /**
  * MACDEXT - MACD with controllable MA type
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optFast_Period=12] - Number of period for the fast MA
  * @param {MATypes} [optFast_MA=SMA] - Type of Moving Average for fast MA
  * @param {number} [optSlow_Period=26] - Number of period for the slow MA
@@ -3593,7 +3595,7 @@ export declare function MACD(
  * @returns {[number[], number[], number[]]} - [outMACD, outMACDSignal, outMACDHist]
  */
 export declare function MACDEXT(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optFast_Period?: number,
   optFast_MA?: MATypes,
   optSlow_Period?: number,
@@ -3634,14 +3636,14 @@ export declare function MACDEXT(
 /**
  * MACDFIX - Moving Average Convergence/Divergence Fix 12/26
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optSignal_Period=9] - Smoothing for the signal line (nb of period)
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {[number[], number[], number[]]} - [outMACD, outMACDSignal, outMACDHist]
  */
 export declare function MACDFIX(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optSignal_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3667,7 +3669,7 @@ export declare function MACDFIX(
 /**
  * MAMA - MESA Adaptive Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optFast_Limit=5.000000e-1] - Upper limit use in the adaptive algorithm
  * @param {number} [optSlow_Limit=5.000000e-2] - Lower limit use in the adaptive algorithm
  * @param {number} [startIdx=0] - The start index to process
@@ -3675,7 +3677,7 @@ export declare function MACDFIX(
  * @returns {[number[], number[]]} - [outMAMA, outFAMA]
  */
 export declare function MAMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optFast_Limit?: number,
   optSlow_Limit?: number,
   startIdx?: number,
@@ -3704,8 +3706,8 @@ export declare function MAMA(
 /**
  * MAVP - Moving average with variable period
  *
- * @param {number[]} inReal - Double Array
- * @param {number[]} inPeriods - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
+ * @param {number[] | Float64Array} inPeriods - Double Array
  * @param {number} [optMinimum_Period=2] - Value less than minimum will be changed to Minimum period
  * @param {number} [optMaximum_Period=30] - Value higher than maximum will be changed to Maximum period
  * @param {MATypes} [optMA_Type=SMA] - Type of Moving Average
@@ -3714,8 +3716,8 @@ export declare function MAMA(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MAVP(
-  inReal: number[],
-  inPeriods: number[],
+  inReal: number[] | Float64Array,
+  inPeriods: number[] | Float64Array,
   optMinimum_Period?: number,
   optMaximum_Period?: number,
   optMA_Type?: MATypes,
@@ -3749,14 +3751,14 @@ export declare function MAVP(
 /**
  * MAX - Highest value over a specified period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MAX(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3782,14 +3784,14 @@ export declare function MAX(
 /**
  * MAXINDEX - Index of highest value over a specified period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function MAXINDEX(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3815,15 +3817,15 @@ export declare function MAXINDEX(
 /**
  * MEDPRICE - Median Price
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MEDPRICE(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -3844,20 +3846,20 @@ export declare function MEDPRICE(
 /**
  * MFI - Money Flow Index
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
- * @param {number[]} inVolume - Volume
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
+ * @param {number[] | Float64Array} inVolume - Volume
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MFI(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
-  inVolume: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
+  inVolume: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3881,14 +3883,14 @@ export declare function MFI(
 /**
  * MIDPOINT - MidPoint over period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MIDPOINT(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3914,16 +3916,16 @@ export declare function MIDPOINT(
 /**
  * MIDPRICE - Midpoint Price over period
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MIDPRICE(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3947,14 +3949,14 @@ export declare function MIDPRICE(
 /**
  * MIN - Lowest value over a specified period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MIN(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -3980,14 +3982,14 @@ export declare function MIN(
 /**
  * MININDEX - Index of lowest value over a specified period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outInteger (Integer Array)
  */
 export declare function MININDEX(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4013,14 +4015,14 @@ export declare function MININDEX(
 /**
  * MINMAX - Lowest and highest values over a specified period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {[number[], number[]]} - [outMin, outMax]
  */
 export declare function MINMAX(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4046,14 +4048,14 @@ export declare function MINMAX(
 /**
  * MINMAXINDEX - Indexes of lowest and highest values over a specified period
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {[number[], number[]]} - [outMinIdx, outMaxIdx]
  */
 export declare function MINMAXINDEX(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4079,18 +4081,18 @@ export declare function MINMAXINDEX(
 /**
  * MINUS_DI - Minus Directional Indicator
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MINUS_DI(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4114,16 +4116,16 @@ export declare function MINUS_DI(
 /**
  * MINUS_DM - Minus Directional Movement
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MINUS_DM(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4147,14 +4149,14 @@ export declare function MINUS_DM(
 /**
  * MOM - Momentum
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=10] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MOM(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4180,15 +4182,15 @@ export declare function MOM(
 /**
  * MULT - Vector Arithmetic Mult
  *
- * @param {number[]} inReal0 - Double Array
- * @param {number[]} inReal1 - Double Array
+ * @param {number[] | Float64Array} inReal0 - Double Array
+ * @param {number[] | Float64Array} inReal1 - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function MULT(
-  inReal0: number[],
-  inReal1: number[],
+  inReal0: number[] | Float64Array,
+  inReal1: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -4213,18 +4215,18 @@ export declare function MULT(
 /**
  * NATR - Normalized Average True Range
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function NATR(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4248,15 +4250,15 @@ export declare function NATR(
 /**
  * OBV - On Balance Volume
  *
- * @param {number[]} inReal - Double Array
- * @param {number[]} inVolume - Volume
+ * @param {number[] | Float64Array} inReal - Double Array
+ * @param {number[] | Float64Array} inVolume - Volume
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function OBV(
-  inReal: number[],
-  inVolume: number[],
+  inReal: number[] | Float64Array,
+  inVolume: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -4279,18 +4281,18 @@ export declare function OBV(
 /**
  * PLUS_DI - Plus Directional Indicator
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function PLUS_DI(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4314,16 +4316,16 @@ export declare function PLUS_DI(
 /**
  * PLUS_DM - Plus Directional Movement
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function PLUS_DM(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4347,7 +4349,7 @@ export declare function PLUS_DM(
 /**
  * PPO - Percentage Price Oscillator
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optFast_Period=12] - Number of period for the fast MA
  * @param {number} [optSlow_Period=26] - Number of period for the slow MA
  * @param {MATypes} [optMA_Type=SMA] - Type of Moving Average
@@ -4356,7 +4358,7 @@ export declare function PLUS_DM(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function PPO(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optFast_Period?: number,
   optSlow_Period?: number,
   optMA_Type?: MATypes,
@@ -4388,14 +4390,14 @@ export declare function PPO(
 /**
  * ROC - Rate of change : ((price/prevPrice)-1)*100
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=10] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ROC(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4421,14 +4423,14 @@ export declare function ROC(
 /**
  * ROCP - Rate of change Percentage: (price-prevPrice)/prevPrice
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=10] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ROCP(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4454,14 +4456,14 @@ export declare function ROCP(
 /**
  * ROCR - Rate of change ratio: (price/prevPrice)
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=10] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ROCR(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4487,14 +4489,14 @@ export declare function ROCR(
 /**
  * ROCR100 - Rate of change ratio 100 scale: (price/prevPrice)*100
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=10] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ROCR100(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4520,14 +4522,14 @@ export declare function ROCR100(
 /**
  * RSI - Relative Strength Index
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function RSI(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4553,8 +4555,8 @@ export declare function RSI(
 /**
  * SAR - Parabolic SAR
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [optAcceleration_Factor=2.000000e-2] - Acceleration Factor used up to the Maximum value
  * @param {number} [optAF_Maximum=2.000000e-1] - Acceleration Factor Maximum value
  * @param {number} [startIdx=0] - The start index to process
@@ -4562,8 +4564,8 @@ export declare function RSI(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SAR(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   optAcceleration_Factor?: number,
   optAF_Maximum?: number,
   startIdx?: number,
@@ -4590,8 +4592,8 @@ export declare function SAR(
 /**
  * SAREXT - Parabolic SAR - Extended
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
  * @param {number} [optStart_Value=0.000000e+0] - Start value and direction. 0 for Auto, >0 for Long, <0 for Short
  * @param {number} [optOffset_on_Reverse=0.000000e+0] - Percent offset added/removed to initial stop on short/long reversal
  * @param {number} [optAF_Init_Long=2.000000e-2] - Acceleration Factor initial value for the Long direction
@@ -4605,8 +4607,8 @@ export declare function SAR(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SAREXT(
-  inHigh: number[],
-  inLow: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
   optStart_Value?: number,
   optOffset_on_Reverse?: number,
   optAF_Init_Long?: number,
@@ -4651,13 +4653,13 @@ export declare function SAREXT(
 /**
  * SIN - Vector Trigonometric Sin
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SIN(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -4680,13 +4682,13 @@ export declare function SIN(
 /**
  * SINH - Vector Trigonometric Sinh
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SINH(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -4709,14 +4711,14 @@ export declare function SINH(
 /**
  * SMA - Simple Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -4742,13 +4744,13 @@ export declare function SMA(
 /**
  * SQRT - Vector Square Root
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SQRT(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -4771,7 +4773,7 @@ export declare function SQRT(
 /**
  * STDDEV - Standard Deviation
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=5] - Number of period
  * @param {number} [optDeviations=1.000000e+0] - Nb of deviations
  * @param {number} [startIdx=0] - The start index to process
@@ -4779,7 +4781,7 @@ export declare function SQRT(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function STDDEV(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   optDeviations?: number,
   startIdx?: number,
@@ -4808,9 +4810,9 @@ export declare function STDDEV(
 /**
  * STOCH - Stochastic
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optFastK_Period=5] - Time period for building the Fast-K line
  * @param {number} [optSlowK_Period=3] - Smoothing for making the Slow-K line. Usually set to 3
  * @param {MATypes} [optSlowK_MA=SMA] - Type of Moving Average for Slow-K
@@ -4821,9 +4823,9 @@ export declare function STDDEV(
  * @returns {[number[], number[]]} - [outSlowK, outSlowD]
  */
 export declare function STOCH(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optFastK_Period?: number,
   optSlowK_Period?: number,
   optSlowK_MA?: MATypes,
@@ -4859,9 +4861,9 @@ export declare function STOCH(
 /**
  * STOCHF - Stochastic Fast
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optFastK_Period=5] - Time period for building the Fast-K line
  * @param {number} [optFastD_Period=3] - Smoothing for making the Fast-D line. Usually set to 3
  * @param {MATypes} [optFastD_MA=SMA] - Type of Moving Average for Fast-D
@@ -4870,9 +4872,9 @@ export declare function STOCH(
  * @returns {[number[], number[]]} - [outFastK, outFastD]
  */
 export declare function STOCHF(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optFastK_Period?: number,
   optFastD_Period?: number,
   optFastD_MA?: MATypes,
@@ -4902,7 +4904,7 @@ export declare function STOCHF(
 /**
  * STOCHRSI - Stochastic Relative Strength Index
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [optFastK_Period=5] - Time period for building the Fast-K line
  * @param {number} [optFastD_Period=3] - Smoothing for making the Fast-D line. Usually set to 3
@@ -4912,7 +4914,7 @@ export declare function STOCHF(
  * @returns {[number[], number[]]} - [outFastK, outFastD]
  */
 export declare function STOCHRSI(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   optFastK_Period?: number,
   optFastD_Period?: number,
@@ -4947,15 +4949,15 @@ export declare function STOCHRSI(
 /**
  * SUB - Vector Arithmetic Substraction
  *
- * @param {number[]} inReal0 - Double Array
- * @param {number[]} inReal1 - Double Array
+ * @param {number[] | Float64Array} inReal0 - Double Array
+ * @param {number[] | Float64Array} inReal1 - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SUB(
-  inReal0: number[],
-  inReal1: number[],
+  inReal0: number[] | Float64Array,
+  inReal1: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -4980,14 +4982,14 @@ export declare function SUB(
 /**
  * SUM - Summation
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function SUM(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -5013,7 +5015,7 @@ export declare function SUM(
 /**
  * T3 - Triple Exponential Moving Average (T3)
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=5] - Number of period
  * @param {number} [optVolume_Factor=7.000000e-1] - Volume Factor
  * @param {number} [startIdx=0] - The start index to process
@@ -5021,7 +5023,7 @@ export declare function SUM(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function T3(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   optVolume_Factor?: number,
   startIdx?: number,
@@ -5050,13 +5052,13 @@ export declare function T3(
 /**
  * TAN - Vector Trigonometric Tan
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TAN(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -5079,13 +5081,13 @@ export declare function TAN(
 /**
  * TANH - Vector Trigonometric Tanh
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TANH(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -5108,14 +5110,14 @@ export declare function TANH(
 /**
  * TEMA - Triple Exponential Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TEMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -5141,17 +5143,17 @@ export declare function TEMA(
 /**
  * TRANGE - True Range
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TRANGE(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -5172,14 +5174,14 @@ export declare function TRANGE(
 /**
  * TRIMA - Triangular Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TRIMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -5205,14 +5207,14 @@ export declare function TRIMA(
 /**
  * TRIX - 1-day Rate-Of-Change (ROC) of a Triple Smooth EMA
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TRIX(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -5238,14 +5240,14 @@ export declare function TRIX(
 /**
  * TSF - Time Series Forecast
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TSF(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -5271,17 +5273,17 @@ export declare function TSF(
 /**
  * TYPPRICE - Typical Price
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function TYPPRICE(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -5302,9 +5304,9 @@ export declare function TYPPRICE(
 /**
  * ULTOSC - Ultimate Oscillator
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optFirst_Period=7] - Number of bars for 1st period.
  * @param {number} [optSecond_Period=14] - Number of bars fro 2nd period
  * @param {number} [optThird_Period=28] - Number of bars for 3rd period
@@ -5313,9 +5315,9 @@ export declare function TYPPRICE(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function ULTOSC(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optFirst_Period?: number,
   optSecond_Period?: number,
   optThird_Period?: number,
@@ -5345,7 +5347,7 @@ export declare function ULTOSC(
 /**
  * VAR - Variance
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=5] - Number of period
  * @param {number} [optDeviations=1.000000e+0] - Nb of deviations
  * @param {number} [startIdx=0] - The start index to process
@@ -5353,7 +5355,7 @@ export declare function ULTOSC(
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function VAR(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   optDeviations?: number,
   startIdx?: number,
@@ -5382,17 +5384,17 @@ export declare function VAR(
 /**
  * WCLPRICE - Weighted Close Price
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function WCLPRICE(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   startIdx?: number,
   endIdx?: number
 ): number[];
@@ -5413,18 +5415,18 @@ export declare function WCLPRICE(
 /**
  * WILLR - Williams' %R
  *
- * @param {number[]} inHigh - High
- * @param {number[]} inLow - Low
- * @param {number[]} inClose - Close
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
  * @param {number} [optTime_Period=14] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function WILLR(
-  inHigh: number[],
-  inLow: number[],
-  inClose: number[],
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
@@ -5448,14 +5450,14 @@ export declare function WILLR(
 /**
  * WMA - Weighted Moving Average
  *
- * @param {number[]} inReal - Double Array
+ * @param {number[] | Float64Array} inReal - Double Array
  * @param {number} [optTime_Period=30] - Number of period
  * @param {number} [startIdx=0] - The start index to process
  * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
  * @returns {number[]} - outReal (Double Array)
  */
 export declare function WMA(
-  inReal: number[],
+  inReal: number[] | Float64Array,
   optTime_Period?: number,
   startIdx?: number,
   endIdx?: number
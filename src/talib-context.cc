@@ -0,0 +1,231 @@
+/*!
+ * The settings contexts, a `Context` carries the unstable periods, the
+ * compatibility, the precision and the candle settings, `withContext` runs
+ * the TA functions of a callback with them.
+ */
+
+#include "talib-extensions.h"
+
+class ContextWrap : public Nan::ObjectWrap {
+public:
+    /**
+     * new Context() => Context
+     *
+     * The context starts with a copy of the global settings.
+     */
+    static void New(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        if (!info.IsConstructCall()) {
+            Nan::ThrowTypeError("`Context` must be called with `new`");
+            return;
+        }
+        TA_Context *context;
+        TA_RetCode retCode = TA_ContextAlloc(&context);
+        if (retCode != TA_SUCCESS) {
+            ThrowRetCode("TA_ContextAlloc", retCode);
+            return;
+        }
+        ContextWrap *wrap = new ContextWrap(context);
+        wrap->Wrap(info.This());
+        info.GetReturnValue().Set(info.This());
+    }
+
+    static ContextWrap *Unwrap(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        return Nan::ObjectWrap::Unwrap<ContextWrap>(info.This());
+    }
+
+    TA_Context *context;
+
+private:
+    explicit ContextWrap(TA_Context *context) : context(context) {}
+    ~ContextWrap() {
+        TA_ContextFree(context);
+    }
+};
+
+/**
+ * Read the integer argument at `index`, throws and returns false if it is
+ * not an integer in [0, max].
+ */
+static bool ReadEnum(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, int max, const char *name,
+                     int *value) {
+    if (info.Length() <= index || !info[index]->IsInt32()) {
+        char error[100];
+        snprintf(error, sizeof(error), "`%s` must be an integer", name);
+        Nan::ThrowTypeError(error);
+        return false;
+    }
+    *value = info[index]->Int32Value(Nan::GetCurrentContext()).FromJust();
+    if (*value < 0 || *value > max) {
+        char error[100];
+        snprintf(error, sizeof(error), "`%s` out of range", name);
+        Nan::ThrowRangeError(error);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * context.setUnstablePeriod(id: FuncUnstId, unstablePeriod: number) => void
+ */
+void TA_FUNC_Context_setUnstablePeriod(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    int id, unstablePeriod;
+    if (!ReadEnum(info, 0, TA_FUNC_UNST_ALL, "id", &id) ||
+        !ReadEnum(info, 1, 0x7fffffff, "unstablePeriod", &unstablePeriod)) {
+        return;
+    }
+    TA_ContextSetUnstablePeriod(ContextWrap::Unwrap(info)->context, (TA_FuncUnstId) id, unstablePeriod);
+}
+
+/**
+ * context.getUnstablePeriod(id: FuncUnstId) => number
+ */
+void TA_FUNC_Context_getUnstablePeriod(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    int id;
+    if (!ReadEnum(info, 0, TA_FUNC_UNST_ALL - 1, "id", &id)) {
+        return;
+    }
+    unsigned int unstablePeriod = TA_ContextGetUnstablePeriod(ContextWrap::Unwrap(info)->context, (TA_FuncUnstId) id);
+    info.GetReturnValue().Set(Nan::New<v8::Number>(unstablePeriod));
+}
+
+/**
+ * context.setCompatibility(compatibility: Compatibility) => void
+ */
+void TA_FUNC_Context_setCompatibility(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    int compatibility;
+    if (!ReadEnum(info, 0, TA_COMPATIBILITY_METASTOCK, "compatibility", &compatibility)) {
+        return;
+    }
+    TA_ContextSetCompatibility(ContextWrap::Unwrap(info)->context, (TA_Compatibility) compatibility);
+}
+
+/**
+ * context.getCompatibility() => Compatibility
+ */
+void TA_FUNC_Context_getCompatibility(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    info.GetReturnValue().Set(Nan::New<v8::Number>(TA_ContextGetCompatibility(ContextWrap::Unwrap(info)->context)));
+}
+
+/**
+ * context.setPrecision(precision: Precision) => void
+ */
+void TA_FUNC_Context_setPrecision(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    int precision;
+    if (!ReadEnum(info, 0, TA_PRECISION_COMPENSATED, "precision", &precision)) {
+        return;
+    }
+    TA_ContextSetPrecision(ContextWrap::Unwrap(info)->context, (TA_Precision) precision);
+}
+
+/**
+ * context.getPrecision() => Precision
+ */
+void TA_FUNC_Context_getPrecision(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    info.GetReturnValue().Set(Nan::New<v8::Number>(TA_ContextGetPrecision(ContextWrap::Unwrap(info)->context)));
+}
+
+/**
+ * context.setCandleSettings(settingType: CandleSettingType, rangeType: RangeType,
+ *                           avgPeriod: number, factor: number) => void
+ */
+void TA_FUNC_Context_setCandleSettings(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    int settingType, rangeType, avgPeriod;
+    if (!ReadEnum(info, 0, TA_AllCandleSettings - 1, "settingType", &settingType) ||
+        !ReadEnum(info, 1, TA_RangeType_Shadows, "rangeType", &rangeType) ||
+        !ReadEnum(info, 2, 0x7fffffff, "avgPeriod", &avgPeriod)) {
+        return;
+    }
+    if (info.Length() < 4 || !info[3]->IsNumber()) {
+        Nan::ThrowTypeError("`factor` must be a number");
+        return;
+    }
+    double factor = info[3]->NumberValue(Nan::GetCurrentContext()).FromJust();
+    TA_ContextSetCandleSettings(ContextWrap::Unwrap(info)->context, (TA_CandleSettingType) settingType,
+                                (TA_RangeType) rangeType, avgPeriod, factor);
+}
+
+/**
+ * context.restoreCandleDefaultSettings(settingType: CandleSettingType) => void
+ */
+void TA_FUNC_Context_restoreCandleDefaultSettings(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    int settingType;
+    if (!ReadEnum(info, 0, TA_AllCandleSettings, "settingType", &settingType)) {
+        return;
+    }
+    TA_ContextRestoreCandleDefaultSettings(ContextWrap::Unwrap(info)->context, (TA_CandleSettingType) settingType);
+}
+
+/**
+ * withContext<T>(context: Context, callback: () => T) => T
+ *
+ * The context is the one of the current thread during the callback, the
+ * previous one is restored after it, even if it throws.
+ */
+void TA_FUNC_withContext(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    AddonData *data = AddonData::From(info);
+    if (info.Length() < 1 || !Nan::New(data->contextTemplate)->HasInstance(info[0])) {
+        Nan::ThrowTypeError("`context` must be a `Context`");
+        return;
+    }
+    if (info.Length() < 2 || !info[1]->IsFunction()) {
+        Nan::ThrowTypeError("`callback` must be a function");
+        return;
+    }
+    v8::Local<v8::Object> contextObject = info[0].As<v8::Object>();
+    ContextWrap *wrap = Nan::ObjectWrap::Unwrap<ContextWrap>(contextObject);
+    const TA_Context *previous = TA_SetThreadContext(wrap->context);
+    Nan::MaybeLocal<v8::Value> result =
+        Nan::Call(info[1].As<v8::Function>(), Nan::GetCurrentContext()->Global(), 0, NULL);
+    TA_SetThreadContext(previous);
+    if (!result.IsEmpty()) {
+        info.GetReturnValue().Set(result.ToLocalChecked());
+    }
+}
+
+void InitContext(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    v8::Local<v8::FunctionTemplate> tpl = Nan::New<v8::FunctionTemplate>(ContextWrap::New);
+    tpl->SetClassName(Nan::New("Context").ToLocalChecked());
+    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(tpl, "setUnstablePeriod", TA_FUNC_Context_setUnstablePeriod);
+    Nan::SetPrototypeMethod(tpl, "getUnstablePeriod", TA_FUNC_Context_getUnstablePeriod);
+    Nan::SetPrototypeMethod(tpl, "setCompatibility", TA_FUNC_Context_setCompatibility);
+    Nan::SetPrototypeMethod(tpl, "getCompatibility", TA_FUNC_Context_getCompatibility);
+    Nan::SetPrototypeMethod(tpl, "setPrecision", TA_FUNC_Context_setPrecision);
+    Nan::SetPrototypeMethod(tpl, "getPrecision", TA_FUNC_Context_getPrecision);
+    Nan::SetPrototypeMethod(tpl, "setCandleSettings", TA_FUNC_Context_setCandleSettings);
+    Nan::SetPrototypeMethod(tpl, "restoreCandleDefaultSettings", TA_FUNC_Context_restoreCandleDefaultSettings);
+    static_cast<AddonData *>(data.As<v8::External>()->Value())->contextTemplate.Reset(tpl);
+    Nan::Set(exports, Nan::New("Context").ToLocalChecked(), tpl->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("withContext").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_withContext, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+
+    static const char *const funcUnstIdNames[TA_FUNC_UNST_ALL] = {
+        "ADX", "ADXR", "ATR", "CMO", "DX", "EMA", "HT_DCPERIOD", "HT_DCPHASE", "HT_PHASOR", "HT_SINE",
+        "HT_TRENDLINE", "HT_TRENDMODE", "IMI", "KAMA", "MAMA", "MFI", "MINUS_DI", "MINUS_DM", "NATR",
+        "PLUS_DI", "PLUS_DM", "RSI", "STOCHRSI", "T3",
+    };
+    v8::Local<v8::Object> FuncUnstId = Nan::New<v8::Object>();
+    for (int id = 0; id < TA_FUNC_UNST_ALL; id++) {
+        Nan::Set(FuncUnstId, Nan::New(funcUnstIdNames[id]).ToLocalChecked(), Nan::New<v8::Number>(id));
+    }
+    Nan::Set(FuncUnstId, Nan::New("ALL").ToLocalChecked(), Nan::New<v8::Number>(TA_FUNC_UNST_ALL));
+    Nan::Set(exports, Nan::New("FuncUnstId").ToLocalChecked(), FuncUnstId);
+    v8::Local<v8::Object> Compatibility = Nan::New<v8::Object>();
+    Nan::Set(Compatibility, Nan::New("Default").ToLocalChecked(), Nan::New<v8::Number>(TA_COMPATIBILITY_DEFAULT));
+    Nan::Set(Compatibility, Nan::New("Metastock").ToLocalChecked(), Nan::New<v8::Number>(TA_COMPATIBILITY_METASTOCK));
+    Nan::Set(exports, Nan::New("Compatibility").ToLocalChecked(), Compatibility);
+    static const char *const candleSettingTypeNames[TA_AllCandleSettings] = {
+        "BodyLong", "BodyVeryLong", "BodyShort", "BodyDoji", "ShadowLong", "ShadowVeryLong",
+        "ShadowShort", "ShadowVeryShort", "Near", "Far", "Equal",
+    };
+    v8::Local<v8::Object> CandleSettingType = Nan::New<v8::Object>();
+    for (int s = 0; s < TA_AllCandleSettings; s++) {
+        Nan::Set(CandleSettingType, Nan::New(candleSettingTypeNames[s]).ToLocalChecked(), Nan::New<v8::Number>(s));
+    }
+    Nan::Set(CandleSettingType, Nan::New("All").ToLocalChecked(), Nan::New<v8::Number>(TA_AllCandleSettings));
+    Nan::Set(exports, Nan::New("CandleSettingType").ToLocalChecked(), CandleSettingType);
+    v8::Local<v8::Object> RangeType = Nan::New<v8::Object>();
+    Nan::Set(RangeType, Nan::New("RealBody").ToLocalChecked(), Nan::New<v8::Number>(TA_RangeType_RealBody));
+    Nan::Set(RangeType, Nan::New("HighLow").ToLocalChecked(), Nan::New<v8::Number>(TA_RangeType_HighLow));
+    Nan::Set(RangeType, Nan::New("Shadows").ToLocalChecked(), Nan::New<v8::Number>(TA_RangeType_Shadows));
+    Nan::Set(exports, Nan::New("RangeType").ToLocalChecked(), RangeType);
+}
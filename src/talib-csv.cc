@@ -0,0 +1,73 @@
+/*!
+ * A native CSV loader, the bars are parsed by several threads straight into
+ * the `Float64Array`s which the TA functions read in place, see
+ * `talib::CsvReader`.
+ */
+
+#include "talib-extensions.h"
+
+/**
+ * readCsv(path: string, options?: {delimiter?: string, header?: boolean,
+ *         names?: string[], columns?: string[]}) => {[column: string]: Float64Array}
+ */
+void TA_FUNC_readCsv(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    if (info.Length() < 1 || !info[0]->IsString()) {
+        Nan::ThrowTypeError("`path` must be a string");
+        return;
+    }
+    talib::CsvReader::Options options;
+    if (info.Length() > 1 && info[1]->IsObject()) {
+        v8::Local<v8::Object> object = info[1].As<v8::Object>();
+        v8::Local<v8::Value> value = Nan::Get(object, Nan::New("delimiter").ToLocalChecked()).ToLocalChecked();
+        if (!value->IsUndefined()) {
+            Nan::Utf8String string(value);
+            if (!value->IsString() || string.length() != 1) {
+                Nan::ThrowTypeError("`delimiter` must be a single character");
+                return;
+            }
+            options.delimiter = (*string)[0];
+        }
+        value = Nan::Get(object, Nan::New("header").ToLocalChecked()).ToLocalChecked();
+        options.header = !value->IsFalse();
+        v8::Local<v8::Value> names = Nan::Get(object, Nan::New("names").ToLocalChecked()).ToLocalChecked();
+        v8::Local<v8::Value> columns = Nan::Get(object, Nan::New("columns").ToLocalChecked()).ToLocalChecked();
+        if ((!names->IsUndefined() && !names->IsArray()) || (!columns->IsUndefined() && !columns->IsArray())) {
+            Nan::ThrowTypeError("`names` and `columns` must be arrays of column names");
+            return;
+        }
+        for (uint32_t i = 0; names->IsArray() && i < names.As<v8::Array>()->Length(); i++) {
+            options.names.push_back(*Nan::Utf8String(Nan::Get(names.As<v8::Array>(), i).ToLocalChecked()));
+        }
+        for (uint32_t i = 0; columns->IsArray() && i < columns.As<v8::Array>()->Length(); i++) {
+            options.columns.push_back(*Nan::Utf8String(Nan::Get(columns.As<v8::Array>(), i).ToLocalChecked()));
+        }
+    }
+
+    Nan::Utf8String path(info[0]);
+    talib::CsvReader reader;
+    std::string error;
+    talib::CsvReader::Status status = reader.Open(*path, options, &error);
+    if (status != talib::CsvReader::OK) {
+        error = "readCsv: " + error;
+        if (status == talib::CsvReader::CANNOT_READ) {
+            Nan::ThrowError(error.c_str());
+        } else if (status == talib::CsvReader::NO_NAMES) {
+            Nan::ThrowTypeError(error.c_str());
+        } else {
+            Nan::ThrowRangeError(error.c_str());
+        }
+        return;
+    }
+    v8::Local<v8::Object> result = Nan::New<v8::Object>();
+    const std::vector<std::string> &columnNames = reader.ColumnNames();
+    std::vector<double *> columns(columnNames.size());
+    for (size_t c = 0; c < columnNames.size(); c++) {
+        Nan::Set(result, Nan::New(columnNames[c]).ToLocalChecked(), NewFloat64Array(reader.RowCount(), &columns[c]));
+    }
+    reader.Parse(columns.data());
+    info.GetReturnValue().Set(result);
+}
+
+void InitCsv(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    Nan::Set(exports, Nan::New("readCsv").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_readCsv, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+}
@@ -0,0 +1,2365 @@
+/*!
+ * talib_engine, see talib-engine.h.
+ */
+
+#include "talib-engine.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+
+extern "C" {
+#include "ta_utility.h"
+}
+
+// ta_utility.h defines these for the C kernels, they break the C++ headers.
+#undef min
+#undef max
+
+#ifdef _WIN32
+#include <windows.h>
+#define fseeko _fseeki64
+#define ftello _ftelli64
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace talib {
+
+static_assert(DMI_OUTPUT_COUNT == TA_DMI_NB_OUTPUT, "DMI_OUTPUT_COUNT");
+static_assert(CDL_PATTERN_COUNT == TA_CDL_NB_PATTERN, "CDL_PATTERN_COUNT");
+
+TA_RetCode Initialize() {
+    static std::once_flag once;
+    static TA_RetCode retCode = TA_SUCCESS;
+    std::call_once(once, []() { retCode = TA_Initialize(); });
+    return retCode;
+}
+
+const TA_Context *CurrentContext() {
+    const TA_Context *context = TA_SetThreadContext(NULL);
+    TA_SetThreadContext(context);
+    return context;
+}
+
+void ParallelFor(int count, int threads, const std::function<void(int)> &body) {
+    if (threads <= 0) {
+        threads = (int) std::thread::hardware_concurrency();
+    }
+    threads = std::max(1, std::min(threads, count));
+    if (threads == 1) {
+        for (int i = 0; i < count; i++) {
+            body(i);
+        }
+        return;
+    }
+    // The calls are taken in order by the threads as they get free.
+    std::atomic<int> next(0);
+    const TA_Context *context = CurrentContext();
+    auto run = [&]() {
+        for (int i = next++; i < count; i = next++) {
+            body(i);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+        workers.push_back(std::thread([&]() {
+            ScopedContext scope(context);
+            run();
+        }));
+    }
+    run();
+    for (size_t t = 0; t < workers.size(); t++) {
+        workers[t].join();
+    }
+}
+
+Function::Function() : handle(NULL), info(NULL), params(NULL) {}
+
+Function::~Function() {
+    if (params != NULL) {
+        TA_ParamHolderFree(params);
+    }
+}
+
+TA_RetCode Function::Init(const char *name) {
+    TA_RetCode retCode = TA_GetFuncHandle(name, &handle);
+    if (retCode == TA_SUCCESS) {
+        retCode = TA_GetFuncInfo(handle, &info);
+    }
+    if (retCode == TA_SUCCESS) {
+        retCode = TA_ParamHolderAlloc(handle, &params);
+    }
+    if (retCode != TA_SUCCESS) {
+        return retCode;
+    }
+    for (unsigned int p = 0; p < info->nbInput; p++) {
+        const TA_InputParameterInfo *paramInfo;
+        TA_GetInputParameterInfo(handle, p, &paramInfo);
+        if (paramInfo->type != TA_Input_Price) {
+            InputColumn column = {p, -1, NULL};
+            columns.push_back(column);
+            continue;
+        }
+        // The components of a price input, TA_IN_PRICE_OPEN to
+        // TA_IN_PRICE_OPENINTEREST.
+        for (int c = 0; c < 6; c++) {
+            if ((paramInfo->flags >> c) & 1) {
+                InputColumn column = {p, c, NULL};
+                columns.push_back(column);
+            }
+        }
+    }
+    return TA_SUCCESS;
+}
+
+bool Function::IsIntegerInput(int column) const {
+    const TA_InputParameterInfo *paramInfo;
+    TA_GetInputParameterInfo(handle, columns[column].param, &paramInfo);
+    return paramInfo->type == TA_Input_Integer;
+}
+
+int Function::OptInputCount() const {
+    return (int) info->nbOptInput;
+}
+
+int Function::OutputCount() const {
+    return (int) info->nbOutput;
+}
+
+const char *Function::OutputName(int output) const {
+    const TA_OutputParameterInfo *paramInfo;
+    TA_GetOutputParameterInfo(handle, output, &paramInfo);
+    return paramInfo->paramName;
+}
+
+bool Function::IsIntegerOutput(int output) const {
+    const TA_OutputParameterInfo *paramInfo;
+    TA_GetOutputParameterInfo(handle, output, &paramInfo);
+    return paramInfo->type == TA_Output_Integer;
+}
+
+TA_RetCode Function::SetOptInput(int index, double value) {
+    const TA_OptInputParameterInfo *paramInfo;
+    TA_RetCode retCode = TA_GetOptInputParameterInfo(handle, index, &paramInfo);
+    if (retCode != TA_SUCCESS) {
+        return retCode;
+    }
+    if (paramInfo->type == TA_OptInput_RealRange || paramInfo->type == TA_OptInput_RealList) {
+        return TA_SetOptInputParamReal(params, index, value);
+    }
+    return TA_SetOptInputParamInteger(params, index, (int) value);
+}
+
+TA_RetCode Function::Lookback(int *lookback) const {
+    return TA_GetLookback(params, lookback);
+}
+
+TA_RetCode Function::Call(int startIdx, int endIdx, void *const *outputs, int *outBegIdx, int *outNBElement) {
+    for (size_t c = 0; c < columns.size();) {
+        const InputColumn &column = columns[c];
+        TA_RetCode retCode;
+        if (column.component >= 0) {
+            const double *price[6] = {NULL, NULL, NULL, NULL, NULL, NULL};
+            for (; c < columns.size() && columns[c].param == column.param; c++) {
+                price[columns[c].component] = static_cast<const double *>(columns[c].values);
+            }
+            retCode = TA_SetInputParamPricePtr(params, column.param, price[0], price[1], price[2], price[3],
+                                               price[4], price[5]);
+        } else if (IsIntegerInput((int) c)) {
+            retCode = TA_SetInputParamIntegerPtr(params, column.param, static_cast<const int *>(column.values));
+            c++;
+        } else {
+            retCode = TA_SetInputParamRealPtr(params, column.param, static_cast<const double *>(column.values));
+            c++;
+        }
+        if (retCode != TA_SUCCESS) {
+            return retCode;
+        }
+    }
+    for (unsigned int o = 0; o < info->nbOutput; o++) {
+        TA_RetCode retCode = IsIntegerOutput(o)
+                                 ? TA_SetOutputParamIntegerPtr(params, o, static_cast<int *>(outputs[o]))
+                                 : TA_SetOutputParamRealPtr(params, o, static_cast<double *>(outputs[o]));
+        if (retCode != TA_SUCCESS) {
+            return retCode;
+        }
+    }
+    return TA_CallFunc(params, startIdx, endIdx, outBegIdx, outNBElement);
+}
+
+TA_RetCode Function::CallFull(int length, double *const *outputs) {
+    int lookback = 0;
+    TA_RetCode retCode = Lookback(&lookback);
+    if (retCode != TA_SUCCESS) {
+        return retCode;
+    }
+    for (int o = 0; o < OutputCount(); o++) {
+        std::fill(outputs[o], outputs[o] + length, NAN);
+    }
+    if (lookback >= length) {
+        return TA_SUCCESS;
+    }
+    // The integer outputs are computed in `integers` and converted, a
+    // function has at most one of them.
+    std::vector<int> integers;
+    std::vector<void *> buffers;
+    int integerOutput = -1;
+    for (int o = 0; o < OutputCount(); o++) {
+        if (IsIntegerOutput(o)) {
+            integerOutput = o;
+            integers.resize(length);
+            buffers.push_back(integers.data());
+        } else {
+            buffers.push_back(outputs[o] + lookback);
+        }
+    }
+    int outBegIdx = 0, outNBElement = 0;
+    retCode = Call(0, length - 1, buffers.data(), &outBegIdx, &outNBElement);
+    if (retCode == TA_SUCCESS && integerOutput >= 0) {
+        std::copy(integers.begin(), integers.begin() + outNBElement, outputs[integerOutput] + outBegIdx);
+    }
+    return retCode;
+}
+
+TA_RetCode MaRibbon(int startIdx, int endIdx, const double *inReal, int nbPeriod, const int *periods,
+                    TA_MAType maType, double *outReal) {
+    int outLength = endIdx - startIdx + 1;
+    std::vector<int> outBegIdx(nbPeriod > 0 ? nbPeriod : 1), outNBElement(nbPeriod > 0 ? nbPeriod : 1);
+    TA_RetCode retCode = TA_INT_MA_RIBBON(startIdx, endIdx, inReal, nbPeriod, periods, maType, outBegIdx.data(),
+                                          outNBElement.data(), outReal);
+    if (retCode != TA_SUCCESS) {
+        return retCode;
+    }
+    for (int r = 0; r < nbPeriod; r++) {
+        int lookback = outNBElement[r] == 0 ? outLength : outBegIdx[r] - startIdx;
+        for (int i = 0; i < lookback; i++) {
+            outReal[r * outLength + i] = NAN;
+        }
+    }
+    return TA_SUCCESS;
+}
+
+TA_RetCode LinearRegAll(int startIdx, int endIdx, const double *inReal, int period, int *outBegIdx,
+                        int *outNBElement, double *outLinearReg, double *outSlope, double *outAngle,
+                        double *outIntercept, double *outTSF) {
+    return TA_INT_LINEARREG(startIdx, endIdx, inReal, period, TA_LINEARREG_RESUM_PERIOD, outBegIdx, outNBElement,
+                            outLinearReg, outSlope, outAngle, outIntercept, outTSF);
+}
+
+TA_RetCode DmiAll(int startIdx, int endIdx, const double *inHigh, const double *inLow, const double *inClose,
+                  int period, int outBegIdx[DMI_OUTPUT_COUNT], int outNBElement[DMI_OUTPUT_COUNT],
+                  double *const outputs[DMI_OUTPUT_COUNT]) {
+    return TA_INT_DMI(startIdx, endIdx, inHigh, inLow, inClose, period, outBegIdx, outNBElement, outputs[0],
+                      outputs[1], outputs[2], outputs[3], outputs[4], outputs[5], outputs[6], outputs[7]);
+}
+
+TA_RetCode HtAll(int startIdx, int endIdx, const double *inReal, int unstablePeriod, int *outBegIdx,
+                 int *outNBElement, double *outDCPeriod, double *outInPhase, double *outQuadrature,
+                 double *outDCPhase, double *outSine, double *outLeadSine, double *outTrendline,
+                 int *outTrendMode) {
+    return TA_INT_HT(startIdx, endIdx, inReal, unstablePeriod, outBegIdx, outNBElement, outDCPeriod, outInPhase,
+                     outQuadrature, outDCPhase, outSine, outLeadSine, outTrendline, outTrendMode);
+}
+
+const char *const cdlPatternNames[CDL_PATTERN_COUNT] = {
+    "CDL2CROWS", "CDL3BLACKCROWS", "CDL3INSIDE", "CDL3LINESTRIKE", "CDL3OUTSIDE",
+    "CDL3STARSINSOUTH", "CDL3WHITESOLDIERS", "CDLABANDONEDBABY", "CDLADVANCEBLOCK", "CDLBELTHOLD",
+    "CDLBREAKAWAY", "CDLCLOSINGMARUBOZU", "CDLCONCEALBABYSWALL", "CDLCOUNTERATTACK",
+    "CDLDARKCLOUDCOVER", "CDLDOJI", "CDLDOJISTAR", "CDLDRAGONFLYDOJI", "CDLENGULFING",
+    "CDLEVENINGDOJISTAR", "CDLEVENINGSTAR", "CDLGAPSIDESIDEWHITE", "CDLGRAVESTONEDOJI", "CDLHAMMER",
+    "CDLHANGINGMAN", "CDLHARAMI", "CDLHARAMICROSS", "CDLHIGHWAVE", "CDLHIKKAKE", "CDLHIKKAKEMOD",
+    "CDLHOMINGPIGEON", "CDLIDENTICAL3CROWS", "CDLINNECK", "CDLINVERTEDHAMMER", "CDLKICKING",
+    "CDLKICKINGBYLENGTH", "CDLLADDERBOTTOM", "CDLLONGLEGGEDDOJI", "CDLLONGLINE", "CDLMARUBOZU",
+    "CDLMATCHINGLOW", "CDLMATHOLD", "CDLMORNINGDOJISTAR", "CDLMORNINGSTAR", "CDLONNECK",
+    "CDLPIERCING", "CDLRICKSHAWMAN", "CDLRISEFALL3METHODS", "CDLSEPARATINGLINES", "CDLSHOOTINGSTAR",
+    "CDLSHORTLINE", "CDLSPINNINGTOP", "CDLSTALLEDPATTERN", "CDLSTICKSANDWICH", "CDLTAKURI",
+    "CDLTASUKIGAP", "CDLTHRUSTING", "CDLTRISTAR", "CDLUNIQUE3RIVER", "CDLUPSIDEGAP2CROWS",
+    "CDLXSIDEGAP3METHODS",
+};
+
+int FindCdlPattern(const char *name) {
+    for (int p = 0; name != NULL && p < CDL_PATTERN_COUNT; p++) {
+        if (strcmp(name, cdlPatternNames[p]) == 0) {
+            return p;
+        }
+    }
+    return -1;
+}
+
+TA_RetCode CdlAll(int startIdx, int endIdx, const double *inOpen, const double *inHigh, const double *inLow,
+                  const double *inClose, int nbPattern, const int *patterns, double optInPenetration,
+                  int *outBegIdx, int *outNBElement, int *outInteger) {
+    return TA_INT_CDL(startIdx, endIdx, inOpen, inHigh, inLow, inClose, nbPattern, patterns,
+                      std::isnan(optInPenetration) ? TA_REAL_DEFAULT : optInPenetration, outBegIdx, outNBElement,
+                      outInteger);
+}
+
+
+// The minimum size of the chunk of a thread, smaller files are parsed by
+// fewer threads.
+static const size_t csvMinChunkSize = 1 << 20;
+
+static const double csvPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+ * Parse a decimal number at `p`, returns the end of the number or `p` if
+ * there is none. The value is exact when the digits fit in a double and the
+ * exponent is small, as for prices and volumes, otherwise strtod is used.
+ */
+static const char *ParseNumber(const char *p, const char *end, double *value) {
+    const char *start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    uint64_t mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool any = false;
+    for (; p < end && (unsigned) (*p - '0') < 10; p++) {
+        any = true;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            digits += mantissa != 0;
+        } else {
+            exponent++;
+            digits++;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && (unsigned) (*p - '0') < 10; p++) {
+            any = true;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                digits += mantissa != 0;
+                exponent--;
+            } else {
+                digits++;
+            }
+        }
+    }
+    if (!any) {
+        return start;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negativeExponent = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            negativeExponent = *q == '-';
+            q++;
+        }
+        if (q < end && (unsigned) (*q - '0') < 10) {
+            int e = 0;
+            for (; q < end && (unsigned) (*q - '0') < 10; q++) {
+                e = e < 10000 ? e * 10 + (*q - '0') : e;
+            }
+            exponent += negativeExponent ? -e : e;
+            p = q;
+        }
+    }
+    if (digits <= 19 && mantissa <= (UINT64_C(1) << 53) && exponent >= -22 && exponent <= 22) {
+        double v = (double) mantissa;
+        v = exponent < 0 ? v / csvPow10[-exponent] : v * csvPow10[exponent];
+        *value = negative ? -v : v;
+    } else {
+        *value = strtod(std::string(start, p).c_str(), NULL);
+    }
+    return p;
+}
+
+static int ParseDigits(const char *&p, const char *end, int count) {
+    int value = 0;
+    for (int i = 0; i < count; i++, p++) {
+        if (p >= end || (unsigned) (*p - '0') >= 10) {
+            return -1;
+        }
+        value = value * 10 + (*p - '0');
+    }
+    return value;
+}
+
+/**
+ * Parse a date `YYYY-MM-DD`, optionally followed by `[T ]HH:MM[:SS[.fff]][Z]`,
+ * as the UTC milliseconds since the epoch. Returns the end of the date or
+ * `p` if there is none.
+ */
+static const char *ParseDate(const char *p, const char *end, double *value) {
+    const char *start = p;
+    int year = ParseDigits(p, end, 4);
+    if (year < 0 || p >= end || *p++ != '-') {
+        return start;
+    }
+    int month = ParseDigits(p, end, 2);
+    if (month < 1 || month > 12 || p >= end || *p++ != '-') {
+        return start;
+    }
+    int day = ParseDigits(p, end, 2);
+    if (day < 1 || day > 31) {
+        return start;
+    }
+    double millis = 0;
+    if (p + 1 < end && (*p == 'T' || *p == ' ') && (unsigned) (p[1] - '0') < 10) {
+        const char *q = p + 1;
+        int hours = ParseDigits(q, end, 2);
+        if (hours >= 0 && q < end && *q++ == ':') {
+            int minutes = ParseDigits(q, end, 2);
+            if (minutes >= 0) {
+                millis = (hours * 60 + minutes) * 60000.0;
+                p = q;
+                if (q < end && *q++ == ':') {
+                    int seconds = ParseDigits(q, end, 2);
+                    if (seconds >= 0) {
+                        millis += seconds * 1000.0;
+                        p = q;
+                        if (q < end && *q == '.') {
+                            double scale = 100;
+                            for (q++; q < end && (unsigned) (*q - '0') < 10; q++, scale /= 10) {
+                                millis += (*q - '0') * scale;
+                            }
+                            p = q;
+                        }
+                    }
+                }
+                if (p < end && *p == 'Z') {
+                    p++;
+                }
+            }
+        }
+    }
+    // The days since the epoch of the proleptic Gregorian calendar.
+    int y = month <= 2 ? year - 1 : year;
+    int era = y / 400;
+    int yearOfEra = y - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    double days = era * 146097.0 + dayOfEra - 719468;
+    *value = days * 86400000.0 + millis;
+    return p;
+}
+
+/**
+ * Parse the field at `p` of a line ending at `end`, returns the end of the
+ * field: the delimiter or `end`.
+ */
+static const char *ParseField(const char *p, const char *end, char delimiter, double *value) {
+    while (p < end && *p == ' ') {
+        p++;
+    }
+    const char *q = ParseDate(p, end, value);
+    if (q == p) {
+        q = ParseNumber(p, end, value);
+    }
+    while (q < end && *q == ' ') {
+        q++;
+    }
+    if (q == p || (q < end && *q != delimiter)) {
+        *value = NAN;
+        q = static_cast<const char *>(memchr(q, delimiter, end - q));
+        return q != NULL ? q : end;
+    }
+    return q;
+}
+
+/**
+ * The end of the line at `p`, without the `\r` of a `\r\n`.
+ */
+static const char *LineEnd(const char *p, const char *end, const char **next) {
+    const char *q = static_cast<const char *>(memchr(p, '\n', end - p));
+    *next = q != NULL ? q + 1 : end;
+    q = q != NULL ? q : end;
+    return q > p && q[-1] == '\r' ? q - 1 : q;
+}
+
+static int CountRows(const char *p, const char *end) {
+    int rows = 0;
+    while (p < end) {
+        const char *next;
+        rows += LineEnd(p, end, &next) > p;
+        p = next;
+    }
+    return rows;
+}
+
+
+static void ParseRows(const char *p, const char *chunkEnd, int row, char delimiter, const int *fieldColumns,
+                      int nbField, double *const *columns) {
+    while (p < chunkEnd) {
+        const char *next;
+        const char *end = LineEnd(p, chunkEnd, &next);
+        if (end > p) {
+            int field = 0;
+            for (; field < nbField && p <= end; field++, p++) {
+                if (fieldColumns[field] >= 0) {
+                    double value = NAN;
+                    p = ParseField(p, end, delimiter, &value);
+                    columns[fieldColumns[field]][row] = value;
+                } else {
+                    const char *q = static_cast<const char *>(memchr(p, delimiter, end - p));
+                    p = q != NULL ? q : end;
+                }
+            }
+            for (; field < nbField; field++) {
+                if (fieldColumns[field] >= 0) {
+                    columns[fieldColumns[field]][row] = NAN;
+                }
+            }
+            row++;
+        }
+        p = next;
+    }
+}
+
+static bool ReadFile(const char *path, std::vector<char> *content) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    bool ok = fseeko(file, 0, SEEK_END) == 0;
+    int64_t size = ftello(file);
+    ok = ok && size >= 0 && fseeko(file, 0, SEEK_SET) == 0;
+    if (ok) {
+        content->resize((size_t) size);
+        ok = fread(content->data(), 1, content->size(), file) == content->size();
+    }
+    fclose(file);
+    return ok;
+}
+
+CsvReader::Status CsvReader::Open(const char *path, const Options &options, std::string *error) {
+    char message[300];
+    content.clear();
+    if (!ReadFile(path, &content)) {
+        snprintf(message, sizeof(message), "cannot read `%s`: %s", path, strerror(errno));
+        *error = message;
+        return CANNOT_READ;
+    }
+    delimiter = options.delimiter;
+    const char *data = content.data();
+    const char *begin = data;
+    const char *end = begin + content.size();
+
+    // The names of the fields, from the header or from `names`.
+    std::vector<std::string> fields;
+    if (options.header) {
+        const char *next;
+        const char *lineEnd = LineEnd(begin, end, &next);
+        for (const char *p = begin; lineEnd > begin && p <= lineEnd; p++) {
+            const char *q = static_cast<const char *>(memchr(p, delimiter, lineEnd - p));
+            q = q != NULL ? q : lineEnd;
+            const char *a = p, *b = q;
+            while (a < b && (*a == ' ' || *a == '"')) {
+                a++;
+            }
+            while (b > a && (b[-1] == ' ' || b[-1] == '"')) {
+                b--;
+            }
+            fields.push_back(std::string(a, b));
+            p = q;
+        }
+        begin = next;
+    }
+    if (!options.names.empty()) {
+        fields = options.names;
+    }
+    if (fields.empty()) {
+        *error = "`names` is required without a header";
+        return NO_NAMES;
+    }
+
+    // The fields to keep, all of them by default.
+    int nbField = (int) fields.size();
+    fieldColumns.assign(nbField, -1);
+    columnNames.clear();
+    if (!options.columns.empty()) {
+        for (size_t c = 0; c < options.columns.size(); c++) {
+            const std::string &name = options.columns[c];
+            int field = (int) (std::find(fields.begin(), fields.end(), name) - fields.begin());
+            if (field == nbField) {
+                snprintf(message, sizeof(message), "`%s` has no column `%s`", path, name.c_str());
+                *error = message;
+                return NO_COLUMN;
+            }
+            fieldColumns[field] = (int) columnNames.size();
+            columnNames.push_back(name);
+        }
+    } else {
+        for (int f = 0; f < nbField; f++) {
+            fieldColumns[f] = f;
+        }
+        columnNames = fields;
+    }
+
+    // Split the rows in chunks starting at the start of a line and count the
+    // rows of each chunk, `Parse` parses them at their position in the
+    // columns.
+    size_t size = end - begin;
+    size_t nbThread = options.threads > 0 ? options.threads : std::thread::hardware_concurrency();
+    nbThread = std::max<size_t>(1, std::min<size_t>(nbThread, size / csvMinChunkSize));
+    chunks.clear();
+    for (size_t t = 0; t < nbThread; t++) {
+        const char *chunkBegin = chunks.empty() ? begin : data + chunks.back().end;
+        const char *chunkEnd = t + 1 == nbThread ? end : begin + size * (t + 1) / nbThread;
+        if (chunkEnd <= chunkBegin) {
+            chunkEnd = chunkBegin;
+        } else if (chunkEnd < end && chunkEnd[-1] != '\n') {
+            const char *newline = static_cast<const char *>(memchr(chunkEnd, '\n', end - chunkEnd));
+            chunkEnd = newline != NULL ? newline + 1 : end;
+        }
+        Chunk chunk = {(size_t) (chunkBegin - data), (size_t) (chunkEnd - data), 0, 0};
+        chunks.push_back(chunk);
+    }
+    ParallelFor((int) chunks.size(), (int) chunks.size(), [this, data](int t) {
+        chunks[t].rows = CountRows(data + chunks[t].begin, data + chunks[t].end);
+    });
+    int64_t rows = 0;
+    for (size_t t = 0; t < chunks.size(); t++) {
+        chunks[t].row = (int) rows;
+        rows += chunks[t].rows;
+    }
+    if (rows > 0x7fffffff) {
+        snprintf(message, sizeof(message), "`%s` has too many rows", path);
+        *error = message;
+        return TOO_MANY_ROWS;
+    }
+    rowCount = (int) rows;
+    return OK;
+}
+
+void CsvReader::Parse(double *const *columns) const {
+    const char *data = content.data();
+    ParallelFor((int) chunks.size(), (int) chunks.size(), [&](int t) {
+        ParseRows(data + chunks[t].begin, data + chunks[t].end, chunks[t].row, delimiter, fieldColumns.data(),
+                  (int) fieldColumns.size(), columns);
+    });
+}
+
+static const char seriesMagic[8] = {'T', 'A', 'S', 'E', 'R', 'I', 'E', 'S'};
+static const size_t seriesHeaderSize = 32;
+
+SeriesFile *SeriesFile::Open(const char *path, std::string *error) {
+    char message[300];
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        snprintf(message, sizeof(message), "cannot open `%s`: error %lu", path, GetLastError());
+        *error = message;
+        return NULL;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG) seriesHeaderSize) {
+        CloseHandle(file);
+        snprintf(message, sizeof(message), "`%s` is not a series file", path);
+        *error = message;
+        return NULL;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);
+    void *address = mapping ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : NULL;
+    if (address == NULL) {
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        snprintf(message, sizeof(message), "cannot map `%s`: error %lu", path, GetLastError());
+        *error = message;
+        return NULL;
+    }
+    SeriesFile *series = new SeriesFile();
+    series->mapping = mapping;
+    series->size = (size_t) fileSize.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        snprintf(message, sizeof(message), "cannot open `%s`: %s", path, strerror(errno));
+        *error = message;
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) seriesHeaderSize) {
+        close(fd);
+        snprintf(message, sizeof(message), "`%s` is not a series file", path);
+        *error = message;
+        return NULL;
+    }
+    void *address = mmap(NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        snprintf(message, sizeof(message), "cannot map `%s`: %s", path, strerror(errno));
+        *error = message;
+        return NULL;
+    }
+    // The TA functions read the columns from the start to the end.
+    madvise(address, (size_t) st.st_size, MADV_SEQUENTIAL);
+    SeriesFile *series = new SeriesFile();
+    series->mapping = NULL;
+    series->size = (size_t) st.st_size;
+#endif
+    series->address = address;
+    series->refs = 1;
+
+    const char *header = static_cast<const char *>(address);
+    uint64_t columns, rows;
+    memcpy(&columns, header + 8, sizeof(columns));
+    memcpy(&rows, header + 16, sizeof(rows));
+    if (memcmp(header, seriesMagic, sizeof(seriesMagic)) != 0 || rows > 0x7fffffff ||
+        (rows > 0 && columns > (series->size - seriesHeaderSize) / sizeof(double) / rows) ||
+        (rows == 0 && columns > 0x7fffffff)) {
+        series->Release();
+        snprintf(message, sizeof(message), "`%s` is not a series file", path);
+        *error = message;
+        return NULL;
+    }
+    series->columnCount = (int) columns;
+    series->rowCount = (int) rows;
+    return series;
+}
+
+double *SeriesFile::Column(int column) const {
+    return reinterpret_cast<double *>(static_cast<char *>(address) + seriesHeaderSize) + (size_t) column * rowCount;
+}
+
+void SeriesFile::Release() {
+    if (--refs == 0) {
+        delete this;
+    }
+}
+
+SeriesFile::~SeriesFile() {
+#ifdef _WIN32
+    UnmapViewOfFile(address);
+    CloseHandle((HANDLE) mapping);
+#else
+    munmap(address, size);
+#endif
+}
+
+bool WriteSeriesFile(const char *path, const double *const *columns, int columnCount, int rowCount,
+                     std::string *error) {
+    char message[300];
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        snprintf(message, sizeof(message), "cannot write `%s`: %s", path, strerror(errno));
+        *error = message;
+        return false;
+    }
+    char header[seriesHeaderSize] = {0};
+    uint64_t columns64 = (uint64_t) columnCount, rows64 = (uint64_t) rowCount;
+    memcpy(header, seriesMagic, sizeof(seriesMagic));
+    memcpy(header + 8, &columns64, sizeof(columns64));
+    memcpy(header + 16, &rows64, sizeof(rows64));
+    bool ok = fwrite(header, 1, seriesHeaderSize, file) == seriesHeaderSize;
+    for (int c = 0; ok && c < columnCount; c++) {
+        ok = fwrite(columns[c], sizeof(double), (size_t) rowCount, file) == (size_t) rowCount;
+    }
+    ok = fclose(file) == 0 && ok;
+    if (!ok) {
+        snprintf(message, sizeof(message), "cannot write `%s`: %s", path, strerror(errno));
+        *error = message;
+    }
+    return ok;
+}
+
+void Bars::Add(double time, double open, double high, double low, double close, double volume) {
+    this->time.push_back(time);
+    this->open.push_back(open);
+    this->high.push_back(high);
+    this->low.push_back(low);
+    this->close.push_back(close);
+    this->volume.push_back(volume);
+}
+
+void BarAggregator::Add(const double *price, const double *size, const double *time, int count, Bars *bars) {
+    for (int i = 0; i < count; i++) {
+        if (std::isnan(price[i])) {
+            continue;
+        }
+        // A time bar ends with the first trade of a later interval, the
+        // trades out of order stay in the current bar.
+        if (type == TIME && trades > 0 && time[i] >= end) {
+            Close(bars);
+        }
+        if (trades == 0) {
+            this->time = time[i];
+            if (type == TIME) {
+                this->time = std::floor(time[i] / barSize) * barSize;
+                end = this->time + barSize;
+            }
+            open = high = low = price[i];
+            volume = amount = 0;
+        }
+        trades++;
+        high = std::max(high, price[i]);
+        low = std::min(low, price[i]);
+        close = price[i];
+        volume += size[i];
+        amount += price[i] * size[i];
+        if ((type == TICK && trades >= barSize) || (type == VOLUME && volume >= barSize) ||
+            (type == DOLLAR && amount >= barSize)) {
+            Close(bars);
+        }
+    }
+}
+
+bool BarAggregator::Flush(Bars *bars) {
+    if (trades == 0) {
+        return false;
+    }
+    Close(bars);
+    return true;
+}
+
+void BarAggregator::Close(Bars *bars) {
+    bars->Add(time, open, high, low, close, volume);
+    trades = 0;
+}
+
+MultiTimeframe::MultiTimeframe(double baseInterval) {
+    AddTimeframe(baseInterval);
+}
+
+int MultiTimeframe::AddTimeframe(double interval) {
+    Timeframe timeframe;
+    timeframe.interval = interval;
+    timeframe.building = false;
+    timeframe.time = timeframe.open = timeframe.high = timeframe.low = timeframe.close = timeframe.volume = 0;
+    timeframes.push_back(timeframe);
+    return (int) timeframes.size() - 1;
+}
+
+int MultiTimeframe::FindTimeframe(double interval) const {
+    for (size_t t = 0; t < timeframes.size(); t++) {
+        if (timeframes[t].interval == interval) {
+            return (int) t;
+        }
+    }
+    return -1;
+}
+
+const char *const BarStore::columnNames[BarStore::COLUMN_COUNT] = {"time", "open", "high", "low", "close", "volume"};
+
+static const std::vector<double> &BarColumn(const Bars &bars, int column) {
+    const std::vector<double> *columns[] = {&bars.time, &bars.open, &bars.high, &bars.low, &bars.close, &bars.volume};
+    return *columns[column];
+}
+
+/**
+ * Init `function` as the indicator `name` over the bar columns `inputs`,
+ * see `MultiTimeframe::AddIndicator`, `columns` is set to the indexes of the
+ * columns. Returns false and sets `error` if it is invalid.
+ */
+static bool InitIndicator(Function &function, const char *name, const std::vector<std::string> &inputs,
+                          const std::vector<double> &optInputs, std::vector<int> *columns, std::string *error) {
+    char message[300];
+    if (function.Init(name) != TA_SUCCESS) {
+        snprintf(message, sizeof(message), "unknown function `%s`", name);
+        *error = message;
+        return false;
+    }
+    if ((int) inputs.size() != function.InputColumnCount()) {
+        snprintf(message, sizeof(message), "%s takes %d input columns", name, function.InputColumnCount());
+        *error = message;
+        return false;
+    }
+    if ((int) optInputs.size() > function.OptInputCount()) {
+        snprintf(message, sizeof(message), "%s takes %d optional inputs", name, function.OptInputCount());
+        *error = message;
+        return false;
+    }
+    for (size_t c = 0; c < inputs.size(); c++) {
+        int column = 0;
+        while (column < BarStore::COLUMN_COUNT && inputs[c] != BarStore::columnNames[column]) {
+            column++;
+        }
+        if (column == BarStore::COLUMN_COUNT || function.IsIntegerInput((int) c)) {
+            snprintf(message, sizeof(message), "invalid input `%s` of %s", inputs[c].c_str(), name);
+            *error = message;
+            return false;
+        }
+        columns->push_back(column);
+    }
+    for (size_t o = 0; o < optInputs.size(); o++) {
+        if (!std::isnan(optInputs[o]) && function.SetOptInput((int) o, optInputs[o]) != TA_SUCCESS) {
+            snprintf(message, sizeof(message), "invalid optional input %g of %s", optInputs[o], name);
+            *error = message;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * The name of the output `o` of an indicator, `label` or `label.outputName`.
+ */
+static std::string IndicatorOutputName(const Function &function, const std::string &label, int output) {
+    return function.OutputCount() == 1 ? label : label + "." + function.OutputName(output);
+}
+
+bool MultiTimeframe::AddIndicator(int timeframe, const std::string &label, const char *name,
+                                  const std::vector<std::string> &inputs, const std::vector<double> &optInputs,
+                                  std::string *error) {
+    Function function;
+    Indicator indicator;
+    if (!InitIndicator(function, name, inputs, optInputs, &indicator.inputs, error)) {
+        return false;
+    }
+    indicator.label = label;
+    indicator.name = name;
+    indicator.optInputs = optInputs;
+    timeframes[timeframe].indicators.push_back(indicator);
+    return true;
+}
+
+void MultiTimeframe::Complete(Timeframe &timeframe, int baseIndex) {
+    timeframe.bars.Add(timeframe.time, timeframe.open, timeframe.high, timeframe.low, timeframe.close,
+                       timeframe.volume);
+    timeframe.completedAt.push_back(baseIndex);
+    timeframe.building = false;
+}
+
+void MultiTimeframe::Append(const double *time, const double *open, const double *high, const double *low,
+                            const double *close, const double *volume, int count) {
+    double baseInterval = timeframes[0].interval;
+    for (int i = 0; i < count; i++) {
+        int baseIndex = timeframes[0].bars.Size();
+        timeframes[0].bars.Add(time[i], open[i], high[i], low[i], close[i], volume[i]);
+        timeframes[0].completedAt.push_back(baseIndex);
+        for (size_t t = 1; t < timeframes.size(); t++) {
+            Timeframe &timeframe = timeframes[t];
+            double start = std::floor(time[i] / timeframe.interval) * timeframe.interval;
+            if (timeframe.building && start > timeframe.time) {
+                // A gap, the bar was not completed by its last base bar.
+                Complete(timeframe, baseIndex);
+            }
+            if (!timeframe.building) {
+                timeframe.building = true;
+                timeframe.time = start;
+                timeframe.open = open[i];
+                timeframe.high = high[i];
+                timeframe.low = low[i];
+                timeframe.volume = 0;
+            }
+            timeframe.high = std::max(timeframe.high, high[i]);
+            timeframe.low = std::min(timeframe.low, low[i]);
+            timeframe.close = close[i];
+            timeframe.volume += volume[i];
+            if (time[i] + baseInterval >= timeframe.time + timeframe.interval) {
+                Complete(timeframe, baseIndex);
+            }
+        }
+    }
+}
+
+TA_RetCode MultiTimeframe::Evaluate(int timeframe, bool forwardFill, std::vector<std::string> *names,
+                                    std::vector<std::vector<double> > *outputs) const {
+    const Timeframe &frame = timeframes[timeframe];
+    int length = frame.bars.Size();
+    int baseLength = timeframes[0].bars.Size();
+    std::vector<double> values;
+    std::vector<double *> buffers;
+    for (size_t i = 0; i < frame.indicators.size(); i++) {
+        const Indicator &indicator = frame.indicators[i];
+        Function function;
+        TA_RetCode retCode = function.Init(indicator.name.c_str());
+        for (size_t c = 0; retCode == TA_SUCCESS && c < indicator.inputs.size(); c++) {
+            function.SetInput((int) c, BarColumn(frame.bars, indicator.inputs[c]).data());
+        }
+        for (size_t o = 0; retCode == TA_SUCCESS && o < indicator.optInputs.size(); o++) {
+            if (!std::isnan(indicator.optInputs[o])) {
+                retCode = function.SetOptInput((int) o, indicator.optInputs[o]);
+            }
+        }
+        int outputCount = retCode == TA_SUCCESS ? function.OutputCount() : 0;
+        values.resize((size_t) outputCount * length);
+        buffers.clear();
+        for (int o = 0; o < outputCount; o++) {
+            buffers.push_back(values.data() + (size_t) o * length);
+        }
+        if (retCode == TA_SUCCESS && length > 0) {
+            retCode = function.CallFull(length, buffers.data());
+        }
+        if (retCode != TA_SUCCESS) {
+            return retCode;
+        }
+        for (int o = 0; o < outputCount; o++) {
+            names->push_back(IndicatorOutputName(function, indicator.label, o));
+            if (!forwardFill || timeframe == 0) {
+                outputs->push_back(std::vector<double>(buffers[o], buffers[o] + length));
+                continue;
+            }
+            // The bar b holds from the base bar completing it to the one
+            // before the base bar completing the next bar.
+            std::vector<double> column(baseLength, NAN);
+            for (int b = 0; b < length; b++) {
+                int end = b + 1 < length ? frame.completedAt[b + 1] : baseLength;
+                std::fill(column.begin() + frame.completedAt[b], column.begin() + end, buffers[o][b]);
+            }
+            outputs->push_back(column);
+        }
+    }
+    return TA_SUCCESS;
+}
+
+/**
+ * The column of a bar of `Stream` which receives the input `input` of a
+ * function of `inputCount` inputs: the close for one, the high and the low
+ * for two, the high, the low and the close for three.
+ */
+static BarStore::Column StreamColumn(size_t inputCount, size_t input) {
+    static const BarStore::Column columns[3][3] = {{BarStore::CLOSE},
+                                                  {BarStore::HIGH, BarStore::LOW},
+                                                  {BarStore::HIGH, BarStore::LOW, BarStore::CLOSE}};
+    return columns[inputCount - 1][input];
+}
+
+/**
+ * The functions whose value depends on all the bars before, besides the ones
+ * with an unstable period.
+ */
+static const char *const cumulativeFunctions[] = {"AD", "ADOSC", "DEMA", "MACD", "MACDFIX", "OBV",
+                                                  "SAR", "SAREXT", "TEMA", "TRIX"};
+
+/**
+ * Whether the function `name` with `optInputs` depends on all the bars
+ * before, so that its newest value cannot be evaluated from the bars of its
+ * lookback: it has an unstable period, it is cumulative, or one of its moving
+ * averages is not an SMA, a WMA or a TRIMA.
+ */
+static bool IsRecursiveFunction(const char *name, const std::vector<double> &optInputs) {
+    const TA_FuncHandle *handle;
+    const TA_FuncInfo *info;
+    if (TA_GetFuncHandle(name, &handle) != TA_SUCCESS || TA_GetFuncInfo(handle, &info) != TA_SUCCESS) {
+        return false;
+    }
+    if (info->flags & TA_FUNC_FLG_UNST_PER) {
+        return true;
+    }
+    for (size_t f = 0; f < sizeof(cumulativeFunctions) / sizeof(cumulativeFunctions[0]); f++) {
+        if (strcmp(name, cumulativeFunctions[f]) == 0) {
+            return true;
+        }
+    }
+    for (unsigned int o = 0; o < info->nbOptInput; o++) {
+        const TA_OptInputParameterInfo *paramInfo;
+        TA_GetOptInputParameterInfo(handle, o, &paramInfo);
+        if (strstr(paramInfo->paramName, "MAType") == NULL) {
+            continue;
+        }
+        int maType = o < optInputs.size() && !std::isnan(optInputs[o]) ? (int) optInputs[o]
+                                                                        : (int) paramInfo->defaultValue;
+        if (maType != TA_MAType_SMA && maType != TA_MAType_WMA && maType != TA_MAType_TRIMA) {
+            return true;
+        }
+    }
+    return false;
+}
+
+BarStore::BarStore(int capacity, int maxSymbols)
+    : capacity(capacity), maxSymbols(maxSymbols), values((size_t) maxSymbols * COLUMN_COUNT * capacity) {
+    symbols.reserve(maxSymbols);
+}
+
+BarStore::~BarStore() {}
+
+bool BarStore::AddIndicator(const std::string &label, const char *name, const std::vector<std::string> &inputs,
+                            const std::vector<double> &optInputs, std::string *error) {
+    Indicator indicator;
+    indicator.function.reset(new Function());
+    if (!InitIndicator(*indicator.function, name, inputs, optInputs, &indicator.inputs, error)) {
+        return false;
+    }
+    int stream = 0;
+    while (stream < STREAM_COUNT && strcmp(name, streamNames[stream]) != 0) {
+        stream++;
+    }
+    if (stream < STREAM_COUNT) {
+        std::unique_ptr<Stream> prototype(Stream::Create(name, optInputs, error));
+        if (!prototype) {
+            return false;
+        }
+        prototype->Save(&indicator.streamState);
+        // The symbols which already have bars start from their buffers.
+        std::vector<double> columns((size_t) COLUMN_COUNT * capacity);
+        std::vector<double> ignored(capacity);
+        for (size_t s = 0; s < symbols.size(); s++) {
+            const double *data[COLUMN_COUNT] = {NULL, NULL, NULL, NULL, NULL, NULL};
+            for (size_t c = 0; c < indicator.inputs.size(); c++) {
+                double *column = &columns[c * capacity];
+                Last((int) s, (Column) indicator.inputs[c], symbols[s].size, column);
+                data[StreamColumn(indicator.inputs.size(), c)] = column;
+            }
+            indicator.streams.push_back(std::unique_ptr<Stream>(
+                Stream::Restore(indicator.streamState.data(), indicator.streamState.size(), error)));
+            indicator.streams.back()->Run(data, symbols[s].size, ignored.data());
+        }
+        indicator.streams.reserve(maxSymbols);
+    }
+    if (stream == STREAM_COUNT && IsRecursiveFunction(name, optInputs)) {
+        char message[300];
+        snprintf(message, sizeof(message), "%s depends on all the bars before, it is not one of the streams", name);
+        *error = message;
+        return false;
+    }
+    int lookback = 0;
+    indicator.function->Lookback(&lookback);
+    if (stream == STREAM_COUNT && lookback >= capacity) {
+        char message[300];
+        snprintf(message, sizeof(message), "%s needs %d bars, the capacity is %d", name, lookback + 1, capacity);
+        *error = message;
+        return false;
+    }
+    indicator.outputOffset = (int) outputNames.size();
+    for (int o = 0; o < indicator.function->OutputCount(); o++) {
+        outputNames.push_back(IndicatorOutputName(*indicator.function, label, o));
+    }
+    if (window.size() < (size_t) capacity * inputs.size()) {
+        window.resize((size_t) capacity * inputs.size());
+    }
+    if (outputs.size() < (size_t) indicator.function->OutputCount()) {
+        outputs.resize(indicator.function->OutputCount());
+    }
+    indicators.push_back(std::move(indicator));
+    return true;
+}
+
+int BarStore::FindSymbol(const std::string &symbol) const {
+    std::unordered_map<std::string, int>::const_iterator found = symbolIndexes.find(symbol);
+    return found != symbolIndexes.end() ? found->second : -1;
+}
+
+int BarStore::AddSymbol(const std::string &symbol) {
+    int index = FindSymbol(symbol);
+    if (index >= 0) {
+        return index;
+    }
+    if ((int) symbols.size() == maxSymbols) {
+        return -1;
+    }
+    Ring ring = {0, 0};
+    symbols.push_back(ring);
+    for (size_t i = 0; i < indicators.size(); i++) {
+        Indicator &indicator = indicators[i];
+        if (!indicator.streamState.empty()) {
+            std::string error;
+            indicator.streams.push_back(std::unique_ptr<Stream>(
+                Stream::Restore(indicator.streamState.data(), indicator.streamState.size(), &error)));
+        }
+    }
+    symbolIndexes[symbol] = (int) symbols.size() - 1;
+    return (int) symbols.size() - 1;
+}
+
+void BarStore::Last(int symbol, Column column, int count, double *values) const {
+    const Ring &ring = symbols[symbol];
+    const double *ringValues = &this->values[((size_t) symbol * COLUMN_COUNT + column) * capacity];
+    // The last `count` values of the ring, in at most two runs.
+    int first = (ring.start + ring.size - count) % capacity;
+    int run = std::min(count, capacity - first);
+    std::copy(ringValues + first, ringValues + first + run, values);
+    std::copy(ringValues, ringValues + count - run, values + run);
+}
+
+TA_RetCode BarStore::Push(int symbol, const double bar[COLUMN_COUNT], double *latest) {
+    Ring &ring = symbols[symbol];
+    int position = (ring.start + ring.size) % capacity;
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+        Values(symbol, c)[position] = bar[c];
+    }
+    if (ring.size < capacity) {
+        ring.size++;
+    } else {
+        ring.start = (ring.start + 1) % capacity;
+    }
+    std::fill(latest, latest + outputNames.size(), NAN);
+    for (size_t i = 0; i < indicators.size(); i++) {
+        Indicator &indicator = indicators[i];
+        if (!indicator.streamState.empty()) {
+            double streamBar[COLUMN_COUNT] = {NAN, NAN, NAN, NAN, NAN, NAN};
+            for (size_t c = 0; c < indicator.inputs.size(); c++) {
+                streamBar[StreamColumn(indicator.inputs.size(), c)] = bar[indicator.inputs[c]];
+            }
+            latest[indicator.outputOffset] = indicator.streams[symbol]->Push(streamBar);
+            continue;
+        }
+        Function &function = *indicator.function;
+        int lookback = 0;
+        TA_RetCode retCode = function.Lookback(&lookback);
+        if (retCode != TA_SUCCESS) {
+            return retCode;
+        }
+        if (lookback >= ring.size) {
+            continue;
+        }
+        // Only the bars of the lookback are read for the newest value.
+        int integer = 0;
+        int count = lookback + 1;
+        for (size_t c = 0; c < indicator.inputs.size(); c++) {
+            double *input = &window[c * capacity];
+            Last(symbol, (Column) indicator.inputs[c], count, input);
+            function.SetInput((int) c, input);
+        }
+        int integerOutput = -1;
+        for (int o = 0; o < function.OutputCount(); o++) {
+            if (function.IsIntegerOutput(o)) {
+                integerOutput = o;
+                outputs[o] = &integer;
+            } else {
+                outputs[o] = latest + indicator.outputOffset + o;
+            }
+        }
+        int outBegIdx = 0, outNBElement = 0;
+        retCode = function.Call(count - 1, count - 1, outputs.data(), &outBegIdx, &outNBElement);
+        if (retCode != TA_SUCCESS) {
+            return retCode;
+        }
+        if (integerOutput >= 0 && outNBElement > 0) {
+            latest[indicator.outputOffset + integerOutput] = integer;
+        }
+    }
+    return TA_SUCCESS;
+}
+
+const char *const streamNames[STREAM_COUNT] = {"EMA", "RSI", "ATR", "ADX", "SAR", "HT_DCPERIOD", "KAMA", "T3"};
+
+namespace {
+
+// The settings of the calling thread, those of its context if it has one.
+static TA_Compatibility ContextCompatibility() {
+    const TA_Context *context = CurrentContext();
+    return context ? TA_ContextGetCompatibility(context) : TA_GetCompatibility();
+}
+
+static TA_Precision ContextPrecision() {
+    const TA_Context *context = CurrentContext();
+    return context ? TA_ContextGetPrecision(context) : TA_GetPrecision();
+}
+
+static unsigned int ContextUnstablePeriod(TA_FuncUnstId id) {
+    const TA_Context *context = CurrentContext();
+    return context ? TA_ContextGetUnstablePeriod(context, id) : TA_GetUnstablePeriod(id);
+}
+
+// The saved states start with the magic and the version of their format,
+// then the index of the stream in `streamNames`, its parameters, its
+// lookback and its committed state. The integers take 4 bytes, the doubles
+// 8 bytes and the flags 1 byte, in little-endian.
+static const char streamMagic[4] = {'T', 'A', 'S', 'T'};
+static const int streamVersion = 1;
+static const size_t streamHeaderSize = sizeof(streamMagic) + 2;
+
+/**
+ * Append the fields of a state to a blob.
+ */
+class StateWriter {
+public:
+    explicit StateWriter(std::string *blob) : blob(blob) {}
+
+    void operator()(int &value, int, int) { Put((uint32_t) value, 4); }
+
+    void operator()(bool &value) { Put(value ? 1 : 0, 1); }
+
+    void operator()(double &value) {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        Put(bits, 8);
+    }
+
+private:
+    void Put(uint64_t bits, int size) {
+        for (int b = 0; b < size; b++) {
+            blob->push_back((char) (bits >> (8 * b)));
+        }
+    }
+
+    std::string *blob;
+};
+
+/**
+ * Read the fields of a state from a blob, the integers out of their range
+ * and the truncated blobs are invalid.
+ */
+class StateReader {
+public:
+    StateReader(const unsigned char *data, size_t size) : data(data), size(size), offset(0), valid(true) {}
+
+    void operator()(int &value, int min, int max) {
+        uint64_t bits;
+        if (Get(&bits, 4)) {
+            int read = (int) (int32_t) (uint32_t) bits;
+            if (read >= min && read <= max) {
+                value = read;
+            } else {
+                valid = false;
+            }
+        }
+    }
+
+    void operator()(bool &value) {
+        uint64_t bits;
+        if (Get(&bits, 1)) {
+            value = bits == 1;
+            valid = valid && bits <= 1;
+        }
+    }
+
+    void operator()(double &value) {
+        uint64_t bits;
+        if (Get(&bits, 8)) {
+            memcpy(&value, &bits, sizeof(value));
+        }
+    }
+
+    /**
+     * Whether all the fields were valid and the whole blob was read.
+     */
+    bool Done() const { return valid && offset == size; }
+
+private:
+    bool Get(uint64_t *bits, int size) {
+        if (!valid || this->size - offset < (size_t) size) {
+            valid = false;
+            return false;
+        }
+        *bits = 0;
+        for (int b = 0; b < size; b++) {
+            *bits |= (uint64_t) data[offset++] << (8 * b);
+        }
+        return true;
+    }
+
+    const unsigned char *data;
+    size_t size;
+    size_t offset;
+    bool valid;
+};
+
+/**
+ * A stream whose state is a plain struct, `UpdateLast` steps a copy of the
+ * committed state which `Commit` keeps. `Derived` visits its parameters and
+ * then `VisitState` with `Visit`, to save and restore them.
+ */
+template <class Derived, class State>
+class StateStream : public Stream {
+public:
+    double UpdateLast(const double *bar) {
+        pending = committed;
+        updated = true;
+        return static_cast<const Derived *>(this)->Step(pending, bar);
+    }
+
+    void Commit() {
+        if (updated) {
+            committed = pending;
+            updated = false;
+        }
+    }
+
+    void Run(const double *const *columns, int length, double *values) {
+        const Derived *derived = static_cast<const Derived *>(this);
+        double bar[BarStore::COLUMN_COUNT];
+        for (int i = 0; i < length; i++) {
+            for (int c = 0; c < BarStore::COLUMN_COUNT; c++) {
+                bar[c] = columns[c] != NULL ? columns[c][i] : NAN;
+            }
+            values[i] = derived->Step(committed, bar);
+        }
+        updated = false;
+    }
+
+    void Save(std::string *blob) const {
+        blob->append(streamMagic, sizeof(streamMagic));
+        blob->push_back((char) streamVersion);
+        blob->push_back((char) Derived::id);
+        StateWriter writer(blob);
+        // The writer only reads the fields.
+        const_cast<Derived *>(static_cast<const Derived *>(this))->Visit(writer);
+    }
+
+    /**
+     * Create the stream saved in the fields of `reader`, NULL if they are
+     * invalid.
+     */
+    static Stream *Restore(StateReader &reader) {
+        Derived *stream = new Derived();
+        stream->Visit(reader);
+        if (!reader.Done()) {
+            delete stream;
+            return NULL;
+        }
+        return stream;
+    }
+
+protected:
+    explicit StateStream(int lookback) : Stream(lookback), committed(), pending(), updated(false) {}
+
+    template <class Visitor>
+    void VisitState(Visitor &visitor) {
+        visitor(lookback, 0, INT_MAX);
+        committed.Visit(visitor);
+    }
+
+    State committed;
+    State pending;
+    bool updated;
+};
+
+struct EmaState {
+    int count;
+    double value;
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        visitor(value);
+    }
+};
+
+// Same as TA_EMA, the seed is the average of the first period or the first
+// value with the Metastock compatibility.
+class EmaStream : public StateStream<EmaStream, EmaState> {
+public:
+    static const int id = 0;
+
+    EmaStream() : StateStream<EmaStream, EmaState>(0), period(2), k(0), metastock(false) {}
+
+    EmaStream(int period, int lookback, bool metastock)
+        : StateStream<EmaStream, EmaState>(lookback), period(period), k(PER_TO_K(period)), metastock(metastock) {}
+
+    double Step(EmaState &state, const double *bar) const {
+        int i = state.count++;
+        double value = bar[BarStore::CLOSE];
+        if (metastock) {
+            state.value = i == 0 ? value : ((value - state.value) * k) + state.value;
+        } else if (i < period) {
+            state.value += value;
+            if (i == period - 1) {
+                state.value /= period;
+            }
+        } else {
+            state.value = ((value - state.value) * k) + state.value;
+        }
+        return i >= lookback ? state.value : NAN;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(period, 2, 100000);
+        visitor(k);
+        visitor(metastock);
+        VisitState(visitor);
+    }
+
+private:
+    int period;
+    double k;
+    bool metastock;
+};
+
+struct RsiState {
+    int count;
+    double prevValue;
+    double gain;
+    double loss;
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        visitor(prevValue);
+        visitor(gain);
+        visitor(loss);
+    }
+};
+
+// Same as TA_RSI, including the additional first value of the Metastock
+// compatibility without unstable period.
+class RsiStream : public StateStream<RsiStream, RsiState> {
+public:
+    static const int id = 1;
+
+    RsiStream() : StateStream<RsiStream, RsiState>(0), period(2), metastockFirst(false) {}
+
+    RsiStream(int period, int lookback, bool metastockFirst)
+        : StateStream<RsiStream, RsiState>(lookback), period(period), metastockFirst(metastockFirst) {}
+
+    double Step(RsiState &state, const double *bar) const {
+        int i = state.count++;
+        double value = bar[BarStore::CLOSE];
+        double diff = value - state.prevValue;
+        state.prevValue = value;
+        if (i == 0) {
+            return NAN;
+        }
+        if (i <= period) {
+            if (diff < 0) {
+                state.loss -= diff;
+            } else {
+                state.gain += diff;
+            }
+            if (metastockFirst && i == period - 1) {
+                double loss = state.loss / period;
+                double gain = state.gain / period;
+                loss = gain + loss;
+                return !TA_IS_ZERO(loss) ? 100 * (gain / loss) : 0.0;
+            }
+            if (i < period) {
+                return NAN;
+            }
+            state.loss /= period;
+            state.gain /= period;
+        } else {
+            state.loss *= (period - 1);
+            state.gain *= (period - 1);
+            if (diff < 0) {
+                state.loss -= diff;
+            } else {
+                state.gain += diff;
+            }
+            state.loss /= period;
+            state.gain /= period;
+        }
+        if (i < lookback) {
+            return NAN;
+        }
+        double total = state.gain + state.loss;
+        return !TA_IS_ZERO(total) ? 100.0 * (state.gain / total) : 0.0;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(period, 2, 100000);
+        visitor(metastockFirst);
+        VisitState(visitor);
+    }
+
+private:
+    int period;
+    bool metastockFirst;
+};
+
+/**
+ * The true range of the bar after the close `prevClose`, same as TA_TRANGE.
+ */
+static double TrueRange(double high, double low, double prevClose) {
+    double greatest = high - low;
+    double value = std_fabs(prevClose - high);
+    if (value > greatest) {
+        greatest = value;
+    }
+    value = std_fabs(prevClose - low);
+    if (value > greatest) {
+        greatest = value;
+    }
+    return greatest;
+}
+
+struct AtrState {
+    int count;
+    double prevClose;
+    double value;
+    double comp;
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        visitor(prevClose);
+        visitor(value);
+        visitor(comp);
+    }
+};
+
+// Same as TA_ATR, the seed is the average of the first period of true
+// ranges, summed as TA_INT_SMA with the precision of the stream.
+class AtrStream : public StateStream<AtrStream, AtrState> {
+public:
+    static const int id = 2;
+
+    AtrStream() : StateStream<AtrStream, AtrState>(0), period(1), compensated(false) {}
+
+    AtrStream(int period, int lookback, bool compensated)
+        : StateStream<AtrStream, AtrState>(lookback), period(period), compensated(compensated) {}
+
+    double Step(AtrState &state, const double *bar) const {
+        int i = state.count++;
+        double prevClose = state.prevClose;
+        state.prevClose = bar[BarStore::CLOSE];
+        if (i == 0) {
+            return NAN;
+        }
+        double trueRange = TrueRange(bar[BarStore::HIGH], bar[BarStore::LOW], prevClose);
+        if (period <= 1) {
+            return i >= lookback ? trueRange : NAN;
+        }
+        if (i <= period) {
+            if (compensated) {
+                TA_COMPENSATED_ADD(state.value, state.comp, trueRange);
+            } else {
+                state.value += trueRange;
+            }
+            if (i < period) {
+                return NAN;
+            }
+            state.value = (compensated ? state.value + state.comp : state.value) / period;
+        } else {
+            state.value *= period - 1;
+            state.value += trueRange;
+            state.value /= period;
+        }
+        return i >= lookback ? state.value : NAN;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(period, 1, 100000);
+        visitor(compensated);
+        VisitState(visitor);
+    }
+
+private:
+    int period;
+    bool compensated;
+};
+
+struct AdxState {
+    int count;
+    double prevHigh;
+    double prevLow;
+    double prevClose;
+    double minusDM;
+    double plusDM;
+    double trueRange;
+    double sumDX;
+    double adx;
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        visitor(prevHigh);
+        visitor(prevLow);
+        visitor(prevClose);
+        visitor(minusDM);
+        visitor(plusDM);
+        visitor(trueRange);
+        visitor(sumDX);
+        visitor(adx);
+    }
+};
+
+// Same as TA_ADX, the directional movements and the true range are summed
+// over the first period, the seed of the ADX is the average of the DX of
+// the second.
+class AdxStream : public StateStream<AdxStream, AdxState> {
+public:
+    static const int id = 3;
+
+    AdxStream() : StateStream<AdxStream, AdxState>(0), period(2) {}
+
+    AdxStream(int period, int lookback) : StateStream<AdxStream, AdxState>(lookback), period(period) {}
+
+    double Step(AdxState &state, const double *bar) const {
+        int i = state.count++;
+        double high = bar[BarStore::HIGH], low = bar[BarStore::LOW];
+        if (i == 0) {
+            state.prevHigh = high;
+            state.prevLow = low;
+            state.prevClose = bar[BarStore::CLOSE];
+            return NAN;
+        }
+        double diffP = high - state.prevHigh;
+        state.prevHigh = high;
+        double diffM = state.prevLow - low;
+        state.prevLow = low;
+        if (i >= period) {
+            state.minusDM -= state.minusDM / period;
+            state.plusDM -= state.plusDM / period;
+        }
+        if ((diffM > 0) && (diffP < diffM)) {
+            state.minusDM += diffM;
+        } else if ((diffP > 0) && (diffP > diffM)) {
+            state.plusDM += diffP;
+        }
+        double trueRange = TrueRange(high, low, state.prevClose);
+        if (i < period) {
+            state.trueRange += trueRange;
+        } else {
+            state.trueRange = state.trueRange - (state.trueRange / period) + trueRange;
+        }
+        state.prevClose = bar[BarStore::CLOSE];
+        if (i < period) {
+            return NAN;
+        }
+        bool isDX = false;
+        double dx = 0.0;
+        if (!TA_IS_ZERO(state.trueRange)) {
+            double minusDI = 100.0 * (state.minusDM / state.trueRange);
+            double plusDI = 100.0 * (state.plusDM / state.trueRange);
+            double sumDI = minusDI + plusDI;
+            if (!TA_IS_ZERO(sumDI)) {
+                isDX = true;
+                dx = 100.0 * (std_fabs(minusDI - plusDI) / sumDI);
+            }
+        }
+        if (i <= 2 * period - 1) {
+            if (isDX) {
+                state.sumDX += dx;
+            }
+            if (i < 2 * period - 1) {
+                return NAN;
+            }
+            state.adx = state.sumDX / period;
+        } else if (isDX) {
+            state.adx = ((state.adx * (period - 1)) + dx) / period;
+        }
+        return i >= lookback ? state.adx : NAN;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(period, 2, 100000);
+        VisitState(visitor);
+    }
+
+private:
+    int period;
+};
+
+struct SarState {
+    int count;
+    bool isLong;
+    double af;
+    double ep;
+    double sar;
+    double newHigh;
+    double newLow;
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        visitor(isLong);
+        visitor(af);
+        visitor(ep);
+        visitor(sar);
+        visitor(newHigh);
+        visitor(newLow);
+    }
+};
+
+// Same as TA_SAR, the direction of the first bar is the one of its
+// directional movement.
+class SarStream : public StateStream<SarStream, SarState> {
+public:
+    static const int id = 4;
+
+    SarStream() : StateStream<SarStream, SarState>(1), acceleration(0), maximum(0) {}
+
+    SarStream(double acceleration, double maximum)
+        : StateStream<SarStream, SarState>(1), acceleration(acceleration > maximum ? maximum : acceleration),
+          maximum(maximum) {}
+
+    double Step(SarState &state, const double *bar) const {
+        int i = state.count++;
+        double high = bar[BarStore::HIGH], low = bar[BarStore::LOW];
+        if (i == 0) {
+            state.newHigh = high;
+            state.newLow = low;
+            return NAN;
+        }
+        if (i == 1) {
+            double diffP = high - state.newHigh;
+            double diffM = state.newLow - low;
+            state.isLong = !((diffM > 0) && (diffP < diffM));
+            state.af = acceleration;
+            state.ep = state.isLong ? high : low;
+            state.sar = state.isLong ? state.newLow : state.newHigh;
+            state.newHigh = high;
+            state.newLow = low;
+        }
+        double prevLow = state.newLow, prevHigh = state.newHigh;
+        double newLow = state.newLow = low, newHigh = state.newHigh = high;
+        double &sar = state.sar;
+        double output;
+        if (state.isLong) {
+            if (newLow <= sar) {
+                state.isLong = false;
+                sar = state.ep;
+                if (sar < prevHigh) {
+                    sar = prevHigh;
+                }
+                if (sar < newHigh) {
+                    sar = newHigh;
+                }
+                output = sar;
+                state.af = acceleration;
+                state.ep = newLow;
+                sar = sar + state.af * (state.ep - sar);
+                if (sar < prevHigh) {
+                    sar = prevHigh;
+                }
+                if (sar < newHigh) {
+                    sar = newHigh;
+                }
+            } else {
+                output = sar;
+                if (newHigh > state.ep) {
+                    state.ep = newHigh;
+                    state.af += acceleration;
+                    if (state.af > maximum) {
+                        state.af = maximum;
+                    }
+                }
+                sar = sar + state.af * (state.ep - sar);
+                if (sar > prevLow) {
+                    sar = prevLow;
+                }
+                if (sar > newLow) {
+                    sar = newLow;
+                }
+            }
+        } else {
+            if (newHigh >= sar) {
+                state.isLong = true;
+                sar = state.ep;
+                if (sar > prevLow) {
+                    sar = prevLow;
+                }
+                if (sar > newLow) {
+                    sar = newLow;
+                }
+                output = sar;
+                state.af = acceleration;
+                state.ep = newHigh;
+                sar = sar + state.af * (state.ep - sar);
+                if (sar > prevLow) {
+                    sar = prevLow;
+                }
+                if (sar > newLow) {
+                    sar = newLow;
+                }
+            } else {
+                output = sar;
+                if (newLow < state.ep) {
+                    state.ep = newLow;
+                    state.af += acceleration;
+                    if (state.af > maximum) {
+                        state.af = maximum;
+                    }
+                }
+                sar = sar + state.af * (state.ep - sar);
+                if (sar < prevHigh) {
+                    sar = prevHigh;
+                }
+                if (sar < newHigh) {
+                    sar = newHigh;
+                }
+            }
+        }
+        return output;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(acceleration);
+        visitor(maximum);
+        VisitState(visitor);
+    }
+
+private:
+    double acceleration;
+    double maximum;
+};
+
+/**
+ * One of the four Hilbert transforms of the HT functions, with the buffers
+ * of the odd and the even bars.
+ */
+struct HilbertTransform {
+    double odd[3];
+    double even[3];
+    double value;
+    double prevOdd;
+    double prevEven;
+    double prevInputOdd;
+    double prevInputEven;
+
+    /**
+     * Same as DO_HILBERT_ODD and DO_HILBERT_EVEN.
+     */
+    void Add(double input, bool isOdd, int hilbertIdx, double adjustedPrevPeriod) {
+        double *buffer = isOdd ? odd : even;
+        double &prev = isOdd ? prevOdd : prevEven;
+        double &prevInput = isOdd ? prevInputOdd : prevInputEven;
+        double hilbertTempReal = 0.0962 * input;
+        value = -buffer[hilbertIdx];
+        buffer[hilbertIdx] = hilbertTempReal;
+        value += hilbertTempReal;
+        value -= prev;
+        prev = 0.5769 * prevInput;
+        value += prev;
+        prevInput = input;
+        value *= adjustedPrevPeriod;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        for (int i = 0; i < 3; i++) {
+            visitor(odd[i]);
+            visitor(even[i]);
+        }
+        visitor(value);
+        visitor(prevOdd);
+        visitor(prevEven);
+        visitor(prevInputOdd);
+        visitor(prevInputEven);
+    }
+};
+
+struct HtDcPeriodState {
+    int count;
+    double prices[4];
+    double periodWMASub;
+    double periodWMASum;
+    double trailingWMAValue;
+    int hilbertIdx;
+    HilbertTransform detrender;
+    HilbertTransform q1;
+    HilbertTransform jI;
+    HilbertTransform jQ;
+    double period;
+    double prevI2;
+    double prevQ2;
+    double re;
+    double im;
+    double i1ForOddPrev2;
+    double i1ForOddPrev3;
+    double i1ForEvenPrev2;
+    double i1ForEvenPrev3;
+    double smoothPeriod;
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        for (int i = 0; i < 4; i++) {
+            visitor(prices[i]);
+        }
+        visitor(periodWMASub);
+        visitor(periodWMASum);
+        visitor(trailingWMAValue);
+        visitor(hilbertIdx, 0, 2);
+        detrender.Visit(visitor);
+        q1.Visit(visitor);
+        jI.Visit(visitor);
+        jQ.Visit(visitor);
+        visitor(period);
+        visitor(prevI2);
+        visitor(prevQ2);
+        visitor(re);
+        visitor(im);
+        visitor(i1ForOddPrev2);
+        visitor(i1ForOddPrev3);
+        visitor(i1ForEvenPrev2);
+        visitor(i1ForEvenPrev3);
+        visitor(smoothPeriod);
+    }
+};
+
+// Same as TA_HT_DCPERIOD, the close is smoothed by a WMA of 4 bars and goes
+// through the Hilbert transforms from the 13th bar.
+class HtDcPeriodStream : public StateStream<HtDcPeriodStream, HtDcPeriodState> {
+public:
+    static const int id = 5;
+
+    HtDcPeriodStream() : StateStream<HtDcPeriodStream, HtDcPeriodState>(0) {}
+
+    explicit HtDcPeriodStream(int lookback) : StateStream<HtDcPeriodStream, HtDcPeriodState>(lookback) {}
+
+    double Step(HtDcPeriodState &state, const double *bar) const {
+        int i = state.count++;
+        double value = bar[BarStore::CLOSE];
+        state.prices[i % 4] = value;
+        if (i < 3) {
+            state.periodWMASub += value;
+            state.periodWMASum += value * (i + 1);
+            return NAN;
+        }
+        double adjustedPrevPeriod = (0.075 * state.period) + 0.54;
+        state.periodWMASub += value;
+        state.periodWMASub -= state.trailingWMAValue;
+        state.periodWMASum += value * 4.0;
+        state.trailingWMAValue = state.prices[(i - 3) % 4];
+        double smoothedValue = state.periodWMASum * 0.1;
+        state.periodWMASum -= state.periodWMASub;
+        if (i < 12) {
+            return NAN;
+        }
+        double q2, i2;
+        if ((i % 2) == 0) {
+            state.detrender.Add(smoothedValue, false, state.hilbertIdx, adjustedPrevPeriod);
+            state.q1.Add(state.detrender.value, false, state.hilbertIdx, adjustedPrevPeriod);
+            state.jI.Add(state.i1ForEvenPrev3, false, state.hilbertIdx, adjustedPrevPeriod);
+            state.jQ.Add(state.q1.value, false, state.hilbertIdx, adjustedPrevPeriod);
+            if (++state.hilbertIdx == 3) {
+                state.hilbertIdx = 0;
+            }
+            q2 = (0.2 * (state.q1.value + state.jI.value)) + (0.8 * state.prevQ2);
+            i2 = (0.2 * (state.i1ForEvenPrev3 - state.jQ.value)) + (0.8 * state.prevI2);
+            state.i1ForOddPrev3 = state.i1ForOddPrev2;
+            state.i1ForOddPrev2 = state.detrender.value;
+        } else {
+            state.detrender.Add(smoothedValue, true, state.hilbertIdx, adjustedPrevPeriod);
+            state.q1.Add(state.detrender.value, true, state.hilbertIdx, adjustedPrevPeriod);
+            state.jI.Add(state.i1ForOddPrev3, true, state.hilbertIdx, adjustedPrevPeriod);
+            state.jQ.Add(state.q1.value, true, state.hilbertIdx, adjustedPrevPeriod);
+            q2 = (0.2 * (state.q1.value + state.jI.value)) + (0.8 * state.prevQ2);
+            i2 = (0.2 * (state.i1ForOddPrev3 - state.jQ.value)) + (0.8 * state.prevI2);
+            state.i1ForEvenPrev3 = state.i1ForEvenPrev2;
+            state.i1ForEvenPrev2 = state.detrender.value;
+        }
+        state.re = (0.2 * ((i2 * state.prevI2) + (q2 * state.prevQ2))) + (0.8 * state.re);
+        state.im = (0.2 * ((i2 * state.prevQ2) - (q2 * state.prevI2))) + (0.8 * state.im);
+        state.prevQ2 = q2;
+        state.prevI2 = i2;
+        double prevPeriod = state.period;
+        if ((state.im != 0.0) && (state.re != 0.0)) {
+            state.period = 360.0 / (std_atan(state.im / state.re) * (180.0 / (4.0 * std_atan(1))));
+        }
+        double limit = 1.5 * prevPeriod;
+        if (state.period > limit) {
+            state.period = limit;
+        }
+        limit = 0.67 * prevPeriod;
+        if (state.period < limit) {
+            state.period = limit;
+        }
+        if (state.period < 6) {
+            state.period = 6;
+        } else if (state.period > 50) {
+            state.period = 50;
+        }
+        state.period = (0.2 * state.period) + (0.8 * prevPeriod);
+        state.smoothPeriod = (0.33 * state.period) + (0.67 * state.smoothPeriod);
+        return i >= lookback ? state.smoothPeriod : NAN;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        VisitState(visitor);
+    }
+};
+
+struct KamaState {
+    int count;
+    double sumROC1;
+    double trailingValue;
+    double prevKAMA;
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        visitor(sumROC1);
+        visitor(trailingValue);
+        visitor(prevKAMA);
+    }
+};
+
+// Same as TA_KAMA, the efficiency ratio is the change over the period
+// divided by the sum of the changes of each bar.
+class KamaStream : public StateStream<KamaStream, KamaState> {
+public:
+    static const int id = 6;
+
+    KamaStream() : StateStream<KamaStream, KamaState>(0), period(2), prices(3) {}
+
+    KamaStream(int period, int lookback)
+        : StateStream<KamaStream, KamaState>(lookback), period(period), prices(period + 1) {}
+
+    double Step(KamaState &state, const double *bar) const {
+        const double constMax = 2.0 / (30.0 + 1.0);
+        const double constDiff = 2.0 / (2.0 + 1.0) - constMax;
+        int i = state.count++;
+        double value = bar[BarStore::CLOSE];
+        // The slot of the bar is the one of the bar `period + 1` bars before,
+        // which the next bars do not read, so an update of the last bar which
+        // is not committed does not change the committed state.
+        int size = period + 1;
+        double prevValue = i > 0 ? prices[(i - 1) % size] : NAN;
+        double trailing = prices[(i + 1) % size];
+        prices[i % size] = value;
+        if (i == 0) {
+            return NAN;
+        }
+        if (i <= period) {
+            state.sumROC1 += std_fabs(prevValue - value);
+            if (i < period) {
+                return NAN;
+            }
+            state.prevKAMA = prevValue;
+        } else {
+            state.sumROC1 -= std_fabs(state.trailingValue - trailing);
+            state.sumROC1 += std_fabs(value - prevValue);
+        }
+        double periodROC = value - trailing;
+        state.trailingValue = trailing;
+        double sc;
+        if ((state.sumROC1 <= periodROC) || TA_IS_ZERO(state.sumROC1)) {
+            sc = 1.0;
+        } else {
+            sc = std_fabs(periodROC / state.sumROC1);
+        }
+        sc = (sc * constDiff) + constMax;
+        sc *= sc;
+        state.prevKAMA = ((value - state.prevKAMA) * sc) + state.prevKAMA;
+        return i >= lookback ? state.prevKAMA : NAN;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(period, 2, 100000);
+        prices.resize(period + 1);
+        for (size_t p = 0; p < prices.size(); p++) {
+            visitor(prices[p]);
+        }
+        VisitState(visitor);
+    }
+
+private:
+    int period;
+    mutable std::vector<double> prices;
+};
+
+struct T3State {
+    int count;
+    double sum;
+    double e[6];
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(count, 0, INT_MAX);
+        visitor(sum);
+        for (int j = 0; j < 6; j++) {
+            visitor(e[j]);
+        }
+    }
+};
+
+// Same as TA_T3, each of the six EMA is seeded by the average of its first
+// period of inputs, the output of the previous one.
+class T3Stream : public StateStream<T3Stream, T3State> {
+public:
+    static const int id = 7;
+
+    T3Stream() : StateStream<T3Stream, T3State>(0), period(2), k(0), c1(0), c2(0), c3(0), c4(0) {}
+
+    T3Stream(int period, double vFactor, int lookback)
+        : StateStream<T3Stream, T3State>(lookback), period(period), k(2.0 / (period + 1.0)) {
+        double tempReal = vFactor * vFactor;
+        c1 = -(tempReal * vFactor);
+        c2 = 3.0 * (tempReal - c1);
+        c3 = -6.0 * tempReal - 3.0 * (vFactor - c1);
+        c4 = 1.0 + 3.0 * vFactor - c1 + 3.0 * tempReal;
+    }
+
+    double Step(T3State &state, const double *bar) const {
+        int i = state.count++;
+        double value = bar[BarStore::CLOSE];
+        double one_minus_k = 1.0 - k;
+        if (i < period) {
+            state.sum += value;
+            if (i < period - 1) {
+                return NAN;
+            }
+            state.e[0] = state.sum / period;
+            state.sum = state.e[0];
+            return NAN;
+        }
+        // The EMA `m` is seeded at the end of the period of bars after the
+        // seed of the previous one.
+        int m = (i - 1) / (period - 1);
+        int count = m < 6 ? m : 6;
+        state.e[0] = (k * value) + (one_minus_k * state.e[0]);
+        for (int j = 1; j < count; j++) {
+            state.e[j] = (k * state.e[j - 1]) + (one_minus_k * state.e[j]);
+        }
+        if (m < 6) {
+            state.sum += state.e[m - 1];
+            if (i % (period - 1) == 0) {
+                state.e[m] = state.sum / period;
+                state.sum = state.e[m];
+            }
+        }
+        return i >= lookback ? Output(state) : NAN;
+    }
+
+    template <class Visitor>
+    void Visit(Visitor &visitor) {
+        visitor(period, 2, 100000);
+        visitor(k);
+        visitor(c1);
+        visitor(c2);
+        visitor(c3);
+        visitor(c4);
+        VisitState(visitor);
+    }
+
+private:
+    double Output(const T3State &state) const {
+        return c1 * state.e[5] + c2 * state.e[4] + c3 * state.e[3] + c4 * state.e[2];
+    }
+
+    int period;
+    double k;
+    double c1;
+    double c2;
+    double c3;
+    double c4;
+};
+
+/**
+ * The optional input `index` of `optInputs`, `defaultValue` if it is
+ * missing or NaN.
+ */
+static double StreamOptInput(const std::vector<double> &optInputs, size_t index, double defaultValue) {
+    return index < optInputs.size() && !std::isnan(optInputs[index]) ? optInputs[index] : defaultValue;
+}
+
+} // namespace
+
+Stream *Stream::Create(const char *name, const std::vector<double> &optInputs, std::string *error) {
+    char message[200];
+    int stream = 0;
+    while (stream < STREAM_COUNT && strcmp(name, streamNames[stream]) != 0) {
+        stream++;
+    }
+    if (stream == STREAM_COUNT) {
+        snprintf(message, sizeof(message), "no stream for %s", name);
+        *error = message;
+        return NULL;
+    }
+    size_t optInputCount = stream == SarStream::id || stream == T3Stream::id ? 2 : stream == HtDcPeriodStream::id ? 0 : 1;
+    if (optInputs.size() > optInputCount) {
+        snprintf(message, sizeof(message), "%s takes %d optional inputs", name, (int) optInputCount);
+        *error = message;
+        return NULL;
+    }
+    if (stream == SarStream::id) {
+        double acceleration = StreamOptInput(optInputs, 0, 0.02);
+        double maximum = StreamOptInput(optInputs, 1, 0.2);
+        if (TA_SAR_Lookback(acceleration, maximum) < 0) {
+            snprintf(message, sizeof(message), "invalid optional inputs %g, %g of %s", acceleration, maximum, name);
+            *error = message;
+            return NULL;
+        }
+        return new SarStream(acceleration, maximum);
+    }
+    if (stream == HtDcPeriodStream::id) {
+        return new HtDcPeriodStream(TA_HT_DCPERIOD_Lookback());
+    }
+    // The other streams take a period, and a volume factor for T3.
+    static const double defaultPeriods[STREAM_COUNT] = {30, 14, 14, 14, 0, 0, 30, 5};
+    double value = StreamOptInput(optInputs, 0, defaultPeriods[stream]);
+    double vFactor = StreamOptInput(optInputs, 1, 0.7);
+    int period = std_fabs(value) <= 100000 ? (int) value : 0;
+    int lookback;
+    switch (stream) {
+    case EmaStream::id:
+        lookback = TA_EMA_Lookback(period);
+        break;
+    case RsiStream::id:
+        lookback = TA_RSI_Lookback(period);
+        break;
+    case AtrStream::id:
+        lookback = TA_ATR_Lookback(period);
+        break;
+    case AdxStream::id:
+        lookback = TA_ADX_Lookback(period);
+        break;
+    case KamaStream::id:
+        lookback = TA_KAMA_Lookback(period);
+        break;
+    default:
+        lookback = TA_T3_Lookback(period, vFactor);
+        break;
+    }
+    if (lookback < 0) {
+        if (stream == T3Stream::id) {
+            snprintf(message, sizeof(message), "invalid optional inputs %g, %g of %s", value, vFactor, name);
+        } else {
+            snprintf(message, sizeof(message), "invalid optional input %g of %s", value, name);
+        }
+        *error = message;
+        return NULL;
+    }
+    switch (stream) {
+    case EmaStream::id:
+        return new EmaStream(period, lookback, ContextCompatibility() == TA_COMPATIBILITY_METASTOCK);
+    case RsiStream::id:
+        return new RsiStream(period, lookback,
+                             ContextCompatibility() == TA_COMPATIBILITY_METASTOCK &&
+                                 ContextUnstablePeriod(TA_FUNC_UNST_RSI) == 0);
+    case AtrStream::id:
+        return new AtrStream(period, lookback, ContextPrecision() == TA_PRECISION_COMPENSATED);
+    case AdxStream::id:
+        return new AdxStream(period, lookback);
+    case KamaStream::id:
+        return new KamaStream(period, lookback);
+    default:
+        return new T3Stream(period, vFactor, lookback);
+    }
+}
+
+Stream *Stream::Restore(const void *data, size_t size, std::string *error) {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    if (size < streamHeaderSize || memcmp(bytes, streamMagic, sizeof(streamMagic)) != 0) {
+        *error = "not a saved stream";
+        return NULL;
+    }
+    int version = bytes[sizeof(streamMagic)];
+    if (version != streamVersion) {
+        char message[100];
+        snprintf(message, sizeof(message), "unsupported version %d of a saved stream", version);
+        *error = message;
+        return NULL;
+    }
+    StateReader reader(bytes + streamHeaderSize, size - streamHeaderSize);
+    Stream *stream = NULL;
+    switch (bytes[sizeof(streamMagic) + 1]) {
+    case EmaStream::id:
+        stream = EmaStream::Restore(reader);
+        break;
+    case RsiStream::id:
+        stream = RsiStream::Restore(reader);
+        break;
+    case AtrStream::id:
+        stream = AtrStream::Restore(reader);
+        break;
+    case AdxStream::id:
+        stream = AdxStream::Restore(reader);
+        break;
+    case SarStream::id:
+        stream = SarStream::Restore(reader);
+        break;
+    case HtDcPeriodStream::id:
+        stream = HtDcPeriodStream::Restore(reader);
+        break;
+    case KamaStream::id:
+        stream = KamaStream::Restore(reader);
+        break;
+    case T3Stream::id:
+        stream = T3Stream::Restore(reader);
+        break;
+    }
+    if (stream == NULL) {
+        *error = "invalid saved stream";
+    }
+    return stream;
+}
+
+} // namespace talib
@@ -0,0 +1,664 @@
+/*!
+ * talib_engine, the computations of the binding without Node.js: the TA
+ * functions called by name, the batch and fused functions, the parallel
+ * loops, the CSV loader and the series files. The Node.js addon is a layer
+ * over it which converts the JS values, C++ programs link it directly.
+ *
+ * The functions return a `TA_RetCode` as the TA functions do, or false with
+ * an error message, they do not throw.
+ */
+
+#ifndef TALIB_ENGINE_H
+#define TALIB_ENGINE_H
+
+#include "ta_libc.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace talib {
+
+/**
+ * Initialize TA-Lib once for the whole process, the later calls get the
+ * result of the first one, initializing again would reset the global
+ * settings under the threads already running.
+ */
+TA_RetCode Initialize();
+
+/**
+ * The context of the calling thread, NULL if it uses the global settings.
+ */
+const TA_Context *CurrentContext();
+
+/**
+ * Set the context of the calling thread until the end of the scope.
+ */
+class ScopedContext {
+public:
+    explicit ScopedContext(const TA_Context *context) : previous(TA_SetThreadContext(context)) {}
+    ~ScopedContext() { TA_SetThreadContext(previous); }
+
+private:
+    ScopedContext(const ScopedContext &);
+    ScopedContext &operator=(const ScopedContext &);
+
+    const TA_Context *previous;
+};
+
+/**
+ * Call `body(i)` for each `i` in [0, count), on up to `threads` threads, one
+ * per core if it is 0. The calling thread takes part, the others run with
+ * its context. Returns when all the calls are done.
+ */
+void ParallelFor(int count, int threads, const std::function<void(int)> &body);
+
+/**
+ * A TA function called by name, through the abstract interface. The inputs
+ * are columns: a real or integer input is one column, a price input is one
+ * column for each of its components, in the order open, high, low, close,
+ * volume and open interest.
+ */
+class Function {
+public:
+    Function();
+    ~Function();
+
+    /**
+     * Find the function `name`, e.g. "SMA". Its optional inputs are set to
+     * their default.
+     */
+    TA_RetCode Init(const char *name);
+
+    int InputColumnCount() const { return (int) columns.size(); }
+    bool IsIntegerInput(int column) const;
+    int OptInputCount() const;
+    int OutputCount() const;
+    const char *OutputName(int output) const;
+    bool IsIntegerOutput(int output) const;
+
+    /**
+     * Set the values of an input column, `double` or `int` for an integer
+     * input.
+     */
+    void SetInput(int column, const void *values) { columns[column].values = values; }
+
+    TA_RetCode SetOptInput(int index, double value);
+
+    /**
+     * The lookback of the function with the current optional inputs.
+     */
+    TA_RetCode Lookback(int *lookback) const;
+
+    /**
+     * Call the function as `TA_<FUNC>(startIdx, endIdx, ...)`, `outputs[o]`
+     * is the `double` or `int` buffer of the output `o`.
+     */
+    TA_RetCode Call(int startIdx, int endIdx, void *const *outputs, int *outBegIdx, int *outNBElement);
+
+    /**
+     * Call the function over the whole input of `length` values, `outputs[o]`
+     * is `length` values aligned with the input, NaN in the lookback. The
+     * integer outputs are converted to `double`.
+     */
+    TA_RetCode CallFull(int length, double *const *outputs);
+
+private:
+    Function(const Function &);
+    Function &operator=(const Function &);
+
+    struct InputColumn {
+        unsigned int param;
+        int component;
+        const void *values;
+    };
+
+    const TA_FuncHandle *handle;
+    const TA_FuncInfo *info;
+    TA_ParamHolder *params;
+    std::vector<InputColumn> columns;
+};
+
+/**
+ * The MA of type `maType` at each of `periods` in one pass. `outReal` is a
+ * nbPeriod x (endIdx - startIdx + 1) matrix in row major order, the values
+ * in the lookback of a period are NaN.
+ */
+TA_RetCode MaRibbon(int startIdx, int endIdx, const double *inReal, int nbPeriod, const int *periods,
+                    TA_MAType maType, double *outReal);
+
+/**
+ * The outputs of LINEARREG, LINEARREG_SLOPE, LINEARREG_ANGLE,
+ * LINEARREG_INTERCEPT and TSF in one pass, any output can be NULL.
+ */
+TA_RetCode LinearRegAll(int startIdx, int endIdx, const double *inReal, int period, int *outBegIdx,
+                        int *outNBElement, double *outLinearReg, double *outSlope, double *outAngle,
+                        double *outIntercept, double *outTSF);
+
+/**
+ * The number of outputs of `DmiAll`.
+ */
+const int DMI_OUTPUT_COUNT = 8;
+
+/**
+ * The outputs of ADX, ADXR, DX, PLUS_DI, MINUS_DI, PLUS_DM, MINUS_DM and
+ * ATR, in this order, from the same smoothed DM and TR. Any output can be
+ * NULL, each one has its own begin and length.
+ */
+TA_RetCode DmiAll(int startIdx, int endIdx, const double *inHigh, const double *inLow, const double *inClose,
+                  int period, int outBegIdx[DMI_OUTPUT_COUNT], int outNBElement[DMI_OUTPUT_COUNT],
+                  double *const outputs[DMI_OUTPUT_COUNT]);
+
+/**
+ * The outputs of the HT_* functions in one pass, any output can be NULL.
+ * HT_DCPERIOD and HT_PHASOR come from a pipeline of 32 bars, the others
+ * from a pipeline of 63 bars, one call evaluates the outputs of only one of
+ * them. `unstablePeriod` is the one of the functions.
+ */
+TA_RetCode HtAll(int startIdx, int endIdx, const double *inReal, int unstablePeriod, int *outBegIdx,
+                 int *outNBElement, double *outDCPeriod, double *outInPhase, double *outQuadrature,
+                 double *outDCPhase, double *outSine, double *outLeadSine, double *outTrendline,
+                 int *outTrendMode);
+
+/**
+ * The number of candlestick patterns of `CdlAll`.
+ */
+const int CDL_PATTERN_COUNT = 61;
+
+/**
+ * The names of the TA_CDL* functions, in the order of the pattern indexes.
+ */
+extern const char *const cdlPatternNames[CDL_PATTERN_COUNT];
+
+/**
+ * The index of the pattern `name`, e.g. "CDLDOJI", -1 if there is none.
+ */
+int FindCdlPattern(const char *name);
+
+/**
+ * The candlestick patterns at the indexes `patterns` from the same candle
+ * features. `optInPenetration` is the one of all the patterns which have an
+ * `optInPenetration`, NaN keeps the default of each pattern. `outInteger` is
+ * a nbPattern x (endIdx - startIdx + 1) matrix in row major order, the values
+ * in the lookback of a pattern are 0.
+ */
+TA_RetCode CdlAll(int startIdx, int endIdx, const double *inOpen, const double *inHigh, const double *inLow,
+                  const double *inClose, int nbPattern, const int *patterns, double optInPenetration,
+                  int *outBegIdx, int *outNBElement, int *outInteger);
+
+/**
+ * A CSV file of bars, parsed in parallel into float64 columns.
+ *
+ * A field is a decimal number, an ISO 8601 date, which is read as the UTC
+ * milliseconds since the epoch, or anything else, which is read as NaN.
+ * Quoted fields are not supported.
+ */
+class CsvReader {
+public:
+    struct Options {
+        Options() : delimiter(','), header(true), threads(0) {}
+
+        char delimiter;
+        /** Whether the first line holds the names of the columns. */
+        bool header;
+        /** The names of the columns, instead of the header. */
+        std::vector<std::string> names;
+        /** The columns to read, all of them if empty. */
+        std::vector<std::string> columns;
+        /** The number of threads parsing the file, one per core if 0. */
+        int threads;
+    };
+
+    enum Status {
+        OK,
+        CANNOT_READ,
+        NO_NAMES,
+        NO_COLUMN,
+        TOO_MANY_ROWS,
+    };
+
+    /**
+     * Read the file and count its rows, `error` is set if it fails.
+     */
+    Status Open(const char *path, const Options &options, std::string *error);
+
+    int RowCount() const { return rowCount; }
+
+    /**
+     * The names of the columns read, in the order of `Parse`.
+     */
+    const std::vector<std::string> &ColumnNames() const { return columnNames; }
+
+    /**
+     * Parse the rows into `columns`, one buffer of `RowCount()` values per
+     * column.
+     */
+    void Parse(double *const *columns) const;
+
+private:
+    struct Chunk {
+        size_t begin;
+        size_t end;
+        int row;
+        int rows;
+    };
+
+    std::vector<char> content;
+    char delimiter;
+    std::vector<int> fieldColumns;
+    std::vector<std::string> columnNames;
+    std::vector<Chunk> chunks;
+    int rowCount;
+};
+
+/**
+ * A series file mapped in memory copy on write, so that writing to a
+ * column changes the memory but not the file. It is unmapped when it is
+ * released by all its users, from any thread.
+ *
+ * A series file is a header of 32 bytes followed by the columns, a column is
+ * `rows` contiguous float64 in the byte order of the machine:
+ *
+ *   offset  0: "TASERIES"
+ *   offset  8: uint64 number of columns
+ *   offset 16: uint64 number of rows
+ *   offset 24: uint64 reserved, 0
+ *   offset 32: column 0, column 1, ...
+ */
+class SeriesFile {
+public:
+    /**
+     * Map the file at `path`, returns NULL and sets `error` if it fails.
+     * The caller holds the first reference.
+     */
+    static SeriesFile *Open(const char *path, std::string *error);
+
+    int ColumnCount() const { return columnCount; }
+    int RowCount() const { return rowCount; }
+    double *Column(int column) const;
+
+    void Retain() { refs++; }
+    void Release();
+
+private:
+    SeriesFile() {}
+    ~SeriesFile();
+    SeriesFile(const SeriesFile &);
+    SeriesFile &operator=(const SeriesFile &);
+
+    void *address;
+    size_t size;
+    void *mapping;
+    int columnCount;
+    int rowCount;
+    std::atomic<int> refs;
+};
+
+/**
+ * Write the series file `path` of `columnCount` columns of `rowCount`
+ * values, see `SeriesFile`. Returns false and sets `error` if it fails.
+ */
+bool WriteSeriesFile(const char *path, const double *const *columns, int columnCount, int rowCount,
+                     std::string *error);
+
+/**
+ * The columns of OHLCV bars, `time` is the start of a bar in milliseconds.
+ */
+struct Bars {
+    std::vector<double> time;
+    std::vector<double> open;
+    std::vector<double> high;
+    std::vector<double> low;
+    std::vector<double> close;
+    std::vector<double> volume;
+
+    int Size() const { return (int) time.size(); }
+    void Add(double time, double open, double high, double low, double close, double volume);
+};
+
+/**
+ * Aggregate trades into OHLCV bars, the trades are fed in order, in any
+ * number of calls. A bar is complete when a trade closes it, or when the next
+ * trade does not belong to it for the time bars, the incomplete bar is kept
+ * for the next call.
+ */
+class BarAggregator {
+public:
+    enum Type {
+        /** A bar per interval of `barSize` milliseconds since the epoch. */
+        TIME,
+        /** A bar per `barSize` trades. */
+        TICK,
+        /** A bar per `barSize` of volume. */
+        VOLUME,
+        /** A bar per `barSize` of price x size. */
+        DOLLAR,
+    };
+
+    BarAggregator(Type type, double barSize)
+        : type(type), barSize(barSize), trades(0), time(0), open(0), high(0), low(0), close(0), volume(0),
+          amount(0), end(0) {}
+
+    /**
+     * Add `count` trades, the completed bars are appended to `bars`. The time
+     * of a bar is the start of its interval for the time bars, the time of
+     * its first trade otherwise. The
+     * trades with a NaN price are skipped. A volume or dollar bar ends with
+     * the trade which reaches `barSize`, trades are not split across bars.
+     */
+    void Add(const double *price, const double *size, const double *time, int count, Bars *bars);
+
+    /**
+     * Append the incomplete bar to `bars` and start a new one, returns false
+     * if there is none.
+     */
+    bool Flush(Bars *bars);
+
+private:
+    void Close(Bars *bars);
+
+    Type type;
+    double barSize;
+    int trades;
+    double time, open, high, low, close, volume, amount;
+    /** The end of the interval of the current time bar. */
+    double end;
+};
+
+/**
+ * The bars of several timeframes derived from the same base bars, the
+ * higher timeframes are aggregated as the base bars are appended, and the
+ * indicators registered on each timeframe are evaluated over its bars.
+ *
+ * The intervals are in milliseconds, the bars of a timeframe are aligned on
+ * the epoch. A higher bar is complete with the base bar which ends at or
+ * after the end of its interval, or with the first base bar of a later
+ * interval if there is a gap, only the complete bars are evaluated.
+ */
+class MultiTimeframe {
+public:
+    /**
+     * The timeframe 0 is the one of the base bars, of `baseInterval`.
+     */
+    explicit MultiTimeframe(double baseInterval);
+
+    /**
+     * Add a timeframe of `interval`, returns its index. The timeframes are
+     * added before the first bars.
+     */
+    int AddTimeframe(double interval);
+
+    int TimeframeCount() const { return (int) timeframes.size(); }
+    double Interval(int timeframe) const { return timeframes[timeframe].interval; }
+
+    /**
+     * The index of the timeframe of `interval`, -1 if there is none.
+     */
+    int FindTimeframe(double interval) const;
+
+    /**
+     * Register the TA function `name` on a timeframe. `inputs` are the names
+     * of the columns of `Bars` for its input columns, see `Function`, and
+     * `optInputs` its optional inputs in order, NaN keeps the default. The
+     * outputs are named `label`, or `label.outputName` if there are several.
+     * Returns false and sets `error` if the function or its inputs are
+     * invalid.
+     */
+    bool AddIndicator(int timeframe, const std::string &label, const char *name,
+                      const std::vector<std::string> &inputs, const std::vector<double> &optInputs,
+                      std::string *error);
+
+    /**
+     * Append `count` base bars, the `time` of a bar is the start of its
+     * interval.
+     */
+    void Append(const double *time, const double *open, const double *high, const double *low, const double *close,
+                const double *volume, int count);
+
+    /**
+     * The complete bars of a timeframe.
+     */
+    const Bars &TimeframeBars(int timeframe) const { return timeframes[timeframe].bars; }
+
+    /**
+     * Evaluate the indicators of a timeframe, `outputs` is filled with one
+     * column per output, named in `names`, aligned with its bars, NaN in the
+     * lookback. With `forwardFill`, the columns are aligned with the base bars
+     * instead, a base bar gets the value of the last higher bar complete with
+     * it, so there is no look ahead.
+     */
+    TA_RetCode Evaluate(int timeframe, bool forwardFill, std::vector<std::string> *names,
+                        std::vector<std::vector<double> > *outputs) const;
+
+private:
+    struct Indicator {
+        std::string label;
+        std::string name;
+        std::vector<int> inputs;
+        std::vector<double> optInputs;
+    };
+
+    struct Timeframe {
+        double interval;
+        Bars bars;
+        /** The index of the base bar which completes each bar. */
+        std::vector<int> completedAt;
+        std::vector<Indicator> indicators;
+        /** The bar being aggregated, if `building` is set. */
+        bool building;
+        double time, open, high, low, close, volume;
+    };
+
+    void Complete(Timeframe &timeframe, int baseIndex);
+
+    std::vector<Timeframe> timeframes;
+};
+
+/**
+ * The last bars of many symbols in ring buffers of a fixed capacity, with
+ * indicators updated as each bar is pushed. The memory of all the symbols is
+ * allocated up front, pushing a bar does not allocate.
+ *
+ * The indicators are registered on the store, every symbol has the same
+ * ones. The functions of `streamNames` keep a `Stream` per symbol, a push
+ * adds the bar to its state, so that their values are the ones over all the
+ * bars pushed and do not depend on the capacity. The other functions only
+ * evaluate their newest value, from the bars of their lookback, which is
+ * exact for the functions which do not depend on the bars before it: the
+ * ones with an unstable period, the cumulative ones such as OBV and the
+ * moving averages other than SMA, WMA and TRIMA are rejected. A store is used
+ * by one thread at a time.
+ */
+class Stream;
+
+class BarStore {
+public:
+    /**
+     * The columns of a bar, in the order of `Push`.
+     */
+    enum Column { TIME, OPEN, HIGH, LOW, CLOSE, VOLUME, COLUMN_COUNT };
+
+    /**
+     * The names of the columns, indexed by `Column`: "time", "open", "high",
+     * "low", "close" and "volume".
+     */
+    static const char *const columnNames[COLUMN_COUNT];
+
+    BarStore(int capacity, int maxSymbols);
+    ~BarStore();
+
+    /**
+     * Register an indicator, see `MultiTimeframe::AddIndicator`, its lookback
+     * must fit in the capacity unless it is a stream, and it must be a
+     * stream if it depends on all the bars before. The indicators added
+     * after some bars are evaluated from the next push, the streams start
+     * from the bars in the buffers.
+     */
+    bool AddIndicator(const std::string &label, const char *name, const std::vector<std::string> &inputs,
+                      const std::vector<double> &optInputs, std::string *error);
+
+    /**
+     * The names of the outputs of all the indicators, in the order of the
+     * values of `Push`.
+     */
+    const std::vector<std::string> &OutputNames() const { return outputNames; }
+
+    /**
+     * The index of `symbol`, it is added if it is new. Returns -1 if the
+     * store already has `maxSymbols` symbols.
+     */
+    int AddSymbol(const std::string &symbol);
+
+    /**
+     * The index of `symbol`, -1 if it has no bar.
+     */
+    int FindSymbol(const std::string &symbol) const;
+
+    /**
+     * Append a bar to a symbol, the oldest one is dropped if the buffer is
+     * full. `latest` is set to the newest value of each output, NaN in the
+     * lookback, the integer outputs are converted to `double`.
+     */
+    TA_RetCode Push(int symbol, const double bar[COLUMN_COUNT], double *latest);
+
+    /**
+     * The number of bars of a symbol.
+     */
+    int Size(int symbol) const { return symbols[symbol].size; }
+
+    /**
+     * Copy the `count` last values of a column of a symbol to `values`, the
+     * oldest first.
+     */
+    void Last(int symbol, Column column, int count, double *values) const;
+
+private:
+    BarStore(const BarStore &);
+    BarStore &operator=(const BarStore &);
+
+    struct Indicator {
+        std::unique_ptr<Function> function;
+        std::vector<int> inputs;
+        int outputOffset;
+        /** The saved state of a new stream, empty if it is not a stream. */
+        std::string streamState;
+        /** The stream of each symbol. */
+        std::vector<std::unique_ptr<Stream>> streams;
+    };
+
+    struct Ring {
+        int start;
+        int size;
+    };
+
+    double *Values(int symbol, int column) {
+        return &values[((size_t) symbol * COLUMN_COUNT + column) * capacity];
+    }
+
+    int capacity;
+    int maxSymbols;
+    std::vector<double> values;
+    std::vector<Ring> symbols;
+    std::unordered_map<std::string, int> symbolIndexes;
+    std::vector<Indicator> indicators;
+    std::vector<std::string> outputNames;
+    /** The inputs and outputs of an indicator, out of the rings. */
+    std::vector<double> window;
+    std::vector<void *> outputs;
+};
+
+/**
+ * A TA function evaluated one bar at a time from its state after the
+ * previous bars, with the values of the TA function over the whole history.
+ * The bar in progress can be revised: `UpdateLast` computes the value of a
+ * bar from the committed state without changing it, each call replacing the
+ * previous one, and `Commit` adds the last updated bar to the state once it
+ * is closed.
+ *
+ * The unstable period, the compatibility and the precision are the ones of
+ * the calling thread when the stream is created.
+ */
+class Stream {
+public:
+    /**
+     * Create the stream of `name`, one of `streamNames`, with its optional
+     * inputs in order, NaN keeps the default. Returns NULL and sets `error`
+     * if they are invalid.
+     */
+    static Stream *Create(const char *name, const std::vector<double> &optInputs, std::string *error);
+
+    virtual ~Stream() {}
+
+    /**
+     * The number of bars before the first value.
+     */
+    int Lookback() const { return lookback; }
+
+    /**
+     * The value at a new bar of the columns of `BarStore::Column`, NaN in the
+     * lookback. The real input of EMA, RSI, HT_DCPERIOD, KAMA and T3 is the
+     * close.
+     */
+    virtual double UpdateLast(const double *bar) = 0;
+
+    /**
+     * Add the bar of the last `UpdateLast` to the state, nothing if there is
+     * none.
+     */
+    virtual void Commit() = 0;
+
+    /**
+     * Add `length` closed bars, the columns are indexed by
+     * `BarStore::Column`, the ones which the function does not read may be
+     * NULL. `values` receives the value at each bar, as `Push` would. A
+     * stream restored from the state of the previous bars gives the same
+     * values as a stream over the whole history.
+     */
+    virtual void Run(const double *const *columns, int length, double *values) = 0;
+
+    double Push(const double *bar) {
+        double value = UpdateLast(bar);
+        Commit();
+        return value;
+    }
+
+    /**
+     * Append the state of the committed bars to `blob`, with the function,
+     * its parameters and its settings. The bar of an `UpdateLast` which is
+     * not committed is not saved.
+     */
+    virtual void Save(std::string *blob) const = 0;
+
+    /**
+     * Create the stream saved by `Save`, which continues exactly as the
+     * saved one would. Returns NULL and sets `error` if the blob is not a
+     * saved stream or comes from another version.
+     */
+    static Stream *Restore(const void *data, size_t size, std::string *error);
+
+protected:
+    explicit Stream(int lookback) : lookback(lookback) {}
+
+    int lookback;
+
+private:
+    Stream(const Stream &);
+    Stream &operator=(const Stream &);
+};
+
+/**
+ * The number of functions of `Stream`.
+ */
+const int STREAM_COUNT = 8;
+
+/**
+ * The functions of `Stream`: EMA, RSI, ATR, ADX, SAR, HT_DCPERIOD, KAMA and
+ * T3.
+ */
+extern const char *const streamNames[STREAM_COUNT];
+
+} // namespace talib
+
+#endif
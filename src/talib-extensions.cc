@@ -0,0 +1,269 @@
+/*!
+ * Shared helpers of the hand-written bindings.
+ */
+
+#include "talib-extensions.h"
+#include <cstring>
+
+static const char *const recordFieldNames[RECORD_FIELD_COUNT] = {"Open", "High", "Low", "Close", "Volume"};
+
+AddonData::AddonData() {
+    for (int f = 0; f < RECORD_FIELD_COUNT; f++) {
+        recordFields[f].Reset(Nan::New(recordFieldNames[f]).ToLocalChecked());
+    }
+}
+
+AddonData::~AddonData() {
+    for (int f = 0; f < RECORD_FIELD_COUNT; f++) {
+        recordFields[f].Reset();
+    }
+    contextTemplate.Reset();
+}
+
+v8::Local<v8::Value> AddonData::New() {
+    AddonData *data = new AddonData();
+    node::AddEnvironmentCleanupHook(v8::Isolate::GetCurrent(), Delete, data);
+    return Nan::New<v8::External>(data);
+}
+
+AddonData *AddonData::From(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    return static_cast<AddonData *>(info.Data().As<v8::External>()->Value());
+}
+
+void AddonData::Delete(void *data) {
+    delete static_cast<AddonData *>(data);
+}
+
+bool RealInput::Init(v8::Local<v8::Value> value, const char *name) {
+    return Init(value, name, -1);
+}
+
+bool RealInput::Init(v8::Local<v8::Value> value, const char *name, int length) {
+    if (value->IsFloat64Array()) {
+        Nan::TypedArrayContents<double> contents(value);
+        data = *contents;
+        this->length = (int) contents.length();
+        if (this->length < length) {
+            char error[100];
+            snprintf(error, sizeof(error), "`%s` is shorter than the first input", name);
+            Nan::ThrowRangeError(error);
+            return false;
+        }
+        return true;
+    }
+    if (!value->IsArray()) {
+        char error[100];
+        snprintf(error, sizeof(error), "`%s` must be a number array or a Float64Array", name);
+        Nan::ThrowTypeError(error);
+        return false;
+    }
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    v8::Local<v8::Array> array = v8::Local<v8::Array>::Cast(value);
+    Alloc(length >= 0 ? length : (int) array->Length());
+    for (uint32_t i = 0; i < (uint32_t) this->length; i++) {
+        data[i] = Nan::Get(array, i).ToLocalChecked()->NumberValue(context).FromJust();
+    }
+    return true;
+}
+
+void RealInput::Alloc(int length) {
+    data = new double[length > 0 ? length : 1];
+    this->length = length;
+    owned = true;
+}
+
+int InputLength(v8::Local<v8::Value> value) {
+    if (value->IsFloat64Array()) {
+        return (int) value.As<v8::Float64Array>()->Length();
+    }
+    if (value->IsArray()) {
+        return (int) value.As<v8::Array>()->Length();
+    }
+    return 0;
+}
+
+int OptionalInt(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, int defaults) {
+    v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
+    return info.Length() > index && info[index]->IsInt32() ? info[index]->Int32Value(context).FromJust() : defaults;
+}
+
+bool ReadRange(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, int inLength, int lookback,
+               int *startIdx, int *endIdx, int *outLength) {
+    *startIdx = OptionalInt(info, index, 0);
+    *endIdx = OptionalInt(info, index + 1, inLength - 1);
+    *outLength = 0;
+    if (inLength == 0) {
+        return true;
+    }
+    if (*startIdx < 0 || *endIdx >= inLength || *startIdx > *endIdx) {
+        Nan::ThrowRangeError("`startIdx` or `endIdx` out of range");
+        return false;
+    }
+    int temp = lookback > *startIdx ? lookback : *startIdx;
+    *outLength = temp > *endIdx ? 0 : *endIdx - temp + 1;
+    return true;
+}
+
+bool ReadFunctionNames(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, const char *fused,
+                       const char *const *names, int count, bool *requested) {
+    bool all = info.Length() <= index || info[index]->IsUndefined() || info[index]->IsNull();
+    for (int f = 0; f < count; f++) {
+        requested[f] = all;
+    }
+    if (all) {
+        return true;
+    }
+    if (!info[index]->IsArray()) {
+        Nan::ThrowTypeError("`optOutputs` must be an array of function names");
+        return false;
+    }
+    v8::Local<v8::Array> array = v8::Local<v8::Array>::Cast(info[index]);
+    for (uint32_t i = 0; i < array->Length(); i++) {
+        Nan::Utf8String name(Nan::Get(array, i).ToLocalChecked());
+        int f = 0;
+        while (f < count && (*name == NULL || strcmp(*name, names[f]) != 0)) {
+            f++;
+        }
+        if (f == count) {
+            char error[200];
+            snprintf(error, sizeof(error), "`%s` is not one of the functions of %s", *name ? *name : "", fused);
+            Nan::ThrowTypeError(error);
+            return false;
+        }
+        requested[f] = true;
+    }
+    return true;
+}
+
+v8::Local<v8::Array> NewRealArray(const double *values, int length) {
+    v8::Local<v8::Array> array = Nan::New<v8::Array>(length);
+    for (uint32_t i = 0; i < (uint32_t) length; i++) {
+        Nan::Set(array, i, Nan::New<v8::Number>(values[i]));
+    }
+    return array;
+}
+
+v8::Local<v8::Array> NewIntegerArray(const int *values, int length) {
+    v8::Local<v8::Array> array = Nan::New<v8::Array>(length);
+    for (uint32_t i = 0; i < (uint32_t) length; i++) {
+        Nan::Set(array, i, Nan::New<v8::Number>(values[i]));
+    }
+    return array;
+}
+
+bool ReadOutputEncoding(v8::Local<v8::Value> options, OutputEncoding *encoding) {
+    *encoding = OUTPUT_ENCODING_ARRAY;
+    if (options->IsUndefined() || options->IsNull()) {
+        return true;
+    }
+    if (!options->IsObject()) {
+        Nan::ThrowTypeError("`options` must be an object");
+        return false;
+    }
+    v8::Local<v8::Value> value = Nan::Get(options.As<v8::Object>(), Nan::New("encoding").ToLocalChecked()).ToLocalChecked();
+    if (value->IsUndefined()) {
+        return true;
+    }
+    int number = value->IsInt32() ? value->Int32Value(Nan::GetCurrentContext()).FromJust() : -1;
+    if (number != OUTPUT_ENCODING_ARRAY && number != OUTPUT_ENCODING_INT8 && number != OUTPUT_ENCODING_SPARSE) {
+        Nan::ThrowRangeError("`encoding` must be one of `OutputEncoding`");
+        return false;
+    }
+    *encoding = (OutputEncoding) number;
+    return true;
+}
+
+v8::Local<v8::Value> NewIntegerOutput(const int *values, int length, int scale, OutputEncoding encoding) {
+    if (encoding == OUTPUT_ENCODING_ARRAY) {
+        return NewIntegerArray(values, length);
+    }
+    if (encoding == OUTPUT_ENCODING_INT8) {
+        v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), length);
+        v8::Local<v8::Int8Array> array = v8::Int8Array::New(buffer, 0, length);
+        Nan::TypedArrayContents<int8_t> contents(array);
+        for (int i = 0; i < length; i++) {
+            (*contents)[i] = (int8_t) (values[i] / scale);
+        }
+        return array;
+    }
+    int count = 0;
+    for (int i = 0; i < length; i++) {
+        if (values[i] != 0) {
+            count++;
+        }
+    }
+    int *index;
+    v8::Local<v8::Int32Array> index_JS = NewInt32Array(count, &index);
+    v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), count);
+    v8::Local<v8::Int8Array> value_JS = v8::Int8Array::New(buffer, 0, count);
+    Nan::TypedArrayContents<int8_t> value(value_JS);
+    for (int i = 0, j = 0; i < length; i++) {
+        if (values[i] != 0) {
+            index[j] = i;
+            (*value)[j] = (int8_t) (values[i] / scale);
+            j++;
+        }
+    }
+    v8::Local<v8::Object> sparse = Nan::New<v8::Object>();
+    Nan::Set(sparse, Nan::New("index").ToLocalChecked(), index_JS);
+    Nan::Set(sparse, Nan::New("value").ToLocalChecked(), value_JS);
+    return sparse;
+}
+
+v8::Local<v8::Float64Array> NewFloat64Array(int length, double **data) {
+    v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), length * sizeof(double));
+    v8::Local<v8::Float64Array> array = v8::Float64Array::New(buffer, 0, length);
+    Nan::TypedArrayContents<double> contents(array);
+    *data = *contents;
+    return array;
+}
+
+v8::Local<v8::Int32Array> NewInt32Array(int length, int **data) {
+    v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), length * sizeof(int));
+    v8::Local<v8::Int32Array> array = v8::Int32Array::New(buffer, 0, length);
+    Nan::TypedArrayContents<int> contents(array);
+    *data = *contents;
+    return array;
+}
+
+v8::Local<v8::Float64Array> NewFloat64Array(const std::vector<double> &values) {
+    double *data;
+    v8::Local<v8::Float64Array> array = NewFloat64Array((int) values.size(), &data);
+    if (!values.empty()) {
+        memcpy(data, values.data(), values.size() * sizeof(double));
+    }
+    return array;
+}
+
+v8::Local<v8::Object> NewBars(const talib::Bars &bars) {
+    v8::Local<v8::Object> result = Nan::New<v8::Object>();
+    Nan::Set(result, Nan::New("time").ToLocalChecked(), NewFloat64Array(bars.time));
+    Nan::Set(result, Nan::New("open").ToLocalChecked(), NewFloat64Array(bars.open));
+    Nan::Set(result, Nan::New("high").ToLocalChecked(), NewFloat64Array(bars.high));
+    Nan::Set(result, Nan::New("low").ToLocalChecked(), NewFloat64Array(bars.low));
+    Nan::Set(result, Nan::New("close").ToLocalChecked(), NewFloat64Array(bars.close));
+    Nan::Set(result, Nan::New("volume").ToLocalChecked(), NewFloat64Array(bars.volume));
+    return result;
+}
+
+void ThrowRetCode(const char *name, TA_RetCode retCode) {
+    TA_RetCodeInfo retCodeInfo;
+    TA_SetRetCodeInfo(retCode, &retCodeInfo);
+    char error[200];
+    snprintf(error, sizeof(error), "%s ERROR: %s - %s", name, retCodeInfo.enumStr, retCodeInfo.infoStr);
+    Nan::ThrowError(error);
+}
+
+void InitExtensions(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    InitFused(exports, data);
+    InitBatch(exports, data);
+    InitSettings(exports, data);
+    InitContext(exports, data);
+    InitSeries(exports, data);
+    InitArrow(exports, data);
+    InitCsv(exports, data);
+    InitBars(exports, data);
+    InitTimeframes(exports, data);
+    InitStore(exports, data);
+    InitStream(exports, data);
+}
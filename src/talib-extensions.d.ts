@@ -0,0 +1,831 @@
+/*!
+ * The declarations of the bindings which are not generated from
+ * ta_func_api.xml, they are re-exported by talib-binding.generated.d.ts.
+ */
+
+import { MATypes } from "./talib-binding.generated";
+
+/**
+ * LINEARREG_ALL - Linear Regression, Slope, Angle, Intercept and Time Series
+ * Forecast in a single pass, the outputs are the same as calling
+ * `LINEARREG`, `LINEARREG_SLOPE`, `LINEARREG_ANGLE`, `LINEARREG_INTERCEPT`
+ * and `TSF` with the same arguments.
+ *
+ * @param {number[] | Float64Array} inReal - Double Array
+ * @param {number} [optTime_Period=14] - Number of period
+ * @param {number} [startIdx=0] - The start index to process
+ * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
+ * @returns {number[][]} - [outLinearReg, outSlope, outAngle, outIntercept, outTSF] (Double Array)
+ */
+export declare function LINEARREG_ALL(
+  inReal: number[] | Float64Array,
+  optTime_Period?: number,
+  startIdx?: number,
+  endIdx?: number
+): [number[], number[], number[], number[], number[]];
+
+/**
+ * HT_ALL - Hilbert Transform - Dominant Cycle Period, Dominant Cycle Phase,
+ * Phasor Components, SineWave, Instantaneous Trendline and Trend vs Cycle
+ * Mode, the outputs are the same as calling the `HT_*` functions with the
+ * same arguments.
+ *
+ * The Hilbert Transform of `HT_DCPERIOD` and `HT_PHASOR` warms up from a
+ * different bar than the one of the other functions, it is evaluated once for
+ * each of the two groups. The outputs of the functions not in `optOutputs` are
+ * `null`.
+ *
+ * @param {number[] | Float64Array} inReal - Double Array
+ * @param {string[]} [optOutputs] - The names of the `HT_*` functions to evaluate, default is all of them
+ * @param {number} [startIdx=0] - The start index to process
+ * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
+ * @param {EncodingOptions} [options] - The encoding of outInteger, default is a `number[]`
+ * @returns {number[][]} - [outDCPeriod, outDCPhase, outInPhase, outQuadrature, outSine, outLeadSine, outTrendLine, outInteger] (Double Array, Integer Array for outInteger)
+ */
+export declare function HT_ALL(
+  inReal: number[] | Float64Array,
+  optOutputs?: Array<'HT_DCPERIOD' | 'HT_DCPHASE' | 'HT_PHASOR' | 'HT_SINE' | 'HT_TRENDLINE' | 'HT_TRENDMODE'> | null,
+  startIdx?: number,
+  endIdx?: number,
+  options?: EncodingOptions & { encoding?: OutputEncoding.Array }
+): [
+  number[] | null, number[] | null, number[] | null, number[] | null,
+  number[] | null, number[] | null, number[] | null, number[] | null
+];
+export declare function HT_ALL(
+  inReal: number[] | Float64Array,
+  optOutputs: Array<'HT_DCPERIOD' | 'HT_DCPHASE' | 'HT_PHASOR' | 'HT_SINE' | 'HT_TRENDLINE' | 'HT_TRENDMODE'> | null | undefined,
+  startIdx: number | undefined,
+  endIdx: number | undefined,
+  options: EncodingOptions
+): [
+  number[] | null, number[] | null, number[] | null, number[] | null,
+  number[] | null, number[] | null, number[] | null, IntegerOutput | null
+];
+
+/**
+ * DMI_ALL - Directional Movement system, the outputs are the same as calling
+ * `ADX`, `ADXR`, `DX`, `PLUS_DI`, `MINUS_DI`, `PLUS_DM`, `MINUS_DM` and `ATR`
+ * with the same arguments, including their unstable periods.
+ *
+ * The smoothed true range and directional movements are shared by all the
+ * functions, they are evaluated in a single pass unless `startIdx` is beyond
+ * the lookback of some of them. The outputs of the functions not in
+ * `optOutputs` are `null`.
+ *
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
+ * @param {number} [optTime_Period=14] - Number of period, from 2 to 100000
+ * @param {string[]} [optOutputs] - The names of the functions to evaluate, default is all of them
+ * @param {number} [startIdx=0] - The start index to process
+ * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
+ * @returns {number[][]} - [outADX, outADXR, outDX, outPlusDI, outMinusDI, outPlusDM, outMinusDM, outATR] (Double Array)
+ */
+export declare function DMI_ALL(
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
+  optTime_Period?: number,
+  optOutputs?: Array<'ADX' | 'ADXR' | 'DX' | 'PLUS_DI' | 'MINUS_DI' | 'PLUS_DM' | 'MINUS_DM' | 'ATR'> | null,
+  startIdx?: number,
+  endIdx?: number,
+  options?: EncodingOptions & { encoding?: OutputEncoding.Array }
+): [
+  number[] | null, number[] | null, number[] | null, number[] | null,
+  number[] | null, number[] | null, number[] | null, number[] | null
+];
+
+/**
+ * The names of the candlestick pattern functions evaluated by `CDL_ALL`.
+ */
+export declare type CandlePattern =
+  'CDL2CROWS' | 'CDL3BLACKCROWS' | 'CDL3INSIDE' | 'CDL3LINESTRIKE'
+  | 'CDL3OUTSIDE' | 'CDL3STARSINSOUTH' | 'CDL3WHITESOLDIERS'
+  | 'CDLABANDONEDBABY' | 'CDLADVANCEBLOCK' | 'CDLBELTHOLD' | 'CDLBREAKAWAY'
+  | 'CDLCLOSINGMARUBOZU' | 'CDLCONCEALBABYSWALL' | 'CDLCOUNTERATTACK'
+  | 'CDLDARKCLOUDCOVER' | 'CDLDOJI' | 'CDLDOJISTAR' | 'CDLDRAGONFLYDOJI'
+  | 'CDLENGULFING' | 'CDLEVENINGDOJISTAR' | 'CDLEVENINGSTAR'
+  | 'CDLGAPSIDESIDEWHITE' | 'CDLGRAVESTONEDOJI' | 'CDLHAMMER' | 'CDLHANGINGMAN'
+  | 'CDLHARAMI' | 'CDLHARAMICROSS' | 'CDLHIGHWAVE' | 'CDLHIKKAKE'
+  | 'CDLHIKKAKEMOD' | 'CDLHOMINGPIGEON' | 'CDLIDENTICAL3CROWS' | 'CDLINNECK'
+  | 'CDLINVERTEDHAMMER' | 'CDLKICKING' | 'CDLKICKINGBYLENGTH'
+  | 'CDLLADDERBOTTOM' | 'CDLLONGLEGGEDDOJI' | 'CDLLONGLINE' | 'CDLMARUBOZU'
+  | 'CDLMATCHINGLOW' | 'CDLMATHOLD' | 'CDLMORNINGDOJISTAR' | 'CDLMORNINGSTAR'
+  | 'CDLONNECK' | 'CDLPIERCING' | 'CDLRICKSHAWMAN' | 'CDLRISEFALL3METHODS'
+  | 'CDLSEPARATINGLINES' | 'CDLSHOOTINGSTAR' | 'CDLSHORTLINE'
+  | 'CDLSPINNINGTOP' | 'CDLSTALLEDPATTERN' | 'CDLSTICKSANDWICH' | 'CDLTAKURI'
+  | 'CDLTASUKIGAP' | 'CDLTHRUSTING' | 'CDLTRISTAR' | 'CDLUNIQUE3RIVER'
+  | 'CDLUPSIDEGAP2CROWS' | 'CDLXSIDEGAP3METHODS';
+
+/**
+ * The `CDL*` functions, in the default order of the rows of `CDL_ALL`.
+ */
+export declare const CDL_PATTERNS: CandlePattern[];
+
+/**
+ * CDL_ALL - All the candlestick patterns in a single pass, the outputs are
+ * the same as calling the `CDL*` functions with the same arguments. The
+ * functions with an `optInPenetration` (`CDLABANDONEDBABY`,
+ * `CDLDARKCLOUDCOVER`, `CDLEVENINGDOJISTAR`, `CDLEVENINGSTAR`,
+ * `CDLMORNINGDOJISTAR` and `CDLMORNINGSTAR`) all use `options.penetration`,
+ * or their own default value if it is missing.
+ *
+ * The real body, shadows, range and color of each candle and the average of
+ * each candle setting are computed once per bar for all the patterns. The
+ * result is a `patterns.length` x `(endIdx - startIdx + 1)` matrix in row
+ * major order: the output of `patterns[r]` at the index `startIdx + c` is at
+ * `r * (endIdx - startIdx + 1) + c`. The values in the lookback of a pattern
+ * are 0. The averages are summed from a different bar than the function does,
+ * a pattern can only differ from its function when a candle is within
+ * rounding of the limit of the setting.
+ *
+ * @param {number[] | Float64Array} inOpen - Open
+ * @param {number[] | Float64Array} inHigh - High
+ * @param {number[] | Float64Array} inLow - Low
+ * @param {number[] | Float64Array} inClose - Close
+ * @param {CandlePattern[]} [patterns=CDL_PATTERNS] - The functions to evaluate, one row each
+ * @param {number} [startIdx=0] - The start index to process
+ * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
+ * @param {CdlAllOptions} [options] - The encoding of the matrix, default is an `Int32Array`, and the penetration
+ * @returns {Int32Array} - The matrix of the patterns
+ */
+export declare function CDL_ALL(
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
+  patterns?: CandlePattern[] | null,
+  startIdx?: number,
+  endIdx?: number,
+  options?: CdlAllOptions & { encoding?: OutputEncoding.Array }
+): Int32Array;
+export declare function CDL_ALL(
+  inOpen: number[] | Float64Array,
+  inHigh: number[] | Float64Array,
+  inLow: number[] | Float64Array,
+  inClose: number[] | Float64Array,
+  patterns: CandlePattern[] | null | undefined,
+  startIdx: number | undefined,
+  endIdx: number | undefined,
+  options: CdlAllOptions
+): Int32Array | Int8Array | SparseOutput;
+
+/**
+ * maRibbon - The same Moving Average at several periods, the input is read
+ * once for all the periods.
+ *
+ * The result is a `periods.length` x `(endIdx - startIdx + 1)` matrix in row
+ * major order: the value of the period `periods[r]` at the index
+ * `startIdx + c` is at `r * (endIdx - startIdx + 1) + c`. The values in the
+ * lookback of a period are `NaN`. The values of `EMA` are the same as `MA`,
+ * `SMA`, `WMA` and `TRIMA` are evaluated from compensated prefix sums and may
+ * differ from `MA` in the last digits.
+ *
+ * @param {number[] | Float64Array} inReal - Double Array
+ * @param {number[]} periods - The periods, from 1 to 100000
+ * @param {MATypes} [optMA_Type=SMA] - Type of Moving Average
+ * @param {number} [startIdx=0] - The start index to process
+ * @param {number} [endIdx=inLength-1] - The end index to process, please not that the value is included, default is the input records length - 1
+ * @returns {Float64Array} - The matrix of the Moving Averages
+ */
+export declare function maRibbon(
+  inReal: number[] | Float64Array,
+  periods: number[],
+  optMA_Type?: MATypes,
+  startIdx?: number,
+  endIdx?: number
+): Float64Array;
+
+/**
+ * The precision of the running sums of SUM, SMA, WMA and TRIMA, which are
+ * also used by the functions based on them, such as MA and BBANDS.
+ */
+export declare enum Precision {
+  /**
+   * Plain double sums, the error grows with the input length.
+   */
+  Default = 0,
+  /**
+   * Neumaier compensated sums, the error does not depend on the input
+   * length, about 2x to 4x slower.
+   */
+  Compensated = 1
+}
+
+/**
+ * TA_SetPrecision - Set the precision of the running sums, it applies to
+ * all the following calls, of all the threads.
+ *
+ * @param {Precision} precision - The precision
+ */
+export declare function setPrecision(precision: Precision): void;
+
+/**
+ * TA_GetPrecision - Get the precision of the running sums
+ *
+ * @returns {Precision} - The precision
+ */
+export declare function getPrecision(): Precision;
+
+/**
+ * The non zero values of a pattern or trend mode output, `index[i]` is the
+ * position of `value[i]` in the `Array` encoding of the output.
+ */
+export declare interface SparseOutput {
+  index: Int32Array;
+  value: Int8Array;
+}
+
+/**
+ * A pattern or trend mode output, see `OutputEncoding`.
+ */
+export declare type IntegerOutput = number[] | Int8Array | SparseOutput;
+
+/**
+ * The encoding of the outputs of `CDL_ALL` and of the trend mode of
+ * `HT_ALL`, the `CDL*` functions and `HT_TRENDMODE` always return a
+ * `number[]`. The `Int8Array` and `Sparse` encodings store the pattern values
+ * divided by 10, from -20 to 20, and the trend mode as is. A single pattern
+ * is encoded by `CDL_ALL` with `patterns` of one function.
+ */
+export declare enum OutputEncoding {
+  /**
+   * A `number[]`, an `Int32Array` for `CDL_ALL`.
+   */
+  Array = 0,
+  /**
+   * An `Int8Array`, one byte per bar.
+   */
+  Int8Array = 1,
+  /**
+   * A `SparseOutput` of the non zero values.
+   */
+  Sparse = 2
+}
+
+/**
+ * The options of `HT_ALL` and `CDL_ALL`.
+ */
+export interface EncodingOptions {
+  /**
+   * The encoding of the integer outputs, default is `OutputEncoding.Array`.
+   */
+  encoding?: OutputEncoding;
+}
+
+/**
+ * The options of `CDL_ALL`.
+ */
+export interface CdlAllOptions extends EncodingOptions {
+  /**
+   * The `optInPenetration` of the patterns which have one, from 0, default
+   * is the one of each pattern.
+   */
+  penetration?: number;
+}
+
+/**
+ * The functions which have an unstable period, see `Context.setUnstablePeriod`.
+ */
+export declare enum FuncUnstId {
+  ADX = 0,
+  ADXR = 1,
+  ATR = 2,
+  CMO = 3,
+  DX = 4,
+  EMA = 5,
+  HT_DCPERIOD = 6,
+  HT_DCPHASE = 7,
+  HT_PHASOR = 8,
+  HT_SINE = 9,
+  HT_TRENDLINE = 10,
+  HT_TRENDMODE = 11,
+  IMI = 12,
+  KAMA = 13,
+  MAMA = 14,
+  MFI = 15,
+  MINUS_DI = 16,
+  MINUS_DM = 17,
+  NATR = 18,
+  PLUS_DI = 19,
+  PLUS_DM = 20,
+  RSI = 21,
+  STOCHRSI = 22,
+  T3 = 23,
+  /**
+   * All of them, only for `setUnstablePeriod`.
+   */
+  ALL = 24
+}
+
+/**
+ * The compatibility of the functions with other software.
+ */
+export declare enum Compatibility {
+  Default = 0,
+  Metastock = 1
+}
+
+/**
+ * The candle settings, the meaning of "long body", "near" etc. in the `CDL*`
+ * functions.
+ */
+export declare enum CandleSettingType {
+  BodyLong = 0,
+  BodyVeryLong = 1,
+  BodyShort = 2,
+  BodyDoji = 3,
+  ShadowLong = 4,
+  ShadowVeryLong = 5,
+  ShadowShort = 6,
+  ShadowVeryShort = 7,
+  Near = 8,
+  Far = 9,
+  Equal = 10,
+  /**
+   * All of them, only for `restoreCandleDefaultSettings`.
+   */
+  All = 11
+}
+
+/**
+ * The range a candle setting is compared with.
+ */
+export declare enum RangeType {
+  RealBody = 0,
+  HighLow = 1,
+  Shadows = 2
+}
+
+/**
+ * The settings of the TA functions: the unstable periods, the compatibility,
+ * the precision and the candle settings. A new context is a copy of the
+ * global settings, it is used by the calls made in `withContext`.
+ */
+export declare class Context {
+  constructor();
+
+  /**
+   * TA_SetUnstablePeriod - Set the number of values dropped at the start of
+   * the output of a function, to let it converge.
+   *
+   * @param {FuncUnstId} id - The function, or `FuncUnstId.ALL`
+   * @param {number} unstablePeriod - The number of values
+   */
+  setUnstablePeriod(id: FuncUnstId, unstablePeriod: number): void;
+
+  /**
+   * TA_GetUnstablePeriod - Get the unstable period of a function
+   *
+   * @param {FuncUnstId} id - The function
+   * @returns {number} - The number of values
+   */
+  getUnstablePeriod(id: FuncUnstId): number;
+
+  /**
+   * TA_SetCompatibility - Set the compatibility with other software
+   *
+   * @param {Compatibility} compatibility - The compatibility
+   */
+  setCompatibility(compatibility: Compatibility): void;
+
+  /**
+   * TA_GetCompatibility - Get the compatibility with other software
+   *
+   * @returns {Compatibility} - The compatibility
+   */
+  getCompatibility(): Compatibility;
+
+  /**
+   * TA_SetPrecision - Set the precision of the running sums
+   *
+   * @param {Precision} precision - The precision
+   */
+  setPrecision(precision: Precision): void;
+
+  /**
+   * TA_GetPrecision - Get the precision of the running sums
+   *
+   * @returns {Precision} - The precision
+   */
+  getPrecision(): Precision;
+
+  /**
+   * TA_SetCandleSettings - A candle is compared with the average of the
+   * `rangeType` of the `avgPeriod` previous candles multiplied by `factor`,
+   * or with its own range if `avgPeriod` is 0.
+   *
+   * @param {CandleSettingType} settingType - The setting
+   * @param {RangeType} rangeType - The range to average
+   * @param {number} avgPeriod - The number of previous candles
+   * @param {number} factor - The factor of the average
+   */
+  setCandleSettings(settingType: CandleSettingType, rangeType: RangeType, avgPeriod: number, factor: number): void;
+
+  /**
+   * TA_RestoreCandleDefaultSettings - Restore the default of a setting
+   *
+   * @param {CandleSettingType} settingType - The setting, or `CandleSettingType.All`
+   */
+  restoreCandleDefaultSettings(settingType: CandleSettingType): void;
+}
+
+/**
+ * withContext - Call `callback` with the settings of `context`, the settings
+ * apply to all the calls made by `callback`, single functions and batches.
+ * The settings used before are restored when `callback` returns or throws.
+ * Each thread has its own current context, so workers can run with different
+ * settings at the same time.
+ *
+ * @param {Context} context - The settings
+ * @param {() => T} callback - The calls to make
+ * @returns {T} - The result of `callback`
+ */
+export declare function withContext<T>(context: Context, callback: () => T): T;
+
+/**
+ * mapSeries - Map a series file in memory, its columns are returned as
+ * `Float64Array`s over the mapped pages, which the TA functions read in
+ * place. Writing to a column changes the memory, not the file. The file is
+ * unmapped when all its columns are garbage collected.
+ *
+ * A series file is a header of 32 bytes followed by the columns, each one is
+ * `rows` contiguous float64 in the byte order of the machine:
+ *
+ * - offset 0: the 8 bytes "TASERIES"
+ * - offset 8: the number of columns, uint64
+ * - offset 16: the number of rows, uint64
+ * - offset 24: reserved, uint64 0
+ * - offset 32: the columns, one after the other
+ *
+ * Requires Node.js 14 or later.
+ *
+ * @param {string} path - The path of the file
+ * @param {string[]} schema - The names of the columns, in the order of the file
+ * @returns {{[column: string]: Float64Array}} - The columns by name
+ */
+export declare function mapSeries(path: string, schema: string[]): { [column: string]: Float64Array };
+
+/**
+ * An array exported through the Arrow C Data Interface, the addresses of its
+ * `struct ArrowArray` and `struct ArrowSchema`.
+ */
+export interface ArrowColumn {
+  array: bigint;
+  schema: bigint;
+}
+
+/**
+ * callArrow - Call `TA_<name>` on the buffers of float64 Arrow arrays, the
+ * outputs are written to new Arrow arrays, no data goes through JS and no
+ * Arrow library is needed.
+ *
+ * `inputs` are the input series of the function in order, a price input
+ * takes one column for each of its components, in the order open, high,
+ * low, close, volume, open interest. They must have the same length and no
+ * nulls. They are moved, as the interface requires: they are released when
+ * the call returns or throws.
+ *
+ * `outputs` are empty structs allocated by the caller, one per output of
+ * the function, they are filled with nullable arrays of format "g" (or "i"
+ * for the integer outputs) named after the outputs, as long as the inputs.
+ * The values of the lookback region are null. The caller releases them.
+ *
+ * @param {string} name - The name of the function, e.g. "SMA"
+ * @param {ArrowColumn[]} inputs - The input arrays
+ * @param {ArrowColumn[]} outputs - The structs to fill
+ * @param {(number | undefined)[]} [optInputs] - The optional inputs in order, the missing ones keep their default
+ * @returns {number} - The length of the lookback region, the number of leading nulls
+ */
+export declare function callArrow(name: string, inputs: ArrowColumn[], outputs: ArrowColumn[], optInputs?: (number | undefined)[]): number;
+
+/**
+ * The options of `readCsv`.
+ */
+export interface CsvOptions {
+  /** The field delimiter, "," by default */
+  delimiter?: string;
+  /** Whether the first line holds the names of the columns, true by default */
+  header?: boolean;
+  /** The names of the columns, instead of the header */
+  names?: string[];
+  /** The columns to read, all of them by default */
+  columns?: string[];
+}
+
+/**
+ * readCsv - Read the bars of a CSV file into `Float64Array`s, one per column,
+ * which the TA functions read in place. The file is parsed natively, by one
+ * thread per core for large files.
+ *
+ * A field is read as a decimal number, as the UTC milliseconds since the
+ * epoch if it is an ISO 8601 date such as "2020-01-02 09:30:00" or
+ * "2020-01-02T09:30:00.000Z", or as NaN otherwise. The missing fields are
+ * NaN, the empty lines are skipped, quoted fields are not supported.
+ *
+ * @param {string} path - The path of the file
+ * @param {CsvOptions} [options] - The format of the file
+ * @returns {{[column: string]: Float64Array}} - The columns by name
+ */
+export declare function readCsv(path: string, options?: CsvOptions): { [column: string]: Float64Array };
+
+/**
+ * The kinds of bars of `BarAggregator` and `aggregateBars`, with the unit
+ * of their `barSize`.
+ */
+export declare enum BarType {
+  /**
+   * A bar per interval of `barSize` milliseconds, aligned on the epoch, the
+   * intervals without trades have no bar.
+   */
+  Time = 0,
+  /**
+   * A bar per `barSize` trades.
+   */
+  Tick = 1,
+  /**
+   * A bar per `barSize` of traded size, the bar ends with the trade which
+   * reaches it.
+   */
+  Volume = 2,
+  /**
+   * A bar per `barSize` of price x size, the bar ends with the trade which
+   * reaches it.
+   */
+  Dollar = 3
+}
+
+/**
+ * OHLCV bars, one `Float64Array` per column, which the TA functions read in
+ * place. The time of a bar is the start of its interval for the time bars,
+ * the time of its first trade otherwise.
+ */
+export interface Bars {
+  time: Float64Array;
+  open: Float64Array;
+  high: Float64Array;
+  low: Float64Array;
+  close: Float64Array;
+  volume: Float64Array;
+}
+
+/**
+ * Aggregate trades into bars natively, as they arrive. The incomplete bar is
+ * kept between the calls, so a live feed can be pushed in any number of
+ * batches. The trades with a NaN price are skipped.
+ */
+export declare class BarAggregator {
+  /**
+   * @param {BarType} type - The kind of bars
+   * @param {number} barSize - The size of a bar, in the unit of `type`
+   */
+  constructor(type: BarType, barSize: number);
+
+  /**
+   * Add trades in time order, a time bar is complete when a trade of a
+   * later interval arrives, the trades out of order are added to the current
+   * bar.
+   *
+   * @param {number[] | Float64Array} price - The prices
+   * @param {number[] | Float64Array} size - The sizes
+   * @param {number[] | Float64Array} time - The times, in milliseconds
+   * @returns {Bars} - The bars completed by the trades
+   */
+  push(price: number[] | Float64Array, size: number[] | Float64Array, time: number[] | Float64Array): Bars;
+
+  /**
+   * Complete the current bar, e.g. at the end of a time interval without
+   * trades, the next trade starts a new bar.
+   *
+   * @returns {Bars} - The current bar, no bar if it has no trade
+   */
+  flush(): Bars;
+}
+
+/**
+ * aggregateBars - Aggregate trades into bars natively, the same as pushing
+ * them to a new `BarAggregator` and flushing it, the last bar may be
+ * incomplete.
+ *
+ * @param {number[] | Float64Array} price - The prices
+ * @param {number[] | Float64Array} size - The sizes
+ * @param {number[] | Float64Array} time - The times, in milliseconds
+ * @param {BarType} type - The kind of bars
+ * @param {number} barSize - The size of a bar, in the unit of `type`
+ * @returns {Bars} - The bars
+ */
+export declare function aggregateBars(
+  price: number[] | Float64Array,
+  size: number[] | Float64Array,
+  time: number[] | Float64Array,
+  type: BarType,
+  barSize: number
+): Bars;
+
+/**
+ * The bars of several timeframes derived from the same base bars, with
+ * indicators registered per timeframe. The higher timeframes are aggregated
+ * natively as the base bars are pushed, so a strategy on 1m, 5m, 15m and 1h
+ * bars pushes only the 1m bars.
+ *
+ * The intervals are in milliseconds, the bars of a timeframe are aligned on
+ * the epoch. A higher bar is complete with the base bar which ends its
+ * interval, or with the first base bar of a later interval if the base bars
+ * have a gap. The incomplete bar is neither returned nor evaluated.
+ */
+export declare class MultiTimeframe {
+  /**
+   * @param {number} baseInterval - The interval of the base bars
+   * @param {number[]} intervals - The intervals of the higher timeframes
+   */
+  constructor(baseInterval: number, intervals: number[]);
+
+  /**
+   * Register an indicator on a timeframe, the base one or a higher one. Its
+   * outputs are named `label`, or `label.outputName` if it has several.
+   *
+   * @param {number} interval - The interval of the timeframe
+   * @param {string} label - The name of the indicator
+   * @param {string} name - The TA function, e.g. "SMA"
+   * @param {string[]} inputs - The columns of its inputs among "time", "open", "high", "low", "close" and "volume", a price input takes one column for each of its components
+   * @param {(number | undefined)[]} [optInputs] - The optional inputs in order, the missing ones keep their default
+   */
+  addIndicator(interval: number, label: string, name: string, inputs: string[], optInputs?: (number | undefined)[]): void;
+
+  /**
+   * Append base bars, in time order, the `time` of a bar is the start of its
+   * interval.
+   *
+   * @param {Bars} bars - The base bars
+   */
+  push(bars: Bars): void;
+
+  /**
+   * The complete bars of a timeframe.
+   *
+   * @param {number} interval - The interval of the timeframe
+   * @returns {Bars} - The bars
+   */
+  bars(interval: number): Bars;
+
+  /**
+   * Evaluate the indicators of a timeframe over its complete bars, NaN in
+   * the lookback. With `forwardFill`, the outputs are aligned with the base
+   * bars instead: a base bar gets the value of the last higher bar complete
+   * with it, there is no look ahead.
+   *
+   * @param {number} interval - The interval of the timeframe
+   * @param {boolean} [forwardFill=false] - Whether to align the outputs with the base bars
+   * @returns {{[output: string]: Float64Array}} - The outputs by name
+   */
+  evaluate(interval: number, forwardFill?: boolean): { [output: string]: Float64Array };
+}
+
+/**
+ * A bar of `BarStore.push`, the missing fields are NaN.
+ */
+export interface Bar {
+  time?: number;
+  open?: number;
+  high?: number;
+  low?: number;
+  close?: number;
+  volume?: number;
+}
+
+/**
+ * The last `capacity` bars of up to `maxSymbols` symbols, in ring buffers
+ * allocated once, with indicators updated on each bar. The indicators are
+ * registered on the store, every symbol has the same ones.
+ *
+ * EMA, RSI, ATR, ADX, SAR, HT_DCPERIOD, KAMA and T3 keep a `Stream` per
+ * symbol, their values are the ones of a run over all the bars pushed. The
+ * other indicators evaluate only their newest value, from the bars of their
+ * lookback, so they are limited to the functions whose value only depends on
+ * these bars: the functions with an unstable period (CMO, PLUS_DI, ...), the
+ * ones based on an EMA-like moving average (DEMA, MACD, ...) and the
+ * cumulative ones (AD, OBV, ...) cannot be added unless they are streams.
+ */
+export declare class BarStore {
+  /**
+   * @param {number} capacity - The number of bars kept per symbol
+   * @param {number} maxSymbols - The number of symbols
+   */
+  constructor(capacity: number, maxSymbols: number);
+
+  /**
+   * Register an indicator for all the symbols. Its outputs are named
+   * `label`, or `label.outputName` if it has several. Its lookback must fit
+   * in the capacity, unless it is one of the stream functions, which start
+   * from the bars already in the buffers when they are added after some.
+   * Throws a `RangeError` for a function which depends on all the bars
+   * before and is not a stream.
+   *
+   * @param {string} label - The name of the indicator
+   * @param {string} name - The TA function, e.g. "SMA"
+   * @param {string[]} inputs - The columns of its inputs among "time", "open", "high", "low", "close" and "volume", a price input takes one column for each of its components
+   * @param {(number | undefined)[]} [optInputs] - The optional inputs in order, the missing ones keep their default
+   */
+  addIndicator(label: string, name: string, inputs: string[], optInputs?: (number | undefined)[]): void;
+
+  /**
+   * The names of the outputs of all the indicators, in the order of the
+   * values returned by `push`.
+   *
+   * @returns {string[]} - The names
+   */
+  outputNames(): string[];
+
+  /**
+   * Append a bar to a symbol, the oldest one is dropped once the buffer is
+   * full.
+   *
+   * @param {string} symbol - The symbol, it is added on its first bar
+   * @param {Bar} bar - The bar
+   * @returns {Float64Array} - The newest value of each output, NaN in the lookback, the same array is overwritten by the next push
+   */
+  push(symbol: string, bar: Bar): Float64Array;
+
+  /**
+   * The bars of a symbol, the oldest first.
+   *
+   * @param {string} symbol - The symbol
+   * @returns {Bars} - The bars, empty if the symbol has none
+   */
+  bars(symbol: string): Bars;
+}
+
+/**
+ * A TA function evaluated one bar at a time from its state after the
+ * previous bars, with the same values as the function over the whole
+ * history. The bar in progress can be revised with `updateLast`, which does
+ * not change the state, until `commit` adds it once it is closed.
+ *
+ * The streams are EMA, RSI, ATR, ADX, SAR, HT_DCPERIOD, KAMA and T3. The
+ * unstable period, the compatibility and the precision are the ones when
+ * the stream is created.
+ *
+ * The state can be saved with `save` and restored with `new Stream(state)`,
+ * to restart without the history, and `run` continues it over a batch of
+ * new bars: the values are the same as a call over the whole history.
+ */
+export declare class Stream {
+  /**
+   * @param {string} name - The TA function, one of "EMA", "RSI", "ATR", "ADX", "SAR", "HT_DCPERIOD", "KAMA" and "T3"
+   * @param {(number | undefined)[]} [optInputs] - The optional inputs in order, the missing ones keep their default
+   */
+  constructor(name: string, optInputs?: (number | undefined)[]);
+
+  /**
+   * Restore a saved stream, it continues exactly as the saved one would,
+   * with its function, parameters and settings.
+   *
+   * @param {Uint8Array} state - The result of `save`
+   */
+  constructor(state: Uint8Array);
+
+  /**
+   * @returns {number} - The number of bars before the first value
+   */
+  lookback(): number;
+
+  /**
+   * The value at the bar in progress, each call replaces the bar of the
+   * previous one.
+   *
+   * @param {Bar | number} bar - The bar, EMA, RSI, HT_DCPERIOD, KAMA and T3 read its close, a number is a bar whose prices are all that number
+   * @returns {number} - The value, NaN in the lookback
+   */
+  updateLast(bar: Bar | number): number;
+
+  /**
+   * Add the bar of the last `updateLast` to the state, nothing if there is
+   * none.
+   */
+  commit(): void;
+
+  /**
+   * Add a closed bar, same as `updateLast` then `commit`.
+   *
+   * @param {Bar | number} bar - The bar
+   * @returns {number} - The value, NaN in the lookback
+   */
+  push(bar: Bar | number): number;
+
+  /**
+   * Add closed bars, same as a push of each of them.
+   *
+   * @param {number[] | Float64Array | object} input - The closes, or the columns of the bars, the ones which the function does not read may be missing
+   * @returns {Float64Array} - The value at each bar, NaN in the lookback
+   */
+  run(input: number[] | Float64Array | { [column in keyof Bars]?: number[] | Float64Array }): Float64Array;
+
+  /**
+   * The state of the committed bars, in a compact versioned format. The bar
+   * of an `updateLast` which is not committed is not saved.
+   *
+   * @returns {Uint8Array} - The state, see `new Stream(state)`
+   */
+  save(): Uint8Array;
+}
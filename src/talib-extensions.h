@@ -0,0 +1,235 @@
+/*!
+ * The bindings which are not generated from ta_func_api.xml, they are
+ * registered by `Init` of talib-binding.generated.cc.
+ */
+
+#ifndef TALIB_EXTENSIONS_H
+#define TALIB_EXTENSIONS_H
+
+#include <nan.h>
+#include "../ta-lib/c/include/ta_libc.h"
+#include "talib-engine.h"
+
+/**
+ * A `number[]` or `Float64Array` input. The content of a `Float64Array` is
+ * used in place, a `number[]` is copied into a temporary buffer.
+ */
+class RealInput {
+public:
+    RealInput() : data(NULL), length(0), owned(false) {}
+    ~RealInput() {
+        if (owned) {
+            delete[] data;
+        }
+    }
+
+    /**
+     * Read the input, throws a TypeError and returns false if the value is
+     * neither a `number[]` nor a `Float64Array`.
+     */
+    bool Init(v8::Local<v8::Value> value, const char *name);
+
+    /**
+     * Read the first `length` values of the input, as the generated functions
+     * do, the missing values of a `number[]` are NaN. Throws a RangeError and
+     * returns false if a `Float64Array` is shorter.
+     */
+    bool Init(v8::Local<v8::Value> value, const char *name, int length);
+
+    /**
+     * Allocate `length` values to fill, for the record inputs.
+     */
+    void Alloc(int length);
+
+    double *data;
+    int length;
+
+private:
+    RealInput(const RealInput &);
+    RealInput &operator=(const RealInput &);
+
+    bool owned;
+};
+
+/**
+ * The length of a `number[]`, a `Record[]` or a `Float64Array`, 0 for any
+ * other value.
+ */
+int InputLength(v8::Local<v8::Value> value);
+
+/**
+ * Read an optional integer argument, returns `defaults` if it is missing.
+ */
+int OptionalInt(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, int defaults);
+
+/**
+ * Read the optional `startIdx` and `endIdx` at `index` and `index + 1`, and
+ * compute the output length as the generated functions do, `lookback` is
+ * the result of `TA_<FUNC>_Lookback`. Throws and returns false if the range
+ * is invalid.
+ */
+bool ReadRange(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, int inLength, int lookback,
+               int *startIdx, int *endIdx, int *outLength);
+
+/**
+ * Read the optional array of function names at `index` of a fused function,
+ * `requested[f]` is set if `names[f]` is in the array, all of them are set if
+ * the argument is missing or null. Throws and returns false if a name is not
+ * in `names`.
+ */
+bool ReadFunctionNames(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, const char *fused,
+                       const char *const *names, int count, bool *requested);
+
+/**
+ * Copy `length` values to a new JS array.
+ */
+v8::Local<v8::Array> NewRealArray(const double *values, int length);
+
+/**
+ * Copy `length` integers to a new JS array.
+ */
+v8::Local<v8::Array> NewIntegerArray(const int *values, int length);
+
+/**
+ * The encodings of the outputs of the candlestick patterns and of the trend
+ * mode, see the `encoding` option of `HT_ALL` and `CDL_ALL`.
+ */
+enum OutputEncoding {
+    OUTPUT_ENCODING_ARRAY = 0,
+    OUTPUT_ENCODING_INT8 = 1,
+    OUTPUT_ENCODING_SPARSE = 2,
+};
+
+/**
+ * The fields of the records accepted by the generated functions.
+ */
+enum RecordField {
+    RECORD_OPEN = 0,
+    RECORD_HIGH = 1,
+    RECORD_LOW = 2,
+    RECORD_CLOSE = 3,
+    RECORD_VOLUME = 4,
+    RECORD_FIELD_COUNT = 5,
+};
+
+/**
+ * The state of one instance of the addon. The addon is loaded once per
+ * thread, by the main thread and by each worker, every instance has its own
+ * isolate, so the handles and the settings of a thread are kept here instead
+ * of in globals. It is the data of the templates of all the functions, and
+ * it is deleted when the environment of its thread is cleaned up.
+ */
+class AddonData {
+public:
+    /**
+     * Create the data of the addon instance of the current isolate, returns
+     * it wrapped in an `External` to be passed to the function templates.
+     */
+    static v8::Local<v8::Value> New();
+
+    /**
+     * The data of the addon instance which `info` is called from.
+     */
+    static AddonData *From(const Nan::FunctionCallbackInfo<v8::Value> &info);
+
+    /**
+     * The names of the record fields, indexed by `RecordField`.
+     */
+    Nan::Persistent<v8::String> recordFields[RECORD_FIELD_COUNT];
+
+    /**
+     * The template of `Context`, to check the contexts given to `withContext`.
+     */
+    Nan::Persistent<v8::FunctionTemplate> contextTemplate;
+
+private:
+    AddonData();
+    ~AddonData();
+    AddonData(const AddonData &);
+    AddonData &operator=(const AddonData &);
+
+    static void Delete(void *data);
+};
+
+/**
+ * Read the `encoding` of the options object `options`, `OUTPUT_ENCODING_ARRAY`
+ * if the options or the encoding are missing. Throws and returns false if it
+ * is not one of `OutputEncoding`.
+ */
+bool ReadOutputEncoding(v8::Local<v8::Value> options, OutputEncoding *encoding);
+
+/**
+ * Encode `length` pattern or trend mode values with `encoding`: a JS array of
+ * the values, an `Int8Array` of the values divided by `scale`, or
+ * `{index, value}` where `index` is an `Int32Array` of the positions of the
+ * non zero values and `value` an `Int8Array` of these values divided by
+ * `scale`.
+ */
+v8::Local<v8::Value> NewIntegerOutput(const int *values, int length, int scale, OutputEncoding encoding);
+
+/**
+ * Create a `Float64Array` of `length` values, `*data` is set to its content.
+ */
+v8::Local<v8::Float64Array> NewFloat64Array(int length, double **data);
+
+/**
+ * Create an `Int32Array` of `length` values, `*data` is set to its content.
+ */
+v8::Local<v8::Int32Array> NewInt32Array(int length, int **data);
+
+/**
+ * Copy `values` to a new `Float64Array`.
+ */
+v8::Local<v8::Float64Array> NewFloat64Array(const std::vector<double> &values);
+
+/**
+ * The bars as `{time, open, high, low, close, volume}`, one `Float64Array`
+ * per column.
+ */
+v8::Local<v8::Object> NewBars(const talib::Bars &bars);
+
+/**
+ * Throw the error returned by a TA function, as the generated functions do.
+ */
+void ThrowRetCode(const char *name, TA_RetCode retCode);
+
+/**
+ * Register the hand-written functions, `data` is the result of
+ * `AddonData::New`.
+ */
+void InitExtensions(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-fused.cc
+void InitFused(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-batch.cc
+void InitBatch(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-settings.cc
+void InitSettings(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-context.cc
+void InitContext(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-series.cc
+void InitSeries(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-arrow.cc
+void InitArrow(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-csv.cc
+void InitCsv(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-bars.cc
+void InitBars(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-timeframes.cc
+void InitTimeframes(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-store.cc
+void InitStore(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+// talib-stream.cc
+void InitStream(v8::Local<v8::Object> exports, v8::Local<v8::Value> data);
+
+#endif
@@ -0,0 +1,318 @@
+/*!
+ * Fused functions, they evaluate the outputs of several TA functions which
+ * share the same intermediate values in a single pass.
+ */
+
+#include "talib-extensions.h"
+
+/**
+ * LINEARREG_ALL(inReal, optTime_Period?, startIdx?, endIdx?)
+ *   => [outLinearReg, outSlope, outAngle, outIntercept, outTSF]
+ */
+void TA_FUNC_LINEARREG_ALL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    RealInput inReal;
+    if (!inReal.Init(info[0], "inReal")) {
+        return;
+    }
+    int optTime_Period = OptionalInt(info, 1, 14);
+    int lookback = TA_LINEARREG_Lookback(optTime_Period);
+    if (lookback < 0) {
+        ThrowRetCode("TA_LINEARREG_ALL", TA_BAD_PARAM);
+        return;
+    }
+    int startIdx, endIdx, outLength;
+    if (!ReadRange(info, 2, inReal.length, lookback, &startIdx, &endIdx, &outLength)) {
+        return;
+    }
+    const int outCount = 5;
+    double *outAll = new double[outCount * (outLength > 0 ? outLength : 1)];
+    int outBegIdx = 0;
+    int outNBElement = 0;
+    if (outLength > 0) {
+        TA_RetCode result = talib::LinearRegAll(startIdx, endIdx, inReal.data, optTime_Period, &outBegIdx,
+                                                &outNBElement, outAll, outAll + outLength, outAll + 2 * outLength,
+                                                outAll + 3 * outLength, outAll + 4 * outLength);
+        if (result != TA_SUCCESS) {
+            delete[] outAll;
+            ThrowRetCode("TA_LINEARREG_ALL", result);
+            return;
+        }
+    }
+    v8::Local<v8::Array> outAll_JS = Nan::New<v8::Array>(outCount);
+    for (int i = 0; i < outCount; i++) {
+        Nan::Set(outAll_JS, i, NewRealArray(outAll + i * outLength, outNBElement));
+    }
+    info.GetReturnValue().Set(outAll_JS);
+    delete[] outAll;
+}
+
+/**
+ * The HT_* functions evaluated by HT_ALL, in the order of the outputs.
+ * The functions of the same pipeline of talib::HtAll and with the same
+ * unstable period are evaluated by the same call.
+ */
+struct HTFunction {
+    const char *name;
+    TA_FuncUnstId unstId;
+    bool withPhase;
+    int firstOutput;
+    int nbOutput;
+};
+
+static const HTFunction htFunctions[] = {
+    {"HT_DCPERIOD", TA_FUNC_UNST_HT_DCPERIOD, false, 0, 1},
+    {"HT_DCPHASE", TA_FUNC_UNST_HT_DCPHASE, true, 1, 1},
+    {"HT_PHASOR", TA_FUNC_UNST_HT_PHASOR, false, 2, 2},
+    {"HT_SINE", TA_FUNC_UNST_HT_SINE, true, 4, 2},
+    {"HT_TRENDLINE", TA_FUNC_UNST_HT_TRENDLINE, true, 6, 1},
+    {"HT_TRENDMODE", TA_FUNC_UNST_HT_TRENDMODE, true, 7, 1},
+};
+
+static const int htFunctionCount = sizeof(htFunctions) / sizeof(htFunctions[0]);
+static const int htOutputCount = 8;
+
+/**
+ * HT_ALL(inReal, optOutputs?, startIdx?, endIdx?, options?: {encoding?: OutputEncoding})
+ *   => [outDCPeriod, outDCPhase, outInPhase, outQuadrature, outSine, outLeadSine, outTrendLine, outInteger]
+ */
+void TA_FUNC_HT_ALL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    RealInput inReal;
+    if (!inReal.Init(info[0], "inReal")) {
+        return;
+    }
+    const char *names[htFunctionCount];
+    for (int f = 0; f < htFunctionCount; f++) {
+        names[f] = htFunctions[f].name;
+    }
+    bool requested[htFunctionCount];
+    if (!ReadFunctionNames(info, 1, "HT_ALL", names, htFunctionCount, requested)) {
+        return;
+    }
+    OutputEncoding encoding;
+    if (!ReadOutputEncoding(info[4], &encoding)) {
+        return;
+    }
+    v8::Local<v8::Array> outAll_JS = Nan::New<v8::Array>(htOutputCount);
+    for (int i = 0; i < htOutputCount; i++) {
+        Nan::Set(outAll_JS, i, Nan::Null());
+    }
+    bool done[htFunctionCount] = {false};
+    for (int f = 0; f < htFunctionCount; f++) {
+        if (!requested[f] || done[f]) {
+            continue;
+        }
+        bool withPhase = htFunctions[f].withPhase;
+        int unstablePeriod = (int) TA_GetUnstablePeriod(htFunctions[f].unstId);
+        int lookback = (withPhase ? 63 : 32) + unstablePeriod;
+        int startIdx, endIdx, outLength;
+        if (!ReadRange(info, 2, inReal.length, lookback, &startIdx, &endIdx, &outLength)) {
+            return;
+        }
+        double *outReal = new double[(htOutputCount - 1) * (outLength > 0 ? outLength : 1)];
+        int *outInteger = new int[outLength > 0 ? outLength : 1];
+        double *outputs[htOutputCount - 1] = {NULL};
+        bool trendMode = false;
+        for (int g = f; g < htFunctionCount; g++) {
+            if (!requested[g] || done[g] || htFunctions[g].withPhase != withPhase ||
+                (int) TA_GetUnstablePeriod(htFunctions[g].unstId) != unstablePeriod) {
+                continue;
+            }
+            done[g] = true;
+            for (int o = htFunctions[g].firstOutput; o < htFunctions[g].firstOutput + htFunctions[g].nbOutput; o++) {
+                if (o == htOutputCount - 1) {
+                    trendMode = true;
+                } else {
+                    outputs[o] = outReal + o * outLength;
+                }
+            }
+        }
+        int outBegIdx = 0;
+        int outNBElement = 0;
+        if (outLength > 0) {
+            TA_RetCode result = talib::HtAll(startIdx, endIdx, inReal.data, unstablePeriod, &outBegIdx,
+                                             &outNBElement, outputs[0], outputs[2], outputs[3], outputs[1],
+                                             outputs[4], outputs[5], outputs[6], trendMode ? outInteger : NULL);
+            if (result != TA_SUCCESS) {
+                delete[] outReal;
+                delete[] outInteger;
+                ThrowRetCode("TA_HT_ALL", result);
+                return;
+            }
+        }
+        for (int o = 0; o < htOutputCount - 1; o++) {
+            if (outputs[o] != NULL) {
+                Nan::Set(outAll_JS, o, NewRealArray(outputs[o], outNBElement));
+            }
+        }
+        if (trendMode) {
+            Nan::Set(outAll_JS, htOutputCount - 1, NewIntegerOutput(outInteger, outNBElement, 1, encoding));
+        }
+        delete[] outReal;
+        delete[] outInteger;
+    }
+    info.GetReturnValue().Set(outAll_JS);
+}
+
+static const char *dmiFunctions[talib::DMI_OUTPUT_COUNT] = {
+    "ADX", "ADXR", "DX", "PLUS_DI", "MINUS_DI", "PLUS_DM", "MINUS_DM", "ATR",
+};
+
+/**
+ * DMI_ALL(inHigh, inLow, inClose, optTime_Period?, optOutputs?, startIdx?, endIdx?)
+ *   => [outADX, outADXR, outDX, outPlusDI, outMinusDI, outPlusDM, outMinusDM, outATR]
+ */
+void TA_FUNC_DMI_ALL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    RealInput inHigh, inLow, inClose;
+    if (!inHigh.Init(info[0], "inHigh") || !inLow.Init(info[1], "inLow") || !inClose.Init(info[2], "inClose")) {
+        return;
+    }
+    if (inLow.length != inHigh.length || inClose.length != inHigh.length) {
+        Nan::ThrowRangeError("`inHigh`, `inLow` and `inClose` must have the same length");
+        return;
+    }
+    int optTime_Period = OptionalInt(info, 3, 14);
+    if (optTime_Period < 2 || optTime_Period > 100000) {
+        ThrowRetCode("TA_DMI_ALL", TA_BAD_PARAM);
+        return;
+    }
+    bool requested[talib::DMI_OUTPUT_COUNT];
+    if (!ReadFunctionNames(info, 4, "DMI_ALL", dmiFunctions, talib::DMI_OUTPUT_COUNT, requested)) {
+        return;
+    }
+    int startIdx, endIdx, outLength;
+    if (!ReadRange(info, 5, inHigh.length, 0, &startIdx, &endIdx, &outLength)) {
+        return;
+    }
+    double *outAll = new double[talib::DMI_OUTPUT_COUNT * (outLength > 0 ? outLength : 1)];
+    double *outputs[talib::DMI_OUTPUT_COUNT];
+    int outBegIdx[talib::DMI_OUTPUT_COUNT] = {0};
+    int outNBElement[talib::DMI_OUTPUT_COUNT] = {0};
+    for (int o = 0; o < talib::DMI_OUTPUT_COUNT; o++) {
+        outputs[o] = requested[o] ? outAll + o * outLength : NULL;
+    }
+    if (outLength > 0) {
+        TA_RetCode result = talib::DmiAll(startIdx, endIdx, inHigh.data, inLow.data, inClose.data, optTime_Period,
+                                          outBegIdx, outNBElement, outputs);
+        if (result != TA_SUCCESS) {
+            delete[] outAll;
+            ThrowRetCode("TA_DMI_ALL", result);
+            return;
+        }
+    }
+    v8::Local<v8::Array> outAll_JS = Nan::New<v8::Array>(talib::DMI_OUTPUT_COUNT);
+    for (int o = 0; o < talib::DMI_OUTPUT_COUNT; o++) {
+        if (requested[o]) {
+            Nan::Set(outAll_JS, o, NewRealArray(outputs[o], outNBElement[o]));
+        } else {
+            Nan::Set(outAll_JS, o, Nan::Null());
+        }
+    }
+    info.GetReturnValue().Set(outAll_JS);
+    delete[] outAll;
+}
+
+/**
+ * CDL_ALL(inOpen, inHigh, inLow, inClose, patterns?, startIdx?, endIdx?,
+ *         options?: {encoding?: OutputEncoding, penetration?: number})
+ *   => Int32Array | Int8Array | {index, value}
+ *
+ * The result is a patterns.length x (endIdx - startIdx + 1) matrix in row
+ * major order, the row `r` is the output of `patterns[r]`, the values in the
+ * lookback of the pattern are 0. With an encoding other than `Array` the
+ * matrix is encoded by `NewIntegerOutput`, the sparse indexes are the
+ * positions in the matrix.
+ */
+void TA_FUNC_CDL_ALL(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    RealInput inOpen, inHigh, inLow, inClose;
+    if (!inOpen.Init(info[0], "inOpen") || !inHigh.Init(info[1], "inHigh") || !inLow.Init(info[2], "inLow") ||
+        !inClose.Init(info[3], "inClose")) {
+        return;
+    }
+    if (inHigh.length != inOpen.length || inLow.length != inOpen.length || inClose.length != inOpen.length) {
+        Nan::ThrowRangeError("`inOpen`, `inHigh`, `inLow` and `inClose` must have the same length");
+        return;
+    }
+    int nbPattern = talib::CDL_PATTERN_COUNT;
+    int *patterns;
+    if (info.Length() <= 4 || info[4]->IsUndefined() || info[4]->IsNull()) {
+        patterns = new int[nbPattern];
+        for (int p = 0; p < nbPattern; p++) {
+            patterns[p] = p;
+        }
+    } else {
+        if (!info[4]->IsArray()) {
+            Nan::ThrowTypeError("`patterns` must be an array of function names");
+            return;
+        }
+        v8::Local<v8::Array> array = v8::Local<v8::Array>::Cast(info[4]);
+        nbPattern = array->Length();
+        patterns = new int[nbPattern > 0 ? nbPattern : 1];
+        for (int r = 0; r < nbPattern; r++) {
+            Nan::Utf8String name(Nan::Get(array, r).ToLocalChecked());
+            int p = talib::FindCdlPattern(*name);
+            if (p < 0) {
+                char error[200];
+                snprintf(error, sizeof(error), "`%s` is not one of the functions of CDL_ALL", *name ? *name : "");
+                Nan::ThrowTypeError(error);
+                delete[] patterns;
+                return;
+            }
+            patterns[r] = p;
+        }
+    }
+    int startIdx, endIdx, outLength;
+    OutputEncoding encoding;
+    if (!ReadRange(info, 5, inOpen.length, 0, &startIdx, &endIdx, &outLength) ||
+        !ReadOutputEncoding(info[7], &encoding)) {
+        delete[] patterns;
+        return;
+    }
+    double penetration = NAN;
+    if (info[7]->IsObject()) {
+        v8::Local<v8::Value> value =
+            Nan::Get(info[7].As<v8::Object>(), Nan::New("penetration").ToLocalChecked()).ToLocalChecked();
+        if (!value->IsUndefined() && !value->IsNumber()) {
+            Nan::ThrowTypeError("`penetration` must be a number");
+            delete[] patterns;
+            return;
+        }
+        if (value->IsNumber()) {
+            penetration = value->NumberValue(Nan::GetCurrentContext()).FromJust();
+        }
+    }
+    int *outInteger;
+    v8::Local<v8::Int32Array> outInteger_JS = NewInt32Array(nbPattern * outLength, &outInteger);
+    if (outLength > 0 && nbPattern > 0) {
+        int outBegIdx, outNBElement;
+        TA_RetCode result = talib::CdlAll(startIdx, endIdx, inOpen.data, inHigh.data, inLow.data, inClose.data,
+                                          nbPattern, patterns, penetration, &outBegIdx, &outNBElement, outInteger);
+        if (result != TA_SUCCESS) {
+            delete[] patterns;
+            ThrowRetCode("TA_CDL_ALL", result);
+            return;
+        }
+    }
+    delete[] patterns;
+    if (encoding == OUTPUT_ENCODING_ARRAY) {
+        info.GetReturnValue().Set(outInteger_JS);
+    } else {
+        info.GetReturnValue().Set(NewIntegerOutput(outInteger, nbPattern * outLength, 10, encoding));
+    }
+}
+
+void InitFused(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    Nan::Set(exports, Nan::New("LINEARREG_ALL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_LINEARREG_ALL, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("HT_ALL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_HT_ALL, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("DMI_ALL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_DMI_ALL, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("CDL_ALL").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_CDL_ALL, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    v8::Local<v8::Array> CDL_PATTERNS = Nan::New<v8::Array>(talib::CDL_PATTERN_COUNT);
+    for (int p = 0; p < talib::CDL_PATTERN_COUNT; p++) {
+        Nan::Set(CDL_PATTERNS, p, Nan::New(talib::cdlPatternNames[p]).ToLocalChecked());
+    }
+    Nan::Set(exports, Nan::New("CDL_PATTERNS").ToLocalChecked(), CDL_PATTERNS);
+    v8::Local<v8::Object> OutputEncoding = Nan::New<v8::Object>();
+    Nan::Set(OutputEncoding, Nan::New("Array").ToLocalChecked(), Nan::New<v8::Number>(OUTPUT_ENCODING_ARRAY));
+    Nan::Set(OutputEncoding, Nan::New("Int8Array").ToLocalChecked(), Nan::New<v8::Number>(OUTPUT_ENCODING_INT8));
+    Nan::Set(OutputEncoding, Nan::New("Sparse").ToLocalChecked(), Nan::New<v8::Number>(OUTPUT_ENCODING_SPARSE));
+    Nan::Set(exports, Nan::New("OutputEncoding").ToLocalChecked(), OutputEncoding);
+}
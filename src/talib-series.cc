@@ -0,0 +1,72 @@
+/*!
+ * Memory mapped series files, their columns are used in place as the inputs
+ * of the TA functions, see `talib::SeriesFile` for the format.
+ */
+
+#include "talib-extensions.h"
+#include <memory>
+
+// The external backing stores of the ArrayBuffers need V8 8.x, Node.js 14.
+#define SERIES_MIN_MODULE_VERSION 83
+
+#if NODE_MODULE_VERSION >= SERIES_MIN_MODULE_VERSION
+static void ReleaseColumn(void *data, size_t length, void *deleterData) {
+    static_cast<talib::SeriesFile *>(deleterData)->Release();
+}
+#endif
+
+/**
+ * mapSeries(path: string, schema: string[]) => {[column: string]: Float64Array}
+ */
+void TA_FUNC_mapSeries(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+#if NODE_MODULE_VERSION < SERIES_MIN_MODULE_VERSION
+    Nan::ThrowError("mapSeries: Node.js 14 or later is required");
+#else
+    if (info.Length() < 1 || !info[0]->IsString()) {
+        Nan::ThrowTypeError("`path` must be a string");
+        return;
+    }
+    if (info.Length() < 2 || !info[1]->IsArray()) {
+        Nan::ThrowTypeError("`schema` must be an array of column names");
+        return;
+    }
+    Nan::Utf8String path(info[0]);
+    v8::Local<v8::Array> schema = info[1].As<v8::Array>();
+    std::string message;
+    talib::SeriesFile *series = talib::SeriesFile::Open(*path, &message);
+    if (series == NULL) {
+        message = "mapSeries: " + message;
+        Nan::ThrowError(message.c_str());
+        return;
+    }
+    if ((uint32_t) series->ColumnCount() != schema->Length()) {
+        char error[300];
+        snprintf(error, sizeof(error), "mapSeries: `%s` has %d columns, the schema has %u", *path,
+                 series->ColumnCount(), schema->Length());
+        series->Release();
+        Nan::ThrowRangeError(error);
+        return;
+    }
+    v8::Local<v8::Object> result = Nan::New<v8::Object>();
+    int rows = series->RowCount();
+    for (int c = 0; c < series->ColumnCount(); c++) {
+        v8::Local<v8::Value> name = Nan::Get(schema, c).ToLocalChecked();
+        if (!name->IsString()) {
+            series->Release();
+            Nan::ThrowTypeError("`schema` must be an array of column names");
+            return;
+        }
+        series->Retain();
+        std::unique_ptr<v8::BackingStore> store =
+            v8::ArrayBuffer::NewBackingStore(series->Column(c), rows * sizeof(double), ReleaseColumn, series);
+        v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(info.GetIsolate(), std::move(store));
+        Nan::Set(result, name, v8::Float64Array::New(buffer, 0, rows));
+    }
+    series->Release();
+    info.GetReturnValue().Set(result);
+#endif
+}
+
+void InitSeries(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    Nan::Set(exports, Nan::New("mapSeries").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_mapSeries, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+}
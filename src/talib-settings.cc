@@ -0,0 +1,40 @@
+/*!
+ * The global settings of TA-Lib.
+ */
+
+#include "talib-extensions.h"
+
+/**
+ * setPrecision(precision: Precision) => void
+ */
+void TA_FUNC_setPrecision(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    if (info.Length() < 1 || !info[0]->IsInt32()) {
+        Nan::ThrowTypeError("`precision` must be one of `Precision`");
+        return;
+    }
+    int precision = info[0]->Int32Value(Nan::GetCurrentContext()).FromJust();
+    if (precision != TA_PRECISION_DEFAULT && precision != TA_PRECISION_COMPENSATED) {
+        Nan::ThrowRangeError("`precision` must be one of `Precision`");
+        return;
+    }
+    TA_RetCode retCode = TA_SetPrecision((TA_Precision) precision);
+    if (retCode != TA_SUCCESS) {
+        ThrowRetCode("TA_SetPrecision", retCode);
+    }
+}
+
+/**
+ * getPrecision() => Precision
+ */
+void TA_FUNC_getPrecision(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    info.GetReturnValue().Set(Nan::New<v8::Number>(TA_GetPrecision()));
+}
+
+void InitSettings(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    Nan::Set(exports, Nan::New("setPrecision").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_setPrecision, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    Nan::Set(exports, Nan::New("getPrecision").ToLocalChecked(), Nan::New<v8::FunctionTemplate>(TA_FUNC_getPrecision, data)->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+    v8::Local<v8::Object> Precision = Nan::New<v8::Object>();
+    Nan::Set(Precision, Nan::New("Default").ToLocalChecked(), Nan::New<v8::Number>(TA_PRECISION_DEFAULT));
+    Nan::Set(Precision, Nan::New("Compensated").ToLocalChecked(), Nan::New<v8::Number>(TA_PRECISION_COMPENSATED));
+    Nan::Set(exports, Nan::New("Precision").ToLocalChecked(), Precision);
+}
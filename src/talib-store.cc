@@ -0,0 +1,171 @@
+/*!
+ * The live bar store, the last bars of each symbol are kept natively in
+ * preallocated ring buffers and the indicators are updated on each bar, see
+ * `talib::BarStore`.
+ */
+
+#include "talib-extensions.h"
+
+class BarStoreWrap : public Nan::ObjectWrap {
+public:
+    /**
+     * new BarStore(capacity: number, maxSymbols: number) => BarStore
+     */
+    static void New(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        if (!info.IsConstructCall()) {
+            Nan::ThrowTypeError("`BarStore` must be called with `new`");
+            return;
+        }
+        if (!info[0]->IsInt32() || !info[1]->IsInt32()) {
+            Nan::ThrowTypeError("`capacity` and `maxSymbols` must be integers");
+            return;
+        }
+        int capacity = info[0]->Int32Value(Nan::GetCurrentContext()).FromJust();
+        int maxSymbols = info[1]->Int32Value(Nan::GetCurrentContext()).FromJust();
+        if (capacity < 1 || maxSymbols < 1) {
+            Nan::ThrowRangeError("`capacity` and `maxSymbols` must be positive");
+            return;
+        }
+        BarStoreWrap *wrap = new BarStoreWrap(capacity, maxSymbols);
+        wrap->Wrap(info.This());
+        info.GetReturnValue().Set(info.This());
+    }
+
+    static BarStoreWrap *Unwrap(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        return Nan::ObjectWrap::Unwrap<BarStoreWrap>(info.This());
+    }
+
+    talib::BarStore store;
+
+    /**
+     * The result of `push`, reused by every push.
+     */
+    Nan::Persistent<v8::Float64Array> latest;
+    double *latestData;
+
+private:
+    BarStoreWrap(int capacity, int maxSymbols) : store(capacity, maxSymbols), latestData(NULL) {}
+    ~BarStoreWrap() {
+        latest.Reset();
+    }
+};
+
+/**
+ * store.addIndicator(label: string, name: string, inputs: string[], optInputs?: (number | undefined)[]) => void
+ */
+void TA_FUNC_BarStore_addIndicator(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    if (!info[0]->IsString() || !info[1]->IsString()) {
+        Nan::ThrowTypeError("`label` and `name` must be strings");
+        return;
+    }
+    if (!info[2]->IsArray()) {
+        Nan::ThrowTypeError("`inputs` must be an array of column names");
+        return;
+    }
+    v8::Local<v8::Array> inputList = info[2].As<v8::Array>();
+    std::vector<std::string> inputs;
+    for (uint32_t i = 0; i < inputList->Length(); i++) {
+        inputs.push_back(*Nan::Utf8String(Nan::Get(inputList, i).ToLocalChecked()));
+    }
+    std::vector<double> optInputs;
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    for (uint32_t p = 0; info[3]->IsArray() && p < info[3].As<v8::Array>()->Length(); p++) {
+        v8::Local<v8::Value> value = Nan::Get(info[3].As<v8::Array>(), p).ToLocalChecked();
+        optInputs.push_back(value->IsNumber() ? value->NumberValue(context).FromJust() : NAN);
+    }
+    std::string error;
+    if (!BarStoreWrap::Unwrap(info)->store.AddIndicator(*Nan::Utf8String(info[0]), *Nan::Utf8String(info[1]),
+                                                        inputs, optInputs, &error)) {
+        error = "addIndicator: " + error;
+        Nan::ThrowRangeError(error.c_str());
+    }
+}
+
+/**
+ * store.outputNames() => string[]
+ */
+void TA_FUNC_BarStore_outputNames(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    const std::vector<std::string> &names = BarStoreWrap::Unwrap(info)->store.OutputNames();
+    v8::Local<v8::Array> result = Nan::New<v8::Array>((int) names.size());
+    for (size_t o = 0; o < names.size(); o++) {
+        Nan::Set(result, (uint32_t) o, Nan::New(names[o]).ToLocalChecked());
+    }
+    info.GetReturnValue().Set(result);
+}
+
+/**
+ * store.push(symbol: string, bar: Bar) => Float64Array
+ *
+ * The newest value of each output, in the order of `outputNames`. The same
+ * array is returned by every push of the store, overwritten.
+ */
+void TA_FUNC_BarStore_push(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    if (!info[0]->IsString()) {
+        Nan::ThrowTypeError("`symbol` must be a string");
+        return;
+    }
+    if (!info[1]->IsObject()) {
+        Nan::ThrowTypeError("`bar` must be an object");
+        return;
+    }
+    BarStoreWrap *wrap = BarStoreWrap::Unwrap(info);
+    int symbol = wrap->store.AddSymbol(*Nan::Utf8String(info[0]));
+    if (symbol < 0) {
+        Nan::ThrowRangeError("push: the store is full, it has `maxSymbols` symbols");
+        return;
+    }
+    v8::Local<v8::Object> barObject = info[1].As<v8::Object>();
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    double bar[talib::BarStore::COLUMN_COUNT];
+    for (int c = 0; c < talib::BarStore::COLUMN_COUNT; c++) {
+        v8::Local<v8::Value> value =
+            Nan::Get(barObject, Nan::New(talib::BarStore::columnNames[c]).ToLocalChecked()).ToLocalChecked();
+        bar[c] = value->IsNumber() ? value->NumberValue(context).FromJust() : NAN;
+    }
+    int outputCount = (int) wrap->store.OutputNames().size();
+    if (wrap->latest.IsEmpty() || (int) Nan::New(wrap->latest)->Length() != outputCount) {
+        wrap->latest.Reset(NewFloat64Array(outputCount, &wrap->latestData));
+    }
+    TA_RetCode retCode = wrap->store.Push(symbol, bar, wrap->latestData);
+    if (retCode != TA_SUCCESS) {
+        ThrowRetCode("TA_CallFunc", retCode);
+        return;
+    }
+    info.GetReturnValue().Set(Nan::New(wrap->latest));
+}
+
+/**
+ * store.bars(symbol: string) => Bars
+ *
+ * The bars of the symbol, the oldest first.
+ */
+void TA_FUNC_BarStore_bars(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    if (!info[0]->IsString()) {
+        Nan::ThrowTypeError("`symbol` must be a string");
+        return;
+    }
+    talib::BarStore &store = BarStoreWrap::Unwrap(info)->store;
+    int symbol = store.FindSymbol(*Nan::Utf8String(info[0]));
+    int size = symbol >= 0 ? store.Size(symbol) : 0;
+    v8::Local<v8::Object> result = Nan::New<v8::Object>();
+    for (int c = 0; c < talib::BarStore::COLUMN_COUNT; c++) {
+        double *values;
+        v8::Local<v8::Float64Array> column = NewFloat64Array(size, &values);
+        if (size > 0) {
+            store.Last(symbol, (talib::BarStore::Column) c, size, values);
+        }
+        Nan::Set(result, Nan::New(talib::BarStore::columnNames[c]).ToLocalChecked(), column);
+    }
+    info.GetReturnValue().Set(result);
+}
+
+void InitStore(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    v8::Local<v8::FunctionTemplate> tpl = Nan::New<v8::FunctionTemplate>(BarStoreWrap::New);
+    tpl->SetClassName(Nan::New("BarStore").ToLocalChecked());
+    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(tpl, "addIndicator", TA_FUNC_BarStore_addIndicator);
+    Nan::SetPrototypeMethod(tpl, "outputNames", TA_FUNC_BarStore_outputNames);
+    Nan::SetPrototypeMethod(tpl, "push", TA_FUNC_BarStore_push);
+    Nan::SetPrototypeMethod(tpl, "bars", TA_FUNC_BarStore_bars);
+    Nan::Set(exports, Nan::New("BarStore").ToLocalChecked(), tpl->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+}
@@ -0,0 +1,200 @@
+/*!
+ * The streams, a TA function evaluated natively one bar at a time with the
+ * bar in progress revised until it is closed, and saved to restart without
+ * the history, see `talib::Stream`.
+ */
+
+#include "talib-extensions.h"
+#include <cmath>
+#include <cstring>
+
+class StreamWrap : public Nan::ObjectWrap {
+public:
+    /**
+     * new Stream(name: string, optInputs?: (number | undefined)[]) => Stream
+     * new Stream(state: Uint8Array) => Stream
+     */
+    static void New(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        if (!info.IsConstructCall()) {
+            Nan::ThrowTypeError("`Stream` must be called with `new`");
+            return;
+        }
+        std::string error;
+        talib::Stream *stream;
+        if (info[0]->IsUint8Array()) {
+            Nan::TypedArrayContents<uint8_t> state(info[0]);
+            stream = talib::Stream::Restore(*state, state.length(), &error);
+        } else if (info[0]->IsString()) {
+            std::vector<double> optInputs;
+            v8::Local<v8::Context> context = Nan::GetCurrentContext();
+            for (uint32_t p = 0; info[1]->IsArray() && p < info[1].As<v8::Array>()->Length(); p++) {
+                v8::Local<v8::Value> value = Nan::Get(info[1].As<v8::Array>(), p).ToLocalChecked();
+                optInputs.push_back(value->IsNumber() ? value->NumberValue(context).FromJust() : NAN);
+            }
+            stream = talib::Stream::Create(*Nan::Utf8String(info[0]), optInputs, &error);
+        } else {
+            Nan::ThrowTypeError("`name` must be a string, or `state` a Uint8Array");
+            return;
+        }
+        if (stream == NULL) {
+            error = "Stream: " + error;
+            Nan::ThrowRangeError(error.c_str());
+            return;
+        }
+        StreamWrap *wrap = new StreamWrap(stream);
+        wrap->Wrap(info.This());
+        info.GetReturnValue().Set(info.This());
+    }
+
+    /**
+     * Read the bar at `index`, a number is a bar whose prices are all that
+     * number. Throws and returns false if it is neither a number nor an
+     * object.
+     */
+    static bool ReadBar(const Nan::FunctionCallbackInfo<v8::Value> &info, int index, double *bar) {
+        v8::Local<v8::Context> context = Nan::GetCurrentContext();
+        if (info[index]->IsNumber()) {
+            double price = info[index]->NumberValue(context).FromJust();
+            for (int c = 0; c < talib::BarStore::COLUMN_COUNT; c++) {
+                bar[c] = c == talib::BarStore::TIME || c == talib::BarStore::VOLUME ? NAN : price;
+            }
+            return true;
+        }
+        if (!info[index]->IsObject()) {
+            Nan::ThrowTypeError("`bar` must be an object or a number");
+            return false;
+        }
+        v8::Local<v8::Object> barObject = info[index].As<v8::Object>();
+        for (int c = 0; c < talib::BarStore::COLUMN_COUNT; c++) {
+            v8::Local<v8::Value> value =
+                Nan::Get(barObject, Nan::New(talib::BarStore::columnNames[c]).ToLocalChecked()).ToLocalChecked();
+            bar[c] = value->IsNumber() ? value->NumberValue(context).FromJust() : NAN;
+        }
+        return true;
+    }
+
+    static StreamWrap *Unwrap(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        return Nan::ObjectWrap::Unwrap<StreamWrap>(info.This());
+    }
+
+    talib::Stream *stream;
+
+private:
+    explicit StreamWrap(talib::Stream *stream) : stream(stream) {}
+    ~StreamWrap() {
+        delete stream;
+    }
+};
+
+/**
+ * stream.lookback() => number
+ */
+void TA_FUNC_Stream_lookback(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    info.GetReturnValue().Set(Nan::New<v8::Number>(StreamWrap::Unwrap(info)->stream->Lookback()));
+}
+
+/**
+ * stream.updateLast(bar: Bar | number) => number
+ *
+ * The value at the bar in progress, the state is not changed.
+ */
+void TA_FUNC_Stream_updateLast(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    double bar[talib::BarStore::COLUMN_COUNT];
+    if (!StreamWrap::ReadBar(info, 0, bar)) {
+        return;
+    }
+    info.GetReturnValue().Set(Nan::New<v8::Number>(StreamWrap::Unwrap(info)->stream->UpdateLast(bar)));
+}
+
+/**
+ * stream.commit() => void
+ */
+void TA_FUNC_Stream_commit(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    StreamWrap::Unwrap(info)->stream->Commit();
+}
+
+/**
+ * stream.push(bar: Bar | number) => number
+ *
+ * The value at a closed bar, same as `updateLast` then `commit`.
+ */
+void TA_FUNC_Stream_push(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    double bar[talib::BarStore::COLUMN_COUNT];
+    if (!StreamWrap::ReadBar(info, 0, bar)) {
+        return;
+    }
+    info.GetReturnValue().Set(Nan::New<v8::Number>(StreamWrap::Unwrap(info)->stream->Push(bar)));
+}
+
+/**
+ * stream.run(input: number[] | Float64Array | Bars) => Float64Array
+ *
+ * The values at closed bars, as many pushes. The prices of a `number[]` or a
+ * `Float64Array` are closes, the columns of `Bars` may be `number[]` too and
+ * the ones which the function does not read may be missing.
+ */
+void TA_FUNC_Stream_run(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    RealInput columns[talib::BarStore::COLUMN_COUNT];
+    const double *data[talib::BarStore::COLUMN_COUNT] = {NULL, NULL, NULL, NULL, NULL, NULL};
+    int length = -1;
+    if (info[0]->IsArray() || info[0]->IsFloat64Array()) {
+        if (!columns[talib::BarStore::CLOSE].Init(info[0], "input")) {
+            return;
+        }
+        data[talib::BarStore::CLOSE] = columns[talib::BarStore::CLOSE].data;
+        length = columns[talib::BarStore::CLOSE].length;
+    } else if (info[0]->IsObject()) {
+        v8::Local<v8::Object> bars = info[0].As<v8::Object>();
+        for (int c = 0; c < talib::BarStore::COLUMN_COUNT; c++) {
+            v8::Local<v8::Value> column =
+                Nan::Get(bars, Nan::New(talib::BarStore::columnNames[c]).ToLocalChecked()).ToLocalChecked();
+            if (column->IsUndefined()) {
+                continue;
+            }
+            if (!(length < 0 ? columns[c].Init(column, talib::BarStore::columnNames[c])
+                             : columns[c].Init(column, talib::BarStore::columnNames[c], length))) {
+                return;
+            }
+            data[c] = columns[c].data;
+            if (length < 0) {
+                length = columns[c].length;
+            }
+        }
+    }
+    if (length < 0) {
+        Nan::ThrowTypeError("`input` must be an array of closes or an object of columns");
+        return;
+    }
+    double *values;
+    v8::Local<v8::Float64Array> result = NewFloat64Array(length, &values);
+    StreamWrap::Unwrap(info)->stream->Run(data, length, values);
+    info.GetReturnValue().Set(result);
+}
+
+/**
+ * stream.save() => Uint8Array
+ *
+ * The state of the committed bars, see `new Stream(state)`.
+ */
+void TA_FUNC_Stream_save(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    std::string blob;
+    StreamWrap::Unwrap(info)->stream->Save(&blob);
+    v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), blob.size());
+    v8::Local<v8::Uint8Array> state = v8::Uint8Array::New(buffer, 0, blob.size());
+    Nan::TypedArrayContents<uint8_t> contents(state);
+    memcpy(*contents, blob.data(), blob.size());
+    info.GetReturnValue().Set(state);
+}
+
+void InitStream(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    v8::Local<v8::FunctionTemplate> tpl = Nan::New<v8::FunctionTemplate>(StreamWrap::New);
+    tpl->SetClassName(Nan::New("Stream").ToLocalChecked());
+    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(tpl, "lookback", TA_FUNC_Stream_lookback);
+    Nan::SetPrototypeMethod(tpl, "updateLast", TA_FUNC_Stream_updateLast);
+    Nan::SetPrototypeMethod(tpl, "commit", TA_FUNC_Stream_commit);
+    Nan::SetPrototypeMethod(tpl, "push", TA_FUNC_Stream_push);
+    Nan::SetPrototypeMethod(tpl, "run", TA_FUNC_Stream_run);
+    Nan::SetPrototypeMethod(tpl, "save", TA_FUNC_Stream_save);
+    Nan::Set(exports, Nan::New("Stream").ToLocalChecked(), tpl->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+}
@@ -0,0 +1,192 @@
+/*!
+ * The multi-timeframe series, the bars of the higher timeframes and the
+ * indicators of every timeframe are kept natively, see
+ * `talib::MultiTimeframe`.
+ */
+
+#include "talib-extensions.h"
+#include <cmath>
+
+class MultiTimeframeWrap : public Nan::ObjectWrap {
+public:
+    /**
+     * new MultiTimeframe(baseInterval: number, intervals: number[]) => MultiTimeframe
+     */
+    static void New(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        if (!info.IsConstructCall()) {
+            Nan::ThrowTypeError("`MultiTimeframe` must be called with `new`");
+            return;
+        }
+        double baseInterval;
+        if (!ReadInterval(info[0], "baseInterval", &baseInterval)) {
+            return;
+        }
+        if (info.Length() < 2 || !info[1]->IsArray()) {
+            Nan::ThrowTypeError("`intervals` must be an array of numbers");
+            return;
+        }
+        v8::Local<v8::Array> intervals = info[1].As<v8::Array>();
+        MultiTimeframeWrap *wrap = new MultiTimeframeWrap(baseInterval);
+        for (uint32_t i = 0; i < intervals->Length(); i++) {
+            double interval;
+            if (!ReadInterval(Nan::Get(intervals, i).ToLocalChecked(), "intervals", &interval)) {
+                delete wrap;
+                return;
+            }
+            if (wrap->series.FindTimeframe(interval) < 0) {
+                wrap->series.AddTimeframe(interval);
+            }
+        }
+        wrap->Wrap(info.This());
+        info.GetReturnValue().Set(info.This());
+    }
+
+    static bool ReadInterval(v8::Local<v8::Value> value, const char *name, double *interval) {
+        if (!value->IsNumber()) {
+            char error[100];
+            snprintf(error, sizeof(error), "`%s` must be a number of milliseconds", name);
+            Nan::ThrowTypeError(error);
+            return false;
+        }
+        *interval = value->NumberValue(Nan::GetCurrentContext()).FromJust();
+        if (!(*interval > 0) || std::isinf(*interval)) {
+            char error[100];
+            snprintf(error, sizeof(error), "`%s` must be positive", name);
+            Nan::ThrowRangeError(error);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Read the interval at `index`, throws and returns -1 if it is not one of
+     * the timeframes.
+     */
+    int ReadTimeframe(const Nan::FunctionCallbackInfo<v8::Value> &info, int index) {
+        double interval;
+        if (!ReadInterval(info[index], "interval", &interval)) {
+            return -1;
+        }
+        int timeframe = series.FindTimeframe(interval);
+        if (timeframe < 0) {
+            Nan::ThrowRangeError("`interval` is not one of the timeframes");
+        }
+        return timeframe;
+    }
+
+    static MultiTimeframeWrap *Unwrap(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+        return Nan::ObjectWrap::Unwrap<MultiTimeframeWrap>(info.This());
+    }
+
+    talib::MultiTimeframe series;
+
+private:
+    explicit MultiTimeframeWrap(double baseInterval) : series(baseInterval) {}
+};
+
+/**
+ * series.addIndicator(interval: number, label: string, name: string, inputs: string[],
+ *                     optInputs?: (number | undefined)[]) => void
+ */
+void TA_FUNC_MultiTimeframe_addIndicator(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    MultiTimeframeWrap *wrap = MultiTimeframeWrap::Unwrap(info);
+    int timeframe = wrap->ReadTimeframe(info, 0);
+    if (timeframe < 0) {
+        return;
+    }
+    if (!info[1]->IsString() || !info[2]->IsString()) {
+        Nan::ThrowTypeError("`label` and `name` must be strings");
+        return;
+    }
+    if (!info[3]->IsArray()) {
+        Nan::ThrowTypeError("`inputs` must be an array of column names");
+        return;
+    }
+    v8::Local<v8::Array> inputList = info[3].As<v8::Array>();
+    std::vector<std::string> inputs;
+    for (uint32_t i = 0; i < inputList->Length(); i++) {
+        inputs.push_back(*Nan::Utf8String(Nan::Get(inputList, i).ToLocalChecked()));
+    }
+    std::vector<double> optInputs;
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    for (uint32_t p = 0; info[4]->IsArray() && p < info[4].As<v8::Array>()->Length(); p++) {
+        v8::Local<v8::Value> value = Nan::Get(info[4].As<v8::Array>(), p).ToLocalChecked();
+        optInputs.push_back(value->IsNumber() ? value->NumberValue(context).FromJust() : NAN);
+    }
+    std::string error;
+    if (!wrap->series.AddIndicator(timeframe, *Nan::Utf8String(info[1]), *Nan::Utf8String(info[2]), inputs,
+                                   optInputs, &error)) {
+        error = "addIndicator: " + error;
+        Nan::ThrowRangeError(error.c_str());
+    }
+}
+
+/**
+ * series.push(bars: Bars) => void
+ */
+void TA_FUNC_MultiTimeframe_push(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    if (!info[0]->IsObject()) {
+        Nan::ThrowTypeError("`bars` must be an object of columns");
+        return;
+    }
+    v8::Local<v8::Object> bars = info[0].As<v8::Object>();
+    static const char *const names[] = {"time", "open", "high", "low", "close", "volume"};
+    RealInput columns[6];
+    for (int c = 0; c < 6; c++) {
+        v8::Local<v8::Value> column = Nan::Get(bars, Nan::New(names[c]).ToLocalChecked()).ToLocalChecked();
+        if (!(c == 0 ? columns[c].Init(column, names[c]) : columns[c].Init(column, names[c], columns[0].length))) {
+            return;
+        }
+    }
+    MultiTimeframeWrap::Unwrap(info)->series.Append(columns[0].data, columns[1].data, columns[2].data,
+                                                    columns[3].data, columns[4].data, columns[5].data,
+                                                    columns[0].length);
+}
+
+/**
+ * series.bars(interval: number) => Bars
+ *
+ * The complete bars of the timeframe.
+ */
+void TA_FUNC_MultiTimeframe_bars(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    MultiTimeframeWrap *wrap = MultiTimeframeWrap::Unwrap(info);
+    int timeframe = wrap->ReadTimeframe(info, 0);
+    if (timeframe < 0) {
+        return;
+    }
+    info.GetReturnValue().Set(NewBars(wrap->series.TimeframeBars(timeframe)));
+}
+
+/**
+ * series.evaluate(interval: number, forwardFill?: boolean) => {[output: string]: Float64Array}
+ */
+void TA_FUNC_MultiTimeframe_evaluate(const Nan::FunctionCallbackInfo<v8::Value> &info) {
+    MultiTimeframeWrap *wrap = MultiTimeframeWrap::Unwrap(info);
+    int timeframe = wrap->ReadTimeframe(info, 0);
+    if (timeframe < 0) {
+        return;
+    }
+    std::vector<std::string> names;
+    std::vector<std::vector<double> > outputs;
+    TA_RetCode retCode = wrap->series.Evaluate(timeframe, info[1]->IsTrue(), &names, &outputs);
+    if (retCode != TA_SUCCESS) {
+        ThrowRetCode("TA_CallFunc", retCode);
+        return;
+    }
+    v8::Local<v8::Object> result = Nan::New<v8::Object>();
+    for (size_t o = 0; o < names.size(); o++) {
+        Nan::Set(result, Nan::New(names[o]).ToLocalChecked(), NewFloat64Array(outputs[o]));
+    }
+    info.GetReturnValue().Set(result);
+}
+
+void InitTimeframes(v8::Local<v8::Object> exports, v8::Local<v8::Value> data) {
+    v8::Local<v8::FunctionTemplate> tpl = Nan::New<v8::FunctionTemplate>(MultiTimeframeWrap::New);
+    tpl->SetClassName(Nan::New("MultiTimeframe").ToLocalChecked());
+    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(tpl, "addIndicator", TA_FUNC_MultiTimeframe_addIndicator);
+    Nan::SetPrototypeMethod(tpl, "push", TA_FUNC_MultiTimeframe_push);
+    Nan::SetPrototypeMethod(tpl, "bars", TA_FUNC_MultiTimeframe_bars);
+    Nan::SetPrototypeMethod(tpl, "evaluate", TA_FUNC_MultiTimeframe_evaluate);
+    Nan::Set(exports, Nan::New("MultiTimeframe").ToLocalChecked(), tpl->GetFunction(Nan::GetCurrentContext()).ToLocalChecked());
+}
@@ -258,6 +258,11 @@ ENUM_BEGIN( Compatibility )
     ENUM_DEFINE( TA_COMPATIBILITY_METASTOCK, Metastock )
 ENUM_END( Compatibility )
 
+ENUM_BEGIN( Precision )
+    ENUM_DEFINE( TA_PRECISION_DEFAULT, Default ),
+    ENUM_DEFINE( TA_PRECISION_COMPENSATED, Compensated )
+ENUM_END( Precision )
+
 ENUM_BEGIN( MAType )
    ENUM_DEFINE( TA_MAType_SMA,   Sma   ) =0,
    ENUM_DEFINE( TA_MAType_EMA,   Ema   ) =1,
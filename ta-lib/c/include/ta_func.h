@@ -5313,6 +5313,18 @@ unsigned int TA_GetUnstablePeriod( TA_FuncUnstId id );
 TA_RetCode TA_SetCompatibility( TA_Compatibility value );
 TA_Compatibility TA_GetCompatibility( void );
 
+/* The running sums of SUM, SMA, WMA and TRIMA accumulate
+ * rounding errors over very long inputs.
+ *
+ * With TA_PRECISION_COMPENSATED these sums are done with
+ * Neumaier compensated summation, which keeps the error
+ * independent of the input length at the cost of some speed.
+ *
+ * See ta_defs.h for the enumeration TA_Precision.
+ */
+TA_RetCode TA_SetPrecision( TA_Precision value );
+TA_Precision TA_GetPrecision( void );
+
 /* Candlesticks struct and functions
  * Because candlestick patterns are subjective, it is necessary 
  * to allow the user to specify what should be the meaning of 
@@ -5334,6 +5346,59 @@ TA_RetCode TA_SetCandleSettings( TA_CandleSettingType settingType,
  */
 TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType );
 
+/* A context is a copy of all the settings above: the unstable
+ * periods, the compatibility, the precision and the candle settings.
+ *
+ * The TA_Set functions change the global settings, which apply to
+ * all the threads. A thread which calls TA_SetThreadContext uses the
+ * settings of the context instead, until it is called again with
+ * NULL. This way threads can run with different settings at the
+ * same time.
+ *
+ * A context can be used by many threads at the same time, as long as
+ * it is not changed while one of them is calling a TA function.
+ *
+ * Example:
+ *      TA_Context *context;
+ *      TA_ContextAlloc( &context );
+ *      TA_ContextSetUnstablePeriod( context, TA_FUNC_UNST_EMA, 30 );
+ *      TA_SetThreadContext( context );
+ *      TA_EMA( ... );
+ *      TA_SetThreadContext( NULL );
+ *      TA_ContextFree( context );
+ */
+typedef struct TA_Context TA_Context;
+
+/* Allocate a context with a copy of the current global settings. */
+TA_RetCode TA_ContextAlloc( TA_Context **context );
+TA_RetCode TA_ContextFree( TA_Context *context );
+
+/* Set the context of the calling thread, NULL to use the global
+ * settings again. Returns the previous context, NULL if there was
+ * none.
+ */
+const TA_Context *TA_SetThreadContext( const TA_Context *context );
+
+TA_RetCode TA_ContextSetUnstablePeriod( TA_Context    *context,
+                                        TA_FuncUnstId  id,
+                                        unsigned int   unstablePeriod );
+unsigned int TA_ContextGetUnstablePeriod( const TA_Context *context,
+                                          TA_FuncUnstId     id );
+
+TA_RetCode TA_ContextSetCompatibility( TA_Context *context, TA_Compatibility value );
+TA_Compatibility TA_ContextGetCompatibility( const TA_Context *context );
+
+TA_RetCode TA_ContextSetPrecision( TA_Context *context, TA_Precision value );
+TA_Precision TA_ContextGetPrecision( const TA_Context *context );
+
+TA_RetCode TA_ContextSetCandleSettings( TA_Context          *context,
+                                        TA_CandleSettingType settingType,
+                                        TA_RangeType         rangeType,
+                                        int                  avgPeriod,
+                                        double               factor );
+TA_RetCode TA_ContextRestoreCandleDefaultSettings( TA_Context          *context,
+                                                   TA_CandleSettingType settingType );
+
 #ifdef __cplusplus
 }
 #endif
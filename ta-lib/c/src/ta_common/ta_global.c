@@ -63,6 +63,7 @@
 #include "ta_magic_nb.h"
 #include "ta_global.h"
 #include "ta_func.h"
+#include "ta_memory.h"
 
 #ifdef TA_LIB_PRO
 /* Section for code distributed with TA-Lib Pro only. */
@@ -77,10 +78,13 @@
 /**** Global variables definitions.    ****/
 
 /* The entry point for all globals */
-TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,(TA_Compatibility)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}};
+TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,{(TA_Compatibility)0,(TA_Precision)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}}};
 
 TA_LibcPriv *TA_Globals = &ta_theGlobals;
 
+/* The settings of the current thread */
+TA_THREAD_LOCAL const TA_Context *TA_ThreadContext = &ta_theGlobals.settings;
+
 /**** Local declarations.              ****/
 /* None */
 
@@ -122,24 +126,74 @@ TA_RetCode TA_Shutdown( void )
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_ContextAlloc( TA_Context **context )
+{
+   if( !context )
+      return TA_BAD_PARAM;
+
+   *context = (TA_Context *)TA_Malloc( sizeof( TA_Context ) );
+   if( !*context )
+      return TA_ALLOC_ERR;
+
+   /* Start from the current global settings. */
+   **context = TA_Globals->settings;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ContextFree( TA_Context *context )
+{
+   if( !context )
+      return TA_BAD_PARAM;
+
+   TA_Free( context );
+
+   return TA_SUCCESS;
+}
+
+const TA_Context *TA_SetThreadContext( const TA_Context *context )
+{
+   const TA_Context *previous;
+
+   previous = TA_ThreadContext == &TA_Globals->settings? NULL : TA_ThreadContext;
+   TA_ThreadContext = context? context : &TA_Globals->settings;
+
+   return previous;
+}
+
 TA_RetCode TA_SetCandleSettings( TA_CandleSettingType settingType, 
                                  TA_RangeType rangeType, 
                                  int avgPeriod, 
                                  double factor )
+{
+    return TA_ContextSetCandleSettings( &TA_Globals->settings, settingType, rangeType, avgPeriod, factor );
+}
+
+TA_RetCode TA_ContextSetCandleSettings( TA_Context *context,
+                                        TA_CandleSettingType settingType,
+                                        TA_RangeType rangeType,
+                                        int avgPeriod,
+                                        double factor )
 {
     /*printf("setcdlset:%d  ",settingType);*/
-    if( settingType >= TA_AllCandleSettings )
+    if( !context || settingType >= TA_AllCandleSettings )
         return TA_BAD_PARAM;
-    TA_Globals->candleSettings[settingType].settingType = settingType;
-    TA_Globals->candleSettings[settingType].rangeType = rangeType;
-    TA_Globals->candleSettings[settingType].avgPeriod = avgPeriod;
-    TA_Globals->candleSettings[settingType].factor = factor;
-    /*printf("cdlset: %d %d %d %f\n",TA_Globals->candleSettings[settingType].settingType,TA_Globals->candleSettings[settingType].rangeType,
-        TA_Globals->candleSettings[settingType].avgPeriod,TA_Globals->candleSettings[settingType].factor);*/
+    context->candleSettings[settingType].settingType = settingType;
+    context->candleSettings[settingType].rangeType = rangeType;
+    context->candleSettings[settingType].avgPeriod = avgPeriod;
+    context->candleSettings[settingType].factor = factor;
+    /*printf("cdlset: %d %d %d %f\n",context->candleSettings[settingType].settingType,context->candleSettings[settingType].rangeType,
+        context->candleSettings[settingType].avgPeriod,context->candleSettings[settingType].factor);*/
     return TA_SUCCESS;
 }
 
 TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType )
+{
+    return TA_ContextRestoreCandleDefaultSettings( &TA_Globals->settings, settingType );
+}
+
+TA_RetCode TA_ContextRestoreCandleDefaultSettings( TA_Context *context,
+                                                   TA_CandleSettingType settingType )
 {
     const TA_CandleSetting TA_CandleDefaultSettings[] = {
         /* real body is long when it's longer than the average of the 10 previous candles' real body */
@@ -170,13 +224,13 @@ TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType )
     };
 
     int i;
-    if( settingType > TA_AllCandleSettings )
+    if( !context || settingType > TA_AllCandleSettings )
         return TA_BAD_PARAM;
     if( settingType == TA_AllCandleSettings )
         for( i = 0; i < TA_AllCandleSettings; ++i )
-            TA_Globals->candleSettings[i] = TA_CandleDefaultSettings[i];
+            context->candleSettings[i] = TA_CandleDefaultSettings[i];
     else
-        TA_Globals->candleSettings[settingType] = TA_CandleDefaultSettings[settingType];
+        context->candleSettings[settingType] = TA_CandleDefaultSettings[settingType];
     return TA_SUCCESS;
 }
 
@@ -17,6 +17,30 @@ typedef struct {
     double                  factor;
 } TA_CandleSetting;
 
+/* The settings that change the output of the TA functions, a copy
+ * of them can be used by one or many threads with TA_SetThreadContext.
+ */
+struct TA_Context
+{
+   /* For handling the compatibility with other software */
+   TA_Compatibility compatibility;
+
+   /* For handling the precision of the running sums */
+   TA_Precision precision;
+
+   /* For handling the unstable period of some TA function. */
+   unsigned int unstablePeriod[TA_FUNC_UNST_ALL];
+
+   /* For handling the candlestick settings */
+   TA_CandleSetting candleSettings[TA_AllCandleSettings];
+};
+
+#if defined( _MSC_VER )
+   #define TA_THREAD_LOCAL __declspec(thread)
+#else
+   #define TA_THREAD_LOCAL __thread
+#endif
+
 /* This interface is used exclusively INTERNALY to the TA-LIB.
  * There is nothing for the end-user here ;->
  */
@@ -100,14 +124,10 @@ typedef struct
 
    const char *localCachePath;
 
-   /* For handling the compatibility with other software */
-   TA_Compatibility compatibility;
-
-   /* For handling the unstable period of some TA function. */
-   unsigned int unstablePeriod[TA_FUNC_UNST_ALL];
-
-   /* For handling the candlestick global settings */
-   TA_CandleSetting candleSettings[TA_AllCandleSettings];
+   /* The settings used when a thread has no context, they are
+    * changed by TA_SetUnstablePeriod, TA_SetCandleSettings etc.
+    */
+   TA_Context settings;
 
 } TA_LibcPriv;
 
@@ -116,4 +136,10 @@ typedef struct
  */
 extern TA_LibcPriv *TA_Globals;
 
+/* The settings read by the TA functions called from the current
+ * thread: the context set by TA_SetThreadContext, or the settings
+ * of TA_Globals when there is none. It is never NULL.
+ */
+extern TA_THREAD_LOCAL const TA_Context *TA_ThreadContext;
+
 #endif
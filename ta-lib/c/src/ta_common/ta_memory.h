@@ -105,12 +105,15 @@
 #if defined( _MANAGED )
    #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (Globals->unstablePeriod[(int)(FuncUnstId::y)])
    #define TA_GLOBALS_COMPATIBILITY        (Globals->compatibility)
+   #define TA_GLOBALS_PRECISION            (Globals->precision)
 #elif defined( _JAVA )
    #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (this.unstablePeriod[FuncUnstId.y.ordinal()])
    #define TA_GLOBALS_COMPATIBILITY        (this.compatibility)
+   #define TA_GLOBALS_PRECISION            (this.precision)
 #else
-   #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_Globals->unstablePeriod[x])
-   #define TA_GLOBALS_COMPATIBILITY        (TA_Globals->compatibility)
+   #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_ThreadContext->unstablePeriod[x])
+   #define TA_GLOBALS_COMPATIBILITY        (TA_ThreadContext->compatibility)
+   #define TA_GLOBALS_PRECISION            (TA_ThreadContext->precision)
 #endif
 
 
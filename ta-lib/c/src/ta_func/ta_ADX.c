@@ -552,6 +552,334 @@
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
 
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+  // No INT function
+#else
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+enum class Core::RetCode Core::TA_INT_DMI( int    startIdx,
+                                           int    endIdx,
+                                           SubArray<double>^ inHigh,
+                                           SubArray<double>^ inLow,
+                                           SubArray<double>^ inClose,
+                                           int    optInTimePeriod,
+                                           cli::array<int>^ outBegIdx,
+                                           cli::array<int>^ outNBElement,
+                                           SubArray<double>^ outADX,
+                                           SubArray<double>^ outADXR,
+                                           SubArray<double>^ outDX,
+                                           SubArray<double>^ outPlusDI,
+                                           SubArray<double>^ outMinusDI,
+                                           SubArray<double>^ outPlusDM,
+                                           SubArray<double>^ outMinusDM,
+                                           SubArray<double>^ outATR )
+#elif defined( _MANAGED )
+enum class Core::RetCode Core::TA_INT_DMI( int    startIdx,
+                                           int    endIdx,
+                                           cli::array<INPUT_TYPE>^ inHigh,
+                                           cli::array<INPUT_TYPE>^ inLow,
+                                           cli::array<INPUT_TYPE>^ inClose,
+                                           int    optInTimePeriod,
+                                           cli::array<int>^ outBegIdx,
+                                           cli::array<int>^ outNBElement,
+                                           cli::array<double>^ outADX,
+                                           cli::array<double>^ outADXR,
+                                           cli::array<double>^ outDX,
+                                           cli::array<double>^ outPlusDI,
+                                           cli::array<double>^ outMinusDI,
+                                           cli::array<double>^ outPlusDM,
+                                           cli::array<double>^ outMinusDM,
+                                           cli::array<double>^ outATR )
+#elif defined( _JAVA )
+public RetCode TA_INT_DMI( int        startIdx,
+                           int        endIdx,
+                           INPUT_TYPE inHigh[],
+                           INPUT_TYPE inLow[],
+                           INPUT_TYPE inClose[],
+                           int        optInTimePeriod,
+                           int        outBegIdx[],
+                           int        outNBElement[],
+                           double     outADX[],
+                           double     outADXR[],
+                           double     outDX[],
+                           double     outPlusDI[],
+                           double     outMinusDI[],
+                           double     outPlusDM[],
+                           double     outMinusDM[],
+                           double     outATR[] )
+#else
+TA_RetCode TA_PREFIX(INT_DMI)( int    startIdx,
+                               int    endIdx,
+                               const INPUT_TYPE *inHigh,
+                               const INPUT_TYPE *inLow,
+                               const INPUT_TYPE *inClose,
+                               int    optInTimePeriod, /* From 2 to 100000 */
+                               int   *outBegIdx,
+                               int   *outNBElement,
+                               double *outADX,
+                               double *outADXR,
+                               double *outDX,
+                               double *outPlusDI,
+                               double *outMinusDI,
+                               double *outPlusDM,
+                               double *outMinusDM,
+                               double *outATR )
+#endif
+{
+   ENUM_DECLARATION(RetCode) retCode;
+   int today, o, passStart, outIdx, adxIdx;
+   double prevHigh, prevLow, prevClose;
+   double prevMinusDM, prevPlusDM, prevTR, prevATR;
+   double tempReal, tempReal2, diffP, diffM;
+   double minusDI, plusDI, sumDX, prevADX, DX;
+   int isDI, isDX;
+   VALUE_HANDLE_INT(outBegIdx1);
+   VALUE_HANDLE_INT(outNbElement1);
+   ARRAY_REF( buffer );
+   ARRAY_LOCAL(prevATRTemp,1);
+
+   /* For each output, in the order of the arguments. */
+   int lookback[TA_DMI_NB_OUTPUT];
+   int begIdx[TA_DMI_NB_OUTPUT];
+   int inPass[TA_DMI_NB_OUTPUT];
+   int requested[TA_DMI_NB_OUTPUT];
+
+   if( optInTimePeriod < 2 )
+      return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+
+   requested[0] = outADX     != NULL;
+   requested[1] = outADXR    != NULL;
+   requested[2] = outDX      != NULL;
+   requested[3] = outPlusDI  != NULL;
+   requested[4] = outMinusDI != NULL;
+   requested[5] = outPlusDM  != NULL;
+   requested[6] = outMinusDM != NULL;
+   requested[7] = outATR     != NULL;
+
+   lookback[0] = LOOKBACK_CALL(ADX)( optInTimePeriod );
+   lookback[1] = LOOKBACK_CALL(ADXR)( optInTimePeriod );
+   lookback[2] = LOOKBACK_CALL(DX)( optInTimePeriod );
+   lookback[3] = LOOKBACK_CALL(PLUS_DI)( optInTimePeriod );
+   lookback[4] = LOOKBACK_CALL(MINUS_DI)( optInTimePeriod );
+   lookback[5] = LOOKBACK_CALL(PLUS_DM)( optInTimePeriod );
+   lookback[6] = LOOKBACK_CALL(MINUS_DM)( optInTimePeriod );
+   lookback[7] = LOOKBACK_CALL(ATR)( optInTimePeriod );
+
+   for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+   {
+      outBegIdx[o] = 0;
+      outNBElement[o] = 0;
+      begIdx[o] = startIdx < lookback[o]? lookback[o] : startIdx;
+      if( begIdx[o] > endIdx )
+         requested[o] = 0;
+   }
+
+   /* The first optInTimePeriod TR for the seed of the ATR,
+    * followed by the last optInTimePeriod ADX for the ADXR.
+    */
+   ARRAY_ALLOC( buffer, 2*optInTimePeriod );
+   #if !defined( _JAVA )
+      if( !buffer )
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+   #endif
+
+   /* Each function starts from the price bar
+    * begIdx-lookback, the outputs starting from the same bar
+    * are evaluated in the same pass. Without startIdx, all of
+    * them start from the first price bar.
+    */
+   for( ;; )
+   {
+      passStart = -1;
+      for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+      {
+         inPass[o] = 0;
+         if( requested[o] )
+         {
+            if( passStart == -1 )
+               passStart = begIdx[o]-lookback[o];
+            if( begIdx[o]-lookback[o] == passStart )
+            {
+               inPass[o] = 1;
+               requested[o] = 0;
+               outBegIdx[o] = begIdx[o];
+               outNBElement[o] = endIdx-begIdx[o]+1;
+            }
+         }
+      }
+      if( passStart == -1 )
+         break;
+
+      /* Same as TA_ADX, TA_DX, TA_PLUS_DI, TA_MINUS_DI,
+       * TA_PLUS_DM and TA_MINUS_DM, the price bar 'outIdx'
+       * after passStart is evaluated in the iteration
+       * 'outIdx' of the loop.
+       */
+      prevMinusDM = 0.0;
+      prevPlusDM  = 0.0;
+      prevTR      = 0.0;
+      prevATR     = 0.0;
+      sumDX       = 0.0;
+      prevADX     = 0.0;
+      DX          = 0.0;
+      adxIdx      = 0;
+      today       = passStart;
+      prevHigh    = inHigh[today];
+      prevLow     = inLow[today];
+      prevClose   = inClose[today];
+      while( today < endIdx )
+      {
+         today++;
+         outIdx = today-passStart;
+         tempReal = inHigh[today];
+         diffP    = tempReal-prevHigh; /* Plus Delta */
+         prevHigh = tempReal;
+
+         tempReal = inLow[today];
+         diffM    = prevLow-tempReal;   /* Minus Delta */
+         prevLow  = tempReal;
+
+         if( outIdx >= optInTimePeriod )
+         {
+            prevMinusDM -= prevMinusDM/optInTimePeriod;
+            prevPlusDM  -= prevPlusDM/optInTimePeriod;
+         }
+
+         if( (diffM > 0) && (diffP < diffM) )
+         {
+            /* Case 2 and 4: +DM=0,-DM=diffM */
+            prevMinusDM += diffM;
+         }
+         else if( (diffP > 0) && (diffP > diffM) )
+         {
+            /* Case 1 and 3: +DM=diffP,-DM=0 */
+            prevPlusDM += diffP;
+         }
+
+         TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
+         if( outIdx < optInTimePeriod )
+            prevTR += tempReal;
+         else
+            prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+         prevClose = inClose[today];
+
+         /* The ATR is seeded with the SMA of the first TR. */
+         if( inPass[7] )
+         {
+            if( outIdx <= optInTimePeriod )
+            {
+               buffer[outIdx-1] = tempReal;
+               if( outIdx == optInTimePeriod )
+               {
+                  retCode = FUNCTION_CALL_DOUBLE(INT_SMA)( optInTimePeriod-1, optInTimePeriod-1,
+                                                           buffer, optInTimePeriod,
+                                                           VALUE_HANDLE_OUT(outBegIdx1),
+                                                           VALUE_HANDLE_OUT(outNbElement1),
+                                                           prevATRTemp );
+                  if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+                  {
+                     ARRAY_FREE( buffer );
+                     return retCode;
+                  }
+                  prevATR = prevATRTemp[0];
+               }
+            }
+            else
+            {
+               prevATR *= optInTimePeriod - 1;
+               prevATR += tempReal;
+               prevATR /= optInTimePeriod;
+            }
+            if( today >= begIdx[7] )
+               outATR[today-begIdx[7]] = prevATR;
+         }
+
+         if( inPass[5] && (today >= begIdx[5]) )
+            outPlusDM[today-begIdx[5]] = prevPlusDM;
+         if( inPass[6] && (today >= begIdx[6]) )
+            outMinusDM[today-begIdx[6]] = prevMinusDM;
+
+         if( outIdx < optInTimePeriod )
+            continue;
+
+         /* Calculate the DI and the DX. */
+         isDI = !TA_IS_ZERO(prevTR);
+         isDX = 0;
+         minusDI = plusDI = 0.0;
+         if( isDI )
+         {
+            minusDI  = 100.0*(prevMinusDM/prevTR);
+            plusDI   = 100.0*(prevPlusDM/prevTR);
+            tempReal = minusDI+plusDI;
+            if( !TA_IS_ZERO(tempReal) )
+            {
+               isDX = 1;
+               DX = 100.0*(std_fabs(minusDI-plusDI)/tempReal);
+            }
+         }
+
+         if( inPass[3] && (today >= begIdx[3]) )
+            outPlusDI[today-begIdx[3]] = plusDI;
+         if( inPass[4] && (today >= begIdx[4]) )
+            outMinusDI[today-begIdx[4]] = minusDI;
+
+         /* Same as TA_DX, the previous DX is repeated
+          * when it cannot be evaluated.
+          */
+         if( inPass[2] && (today >= begIdx[2]) )
+         {
+            if( isDX )
+               outDX[today-begIdx[2]] = DX;
+            else if( today == begIdx[2] )
+               outDX[0] = 0.0;
+            else
+               outDX[today-begIdx[2]] = outDX[today-begIdx[2]-1];
+         }
+
+         if( !inPass[0] && !inPass[1] )
+            continue;
+
+         /* Calculate the ADX, the first one is the
+          * average of the first optInTimePeriod DX.
+          */
+         if( outIdx < 2*optInTimePeriod-1 )
+         {
+            if( isDX )
+               sumDX += DX;
+            continue;
+         }
+         if( outIdx == 2*optInTimePeriod-1 )
+         {
+            if( isDX )
+               sumDX += DX;
+            prevADX = sumDX / optInTimePeriod;
+         }
+         else if( isDX )
+            prevADX = ((prevADX*(optInTimePeriod-1))+DX)/optInTimePeriod;
+
+         if( inPass[0] && (today >= begIdx[0]) )
+            outADX[today-begIdx[0]] = prevADX;
+
+         if( inPass[1] )
+         {
+            /* Same as TA_ADXR, the average of the ADX and
+             * of the ADX optInTimePeriod-1 bars ago.
+             */
+            if( today >= begIdx[1] )
+               outADXR[today-begIdx[1]] = (prevADX+buffer[optInTimePeriod+(adxIdx+1)%optInTimePeriod])/2.0;
+            buffer[optInTimePeriod+adxIdx] = prevADX;
+            if( ++adxIdx == optInTimePeriod )
+               adxIdx = 0;
+         }
+      }
+   }
+
+   ARRAY_FREE( buffer );
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#endif
+
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
 /* Generated */ #define  USE_SINGLE_PRECISION_INPUT
@@ -788,6 +1116,281 @@
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */   // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::TA_INT_DMI( int    startIdx,
+/* Generated */                                            int    endIdx,
+/* Generated */                                            SubArray<double>^ inHigh,
+/* Generated */                                            SubArray<double>^ inLow,
+/* Generated */                                            SubArray<double>^ inClose,
+/* Generated */                                            int    optInTimePeriod,
+/* Generated */                                            cli::array<int>^ outBegIdx,
+/* Generated */                                            cli::array<int>^ outNBElement,
+/* Generated */                                            SubArray<double>^ outADX,
+/* Generated */                                            SubArray<double>^ outADXR,
+/* Generated */                                            SubArray<double>^ outDX,
+/* Generated */                                            SubArray<double>^ outPlusDI,
+/* Generated */                                            SubArray<double>^ outMinusDI,
+/* Generated */                                            SubArray<double>^ outPlusDM,
+/* Generated */                                            SubArray<double>^ outMinusDM,
+/* Generated */                                            SubArray<double>^ outATR )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::TA_INT_DMI( int    startIdx,
+/* Generated */                                            int    endIdx,
+/* Generated */                                            cli::array<INPUT_TYPE>^ inHigh,
+/* Generated */                                            cli::array<INPUT_TYPE>^ inLow,
+/* Generated */                                            cli::array<INPUT_TYPE>^ inClose,
+/* Generated */                                            int    optInTimePeriod,
+/* Generated */                                            cli::array<int>^ outBegIdx,
+/* Generated */                                            cli::array<int>^ outNBElement,
+/* Generated */                                            cli::array<double>^ outADX,
+/* Generated */                                            cli::array<double>^ outADXR,
+/* Generated */                                            cli::array<double>^ outDX,
+/* Generated */                                            cli::array<double>^ outPlusDI,
+/* Generated */                                            cli::array<double>^ outMinusDI,
+/* Generated */                                            cli::array<double>^ outPlusDM,
+/* Generated */                                            cli::array<double>^ outMinusDM,
+/* Generated */                                            cli::array<double>^ outATR )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode TA_INT_DMI( int        startIdx,
+/* Generated */                            int        endIdx,
+/* Generated */                            INPUT_TYPE inHigh[],
+/* Generated */                            INPUT_TYPE inLow[],
+/* Generated */                            INPUT_TYPE inClose[],
+/* Generated */                            int        optInTimePeriod,
+/* Generated */                            int        outBegIdx[],
+/* Generated */                            int        outNBElement[],
+/* Generated */                            double     outADX[],
+/* Generated */                            double     outADXR[],
+/* Generated */                            double     outDX[],
+/* Generated */                            double     outPlusDI[],
+/* Generated */                            double     outMinusDI[],
+/* Generated */                            double     outPlusDM[],
+/* Generated */                            double     outMinusDM[],
+/* Generated */                            double     outATR[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_DMI)( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                const INPUT_TYPE *inHigh,
+/* Generated */                                const INPUT_TYPE *inLow,
+/* Generated */                                const INPUT_TYPE *inClose,
+/* Generated */                                int    optInTimePeriod, 
+/* Generated */                                int   *outBegIdx,
+/* Generated */                                int   *outNBElement,
+/* Generated */                                double *outADX,
+/* Generated */                                double *outADXR,
+/* Generated */                                double *outDX,
+/* Generated */                                double *outPlusDI,
+/* Generated */                                double *outMinusDI,
+/* Generated */                                double *outPlusDM,
+/* Generated */                                double *outMinusDM,
+/* Generated */                                double *outATR )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    ENUM_DECLARATION(RetCode) retCode;
+/* Generated */    int today, o, passStart, outIdx, adxIdx;
+/* Generated */    double prevHigh, prevLow, prevClose;
+/* Generated */    double prevMinusDM, prevPlusDM, prevTR, prevATR;
+/* Generated */    double tempReal, tempReal2, diffP, diffM;
+/* Generated */    double minusDI, plusDI, sumDX, prevADX, DX;
+/* Generated */    int isDI, isDX;
+/* Generated */    VALUE_HANDLE_INT(outBegIdx1);
+/* Generated */    VALUE_HANDLE_INT(outNbElement1);
+/* Generated */    ARRAY_REF( buffer );
+/* Generated */    ARRAY_LOCAL(prevATRTemp,1);
+/* Generated */    int lookback[TA_DMI_NB_OUTPUT];
+/* Generated */    int begIdx[TA_DMI_NB_OUTPUT];
+/* Generated */    int inPass[TA_DMI_NB_OUTPUT];
+/* Generated */    int requested[TA_DMI_NB_OUTPUT];
+/* Generated */    if( optInTimePeriod < 2 )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    requested[0] = outADX     != NULL;
+/* Generated */    requested[1] = outADXR    != NULL;
+/* Generated */    requested[2] = outDX      != NULL;
+/* Generated */    requested[3] = outPlusDI  != NULL;
+/* Generated */    requested[4] = outMinusDI != NULL;
+/* Generated */    requested[5] = outPlusDM  != NULL;
+/* Generated */    requested[6] = outMinusDM != NULL;
+/* Generated */    requested[7] = outATR     != NULL;
+/* Generated */    lookback[0] = LOOKBACK_CALL(ADX)( optInTimePeriod );
+/* Generated */    lookback[1] = LOOKBACK_CALL(ADXR)( optInTimePeriod );
+/* Generated */    lookback[2] = LOOKBACK_CALL(DX)( optInTimePeriod );
+/* Generated */    lookback[3] = LOOKBACK_CALL(PLUS_DI)( optInTimePeriod );
+/* Generated */    lookback[4] = LOOKBACK_CALL(MINUS_DI)( optInTimePeriod );
+/* Generated */    lookback[5] = LOOKBACK_CALL(PLUS_DM)( optInTimePeriod );
+/* Generated */    lookback[6] = LOOKBACK_CALL(MINUS_DM)( optInTimePeriod );
+/* Generated */    lookback[7] = LOOKBACK_CALL(ATR)( optInTimePeriod );
+/* Generated */    for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+/* Generated */    {
+/* Generated */       outBegIdx[o] = 0;
+/* Generated */       outNBElement[o] = 0;
+/* Generated */       begIdx[o] = startIdx < lookback[o]? lookback[o] : startIdx;
+/* Generated */       if( begIdx[o] > endIdx )
+/* Generated */          requested[o] = 0;
+/* Generated */    }
+/* Generated */    ARRAY_ALLOC( buffer, 2*optInTimePeriod );
+/* Generated */    #if !defined( _JAVA )
+/* Generated */       if( !buffer )
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */    #endif
+/* Generated */    for( ;; )
+/* Generated */    {
+/* Generated */       passStart = -1;
+/* Generated */       for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+/* Generated */       {
+/* Generated */          inPass[o] = 0;
+/* Generated */          if( requested[o] )
+/* Generated */          {
+/* Generated */             if( passStart == -1 )
+/* Generated */                passStart = begIdx[o]-lookback[o];
+/* Generated */             if( begIdx[o]-lookback[o] == passStart )
+/* Generated */             {
+/* Generated */                inPass[o] = 1;
+/* Generated */                requested[o] = 0;
+/* Generated */                outBegIdx[o] = begIdx[o];
+/* Generated */                outNBElement[o] = endIdx-begIdx[o]+1;
+/* Generated */             }
+/* Generated */          }
+/* Generated */       }
+/* Generated */       if( passStart == -1 )
+/* Generated */          break;
+/* Generated */       prevMinusDM = 0.0;
+/* Generated */       prevPlusDM  = 0.0;
+/* Generated */       prevTR      = 0.0;
+/* Generated */       prevATR     = 0.0;
+/* Generated */       sumDX       = 0.0;
+/* Generated */       prevADX     = 0.0;
+/* Generated */       DX          = 0.0;
+/* Generated */       adxIdx      = 0;
+/* Generated */       today       = passStart;
+/* Generated */       prevHigh    = inHigh[today];
+/* Generated */       prevLow     = inLow[today];
+/* Generated */       prevClose   = inClose[today];
+/* Generated */       while( today < endIdx )
+/* Generated */       {
+/* Generated */          today++;
+/* Generated */          outIdx = today-passStart;
+/* Generated */          tempReal = inHigh[today];
+/* Generated */          diffP    = tempReal-prevHigh; 
+/* Generated */          prevHigh = tempReal;
+/* Generated */          tempReal = inLow[today];
+/* Generated */          diffM    = prevLow-tempReal;   
+/* Generated */          prevLow  = tempReal;
+/* Generated */          if( outIdx >= optInTimePeriod )
+/* Generated */          {
+/* Generated */             prevMinusDM -= prevMinusDM/optInTimePeriod;
+/* Generated */             prevPlusDM  -= prevPlusDM/optInTimePeriod;
+/* Generated */          }
+/* Generated */          if( (diffM > 0) && (diffP < diffM) )
+/* Generated */          {
+/* Generated */             prevMinusDM += diffM;
+/* Generated */          }
+/* Generated */          else if( (diffP > 0) && (diffP > diffM) )
+/* Generated */          {
+/* Generated */             prevPlusDM += diffP;
+/* Generated */          }
+/* Generated */          TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
+/* Generated */          if( outIdx < optInTimePeriod )
+/* Generated */             prevTR += tempReal;
+/* Generated */          else
+/* Generated */             prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+/* Generated */          prevClose = inClose[today];
+/* Generated */          if( inPass[7] )
+/* Generated */          {
+/* Generated */             if( outIdx <= optInTimePeriod )
+/* Generated */             {
+/* Generated */                buffer[outIdx-1] = tempReal;
+/* Generated */                if( outIdx == optInTimePeriod )
+/* Generated */                {
+/* Generated */                   retCode = FUNCTION_CALL_DOUBLE(INT_SMA)( optInTimePeriod-1, optInTimePeriod-1,
+/* Generated */                                                            buffer, optInTimePeriod,
+/* Generated */                                                            VALUE_HANDLE_OUT(outBegIdx1),
+/* Generated */                                                            VALUE_HANDLE_OUT(outNbElement1),
+/* Generated */                                                            prevATRTemp );
+/* Generated */                   if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */                   {
+/* Generated */                      ARRAY_FREE( buffer );
+/* Generated */                      return retCode;
+/* Generated */                   }
+/* Generated */                   prevATR = prevATRTemp[0];
+/* Generated */                }
+/* Generated */             }
+/* Generated */             else
+/* Generated */             {
+/* Generated */                prevATR *= optInTimePeriod - 1;
+/* Generated */                prevATR += tempReal;
+/* Generated */                prevATR /= optInTimePeriod;
+/* Generated */             }
+/* Generated */             if( today >= begIdx[7] )
+/* Generated */                outATR[today-begIdx[7]] = prevATR;
+/* Generated */          }
+/* Generated */          if( inPass[5] && (today >= begIdx[5]) )
+/* Generated */             outPlusDM[today-begIdx[5]] = prevPlusDM;
+/* Generated */          if( inPass[6] && (today >= begIdx[6]) )
+/* Generated */             outMinusDM[today-begIdx[6]] = prevMinusDM;
+/* Generated */          if( outIdx < optInTimePeriod )
+/* Generated */             continue;
+/* Generated */          isDI = !TA_IS_ZERO(prevTR);
+/* Generated */          isDX = 0;
+/* Generated */          minusDI = plusDI = 0.0;
+/* Generated */          if( isDI )
+/* Generated */          {
+/* Generated */             minusDI  = 100.0*(prevMinusDM/prevTR);
+/* Generated */             plusDI   = 100.0*(prevPlusDM/prevTR);
+/* Generated */             tempReal = minusDI+plusDI;
+/* Generated */             if( !TA_IS_ZERO(tempReal) )
+/* Generated */             {
+/* Generated */                isDX = 1;
+/* Generated */                DX = 100.0*(std_fabs(minusDI-plusDI)/tempReal);
+/* Generated */             }
+/* Generated */          }
+/* Generated */          if( inPass[3] && (today >= begIdx[3]) )
+/* Generated */             outPlusDI[today-begIdx[3]] = plusDI;
+/* Generated */          if( inPass[4] && (today >= begIdx[4]) )
+/* Generated */             outMinusDI[today-begIdx[4]] = minusDI;
+/* Generated */          if( inPass[2] && (today >= begIdx[2]) )
+/* Generated */          {
+/* Generated */             if( isDX )
+/* Generated */                outDX[today-begIdx[2]] = DX;
+/* Generated */             else if( today == begIdx[2] )
+/* Generated */                outDX[0] = 0.0;
+/* Generated */             else
+/* Generated */                outDX[today-begIdx[2]] = outDX[today-begIdx[2]-1];
+/* Generated */          }
+/* Generated */          if( !inPass[0] && !inPass[1] )
+/* Generated */             continue;
+/* Generated */          if( outIdx < 2*optInTimePeriod-1 )
+/* Generated */          {
+/* Generated */             if( isDX )
+/* Generated */                sumDX += DX;
+/* Generated */             continue;
+/* Generated */          }
+/* Generated */          if( outIdx == 2*optInTimePeriod-1 )
+/* Generated */          {
+/* Generated */             if( isDX )
+/* Generated */                sumDX += DX;
+/* Generated */             prevADX = sumDX / optInTimePeriod;
+/* Generated */          }
+/* Generated */          else if( isDX )
+/* Generated */             prevADX = ((prevADX*(optInTimePeriod-1))+DX)/optInTimePeriod;
+/* Generated */          if( inPass[0] && (today >= begIdx[0]) )
+/* Generated */             outADX[today-begIdx[0]] = prevADX;
+/* Generated */          if( inPass[1] )
+/* Generated */          {
+/* Generated */             if( today >= begIdx[1] )
+/* Generated */                outADXR[today-begIdx[1]] = (prevADX+buffer[optInTimePeriod+(adxIdx+1)%optInTimePeriod])/2.0;
+/* Generated */             buffer[optInTimePeriod+adxIdx] = prevADX;
+/* Generated */             if( ++adxIdx == optInTimePeriod )
+/* Generated */                adxIdx = 0;
+/* Generated */          }
+/* Generated */       }
+/* Generated */    }
+/* Generated */    ARRAY_FREE( buffer );
+/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ }
+/* Generated */ #endif
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
@@ -157,6 +157,8 @@
 {
    /* insert local variable here */
 	int today, outIdx, lookback;
+	double laneSum[TA_MEANDEV_LANES], laneMean[TA_MEANDEV_LANES], laneDev[TA_MEANDEV_LANES];
+	int k;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -205,6 +207,37 @@
 
 	outIdx = 0;
 
+	/* Evaluate TA_MEANDEV_LANES outputs at a time, the lane 'k' adds
+	 * inReal[today+k-i] at the step 'i', which are the same values in
+	 * the same order as the loop below (see ta_utility.h).
+	 */
+	while (today+TA_MEANDEV_LANES-1 <= endIdx) {
+		int i;
+
+		for (k = 0; k < TA_MEANDEV_LANES; k++) {
+			laneSum[k] = 0.0;
+		}
+		for (i = 0; i < optInTimePeriod; i++) {
+			TA_MEANDEV_ADD(laneSum, &inReal[today-i]);
+		}
+
+		for (k = 0; k < TA_MEANDEV_LANES; k++) {
+			laneMean[k] = laneSum[k]/optInTimePeriod;
+			laneDev[k] = 0.0;
+		}
+		for (i = 0; i < optInTimePeriod; i++) {
+			TA_MEANDEV_ADD_DEV(laneDev, &inReal[today-i], laneMean);
+		}
+
+		for (k = 0; k < TA_MEANDEV_LANES; k++) {
+			outReal[outIdx+k] = laneDev[k]/optInTimePeriod;
+		}
+
+		outIdx += TA_MEANDEV_LANES;
+		today += TA_MEANDEV_LANES;
+	}
+
+	/* The last outputs, one at a time. */
 	while (today <= endIdx) {
 	   	double todaySum, todayDev;
 		int i;
@@ -274,6 +307,8 @@
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */ 	int today, outIdx, lookback;
+/* Generated */ 	double laneSum[TA_MEANDEV_LANES], laneMean[TA_MEANDEV_LANES], laneDev[TA_MEANDEV_LANES];
+/* Generated */ 	int k;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -303,6 +338,27 @@
 /* Generated */ 	}
 /* Generated */ 	VALUE_HANDLE_DEREF(outBegIdx) = today;
 /* Generated */ 	outIdx = 0;
+/* Generated */ 	while (today+TA_MEANDEV_LANES-1 <= endIdx) {
+/* Generated */ 		int i;
+/* Generated */ 		for (k = 0; k < TA_MEANDEV_LANES; k++) {
+/* Generated */ 			laneSum[k] = 0.0;
+/* Generated */ 		}
+/* Generated */ 		for (i = 0; i < optInTimePeriod; i++) {
+/* Generated */ 			TA_MEANDEV_ADD(laneSum, &inReal[today-i]);
+/* Generated */ 		}
+/* Generated */ 		for (k = 0; k < TA_MEANDEV_LANES; k++) {
+/* Generated */ 			laneMean[k] = laneSum[k]/optInTimePeriod;
+/* Generated */ 			laneDev[k] = 0.0;
+/* Generated */ 		}
+/* Generated */ 		for (i = 0; i < optInTimePeriod; i++) {
+/* Generated */ 			TA_MEANDEV_ADD_DEV(laneDev, &inReal[today-i], laneMean);
+/* Generated */ 		}
+/* Generated */ 		for (k = 0; k < TA_MEANDEV_LANES; k++) {
+/* Generated */ 			outReal[outIdx+k] = laneDev[k]/optInTimePeriod;
+/* Generated */ 		}
+/* Generated */ 		outIdx += TA_MEANDEV_LANES;
+/* Generated */ 		today += TA_MEANDEV_LANES;
+/* Generated */ 	}
 /* Generated */ 	while (today <= endIdx) {
 /* Generated */ 	   	double todaySum, todayDev;
 /* Generated */ 		int i;
@@ -329,28 +329,21 @@
       return retCode;
    }
 
-   /* Calculate the standard deviation into tempBuffer2. */
-   if( optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
-   {
-      /* A small speed optimization by re-using the
-       * already calculated SMA.
-       */
-       FUNCTION_CALL(INT_stddev_using_precalc_ma)( inReal, tempBuffer1, 
-                                                   (int)VALUE_HANDLE_DEREF(outBegIdx), (int)VALUE_HANDLE_DEREF(outNBElement),
-                                                   optInTimePeriod, tempBuffer2 );
-   }
-   else
-   {
-      /* Calculate the Standard Deviation */
-      retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
-                                       optInTimePeriod, 1.0,
-                                       outBegIdx, outNBElement, tempBuffer2 );
+   /* Calculate the standard deviation into tempBuffer2.
+    *
+    * The rolling moments of TA_STDDEV are used for all the MA
+    * types, including the SMA. Re-using the already calculated
+    * SMA with the sum of the squares is not accurate when the
+    * values are large compared to their spread.
+    */
+   retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
+                                    optInTimePeriod, 1.0,
+                                    outBegIdx, outNBElement, tempBuffer2 );
 
-      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-      {
-         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-         return retCode;
-      }
+   if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return retCode;
    }
 
    /* Copy the MA calculation into the middle band ouput, unless
@@ -571,22 +564,13 @@
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return retCode;
 /* Generated */    }
-/* Generated */    if( optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
-/* Generated */    {
-/* Generated */        FUNCTION_CALL(INT_stddev_using_precalc_ma)( inReal, tempBuffer1, 
-/* Generated */                                                    (int)VALUE_HANDLE_DEREF(outBegIdx), (int)VALUE_HANDLE_DEREF(outNBElement),
-/* Generated */                                                    optInTimePeriod, tempBuffer2 );
-/* Generated */    }
-/* Generated */    else
+/* Generated */    retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
+/* Generated */                                     optInTimePeriod, 1.0,
+/* Generated */                                     outBegIdx, outNBElement, tempBuffer2 );
+/* Generated */    if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
 /* Generated */    {
-/* Generated */       retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
-/* Generated */                                        optInTimePeriod, 1.0,
-/* Generated */                                        outBegIdx, outNBElement, tempBuffer2 );
-/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-/* Generated */       {
-/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */          return retCode;
-/* Generated */       }
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return retCode;
 /* Generated */    }
 /* Generated */    #if !defined(USE_SINGLE_PRECISION_INPUT)
 /* Generated */       if( tempBuffer1 != outRealMiddleBand )
@@ -157,19 +157,18 @@
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
-    double S_xx = 0.0f; /* sum of x * x */
-    double S_xy = 0.0f; /* sum of x * y */
-    double S_x = 0.0f; /* sum of x */
-    double S_y = 0.0f; /* sum of y */
-    double last_price_x = 0.0f; /* the last price read from inReal0 */
-    double last_price_y = 0.0f; /* the last price read from inReal1 */
-    double trailing_last_price_x = 0.0f; /* same as last_price_x except used to remove elements from the trailing summation */
-    double trailing_last_price_y = 0.0f; /* same as last_price_y except used to remove elements from the trailing summation */
+    double mean_x = 0.0; /* mean of x */
+    double mean_y = 0.0; /* mean of y */
+    double S_dxdx = 0.0; /* sum of the squared deviations of x */
+    double S_dydy = 0.0; /* sum of the squared deviations of y */
+    double S_dxdy = 0.0; /* sum of the products of the deviations of x and y */
+    double trailing_x = 0.0; /* the 'x' value leaving the period on the next iteration */
+    double trailing_y = 0.0; /* the 'y' value leaving the period on the next iteration */
     double tmp_real = 0.0f; /* temporary variable */
     double x; /* the 'x' value, which is the last change between values in inReal0 */
     double y; /* the 'y' value, which is the last change between values in inReal1 */
     double n = 0.0f;
-    int i, outIdx;
+    int i, today, outIdx;
     int trailingIdx, nbInitialElementNeeded;
 
 
@@ -236,90 +235,95 @@
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }   
 
-   /* Consume first input. */
-   trailingIdx = startIdx-nbInitialElementNeeded;
-   last_price_x = trailing_last_price_x = inReal0[trailingIdx];
-   last_price_y = trailing_last_price_y = inReal1[trailingIdx];
-
-   /* Process remaining of lookback until ready to output the first value. */
-   i = ++trailingIdx;
-
-   while( i < startIdx )
-   {
-       tmp_real = inReal0[i];
-       if( !TA_IS_ZERO(last_price_x) )
-          x = (tmp_real-last_price_x)/last_price_x;
-       else
-          x = 0.0;
-       last_price_x = tmp_real;
-
-       tmp_real = inReal1[i++];
-       if( !TA_IS_ZERO(last_price_y) )
-          y = (tmp_real-last_price_y)/last_price_y;
-       else
-          y = 0.0;
-       last_price_y = tmp_real;
-
-       S_xx += x*x;
-       S_xy += x*y;
-       S_x += x;
-       S_y += y;      
-   }
-   
-
+   /* The slope is the sum of the products of the deviations of x
+    * and y divided by the sum of the squared deviations of x. The
+    * moments are rolled with the Welford update of
+    * TA_COMOMENTS_REPLACE (see ta_utility.h) and are rebuilt from
+    * the whole period every TA_MOMENTS_RESUM_PERIOD outputs.
+    */
    outIdx = 0; /* First output always start at index zero */
    n = (double)optInTimePeriod;
+   today = startIdx;
    do
    {
-       tmp_real = inReal0[i];
-       if( !TA_IS_ZERO(last_price_x) )
-          x = (tmp_real-last_price_x)/last_price_x;
-       else
-          x = 0.0;
-       last_price_x = tmp_real;
+       if( (outIdx % TA_MOMENTS_RESUM_PERIOD) == 0 )
+       {
+          /* The changes of the period are at [trailingIdx..today]. */
+          trailingIdx = today-nbInitialElementNeeded+1;
+          mean_x = mean_y = 0.0;
+          for( i=trailingIdx; i <= today; i++ )
+          {
+             tmp_real = inReal0[i-1];
+             if( !TA_IS_ZERO(tmp_real) )
+                mean_x += (inReal0[i]-tmp_real)/tmp_real;
+             tmp_real = inReal1[i-1];
+             if( !TA_IS_ZERO(tmp_real) )
+                mean_y += (inReal1[i]-tmp_real)/tmp_real;
+          }
+          mean_x /= n;
+          mean_y /= n;
 
-       tmp_real = inReal1[i++];
-       if( !TA_IS_ZERO(last_price_y) )
-          y = (tmp_real-last_price_y)/last_price_y;
+          S_dxdx = S_dydy = S_dxdy = 0.0;
+          for( i=trailingIdx; i <= today; i++ )
+          {
+             tmp_real = inReal0[i-1];
+             if( !TA_IS_ZERO(tmp_real) )
+                x = (inReal0[i]-tmp_real)/tmp_real;
+             else
+                x = 0.0;
+             tmp_real = inReal1[i-1];
+             if( !TA_IS_ZERO(tmp_real) )
+                y = (inReal1[i]-tmp_real)/tmp_real;
+             else
+                y = 0.0;
+             x -= mean_x;
+             y -= mean_y;
+             S_dxdx += x*x;
+             S_dydy += y*y;
+             S_dxdy += x*y;
+          }
+       }
        else
-          y = 0.0;
-       last_price_y = tmp_real;
+       {
+          tmp_real = inReal0[today-1];
+          if( !TA_IS_ZERO(tmp_real) )
+             x = (inReal0[today]-tmp_real)/tmp_real;
+          else
+             x = 0.0;
 
-       S_xx += x*x;
-       S_xy += x*y;
-       S_x += x;
-       S_y += y;
+          tmp_real = inReal1[today-1];
+          if( !TA_IS_ZERO(tmp_real) )
+             y = (inReal1[today]-tmp_real)/tmp_real;
+          else
+             y = 0.0;
+
+          TA_COMOMENTS_REPLACE( n, mean_x, mean_y, S_dxdx, S_dydy, S_dxdy,
+                                x, y, trailing_x, trailing_y );
+       }
 
        /* Always read the trailing before writing the output because the input and output
         * buffer can be the same.
         */
-       tmp_real = inReal0[trailingIdx];
-       if( !TA_IS_ZERO(trailing_last_price_x) )
-          x = (tmp_real-trailing_last_price_x)/trailing_last_price_x;
+       trailingIdx = today-nbInitialElementNeeded+1;
+       tmp_real = inReal0[trailingIdx-1];
+       if( !TA_IS_ZERO(tmp_real) )
+          trailing_x = (inReal0[trailingIdx]-tmp_real)/tmp_real;
        else
-          x = 0.0;
-       trailing_last_price_x = tmp_real;
+          trailing_x = 0.0;
 
-       tmp_real = inReal1[trailingIdx++];
-       if( !TA_IS_ZERO(trailing_last_price_y) )
-          y = (tmp_real-trailing_last_price_y)/trailing_last_price_y;
+       tmp_real = inReal1[trailingIdx-1];
+       if( !TA_IS_ZERO(tmp_real) )
+          trailing_y = (inReal1[trailingIdx]-tmp_real)/tmp_real;
        else
-          y = 0.0;
-       trailing_last_price_y = tmp_real;
+          trailing_y = 0.0;
 
        /* Write the output */
-       tmp_real = (n * S_xx) - (S_x * S_x);
+       tmp_real = n * S_dxdx;
        if( !TA_IS_ZERO(tmp_real) )
-          outReal[outIdx++] = ((n * S_xy) - (S_x * S_y)) / tmp_real;
+          outReal[outIdx++] = S_dxdy / S_dxdx;
        else
           outReal[outIdx++] = 0.0;
-
-       /* Remove the calculation starting with the trailingIdx. */
-       S_xx -= x*x;
-       S_xy -= x*y;
-       S_x -= x;
-       S_y -= y;       
-   } while( i <= endIdx );
+   } while( ++today <= endIdx );
 
    /* All done. Indicate the output limits and return. */
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
@@ -376,19 +380,18 @@
 /* Generated */                       double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */     double S_xx = 0.0f; 
-/* Generated */     double S_xy = 0.0f; 
-/* Generated */     double S_x = 0.0f; 
-/* Generated */     double S_y = 0.0f; 
-/* Generated */     double last_price_x = 0.0f; 
-/* Generated */     double last_price_y = 0.0f; 
-/* Generated */     double trailing_last_price_x = 0.0f; 
-/* Generated */     double trailing_last_price_y = 0.0f; 
+/* Generated */     double mean_x = 0.0; 
+/* Generated */     double mean_y = 0.0; 
+/* Generated */     double S_dxdx = 0.0; 
+/* Generated */     double S_dydy = 0.0; 
+/* Generated */     double S_dxdy = 0.0; 
+/* Generated */     double trailing_x = 0.0; 
+/* Generated */     double trailing_y = 0.0; 
 /* Generated */     double tmp_real = 0.0f; 
 /* Generated */     double x; 
 /* Generated */     double y; 
 /* Generated */     double n = 0.0f;
-/* Generated */     int i, outIdx;
+/* Generated */     int i, today, outIdx;
 /* Generated */     int trailingIdx, nbInitialElementNeeded;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
@@ -417,71 +420,78 @@
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }   
-/* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
-/* Generated */    last_price_x = trailing_last_price_x = inReal0[trailingIdx];
-/* Generated */    last_price_y = trailing_last_price_y = inReal1[trailingIdx];
-/* Generated */    i = ++trailingIdx;
-/* Generated */    while( i < startIdx )
-/* Generated */    {
-/* Generated */        tmp_real = inReal0[i];
-/* Generated */        if( !TA_IS_ZERO(last_price_x) )
-/* Generated */           x = (tmp_real-last_price_x)/last_price_x;
-/* Generated */        else
-/* Generated */           x = 0.0;
-/* Generated */        last_price_x = tmp_real;
-/* Generated */        tmp_real = inReal1[i++];
-/* Generated */        if( !TA_IS_ZERO(last_price_y) )
-/* Generated */           y = (tmp_real-last_price_y)/last_price_y;
-/* Generated */        else
-/* Generated */           y = 0.0;
-/* Generated */        last_price_y = tmp_real;
-/* Generated */        S_xx += x*x;
-/* Generated */        S_xy += x*y;
-/* Generated */        S_x += x;
-/* Generated */        S_y += y;      
-/* Generated */    }
 /* Generated */    outIdx = 0; 
 /* Generated */    n = (double)optInTimePeriod;
+/* Generated */    today = startIdx;
 /* Generated */    do
 /* Generated */    {
-/* Generated */        tmp_real = inReal0[i];
-/* Generated */        if( !TA_IS_ZERO(last_price_x) )
-/* Generated */           x = (tmp_real-last_price_x)/last_price_x;
-/* Generated */        else
-/* Generated */           x = 0.0;
-/* Generated */        last_price_x = tmp_real;
-/* Generated */        tmp_real = inReal1[i++];
-/* Generated */        if( !TA_IS_ZERO(last_price_y) )
-/* Generated */           y = (tmp_real-last_price_y)/last_price_y;
+/* Generated */        if( (outIdx % TA_MOMENTS_RESUM_PERIOD) == 0 )
+/* Generated */        {
+/* Generated */           trailingIdx = today-nbInitialElementNeeded+1;
+/* Generated */           mean_x = mean_y = 0.0;
+/* Generated */           for( i=trailingIdx; i <= today; i++ )
+/* Generated */           {
+/* Generated */              tmp_real = inReal0[i-1];
+/* Generated */              if( !TA_IS_ZERO(tmp_real) )
+/* Generated */                 mean_x += (inReal0[i]-tmp_real)/tmp_real;
+/* Generated */              tmp_real = inReal1[i-1];
+/* Generated */              if( !TA_IS_ZERO(tmp_real) )
+/* Generated */                 mean_y += (inReal1[i]-tmp_real)/tmp_real;
+/* Generated */           }
+/* Generated */           mean_x /= n;
+/* Generated */           mean_y /= n;
+/* Generated */           S_dxdx = S_dydy = S_dxdy = 0.0;
+/* Generated */           for( i=trailingIdx; i <= today; i++ )
+/* Generated */           {
+/* Generated */              tmp_real = inReal0[i-1];
+/* Generated */              if( !TA_IS_ZERO(tmp_real) )
+/* Generated */                 x = (inReal0[i]-tmp_real)/tmp_real;
+/* Generated */              else
+/* Generated */                 x = 0.0;
+/* Generated */              tmp_real = inReal1[i-1];
+/* Generated */              if( !TA_IS_ZERO(tmp_real) )
+/* Generated */                 y = (inReal1[i]-tmp_real)/tmp_real;
+/* Generated */              else
+/* Generated */                 y = 0.0;
+/* Generated */              x -= mean_x;
+/* Generated */              y -= mean_y;
+/* Generated */              S_dxdx += x*x;
+/* Generated */              S_dydy += y*y;
+/* Generated */              S_dxdy += x*y;
+/* Generated */           }
+/* Generated */        }
 /* Generated */        else
-/* Generated */           y = 0.0;
-/* Generated */        last_price_y = tmp_real;
-/* Generated */        S_xx += x*x;
-/* Generated */        S_xy += x*y;
-/* Generated */        S_x += x;
-/* Generated */        S_y += y;
-/* Generated */        tmp_real = inReal0[trailingIdx];
-/* Generated */        if( !TA_IS_ZERO(trailing_last_price_x) )
-/* Generated */           x = (tmp_real-trailing_last_price_x)/trailing_last_price_x;
+/* Generated */        {
+/* Generated */           tmp_real = inReal0[today-1];
+/* Generated */           if( !TA_IS_ZERO(tmp_real) )
+/* Generated */              x = (inReal0[today]-tmp_real)/tmp_real;
+/* Generated */           else
+/* Generated */              x = 0.0;
+/* Generated */           tmp_real = inReal1[today-1];
+/* Generated */           if( !TA_IS_ZERO(tmp_real) )
+/* Generated */              y = (inReal1[today]-tmp_real)/tmp_real;
+/* Generated */           else
+/* Generated */              y = 0.0;
+/* Generated */           TA_COMOMENTS_REPLACE( n, mean_x, mean_y, S_dxdx, S_dydy, S_dxdy,
+/* Generated */                                 x, y, trailing_x, trailing_y );
+/* Generated */        }
+/* Generated */        trailingIdx = today-nbInitialElementNeeded+1;
+/* Generated */        tmp_real = inReal0[trailingIdx-1];
+/* Generated */        if( !TA_IS_ZERO(tmp_real) )
+/* Generated */           trailing_x = (inReal0[trailingIdx]-tmp_real)/tmp_real;
 /* Generated */        else
-/* Generated */           x = 0.0;
-/* Generated */        trailing_last_price_x = tmp_real;
-/* Generated */        tmp_real = inReal1[trailingIdx++];
-/* Generated */        if( !TA_IS_ZERO(trailing_last_price_y) )
-/* Generated */           y = (tmp_real-trailing_last_price_y)/trailing_last_price_y;
+/* Generated */           trailing_x = 0.0;
+/* Generated */        tmp_real = inReal1[trailingIdx-1];
+/* Generated */        if( !TA_IS_ZERO(tmp_real) )
+/* Generated */           trailing_y = (inReal1[trailingIdx]-tmp_real)/tmp_real;
 /* Generated */        else
-/* Generated */           y = 0.0;
-/* Generated */        trailing_last_price_y = tmp_real;
-/* Generated */        tmp_real = (n * S_xx) - (S_x * S_x);
+/* Generated */           trailing_y = 0.0;
+/* Generated */        tmp_real = n * S_dxdx;
 /* Generated */        if( !TA_IS_ZERO(tmp_real) )
-/* Generated */           outReal[outIdx++] = ((n * S_xy) - (S_x * S_y)) / tmp_real;
+/* Generated */           outReal[outIdx++] = S_dxdy / S_dxdx;
 /* Generated */        else
 /* Generated */           outReal[outIdx++] = 0.0;
-/* Generated */        S_xx -= x*x;
-/* Generated */        S_xy -= x*y;
-/* Generated */        S_x -= x;
-/* Generated */        S_y -= y;       
-/* Generated */    } while( i <= endIdx );
+/* Generated */    } while( ++today <= endIdx );
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
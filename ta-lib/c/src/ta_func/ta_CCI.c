@@ -171,11 +171,13 @@
 	/* insert local variable here */
    double tempReal, tempReal2, theAverage, lastValue;
    int i, j, outIdx, lookbackTotal;
+   int today, nbOut, m, c, k, phase, first;
+   double laneSum[TA_MEANDEV_LANES], laneDev[TA_MEANDEV_LANES], laneValue[TA_MEANDEV_LANES];
 
-   /* This ptr will points on a circular buffer of
-    * at least "optInTimePeriod" element.
+   /* The typical prices of the window of the first output of a
+    * block, followed by those of the TA_MEANDEV_BLOCK outputs.
     */
-   CIRCBUF_PROLOG(circBuffer,double,30);
+   ARRAY_REF(typPrice);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -229,73 +231,156 @@
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
-   /* Allocate a circular buffer equal to the requested
-    * period.
-    */
-   CIRCBUF_INIT( circBuffer, double, optInTimePeriod );
-  
-   /* Do the MA calculation using tight loops. */
-
-   /* Add-up the initial period, except for the last value. 
-    * Fill up the circular buffer at the same time.
-    */
-   i=startIdx-lookbackTotal;
-   if( optInTimePeriod > 1 )
+   ARRAY_ALLOC(typPrice,lookbackTotal+TA_MEANDEV_BLOCK);
+   if( !typPrice )
    {
-      while( i < startIdx )
-      {
-         circBuffer[circBuffer_Idx] = (inHigh[i]+inLow[i]+inClose[i])/3;
-         i++;
-         CIRCBUF_NEXT(circBuffer);
-      }
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
    }
 
-   /* Proceed with the calculation for the requested range.
-    * Note that this algorithm allows the inReal and
-    * outReal to be the same buffer.
+   /* The window used to be kept in a circular buffer of
+    * optInTimePeriod values and summed from the first slot of the
+    * buffer. The window is now linear: the window of the output
+    * 'm' is typPrice[m] to typPrice[m+lookbackTotal], and 'phase'
+    * is the number of its newest values which were in the first
+    * slots. They are summed first, from the position 'first',
+    * followed by the older ones, so the sums are the same as
+    * before.
+    *
+    * The TA_MEANDEV_LANES outputs starting at typPrice[m] are
+    * evaluated together (see ta_utility.h). In the order of the
+    * output 'm', the lane 'k' adds the same values, except at the
+    * window positions 'c' below 'k': the value of the slot was
+    * replaced by the one at 'c+optInTimePeriod'. A period shorter
+    * than the lanes would replace a slot more than once, it is
+    * evaluated one output at a time.
+    *
+    * Note that this algorithm allows the inReal and outReal to
+    * be the same buffer, each block reads its window again.
     */
    outIdx = 0;
-   do
+   phase = 0;
+   today = startIdx;
+   while( today <= endIdx )
    {
-      lastValue = (inHigh[i]+inLow[i]+inClose[i])/3;
-      circBuffer[circBuffer_Idx] = lastValue;
+      nbOut = endIdx-today+1;
+      if( nbOut > TA_MEANDEV_BLOCK )
+         nbOut = TA_MEANDEV_BLOCK;
+      j = 0;
+      for( i=today-lookbackTotal; i < today+nbOut; i++ )
+         typPrice[j++] = (inHigh[i]+inLow[i]+inClose[i])/3;
 
-      /* Calculate the average for the whole period. */
-      theAverage = 0;
-      for( j=0; j < optInTimePeriod; j++ )
-         theAverage += circBuffer[j];
-      theAverage /= optInTimePeriod;
+      m = 0;
+      while( (optInTimePeriod >= TA_MEANDEV_LANES) && (m+TA_MEANDEV_LANES <= nbOut) )
+      {
+         first = optInTimePeriod-phase;
+
+         for( k=0; k < TA_MEANDEV_LANES; k++ )
+            laneSum[k] = 0.0;
+         c = first == optInTimePeriod ? 0 : first;
+         for( j=0; j < optInTimePeriod; j++ )
+         {
+            if( c < TA_MEANDEV_LANES-1 )
+            {
+               for( k=0; k < TA_MEANDEV_LANES; k++ )
+                  laneValue[k] = typPrice[m+c+(c < k ? optInTimePeriod : 0)];
+               TA_MEANDEV_ADD(laneSum,laneValue);
+            }
+            else
+            {
+               tempReal = typPrice[m+c];
+               TA_MEANDEV_ADD_ALL(laneSum,tempReal);
+            }
+            if( ++c == optInTimePeriod )
+               c = 0;
+         }
+
+         for( k=0; k < TA_MEANDEV_LANES; k++ )
+         {
+            laneSum[k] /= optInTimePeriod;
+            laneDev[k] = 0.0;
+         }
+         c = first == optInTimePeriod ? 0 : first;
+         for( j=0; j < optInTimePeriod; j++ )
+         {
+            if( c < TA_MEANDEV_LANES-1 )
+            {
+               for( k=0; k < TA_MEANDEV_LANES; k++ )
+                  laneValue[k] = typPrice[m+c+(c < k ? optInTimePeriod : 0)];
+               TA_MEANDEV_ADD_DEV(laneDev,laneValue,laneSum);
+            }
+            else
+            {
+               tempReal = typPrice[m+c];
+               TA_MEANDEV_ADD_DEV_ALL(laneDev,tempReal,laneSum);
+            }
+            if( ++c == optInTimePeriod )
+               c = 0;
+         }
 
-      /* Do the summation of the ABS(TypePrice-average)
-       * for the whole period.
-       */
-      tempReal2 = 0;
-      for( j=0; j < optInTimePeriod; j++ )
-         tempReal2 += std_fabs(circBuffer[j]-theAverage);
+         /* And finally, the CCI... */
+         for( k=0; k < TA_MEANDEV_LANES; k++ )
+         {
+            tempReal = typPrice[m+k+lookbackTotal]-laneSum[k];
+            if( (tempReal != 0.0) && (laneDev[k] != 0.0) )
+               outReal[outIdx++] = tempReal/(0.015*(laneDev[k]/optInTimePeriod));
+            else
+               outReal[outIdx++] = 0.0;
+         }
 
-      /* And finally, the CCI... */
-      tempReal = lastValue-theAverage;
+         phase += TA_MEANDEV_LANES;
+         if( phase >= optInTimePeriod )
+            phase -= optInTimePeriod;
+         m += TA_MEANDEV_LANES;
+      }
 
-      if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+      /* The last outputs of the block, one at a time. */
+      for( ; m < nbOut; m++ )
       {
-         outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+         lastValue = typPrice[m+lookbackTotal];
+         first = optInTimePeriod-phase;
+
+         /* Calculate the average for the whole period. */
+         theAverage = 0;
+         for( c=first; c < optInTimePeriod; c++ )
+            theAverage += typPrice[m+c];
+         for( c=0; c < first; c++ )
+            theAverage += typPrice[m+c];
+         theAverage /= optInTimePeriod;
+
+         /* Do the summation of the ABS(TypePrice-average)
+          * for the whole period.
+          */
+         tempReal2 = 0;
+         for( c=first; c < optInTimePeriod; c++ )
+            tempReal2 += std_fabs(typPrice[m+c]-theAverage);
+         for( c=0; c < first; c++ )
+            tempReal2 += std_fabs(typPrice[m+c]-theAverage);
+
+         /* And finally, the CCI... */
+         tempReal = lastValue-theAverage;
+
+         if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+         {
+            outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+         }
+         else
+            outReal[outIdx++] = 0.0;
+
+         if( ++phase == optInTimePeriod )
+            phase = 0;
       }
-      else
-         outReal[outIdx++] = 0.0;
-      
-      /* Move forward the circular buffer indexes. */
-      CIRCBUF_NEXT(circBuffer);
 
-      i++;
-   } while( i <= endIdx );
+      today += nbOut;
+   }
+
+   ARRAY_FREE(typPrice);
 
    /* All done. Indicate the output limits and return. */
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 
-   /* Free the circular buffer if it was dynamically allocated. */
-   CIRCBUF_DESTROY(circBuffer);
-
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
 
@@ -353,7 +438,9 @@
 /* Generated */ {
 /* Generated */    double tempReal, tempReal2, theAverage, lastValue;
 /* Generated */    int i, j, outIdx, lookbackTotal;
-/* Generated */    CIRCBUF_PROLOG(circBuffer,double,30);
+/* Generated */    int today, nbOut, m, c, k, phase, first;
+/* Generated */    double laneSum[TA_MEANDEV_LANES], laneDev[TA_MEANDEV_LANES], laneValue[TA_MEANDEV_LANES];
+/* Generated */    ARRAY_REF(typPrice);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -381,42 +468,112 @@
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
-/* Generated */    CIRCBUF_INIT( circBuffer, double, optInTimePeriod );
-/* Generated */    i=startIdx-lookbackTotal;
-/* Generated */    if( optInTimePeriod > 1 )
+/* Generated */    ARRAY_ALLOC(typPrice,lookbackTotal+TA_MEANDEV_BLOCK);
+/* Generated */    if( !typPrice )
 /* Generated */    {
-/* Generated */       while( i < startIdx )
-/* Generated */       {
-/* Generated */          circBuffer[circBuffer_Idx] = (inHigh[i]+inLow[i]+inClose[i])/3;
-/* Generated */          i++;
-/* Generated */          CIRCBUF_NEXT(circBuffer);
-/* Generated */       }
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
 /* Generated */    }
 /* Generated */    outIdx = 0;
-/* Generated */    do
+/* Generated */    phase = 0;
+/* Generated */    today = startIdx;
+/* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       lastValue = (inHigh[i]+inLow[i]+inClose[i])/3;
-/* Generated */       circBuffer[circBuffer_Idx] = lastValue;
-/* Generated */       theAverage = 0;
-/* Generated */       for( j=0; j < optInTimePeriod; j++ )
-/* Generated */          theAverage += circBuffer[j];
-/* Generated */       theAverage /= optInTimePeriod;
-/* Generated */       tempReal2 = 0;
-/* Generated */       for( j=0; j < optInTimePeriod; j++ )
-/* Generated */          tempReal2 += std_fabs(circBuffer[j]-theAverage);
-/* Generated */       tempReal = lastValue-theAverage;
-/* Generated */       if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+/* Generated */       nbOut = endIdx-today+1;
+/* Generated */       if( nbOut > TA_MEANDEV_BLOCK )
+/* Generated */          nbOut = TA_MEANDEV_BLOCK;
+/* Generated */       j = 0;
+/* Generated */       for( i=today-lookbackTotal; i < today+nbOut; i++ )
+/* Generated */          typPrice[j++] = (inHigh[i]+inLow[i]+inClose[i])/3;
+/* Generated */       m = 0;
+/* Generated */       while( (optInTimePeriod >= TA_MEANDEV_LANES) && (m+TA_MEANDEV_LANES <= nbOut) )
 /* Generated */       {
-/* Generated */          outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+/* Generated */          first = optInTimePeriod-phase;
+/* Generated */          for( k=0; k < TA_MEANDEV_LANES; k++ )
+/* Generated */             laneSum[k] = 0.0;
+/* Generated */          c = first == optInTimePeriod ? 0 : first;
+/* Generated */          for( j=0; j < optInTimePeriod; j++ )
+/* Generated */          {
+/* Generated */             if( c < TA_MEANDEV_LANES-1 )
+/* Generated */             {
+/* Generated */                for( k=0; k < TA_MEANDEV_LANES; k++ )
+/* Generated */                   laneValue[k] = typPrice[m+c+(c < k ? optInTimePeriod : 0)];
+/* Generated */                TA_MEANDEV_ADD(laneSum,laneValue);
+/* Generated */             }
+/* Generated */             else
+/* Generated */             {
+/* Generated */                tempReal = typPrice[m+c];
+/* Generated */                TA_MEANDEV_ADD_ALL(laneSum,tempReal);
+/* Generated */             }
+/* Generated */             if( ++c == optInTimePeriod )
+/* Generated */                c = 0;
+/* Generated */          }
+/* Generated */          for( k=0; k < TA_MEANDEV_LANES; k++ )
+/* Generated */          {
+/* Generated */             laneSum[k] /= optInTimePeriod;
+/* Generated */             laneDev[k] = 0.0;
+/* Generated */          }
+/* Generated */          c = first == optInTimePeriod ? 0 : first;
+/* Generated */          for( j=0; j < optInTimePeriod; j++ )
+/* Generated */          {
+/* Generated */             if( c < TA_MEANDEV_LANES-1 )
+/* Generated */             {
+/* Generated */                for( k=0; k < TA_MEANDEV_LANES; k++ )
+/* Generated */                   laneValue[k] = typPrice[m+c+(c < k ? optInTimePeriod : 0)];
+/* Generated */                TA_MEANDEV_ADD_DEV(laneDev,laneValue,laneSum);
+/* Generated */             }
+/* Generated */             else
+/* Generated */             {
+/* Generated */                tempReal = typPrice[m+c];
+/* Generated */                TA_MEANDEV_ADD_DEV_ALL(laneDev,tempReal,laneSum);
+/* Generated */             }
+/* Generated */             if( ++c == optInTimePeriod )
+/* Generated */                c = 0;
+/* Generated */          }
+/* Generated */          for( k=0; k < TA_MEANDEV_LANES; k++ )
+/* Generated */          {
+/* Generated */             tempReal = typPrice[m+k+lookbackTotal]-laneSum[k];
+/* Generated */             if( (tempReal != 0.0) && (laneDev[k] != 0.0) )
+/* Generated */                outReal[outIdx++] = tempReal/(0.015*(laneDev[k]/optInTimePeriod));
+/* Generated */             else
+/* Generated */                outReal[outIdx++] = 0.0;
+/* Generated */          }
+/* Generated */          phase += TA_MEANDEV_LANES;
+/* Generated */          if( phase >= optInTimePeriod )
+/* Generated */             phase -= optInTimePeriod;
+/* Generated */          m += TA_MEANDEV_LANES;
 /* Generated */       }
-/* Generated */       else
-/* Generated */          outReal[outIdx++] = 0.0;
-/* Generated */       CIRCBUF_NEXT(circBuffer);
-/* Generated */       i++;
-/* Generated */    } while( i <= endIdx );
+/* Generated */       for( ; m < nbOut; m++ )
+/* Generated */       {
+/* Generated */          lastValue = typPrice[m+lookbackTotal];
+/* Generated */          first = optInTimePeriod-phase;
+/* Generated */          theAverage = 0;
+/* Generated */          for( c=first; c < optInTimePeriod; c++ )
+/* Generated */             theAverage += typPrice[m+c];
+/* Generated */          for( c=0; c < first; c++ )
+/* Generated */             theAverage += typPrice[m+c];
+/* Generated */          theAverage /= optInTimePeriod;
+/* Generated */          tempReal2 = 0;
+/* Generated */          for( c=first; c < optInTimePeriod; c++ )
+/* Generated */             tempReal2 += std_fabs(typPrice[m+c]-theAverage);
+/* Generated */          for( c=0; c < first; c++ )
+/* Generated */             tempReal2 += std_fabs(typPrice[m+c]-theAverage);
+/* Generated */          tempReal = lastValue-theAverage;
+/* Generated */          if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+/* Generated */          {
+/* Generated */             outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+/* Generated */          }
+/* Generated */          else
+/* Generated */             outReal[outIdx++] = 0.0;
+/* Generated */          if( ++phase == optInTimePeriod )
+/* Generated */             phase = 0;
+/* Generated */       }
+/* Generated */       today += nbOut;
+/* Generated */    }
+/* Generated */    ARRAY_FREE(typPrice);
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
-/* Generated */    CIRCBUF_DESTROY(circBuffer);
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
@@ -163,9 +163,10 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
 	/* insert local variable here */
-    double sumXY, sumX, sumY, sumX2, sumY2, x, y, trailingX, trailingY;
+    double meanX, meanY, sumDevX2, sumDevY2, sumDevXY, x, y, trailingX, trailingY;
+    double offsetX, offsetY;
     double tempReal;
-    int lookbackTotal, today, trailingIdx, outIdx;
+    int lookbackTotal, i, today, trailingIdx, outIdx;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -214,68 +215,67 @@
    }
 
    VALUE_HANDLE_DEREF(outBegIdx)  = startIdx;
-   trailingIdx = startIdx - lookbackTotal;
 
-   /* Calculate the initial values. */
-   sumXY = sumX = sumY = sumX2 = sumY2 = 0.0;
-   for( today=trailingIdx; today <= startIdx; today++ )
-   {
-      x = inReal0[today];
-      sumX  += x;
-      sumX2 += x*x;
-
-      y = inReal1[today];
-      sumXY += x*y;
-      sumY  += y;
-      sumY2 += y*y;
-   }
-
-   /* Write the first output. 
-    * Save first the trailing values since the input
-    * and output might be the same array,
+   /* The means, the sums of the squared deviations and the sum
+    * of the products of the deviations are rolled with the
+    * Welford update of TA_COMOMENTS_REPLACE (see ta_utility.h).
+    *
+    * Every TA_MOMENTS_RESUM_PERIOD outputs, these moments are
+    * rebuilt from the whole period with two passes. The values
+    * are taken relative to the last values at that time to keep
+    * the precision of the means (see TA_INT_VAR).
     */
-   trailingX = inReal0[trailingIdx];
-   trailingY = inReal1[trailingIdx++];
-   tempReal = (sumX2-((sumX*sumX)/optInTimePeriod)) * (sumY2-((sumY*sumY)/optInTimePeriod));
-   if( !TA_IS_ZERO_OR_NEG(tempReal) )
-      outReal[0] = (sumXY-((sumX*sumY)/optInTimePeriod)) / std_sqrt(tempReal);
-   else 
-      outReal[0] = 0.0;
-
-   /* Tight loop to do subsequent values. */
-   outIdx = 1;
-   while( today <= endIdx )
+   meanX = meanY = sumDevX2 = sumDevY2 = sumDevXY = 0.0;
+   trailingX = trailingY = offsetX = offsetY = 0.0;
+   today  = startIdx;
+   outIdx = 0;
+   do
    {
-      /* Remove trailing values */
-      sumX  -= trailingX;
-      sumX2 -= trailingX*trailingX;
-
-      sumXY -= trailingX*trailingY;
-      sumY  -= trailingY;
-      sumY2 -= trailingY*trailingY;
+      if( (outIdx % TA_MOMENTS_RESUM_PERIOD) == 0 )
+      {
+         trailingIdx = today-lookbackTotal;
+         offsetX = inReal0[today];
+         offsetY = inReal1[today];
+         meanX = meanY = 0.0;
+         for( i=trailingIdx; i <= today; i++ )
+         {
+            meanX += inReal0[i]-offsetX;
+            meanY += inReal1[i]-offsetY;
+         }
+         meanX /= optInTimePeriod;
+         meanY /= optInTimePeriod;
 
-      /* Add new values */
-      x = inReal0[today];
-      sumX  += x;
-      sumX2 += x*x;
-
-      y = inReal1[today++];
-      sumXY += x*y;
-      sumY  += y;
-      sumY2 += y*y;
+         sumDevX2 = sumDevY2 = sumDevXY = 0.0;
+         for( i=trailingIdx; i <= today; i++ )
+         {
+            x = (inReal0[i]-offsetX)-meanX;
+            y = (inReal1[i]-offsetY)-meanY;
+            sumDevX2 += x*x;
+            sumDevY2 += y*y;
+            sumDevXY += x*y;
+         }
+      }
+      else
+      {
+         x = inReal0[today]-offsetX;
+         y = inReal1[today]-offsetY;
+         TA_COMOMENTS_REPLACE( optInTimePeriod, meanX, meanY,
+                               sumDevX2, sumDevY2, sumDevXY,
+                               x, y, trailingX, trailingY );
+      }
 
       /* Output new coefficient.
        * Save first the trailing values since the input
        * and output might be the same array,
        */
-      trailingX = inReal0[trailingIdx];
-      trailingY = inReal1[trailingIdx++];
-      tempReal = (sumX2-((sumX*sumX)/optInTimePeriod)) * (sumY2-((sumY*sumY)/optInTimePeriod));
+      trailingX = inReal0[today-lookbackTotal]-offsetX;
+      trailingY = inReal1[today-lookbackTotal]-offsetY;
+      tempReal = sumDevX2 * sumDevY2;
       if( !TA_IS_ZERO_OR_NEG(tempReal) )
-         outReal[outIdx++] = (sumXY-((sumX*sumY)/optInTimePeriod)) / std_sqrt(tempReal);
+         outReal[outIdx++] = sumDevXY / std_sqrt(tempReal);
       else
          outReal[outIdx++] = 0.0;
-   }  
+   } while( ++today <= endIdx );
 
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 
@@ -330,9 +330,10 @@
 /* Generated */                         double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */     double sumXY, sumX, sumY, sumX2, sumY2, x, y, trailingX, trailingY;
+/* Generated */     double meanX, meanY, sumDevX2, sumDevY2, sumDevXY, x, y, trailingX, trailingY;
+/* Generated */     double offsetX, offsetY;
 /* Generated */     double tempReal;
-/* Generated */     int lookbackTotal, today, trailingIdx, outIdx;
+/* Generated */     int lookbackTotal, i, today, trailingIdx, outIdx;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -361,48 +362,51 @@
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)  = startIdx;
-/* Generated */    trailingIdx = startIdx - lookbackTotal;
-/* Generated */    sumXY = sumX = sumY = sumX2 = sumY2 = 0.0;
-/* Generated */    for( today=trailingIdx; today <= startIdx; today++ )
+/* Generated */    meanX = meanY = sumDevX2 = sumDevY2 = sumDevXY = 0.0;
+/* Generated */    trailingX = trailingY = offsetX = offsetY = 0.0;
+/* Generated */    today  = startIdx;
+/* Generated */    outIdx = 0;
+/* Generated */    do
 /* Generated */    {
-/* Generated */       x = inReal0[today];
-/* Generated */       sumX  += x;
-/* Generated */       sumX2 += x*x;
-/* Generated */       y = inReal1[today];
-/* Generated */       sumXY += x*y;
-/* Generated */       sumY  += y;
-/* Generated */       sumY2 += y*y;
-/* Generated */    }
-/* Generated */    trailingX = inReal0[trailingIdx];
-/* Generated */    trailingY = inReal1[trailingIdx++];
-/* Generated */    tempReal = (sumX2-((sumX*sumX)/optInTimePeriod)) * (sumY2-((sumY*sumY)/optInTimePeriod));
-/* Generated */    if( !TA_IS_ZERO_OR_NEG(tempReal) )
-/* Generated */       outReal[0] = (sumXY-((sumX*sumY)/optInTimePeriod)) / std_sqrt(tempReal);
-/* Generated */    else 
-/* Generated */       outReal[0] = 0.0;
-/* Generated */    outIdx = 1;
-/* Generated */    while( today <= endIdx )
-/* Generated */    {
-/* Generated */       sumX  -= trailingX;
-/* Generated */       sumX2 -= trailingX*trailingX;
-/* Generated */       sumXY -= trailingX*trailingY;
-/* Generated */       sumY  -= trailingY;
-/* Generated */       sumY2 -= trailingY*trailingY;
-/* Generated */       x = inReal0[today];
-/* Generated */       sumX  += x;
-/* Generated */       sumX2 += x*x;
-/* Generated */       y = inReal1[today++];
-/* Generated */       sumXY += x*y;
-/* Generated */       sumY  += y;
-/* Generated */       sumY2 += y*y;
-/* Generated */       trailingX = inReal0[trailingIdx];
-/* Generated */       trailingY = inReal1[trailingIdx++];
-/* Generated */       tempReal = (sumX2-((sumX*sumX)/optInTimePeriod)) * (sumY2-((sumY*sumY)/optInTimePeriod));
+/* Generated */       if( (outIdx % TA_MOMENTS_RESUM_PERIOD) == 0 )
+/* Generated */       {
+/* Generated */          trailingIdx = today-lookbackTotal;
+/* Generated */          offsetX = inReal0[today];
+/* Generated */          offsetY = inReal1[today];
+/* Generated */          meanX = meanY = 0.0;
+/* Generated */          for( i=trailingIdx; i <= today; i++ )
+/* Generated */          {
+/* Generated */             meanX += inReal0[i]-offsetX;
+/* Generated */             meanY += inReal1[i]-offsetY;
+/* Generated */          }
+/* Generated */          meanX /= optInTimePeriod;
+/* Generated */          meanY /= optInTimePeriod;
+/* Generated */          sumDevX2 = sumDevY2 = sumDevXY = 0.0;
+/* Generated */          for( i=trailingIdx; i <= today; i++ )
+/* Generated */          {
+/* Generated */             x = (inReal0[i]-offsetX)-meanX;
+/* Generated */             y = (inReal1[i]-offsetY)-meanY;
+/* Generated */             sumDevX2 += x*x;
+/* Generated */             sumDevY2 += y*y;
+/* Generated */             sumDevXY += x*y;
+/* Generated */          }
+/* Generated */       }
+/* Generated */       else
+/* Generated */       {
+/* Generated */          x = inReal0[today]-offsetX;
+/* Generated */          y = inReal1[today]-offsetY;
+/* Generated */          TA_COMOMENTS_REPLACE( optInTimePeriod, meanX, meanY,
+/* Generated */                                sumDevX2, sumDevY2, sumDevXY,
+/* Generated */                                x, y, trailingX, trailingY );
+/* Generated */       }
+/* Generated */       trailingX = inReal0[today-lookbackTotal]-offsetX;
+/* Generated */       trailingY = inReal1[today-lookbackTotal]-offsetY;
+/* Generated */       tempReal = sumDevX2 * sumDevY2;
 /* Generated */       if( !TA_IS_ZERO_OR_NEG(tempReal) )
-/* Generated */          outReal[outIdx++] = (sumXY-((sumX*sumY)/optInTimePeriod)) / std_sqrt(tempReal);
+/* Generated */          outReal[outIdx++] = sumDevXY / std_sqrt(tempReal);
 /* Generated */       else
 /* Generated */          outReal[outIdx++] = 0.0;
-/* Generated */    }  
+/* Generated */    } while( ++today <= endIdx );
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
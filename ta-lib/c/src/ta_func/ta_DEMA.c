@@ -162,15 +162,9 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* Insert local variables here. */
-   ARRAY_REF(firstEMA);
-   ARRAY_REF(secondEMA);
-   double k;
-   VALUE_HANDLE_INT(firstEMABegIdx);
-   VALUE_HANDLE_INT(firstEMANbElement);
-   VALUE_HANDLE_INT(secondEMABegIdx);
-   VALUE_HANDLE_INT(secondEMANbElement);
-   int tempInt, outIdx, firstEMAIdx, lookbackTotal, lookbackEMA;
-   ENUM_DECLARATION(RetCode) retCode;
+   double k, firstEMA, secondEMA;
+   int today, outIdx, firstEMABegIdx, lookbackTotal, lookbackEMA;
+   int firstEMACount, secondEMACount;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -241,100 +235,48 @@
    if( startIdx > endIdx )
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success); 
 
-   /* Allocate a temporary buffer for the firstEMA.
-    *
-    * When possible, re-use the outputBuffer for temp
-    * calculation.
+   /* Both EMAs are evaluated in a single pass, the second one is
+    * fed each value of the first one as soon as it is computed.
+    * The values are the same as running TA_INT_EMA on the input
+    * from 'firstEMABegIdx', then on the buffer of its output (see
+    * TA_EMA_CASCADE_FEED).
     */
-   #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-      tempInt = lookbackTotal+(endIdx-startIdx)+1;
-      ARRAY_ALLOC(firstEMA, tempInt );
-      #if !defined( _JAVA )
-         if( !firstEMA )
-            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-      #endif
-   #else
-      if( inReal == outReal )
-         firstEMA = outReal;
-      else
-      {
-         tempInt = lookbackTotal+(endIdx-startIdx)+1;
-         ARRAY_ALLOC(firstEMA, tempInt );
-         #if !defined( _JAVA )
-            if( !firstEMA )
-               return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-         #endif
-      }
-   #endif
-
-   /* Calculate the first EMA */   
    k = PER_TO_K(optInTimePeriod);
-   retCode = FUNCTION_CALL(INT_EMA)( startIdx-lookbackEMA, endIdx, inReal,
-                                     optInTimePeriod, k,
-                                     VALUE_HANDLE_OUT(firstEMABegIdx), VALUE_HANDLE_OUT(firstEMANbElement),
-								     firstEMA );
-   
-   /* Verify for failure or if not enough data after
-    * calculating the first EMA.
-    */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success)) || (VALUE_HANDLE_GET(firstEMANbElement) == 0) )
-   {
-      ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-      return retCode;
-   }
-
-   /* Allocate a temporary buffer for storing the EMA of the EMA. */
-   ARRAY_ALLOC(secondEMA, VALUE_HANDLE_GET(firstEMANbElement));
+   firstEMABegIdx = startIdx-lookbackEMA;
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+      today = firstEMABegIdx-lookbackEMA;
+   else
+      today = 0;
+   firstEMA  = 0.0;
+   secondEMA = 0.0;
+   firstEMACount  = 0;
+   secondEMACount = 0;
 
-   #if !defined( _JAVA )
-      if( !secondEMA )
-      {
-         ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-      }
-   #endif
-
-   retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(firstEMANbElement)-1, firstEMA,
-                                            optInTimePeriod, k,
-                                            VALUE_HANDLE_OUT(secondEMABegIdx), VALUE_HANDLE_OUT(secondEMANbElement),
-						                    secondEMA );
-
-   /* Return empty output on failure or if not enough data after
-    * calculating the second EMA.
-    */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success)) || (VALUE_HANDLE_GET(secondEMANbElement) == 0) )      
+   /* Seed both EMAs, up to the first output. */
+   while( today <= startIdx )
    {
-      #if defined(USE_SINGLE_PRECISION_INPUT)
-         ARRAY_FREE( firstEMA );
-      #else
-         ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-      #endif
-      ARRAY_FREE( secondEMA );
-      return retCode;
+      TA_EMA_CASCADE_FEED(firstEMA,firstEMACount,inReal[today],optInTimePeriod,k);
+      if( today >= firstEMABegIdx )
+         TA_EMA_CASCADE_FEED(secondEMA,secondEMACount,firstEMA,optInTimePeriod,k);
+      today++;
    }
+   outReal[0] = (2.0*firstEMA) - secondEMA;
+   outIdx = 1;
 
-   /* Iterate through the second EMA and write the DEMA into
-    * the output.
+   /* Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
     */
-   firstEMAIdx = VALUE_HANDLE_GET(secondEMABegIdx);
-   outIdx = 0;
-   while( outIdx < VALUE_HANDLE_GET(secondEMANbElement) ) 
+   while( today <= endIdx )
    {
-      outReal[outIdx] = (2.0*firstEMA[firstEMAIdx++]) - secondEMA[outIdx];
-      outIdx++;
+      firstEMA  = ((inReal[today++]-firstEMA)*k) + firstEMA;
+      secondEMA = ((firstEMA-secondEMA)*k) + secondEMA;
+      outReal[outIdx++] = (2.0*firstEMA) - secondEMA;
    }
 
-   #if defined(USE_SINGLE_PRECISION_INPUT)
-      ARRAY_FREE( firstEMA );
-   #else
-      ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-   #endif
-   ARRAY_FREE( secondEMA );
-
    /* Succeed. Indicate where the output starts relative to
     * the caller input.
     */
-   VALUE_HANDLE_DEREF(outBegIdx)    = VALUE_HANDLE_GET(firstEMABegIdx) + VALUE_HANDLE_GET(secondEMABegIdx);
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -385,15 +327,9 @@
 /* Generated */                       double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    ARRAY_REF(firstEMA);
-/* Generated */    ARRAY_REF(secondEMA);
-/* Generated */    double k;
-/* Generated */    VALUE_HANDLE_INT(firstEMABegIdx);
-/* Generated */    VALUE_HANDLE_INT(firstEMANbElement);
-/* Generated */    VALUE_HANDLE_INT(secondEMABegIdx);
-/* Generated */    VALUE_HANDLE_INT(secondEMANbElement);
-/* Generated */    int tempInt, outIdx, firstEMAIdx, lookbackTotal, lookbackEMA;
-/* Generated */    ENUM_DECLARATION(RetCode) retCode;
+/* Generated */    double k, firstEMA, secondEMA;
+/* Generated */    int today, outIdx, firstEMABegIdx, lookbackTotal, lookbackEMA;
+/* Generated */    int firstEMACount, secondEMACount;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -419,72 +355,32 @@
 /* Generated */       startIdx = lookbackTotal;
 /* Generated */    if( startIdx > endIdx )
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success); 
-/* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-/* Generated */       tempInt = lookbackTotal+(endIdx-startIdx)+1;
-/* Generated */       ARRAY_ALLOC(firstEMA, tempInt );
-/* Generated */       #if !defined( _JAVA )
-/* Generated */          if( !firstEMA )
-/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-/* Generated */       #endif
-/* Generated */    #else
-/* Generated */       if( inReal == outReal )
-/* Generated */          firstEMA = outReal;
-/* Generated */       else
-/* Generated */       {
-/* Generated */          tempInt = lookbackTotal+(endIdx-startIdx)+1;
-/* Generated */          ARRAY_ALLOC(firstEMA, tempInt );
-/* Generated */          #if !defined( _JAVA )
-/* Generated */             if( !firstEMA )
-/* Generated */                return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-/* Generated */          #endif
-/* Generated */       }
-/* Generated */    #endif
 /* Generated */    k = PER_TO_K(optInTimePeriod);
-/* Generated */    retCode = FUNCTION_CALL(INT_EMA)( startIdx-lookbackEMA, endIdx, inReal,
-/* Generated */                                      optInTimePeriod, k,
-/* Generated */                                      VALUE_HANDLE_OUT(firstEMABegIdx), VALUE_HANDLE_OUT(firstEMANbElement),
-/* Generated */ 								     firstEMA );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success)) || (VALUE_HANDLE_GET(firstEMANbElement) == 0) )
-/* Generated */    {
-/* Generated */       ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    ARRAY_ALLOC(secondEMA, VALUE_HANDLE_GET(firstEMANbElement));
-/* Generated */    #if !defined( _JAVA )
-/* Generated */       if( !secondEMA )
-/* Generated */       {
-/* Generated */          ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-/* Generated */       }
-/* Generated */    #endif
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(firstEMANbElement)-1, firstEMA,
-/* Generated */                                             optInTimePeriod, k,
-/* Generated */                                             VALUE_HANDLE_OUT(secondEMABegIdx), VALUE_HANDLE_OUT(secondEMANbElement),
-/* Generated */ 						                    secondEMA );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success)) || (VALUE_HANDLE_GET(secondEMANbElement) == 0) )      
+/* Generated */    firstEMABegIdx = startIdx-lookbackEMA;
+/* Generated */    if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+/* Generated */       today = firstEMABegIdx-lookbackEMA;
+/* Generated */    else
+/* Generated */       today = 0;
+/* Generated */    firstEMA  = 0.0;
+/* Generated */    secondEMA = 0.0;
+/* Generated */    firstEMACount  = 0;
+/* Generated */    secondEMACount = 0;
+/* Generated */    while( today <= startIdx )
 /* Generated */    {
-/* Generated */       #if defined(USE_SINGLE_PRECISION_INPUT)
-/* Generated */          ARRAY_FREE( firstEMA );
-/* Generated */       #else
-/* Generated */          ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-/* Generated */       #endif
-/* Generated */       ARRAY_FREE( secondEMA );
-/* Generated */       return retCode;
+/* Generated */       TA_EMA_CASCADE_FEED(firstEMA,firstEMACount,inReal[today],optInTimePeriod,k);
+/* Generated */       if( today >= firstEMABegIdx )
+/* Generated */          TA_EMA_CASCADE_FEED(secondEMA,secondEMACount,firstEMA,optInTimePeriod,k);
+/* Generated */       today++;
 /* Generated */    }
-/* Generated */    firstEMAIdx = VALUE_HANDLE_GET(secondEMABegIdx);
-/* Generated */    outIdx = 0;
-/* Generated */    while( outIdx < VALUE_HANDLE_GET(secondEMANbElement) ) 
+/* Generated */    outReal[0] = (2.0*firstEMA) - secondEMA;
+/* Generated */    outIdx = 1;
+/* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       outReal[outIdx] = (2.0*firstEMA[firstEMAIdx++]) - secondEMA[outIdx];
-/* Generated */       outIdx++;
+/* Generated */       firstEMA  = ((inReal[today++]-firstEMA)*k) + firstEMA;
+/* Generated */       secondEMA = ((firstEMA-secondEMA)*k) + secondEMA;
+/* Generated */       outReal[outIdx++] = (2.0*firstEMA) - secondEMA;
 /* Generated */    }
-/* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT)
-/* Generated */       ARRAY_FREE( firstEMA );
-/* Generated */    #else
-/* Generated */       ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
-/* Generated */    #endif
-/* Generated */    ARRAY_FREE( secondEMA );
-/* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = VALUE_HANDLE_GET(firstEMABegIdx) + VALUE_HANDLE_GET(secondEMABegIdx);
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
@@ -524,6 +524,413 @@
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
 
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+  // No INT function
+#else
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+enum class Core::RetCode Core::TA_INT_HT( int    startIdx,
+                                          int    endIdx,
+                                          SubArray<double>^ inReal,
+                                          int    optInUnstablePeriod,
+                                          [Out]int% outBegIdx,
+                                          [Out]int% outNBElement,
+                                          SubArray<double>^ outDCPeriod,
+                                          SubArray<double>^ outInPhase,
+                                          SubArray<double>^ outQuadrature,
+                                          SubArray<double>^ outDCPhase,
+                                          SubArray<double>^ outSine,
+                                          SubArray<double>^ outLeadSine,
+                                          SubArray<double>^ outTrendline,
+                                          SubArray<int>^    outTrendMode )
+#elif defined( _MANAGED )
+enum class Core::RetCode Core::TA_INT_HT( int    startIdx,
+                                          int    endIdx,
+                                          cli::array<INPUT_TYPE>^ inReal,
+                                          int    optInUnstablePeriod,
+                                          [Out]int% outBegIdx,
+                                          [Out]int% outNBElement,
+                                          cli::array<double>^ outDCPeriod,
+                                          cli::array<double>^ outInPhase,
+                                          cli::array<double>^ outQuadrature,
+                                          cli::array<double>^ outDCPhase,
+                                          cli::array<double>^ outSine,
+                                          cli::array<double>^ outLeadSine,
+                                          cli::array<double>^ outTrendline,
+                                          cli::array<int>^    outTrendMode )
+#elif defined( _JAVA )
+public RetCode TA_INT_HT( int        startIdx,
+                          int        endIdx,
+                          INPUT_TYPE inReal[],
+                          int        optInUnstablePeriod,
+                          MInteger   outBegIdx,
+                          MInteger   outNBElement,
+                          double     outDCPeriod[],
+                          double     outInPhase[],
+                          double     outQuadrature[],
+                          double     outDCPhase[],
+                          double     outSine[],
+                          double     outLeadSine[],
+                          double     outTrendline[],
+                          int        outTrendMode[] )
+#else
+TA_RetCode TA_PREFIX(INT_HT)( int    startIdx,
+                              int    endIdx,
+                              const INPUT_TYPE *inReal,
+                              int    optInUnstablePeriod,
+                              int   *outBegIdx,
+                              int   *outNBElement,
+                              double *outDCPeriod,
+                              double *outInPhase,
+                              double *outQuadrature,
+                              double *outDCPhase,
+                              double *outSine,
+                              double *outLeadSine,
+                              double *outTrendline,
+                              int    *outTrendMode )
+#endif
+{
+   int outIdx, i;
+   int lookbackTotal, today;
+   double tempReal, tempReal2;
+
+   double adjustedPrevPeriod, period;
+
+   /* Variable used for the price smoother (a weighted moving average). */
+   int trailingWMAIdx;
+   double periodWMASum, periodWMASub, trailingWMAValue;
+   double smoothedValue;
+
+   /* Variable to keep track of the last 3 ITrend */
+   double iTrend1, iTrend2, iTrend3;
+
+   /* Variables used for the Hilbert Transormation */
+   CONSTANT_DOUBLE(a) = 0.0962;
+   CONSTANT_DOUBLE(b) = 0.5769;
+   double hilbertTempReal;
+   int hilbertIdx;
+
+   HILBERT_VARIABLES( detrender );
+   HILBERT_VARIABLES( Q1 );
+   HILBERT_VARIABLES( jI );
+   HILBERT_VARIABLES( jQ );
+
+   double Q2, I2, prevQ2, prevI2, Re, Im;
+
+   double I1ForOddPrev2,  I1ForOddPrev3;
+   double I1ForEvenPrev2, I1ForEvenPrev3;
+
+   double rad2Deg, deg2Rad, constDeg2RadBy360;
+
+   double todayValue, smoothPeriod;
+
+   /* Circular buffer of the last smoothed prices,
+    * SMOOTH_PRICE_SIZE is defined in TA_HT_TRENDMODE.
+    */
+   CIRCBUF_PROLOG(smoothPrice,double,SMOOTH_PRICE_SIZE);
+   int idx;
+
+   /* Variable used to calculate the dominant cycle phase */
+   int DCPeriodInt;
+   double DCPhase, DCPeriod, imagPart, realPart;
+
+   /* Variable used to calculate the trend mode */
+   int daysInTrend, trend = 0;
+   double prevDCPhase, trendline;
+   double prevSine, prevLeadSine, sine, leadSine;
+
+   /* Which part of the pipeline must be evaluated. */
+   int withPhase, doPhase, doSine, doTrendline;
+
+   withPhase   = (outDCPhase != NULL) || (outSine != NULL) || (outLeadSine != NULL) ||
+                 (outTrendline != NULL) || (outTrendMode != NULL);
+   doPhase     = (outDCPhase != NULL) || (outSine != NULL) || (outLeadSine != NULL) || (outTrendMode != NULL);
+   doSine      = (outSine != NULL) || (outLeadSine != NULL) || (outTrendMode != NULL);
+   doTrendline = (outTrendline != NULL) || (outTrendMode != NULL);
+
+   /* The outputs of the two pipelines do not start from the
+    * same price bar, so they cannot be requested together.
+    */
+   if( withPhase && ((outDCPeriod != NULL) || (outInPhase != NULL) || (outQuadrature != NULL)) )
+      return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+
+   if( optInUnstablePeriod < 0 )
+      return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+
+   CIRCBUF_INIT_LOCAL_ONLY(smoothPrice,double);
+
+   iTrend1 = iTrend2 = iTrend3 = 0.0;
+   daysInTrend  = 0;
+   prevDCPhase  = DCPhase  = 0.0;
+   prevSine     = sine     = 0.0;
+   prevLeadSine = leadSine = 0.0;
+   trendline    = 0.0;
+
+   /* The constants are evaluated exactly as the individual functions do. */
+   if( withPhase )
+   {
+      tempReal = std_atan(1);
+      rad2Deg = 45.0/tempReal;
+      deg2Rad = 1.0/rad2Deg;
+      constDeg2RadBy360 = tempReal*8.0;
+      lookbackTotal = 63 + optInUnstablePeriod;
+   }
+   else
+   {
+      rad2Deg = 180.0 / (4.0 * std_atan(1));
+      deg2Rad = constDeg2RadBy360 = 0.0;
+      lookbackTotal = 32 + optInUnstablePeriod;
+   }
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Initialize the price smoother, see TA_HT_TRENDMODE. */
+   trailingWMAIdx = startIdx - lookbackTotal;
+   today = trailingWMAIdx;
+
+   tempReal = inReal[today++];
+   periodWMASub = tempReal;
+   periodWMASum = tempReal;
+   tempReal = inReal[today++];
+   periodWMASub += tempReal;
+   periodWMASum += tempReal*2.0;
+   tempReal = inReal[today++];
+   periodWMASub += tempReal;
+   periodWMASum += tempReal*3.0;
+
+   trailingWMAValue = 0.0;
+
+   /* DO_PRICE_WMA is defined in TA_HT_TRENDMODE. */
+   i = withPhase? 34 : 9;
+   do
+   {
+      tempReal = inReal[today++];
+      DO_PRICE_WMA(tempReal,smoothedValue);
+   } while( --i != 0);
+
+   hilbertIdx = 0;
+
+   INIT_HILBERT_VARIABLES(detrender);
+   INIT_HILBERT_VARIABLES(Q1);
+   INIT_HILBERT_VARIABLES(jI);
+   INIT_HILBERT_VARIABLES(jQ);
+
+   period = 0.0;
+   outIdx = 0;
+
+   prevI2 = prevQ2 = 0.0;
+   Re     = Im     = 0.0;
+   I1ForOddPrev3 = I1ForEvenPrev3 = 0.0;
+   I1ForOddPrev2 = I1ForEvenPrev2 = 0.0;
+   smoothPeriod  = 0.0;
+
+   for( i=0; i < SMOOTH_PRICE_SIZE; i++ )
+      smoothPrice[i] = 0.0;
+
+   while( today <= endIdx )
+   {
+      adjustedPrevPeriod = (0.075*period)+0.54;
+
+      todayValue = inReal[today];
+      DO_PRICE_WMA(todayValue,smoothedValue);
+
+      smoothPrice[smoothPrice_Idx] = smoothedValue;
+
+      if( (today%2) == 0 )
+      {
+         /* Do the Hilbert Transforms for even price bar */
+         DO_HILBERT_EVEN(detrender,smoothedValue);
+         DO_HILBERT_EVEN(Q1,detrender);
+         if( today >= startIdx )
+         {
+            if( outQuadrature ) outQuadrature[outIdx] = Q1;
+            if( outInPhase ) outInPhase[outIdx] = I1ForEvenPrev3;
+         }
+         DO_HILBERT_EVEN(jI,I1ForEvenPrev3);
+         DO_HILBERT_EVEN(jQ,Q1);
+         if( ++hilbertIdx == 3 )
+            hilbertIdx = 0;
+
+         Q2 = (0.2*(Q1 + jI)) + (0.8*prevQ2);
+         I2 = (0.2*(I1ForEvenPrev3 - jQ)) + (0.8*prevI2);
+
+         I1ForOddPrev3 = I1ForOddPrev2;
+         I1ForOddPrev2 = detrender;
+      }
+      else
+      {
+         /* Do the Hilbert Transforms for odd price bar */
+         DO_HILBERT_ODD(detrender,smoothedValue);
+         DO_HILBERT_ODD(Q1,detrender);
+         if( today >= startIdx )
+         {
+            if( outQuadrature ) outQuadrature[outIdx] = Q1;
+            if( outInPhase ) outInPhase[outIdx] = I1ForOddPrev3;
+         }
+         DO_HILBERT_ODD(jI,I1ForOddPrev3);
+         DO_HILBERT_ODD(jQ,Q1);
+
+         Q2 = (0.2*(Q1 + jI)) + (0.8*prevQ2);
+         I2 = (0.2*(I1ForOddPrev3 - jQ)) + (0.8*prevI2);
+
+         I1ForEvenPrev3 = I1ForEvenPrev2;
+         I1ForEvenPrev2 = detrender;
+      }
+
+      /* Adjust the period for next price bar */
+      Re = (0.2*((I2*prevI2)+(Q2*prevQ2)))+(0.8*Re);
+      Im = (0.2*((I2*prevQ2)-(Q2*prevI2)))+(0.8*Im);
+      prevQ2 = Q2;
+      prevI2 = I2;
+      tempReal = period;
+      if( (Im != 0.0) && (Re != 0.0) )
+         period = 360.0 / (std_atan(Im/Re)*rad2Deg);
+      tempReal2 = 1.5*tempReal;
+      if( period > tempReal2)
+         period = tempReal2;
+      tempReal2 = 0.67*tempReal;
+      if( period < tempReal2 )
+         period = tempReal2;
+      if( period < 6 )
+         period = 6;
+      else if( period > 50 )
+         period = 50;
+      period = (0.2*period) + (0.8 * tempReal);
+
+      smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
+
+      DCPeriod    = smoothPeriod+0.5;
+      DCPeriodInt = (int)DCPeriod;
+
+      if( doPhase )
+      {
+         /* Compute Dominant Cycle Phase */
+         prevDCPhase = DCPhase;
+         realPart = 0.0;
+         imagPart = 0.0;
+
+         idx = smoothPrice_Idx;
+         for( i=0; i < DCPeriodInt; i++ )
+         {
+            tempReal  = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
+            tempReal2 = smoothPrice[idx];
+            realPart += std_sin(tempReal)*tempReal2;
+            imagPart += std_cos(tempReal)*tempReal2;
+            if( idx == 0 )
+               idx = SMOOTH_PRICE_SIZE-1;
+            else
+               idx--;
+         }
+
+         tempReal = std_fabs(imagPart);
+         if( tempReal > 0.0 )
+            DCPhase = std_atan(realPart/imagPart)*rad2Deg;
+         else if( tempReal <= 0.01 )
+         {
+            if( realPart < 0.0 )
+               DCPhase -= 90.0;
+            else if( realPart > 0.0 )
+               DCPhase += 90.0;
+         }
+         DCPhase += 90.0;
+
+         /* Compensate for one bar lag of the weighted moving average */
+         DCPhase += 360.0 / smoothPeriod;
+         if( imagPart < 0.0 )
+            DCPhase += 180.0;
+         if( DCPhase > 315.0 )
+            DCPhase -= 360.0;
+      }
+
+      if( doSine )
+      {
+         prevSine     = sine;
+         prevLeadSine = leadSine;
+         sine     = std_sin(DCPhase*deg2Rad);
+         leadSine = std_sin((DCPhase+45)*deg2Rad);
+      }
+
+      if( doTrendline )
+      {
+         /* Compute Trendline */
+         idx = today;
+         tempReal = 0.0;
+         for( i=0; i < DCPeriodInt; i++ )
+            tempReal += inReal[idx--];
+
+         if( DCPeriodInt > 0 )
+            tempReal = tempReal/(double)DCPeriodInt;
+
+         trendline = (4.0*tempReal + 3.0*iTrend1 + 2.0*iTrend2 + iTrend3) / 10.0;
+         iTrend3   = iTrend2;
+         iTrend2   = iTrend1;
+         iTrend1   = tempReal;
+      }
+
+      if( outTrendMode )
+      {
+         /* Compute the trend Mode, see TA_HT_TRENDMODE. */
+         trend = 1;
+         if( ((sine > leadSine) && (prevSine <= prevLeadSine)) ||
+             ((sine < leadSine) && (prevSine >= prevLeadSine)) )
+         {
+            daysInTrend = 0;
+            trend = 0;
+         }
+
+         daysInTrend++;
+
+         if( daysInTrend < (0.5*smoothPeriod) )
+            trend = 0;
+
+         tempReal = DCPhase - prevDCPhase;
+         if( (smoothPeriod != 0.0) &&
+             ((tempReal > (0.67*360.0/smoothPeriod)) && (tempReal < (1.5*360.0/smoothPeriod))) )
+         {
+            trend = 0;
+         }
+
+         tempReal = smoothPrice[smoothPrice_Idx];
+         if( (trendline != 0.0) && (std_fabs( (tempReal - trendline)/trendline ) >= 0.015) )
+            trend = 1;
+      }
+
+      if( today >= startIdx )
+      {
+         if( outDCPeriod ) outDCPeriod[outIdx] = smoothPeriod;
+         if( outDCPhase ) outDCPhase[outIdx] = DCPhase;
+         if( outSine ) outSine[outIdx] = sine;
+         if( outLeadSine ) outLeadSine[outIdx] = leadSine;
+         if( outTrendline ) outTrendline[outIdx] = trendline;
+         if( outTrendMode ) outTrendMode[outIdx] = trend;
+         outIdx++;
+      }
+
+      /* Ooof... let's do the next price bar now! */
+      CIRCBUF_NEXT(smoothPrice);
+      today++;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#endif
+
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
 /* Generated */ #define  USE_SINGLE_PRECISION_INPUT
@@ -794,6 +1201,325 @@
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */   // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::TA_INT_HT( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                           SubArray<double>^ inReal,
+/* Generated */                                           int    optInUnstablePeriod,
+/* Generated */                                           [Out]int% outBegIdx,
+/* Generated */                                           [Out]int% outNBElement,
+/* Generated */                                           SubArray<double>^ outDCPeriod,
+/* Generated */                                           SubArray<double>^ outInPhase,
+/* Generated */                                           SubArray<double>^ outQuadrature,
+/* Generated */                                           SubArray<double>^ outDCPhase,
+/* Generated */                                           SubArray<double>^ outSine,
+/* Generated */                                           SubArray<double>^ outLeadSine,
+/* Generated */                                           SubArray<double>^ outTrendline,
+/* Generated */                                           SubArray<int>^    outTrendMode )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::TA_INT_HT( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                           cli::array<INPUT_TYPE>^ inReal,
+/* Generated */                                           int    optInUnstablePeriod,
+/* Generated */                                           [Out]int% outBegIdx,
+/* Generated */                                           [Out]int% outNBElement,
+/* Generated */                                           cli::array<double>^ outDCPeriod,
+/* Generated */                                           cli::array<double>^ outInPhase,
+/* Generated */                                           cli::array<double>^ outQuadrature,
+/* Generated */                                           cli::array<double>^ outDCPhase,
+/* Generated */                                           cli::array<double>^ outSine,
+/* Generated */                                           cli::array<double>^ outLeadSine,
+/* Generated */                                           cli::array<double>^ outTrendline,
+/* Generated */                                           cli::array<int>^    outTrendMode )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode TA_INT_HT( int        startIdx,
+/* Generated */                           int        endIdx,
+/* Generated */                           INPUT_TYPE inReal[],
+/* Generated */                           int        optInUnstablePeriod,
+/* Generated */                           MInteger   outBegIdx,
+/* Generated */                           MInteger   outNBElement,
+/* Generated */                           double     outDCPeriod[],
+/* Generated */                           double     outInPhase[],
+/* Generated */                           double     outQuadrature[],
+/* Generated */                           double     outDCPhase[],
+/* Generated */                           double     outSine[],
+/* Generated */                           double     outLeadSine[],
+/* Generated */                           double     outTrendline[],
+/* Generated */                           int        outTrendMode[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_HT)( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                               const INPUT_TYPE *inReal,
+/* Generated */                               int    optInUnstablePeriod,
+/* Generated */                               int   *outBegIdx,
+/* Generated */                               int   *outNBElement,
+/* Generated */                               double *outDCPeriod,
+/* Generated */                               double *outInPhase,
+/* Generated */                               double *outQuadrature,
+/* Generated */                               double *outDCPhase,
+/* Generated */                               double *outSine,
+/* Generated */                               double *outLeadSine,
+/* Generated */                               double *outTrendline,
+/* Generated */                               int    *outTrendMode )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    int outIdx, i;
+/* Generated */    int lookbackTotal, today;
+/* Generated */    double tempReal, tempReal2;
+/* Generated */    double adjustedPrevPeriod, period;
+/* Generated */    int trailingWMAIdx;
+/* Generated */    double periodWMASum, periodWMASub, trailingWMAValue;
+/* Generated */    double smoothedValue;
+/* Generated */    double iTrend1, iTrend2, iTrend3;
+/* Generated */    CONSTANT_DOUBLE(a) = 0.0962;
+/* Generated */    CONSTANT_DOUBLE(b) = 0.5769;
+/* Generated */    double hilbertTempReal;
+/* Generated */    int hilbertIdx;
+/* Generated */    HILBERT_VARIABLES( detrender );
+/* Generated */    HILBERT_VARIABLES( Q1 );
+/* Generated */    HILBERT_VARIABLES( jI );
+/* Generated */    HILBERT_VARIABLES( jQ );
+/* Generated */    double Q2, I2, prevQ2, prevI2, Re, Im;
+/* Generated */    double I1ForOddPrev2,  I1ForOddPrev3;
+/* Generated */    double I1ForEvenPrev2, I1ForEvenPrev3;
+/* Generated */    double rad2Deg, deg2Rad, constDeg2RadBy360;
+/* Generated */    double todayValue, smoothPeriod;
+/* Generated */    CIRCBUF_PROLOG(smoothPrice,double,SMOOTH_PRICE_SIZE);
+/* Generated */    int idx;
+/* Generated */    int DCPeriodInt;
+/* Generated */    double DCPhase, DCPeriod, imagPart, realPart;
+/* Generated */    int daysInTrend, trend = 0;
+/* Generated */    double prevDCPhase, trendline;
+/* Generated */    double prevSine, prevLeadSine, sine, leadSine;
+/* Generated */    int withPhase, doPhase, doSine, doTrendline;
+/* Generated */    withPhase   = (outDCPhase != NULL) || (outSine != NULL) || (outLeadSine != NULL) ||
+/* Generated */                  (outTrendline != NULL) || (outTrendMode != NULL);
+/* Generated */    doPhase     = (outDCPhase != NULL) || (outSine != NULL) || (outLeadSine != NULL) || (outTrendMode != NULL);
+/* Generated */    doSine      = (outSine != NULL) || (outLeadSine != NULL) || (outTrendMode != NULL);
+/* Generated */    doTrendline = (outTrendline != NULL) || (outTrendMode != NULL);
+/* Generated */    if( withPhase && ((outDCPeriod != NULL) || (outInPhase != NULL) || (outQuadrature != NULL)) )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    if( optInUnstablePeriod < 0 )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    CIRCBUF_INIT_LOCAL_ONLY(smoothPrice,double);
+/* Generated */    iTrend1 = iTrend2 = iTrend3 = 0.0;
+/* Generated */    daysInTrend  = 0;
+/* Generated */    prevDCPhase  = DCPhase  = 0.0;
+/* Generated */    prevSine     = sine     = 0.0;
+/* Generated */    prevLeadSine = leadSine = 0.0;
+/* Generated */    trendline    = 0.0;
+/* Generated */    if( withPhase )
+/* Generated */    {
+/* Generated */       tempReal = std_atan(1);
+/* Generated */       rad2Deg = 45.0/tempReal;
+/* Generated */       deg2Rad = 1.0/rad2Deg;
+/* Generated */       constDeg2RadBy360 = tempReal*8.0;
+/* Generated */       lookbackTotal = 63 + optInUnstablePeriod;
+/* Generated */    }
+/* Generated */    else
+/* Generated */    {
+/* Generated */       rad2Deg = 180.0 / (4.0 * std_atan(1));
+/* Generated */       deg2Rad = constDeg2RadBy360 = 0.0;
+/* Generated */       lookbackTotal = 32 + optInUnstablePeriod;
+/* Generated */    }
+/* Generated */    if( startIdx < lookbackTotal )
+/* Generated */       startIdx = lookbackTotal;
+/* Generated */    if( startIdx > endIdx )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */    trailingWMAIdx = startIdx - lookbackTotal;
+/* Generated */    today = trailingWMAIdx;
+/* Generated */    tempReal = inReal[today++];
+/* Generated */    periodWMASub = tempReal;
+/* Generated */    periodWMASum = tempReal;
+/* Generated */    tempReal = inReal[today++];
+/* Generated */    periodWMASub += tempReal;
+/* Generated */    periodWMASum += tempReal*2.0;
+/* Generated */    tempReal = inReal[today++];
+/* Generated */    periodWMASub += tempReal;
+/* Generated */    periodWMASum += tempReal*3.0;
+/* Generated */    trailingWMAValue = 0.0;
+/* Generated */    i = withPhase? 34 : 9;
+/* Generated */    do
+/* Generated */    {
+/* Generated */       tempReal = inReal[today++];
+/* Generated */       DO_PRICE_WMA(tempReal,smoothedValue);
+/* Generated */    } while( --i != 0);
+/* Generated */    hilbertIdx = 0;
+/* Generated */    INIT_HILBERT_VARIABLES(detrender);
+/* Generated */    INIT_HILBERT_VARIABLES(Q1);
+/* Generated */    INIT_HILBERT_VARIABLES(jI);
+/* Generated */    INIT_HILBERT_VARIABLES(jQ);
+/* Generated */    period = 0.0;
+/* Generated */    outIdx = 0;
+/* Generated */    prevI2 = prevQ2 = 0.0;
+/* Generated */    Re     = Im     = 0.0;
+/* Generated */    I1ForOddPrev3 = I1ForEvenPrev3 = 0.0;
+/* Generated */    I1ForOddPrev2 = I1ForEvenPrev2 = 0.0;
+/* Generated */    smoothPeriod  = 0.0;
+/* Generated */    for( i=0; i < SMOOTH_PRICE_SIZE; i++ )
+/* Generated */       smoothPrice[i] = 0.0;
+/* Generated */    while( today <= endIdx )
+/* Generated */    {
+/* Generated */       adjustedPrevPeriod = (0.075*period)+0.54;
+/* Generated */       todayValue = inReal[today];
+/* Generated */       DO_PRICE_WMA(todayValue,smoothedValue);
+/* Generated */       smoothPrice[smoothPrice_Idx] = smoothedValue;
+/* Generated */       if( (today%2) == 0 )
+/* Generated */       {
+/* Generated */          DO_HILBERT_EVEN(detrender,smoothedValue);
+/* Generated */          DO_HILBERT_EVEN(Q1,detrender);
+/* Generated */          if( today >= startIdx )
+/* Generated */          {
+/* Generated */             if( outQuadrature ) outQuadrature[outIdx] = Q1;
+/* Generated */             if( outInPhase ) outInPhase[outIdx] = I1ForEvenPrev3;
+/* Generated */          }
+/* Generated */          DO_HILBERT_EVEN(jI,I1ForEvenPrev3);
+/* Generated */          DO_HILBERT_EVEN(jQ,Q1);
+/* Generated */          if( ++hilbertIdx == 3 )
+/* Generated */             hilbertIdx = 0;
+/* Generated */          Q2 = (0.2*(Q1 + jI)) + (0.8*prevQ2);
+/* Generated */          I2 = (0.2*(I1ForEvenPrev3 - jQ)) + (0.8*prevI2);
+/* Generated */          I1ForOddPrev3 = I1ForOddPrev2;
+/* Generated */          I1ForOddPrev2 = detrender;
+/* Generated */       }
+/* Generated */       else
+/* Generated */       {
+/* Generated */          DO_HILBERT_ODD(detrender,smoothedValue);
+/* Generated */          DO_HILBERT_ODD(Q1,detrender);
+/* Generated */          if( today >= startIdx )
+/* Generated */          {
+/* Generated */             if( outQuadrature ) outQuadrature[outIdx] = Q1;
+/* Generated */             if( outInPhase ) outInPhase[outIdx] = I1ForOddPrev3;
+/* Generated */          }
+/* Generated */          DO_HILBERT_ODD(jI,I1ForOddPrev3);
+/* Generated */          DO_HILBERT_ODD(jQ,Q1);
+/* Generated */          Q2 = (0.2*(Q1 + jI)) + (0.8*prevQ2);
+/* Generated */          I2 = (0.2*(I1ForOddPrev3 - jQ)) + (0.8*prevI2);
+/* Generated */          I1ForEvenPrev3 = I1ForEvenPrev2;
+/* Generated */          I1ForEvenPrev2 = detrender;
+/* Generated */       }
+/* Generated */       Re = (0.2*((I2*prevI2)+(Q2*prevQ2)))+(0.8*Re);
+/* Generated */       Im = (0.2*((I2*prevQ2)-(Q2*prevI2)))+(0.8*Im);
+/* Generated */       prevQ2 = Q2;
+/* Generated */       prevI2 = I2;
+/* Generated */       tempReal = period;
+/* Generated */       if( (Im != 0.0) && (Re != 0.0) )
+/* Generated */          period = 360.0 / (std_atan(Im/Re)*rad2Deg);
+/* Generated */       tempReal2 = 1.5*tempReal;
+/* Generated */       if( period > tempReal2)
+/* Generated */          period = tempReal2;
+/* Generated */       tempReal2 = 0.67*tempReal;
+/* Generated */       if( period < tempReal2 )
+/* Generated */          period = tempReal2;
+/* Generated */       if( period < 6 )
+/* Generated */          period = 6;
+/* Generated */       else if( period > 50 )
+/* Generated */          period = 50;
+/* Generated */       period = (0.2*period) + (0.8 * tempReal);
+/* Generated */       smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
+/* Generated */       DCPeriod    = smoothPeriod+0.5;
+/* Generated */       DCPeriodInt = (int)DCPeriod;
+/* Generated */       if( doPhase )
+/* Generated */       {
+/* Generated */          prevDCPhase = DCPhase;
+/* Generated */          realPart = 0.0;
+/* Generated */          imagPart = 0.0;
+/* Generated */          idx = smoothPrice_Idx;
+/* Generated */          for( i=0; i < DCPeriodInt; i++ )
+/* Generated */          {
+/* Generated */             tempReal  = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
+/* Generated */             tempReal2 = smoothPrice[idx];
+/* Generated */             realPart += std_sin(tempReal)*tempReal2;
+/* Generated */             imagPart += std_cos(tempReal)*tempReal2;
+/* Generated */             if( idx == 0 )
+/* Generated */                idx = SMOOTH_PRICE_SIZE-1;
+/* Generated */             else
+/* Generated */                idx--;
+/* Generated */          }
+/* Generated */          tempReal = std_fabs(imagPart);
+/* Generated */          if( tempReal > 0.0 )
+/* Generated */             DCPhase = std_atan(realPart/imagPart)*rad2Deg;
+/* Generated */          else if( tempReal <= 0.01 )
+/* Generated */          {
+/* Generated */             if( realPart < 0.0 )
+/* Generated */                DCPhase -= 90.0;
+/* Generated */             else if( realPart > 0.0 )
+/* Generated */                DCPhase += 90.0;
+/* Generated */          }
+/* Generated */          DCPhase += 90.0;
+/* Generated */          DCPhase += 360.0 / smoothPeriod;
+/* Generated */          if( imagPart < 0.0 )
+/* Generated */             DCPhase += 180.0;
+/* Generated */          if( DCPhase > 315.0 )
+/* Generated */             DCPhase -= 360.0;
+/* Generated */       }
+/* Generated */       if( doSine )
+/* Generated */       {
+/* Generated */          prevSine     = sine;
+/* Generated */          prevLeadSine = leadSine;
+/* Generated */          sine     = std_sin(DCPhase*deg2Rad);
+/* Generated */          leadSine = std_sin((DCPhase+45)*deg2Rad);
+/* Generated */       }
+/* Generated */       if( doTrendline )
+/* Generated */       {
+/* Generated */          idx = today;
+/* Generated */          tempReal = 0.0;
+/* Generated */          for( i=0; i < DCPeriodInt; i++ )
+/* Generated */             tempReal += inReal[idx--];
+/* Generated */          if( DCPeriodInt > 0 )
+/* Generated */             tempReal = tempReal/(double)DCPeriodInt;
+/* Generated */          trendline = (4.0*tempReal + 3.0*iTrend1 + 2.0*iTrend2 + iTrend3) / 10.0;
+/* Generated */          iTrend3   = iTrend2;
+/* Generated */          iTrend2   = iTrend1;
+/* Generated */          iTrend1   = tempReal;
+/* Generated */       }
+/* Generated */       if( outTrendMode )
+/* Generated */       {
+/* Generated */          trend = 1;
+/* Generated */          if( ((sine > leadSine) && (prevSine <= prevLeadSine)) ||
+/* Generated */              ((sine < leadSine) && (prevSine >= prevLeadSine)) )
+/* Generated */          {
+/* Generated */             daysInTrend = 0;
+/* Generated */             trend = 0;
+/* Generated */          }
+/* Generated */          daysInTrend++;
+/* Generated */          if( daysInTrend < (0.5*smoothPeriod) )
+/* Generated */             trend = 0;
+/* Generated */          tempReal = DCPhase - prevDCPhase;
+/* Generated */          if( (smoothPeriod != 0.0) &&
+/* Generated */              ((tempReal > (0.67*360.0/smoothPeriod)) && (tempReal < (1.5*360.0/smoothPeriod))) )
+/* Generated */          {
+/* Generated */             trend = 0;
+/* Generated */          }
+/* Generated */          tempReal = smoothPrice[smoothPrice_Idx];
+/* Generated */          if( (trendline != 0.0) && (std_fabs( (tempReal - trendline)/trendline ) >= 0.015) )
+/* Generated */             trend = 1;
+/* Generated */       }
+/* Generated */       if( today >= startIdx )
+/* Generated */       {
+/* Generated */          if( outDCPeriod ) outDCPeriod[outIdx] = smoothPeriod;
+/* Generated */          if( outDCPhase ) outDCPhase[outIdx] = DCPhase;
+/* Generated */          if( outSine ) outSine[outIdx] = sine;
+/* Generated */          if( outLeadSine ) outLeadSine[outIdx] = leadSine;
+/* Generated */          if( outTrendline ) outTrendline[outIdx] = trendline;
+/* Generated */          if( outTrendMode ) outTrendMode[outIdx] = trend;
+/* Generated */          outIdx++;
+/* Generated */       }
+/* Generated */       CIRCBUF_NEXT(smoothPrice);
+/* Generated */       today++;
+/* Generated */    }
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ }
+/* Generated */ #endif
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
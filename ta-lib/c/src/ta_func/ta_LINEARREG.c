@@ -157,16 +157,6 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* insert local variable here */
-   int outIdx;
-
-   int today, lookbackTotal;
-   double SumX, SumXY, SumY, SumXSqr, Divisor;
-
-   double m, b;
-   int i;
-
-   double tempValue1;
-
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
 /* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -212,13 +202,86 @@
     * TA_LINEARREG_ANGLE    : Returns 'm' in degree.
     * TA_LINEARREG_INTERCEPT: Returns 'b'
     * TA_TSF                : Returns b+m*(period)
+    *
+    * All five functions share the same sliding
+    * sums, see TA_INT_LINEARREG below.
     */
+   return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx, inReal,
+                                        optInTimePeriod,
+                                        TA_LINEARREG_RESUM_PERIOD,
+                                        outBegIdx, outNBElement,
+                                        outReal, NULL, NULL, NULL, NULL );
+}
 
-   /* Adjust startIdx to account for the lookback period. */
-   lookbackTotal = LOOKBACK_CALL(LINEARREG)( optInTimePeriod );
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+  // No INT function
+#else
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+enum class Core::RetCode Core::TA_INT_LINEARREG( int    startIdx,
+                                                 int    endIdx,
+                                                 SubArray<double>^ inReal,
+                                                 int    optInTimePeriod,
+                                                 int    optInResumPeriod,
+                                                 [Out]int% outBegIdx,
+                                                 [Out]int% outNBElement,
+                                                 SubArray<double>^ outLinearReg,
+                                                 SubArray<double>^ outSlope,
+                                                 SubArray<double>^ outAngle,
+                                                 SubArray<double>^ outIntercept,
+                                                 SubArray<double>^ outTSF )
+#elif defined( _MANAGED )
+enum class Core::RetCode Core::TA_INT_LINEARREG( int    startIdx,
+                                                 int    endIdx,
+                                                 cli::array<INPUT_TYPE>^ inReal,
+                                                 int    optInTimePeriod,
+                                                 int    optInResumPeriod,
+                                                 [Out]int% outBegIdx,
+                                                 [Out]int% outNBElement,
+                                                 cli::array<double>^ outLinearReg,
+                                                 cli::array<double>^ outSlope,
+                                                 cli::array<double>^ outAngle,
+                                                 cli::array<double>^ outIntercept,
+                                                 cli::array<double>^ outTSF )
+#elif defined( _JAVA )
+public RetCode TA_INT_LINEARREG( int        startIdx,
+                                 int        endIdx,
+                                 INPUT_TYPE inReal[],
+                                 int        optInTimePeriod,
+                                 int        optInResumPeriod,
+                                 MInteger   outBegIdx,
+                                 MInteger   outNBElement,
+                                 double     outLinearReg[],
+                                 double     outSlope[],
+                                 double     outAngle[],
+                                 double     outIntercept[],
+                                 double     outTSF[] )
+#else
+TA_RetCode TA_PREFIX(INT_LINEARREG)( int    startIdx,
+                                     int    endIdx,
+                                     const INPUT_TYPE *inReal,
+                                     int    optInTimePeriod, /* From 2 to 100000 */
+                                     int    optInResumPeriod, /* 0 disables the re-summation */
+                                     int   *outBegIdx,
+                                     int   *outNBElement,
+                                     double *outLinearReg,
+                                     double *outSlope,
+                                     double *outAngle,
+                                     double *outIntercept,
+                                     double *outTSF )
+#endif
+{
+   int outIdx, today, trailingIdx, resumIdx;
+   int i;
+   double SumX, SumXY, SumY, SumXSqr, Divisor;
+   double m, b, offset;
+   double tempValue1;
 
-   if( startIdx < lookbackTotal )
-      startIdx = lookbackTotal;
+   /* Adjust startIdx to account for the lookback period.
+    * All five functions share the same lookback.
+    */
+   if( startIdx < optInTimePeriod-1 )
+      startIdx = optInTimePeriod-1;
 
    /* Make sure there is still something to evaluate. */
    if( startIdx > endIdx )
@@ -228,26 +291,81 @@
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
+   /* The re-summation must not happen more often than once
+    * per period, else the cost would not be O(1) per bar anymore.
+    */
+   if( (optInResumPeriod > 0) && (optInResumPeriod < optInTimePeriod) )
+      optInResumPeriod = optInTimePeriod;
+
    outIdx = 0; /* Index into the output. */
    today = startIdx;
+   trailingIdx = startIdx-optInTimePeriod+1;
 
    SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
    SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
    Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
 
+   /* The x of inReal[today-i] is 'i', so the most recent
+    * price is x=0. When sliding the window by one bar, every
+    * remaining price moves to x+1 and the trailing price
+    * (at x=period-1) leaves the window:
+    *
+    *    SumXY(today+1) = SumXY(today) + SumY(today) - period*inReal[trailingIdx]
+    *    SumY(today+1)  = SumY(today) - inReal[trailingIdx] + inReal[today+1]
+    *
+    * The rolling update accumulates rounding error. To keep it
+    * small, the sums are done on the prices minus an 'offset'
+    * (a recent price), so their magnitude follows the price
+    * variations rather than the price level. When
+    * optInResumPeriod is not zero, the sums are rebuilt from
+    * scratch at that interval to keep the drift bounded.
+    */
+   resumIdx = today;
+   offset = 0.0;
+   SumXY = 0.0;
+   SumY = 0.0;
+
    while( today <= endIdx )
    {
-     SumXY = 0;
-     SumY = 0;
-     for( i = optInTimePeriod; i-- != 0; )
+     if( today == resumIdx )
      {
-       SumY += tempValue1 = inReal[today - i];
-       SumXY += (double)i * tempValue1;
+       offset = inReal[today];
+       SumXY = 0.0;
+       SumY = 0.0;
+       for( i = optInTimePeriod; i-- != 0; )
+       {
+         SumY += tempValue1 = inReal[today - i] - offset;
+         SumXY += (double)i * tempValue1;
+       }
+       if( optInResumPeriod > 0 )
+         resumIdx = today + optInResumPeriod;
      }
+
      m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
-     b = ( SumY - m * SumX ) / (double)optInTimePeriod;
-     outReal[outIdx++] = b + m * (double)(optInTimePeriod-1);
-     today++;
+     b = ( SumY - m * SumX ) / (double)optInTimePeriod + offset;
+
+     /* Read the trailing price before writing the outputs, this
+      * allows inReal and an output to be the same buffer.
+      */
+     tempValue1 = inReal[trailingIdx++] - offset;
+
+     if( outLinearReg )
+        outLinearReg[outIdx] = b + m * (double)(optInTimePeriod-1);
+     if( outSlope )
+        outSlope[outIdx] = m;
+     if( outAngle )
+        outAngle[outIdx] = std_atan(m) * ( 180.0 / PI );
+     if( outIntercept )
+        outIntercept[outIdx] = b;
+     if( outTSF )
+        outTSF[outIdx] = b + m * (double)optInTimePeriod;
+     outIdx++;
+
+     if( ++today <= endIdx )
+     {
+       SumXY += SumY - (double)optInTimePeriod * tempValue1;
+       SumY  += (inReal[today] - offset) - tempValue1;
+     }
    }
 
    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
@@ -255,6 +373,7 @@
 
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
+#endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
 
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -300,12 +419,6 @@
 /* Generated */                            double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    int outIdx;
-/* Generated */    int today, lookbackTotal;
-/* Generated */    double SumX, SumXY, SumY, SumXSqr, Divisor;
-/* Generated */    double m, b;
-/* Generated */    int i;
-/* Generated */    double tempValue1;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -323,38 +436,134 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
-/* Generated */    lookbackTotal = LOOKBACK_CALL(LINEARREG)( optInTimePeriod );
-/* Generated */    if( startIdx < lookbackTotal )
-/* Generated */       startIdx = lookbackTotal;
+/* Generated */    return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx, inReal,
+/* Generated */                                         optInTimePeriod,
+/* Generated */                                         TA_LINEARREG_RESUM_PERIOD,
+/* Generated */                                         outBegIdx, outNBElement,
+/* Generated */                                         outReal, NULL, NULL, NULL, NULL );
+/* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */   // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::TA_INT_LINEARREG( int    startIdx,
+/* Generated */                                                  int    endIdx,
+/* Generated */                                                  SubArray<double>^ inReal,
+/* Generated */                                                  int    optInTimePeriod,
+/* Generated */                                                  int    optInResumPeriod,
+/* Generated */                                                  [Out]int% outBegIdx,
+/* Generated */                                                  [Out]int% outNBElement,
+/* Generated */                                                  SubArray<double>^ outLinearReg,
+/* Generated */                                                  SubArray<double>^ outSlope,
+/* Generated */                                                  SubArray<double>^ outAngle,
+/* Generated */                                                  SubArray<double>^ outIntercept,
+/* Generated */                                                  SubArray<double>^ outTSF )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::TA_INT_LINEARREG( int    startIdx,
+/* Generated */                                                  int    endIdx,
+/* Generated */                                                  cli::array<INPUT_TYPE>^ inReal,
+/* Generated */                                                  int    optInTimePeriod,
+/* Generated */                                                  int    optInResumPeriod,
+/* Generated */                                                  [Out]int% outBegIdx,
+/* Generated */                                                  [Out]int% outNBElement,
+/* Generated */                                                  cli::array<double>^ outLinearReg,
+/* Generated */                                                  cli::array<double>^ outSlope,
+/* Generated */                                                  cli::array<double>^ outAngle,
+/* Generated */                                                  cli::array<double>^ outIntercept,
+/* Generated */                                                  cli::array<double>^ outTSF )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode TA_INT_LINEARREG( int        startIdx,
+/* Generated */                                  int        endIdx,
+/* Generated */                                  INPUT_TYPE inReal[],
+/* Generated */                                  int        optInTimePeriod,
+/* Generated */                                  int        optInResumPeriod,
+/* Generated */                                  MInteger   outBegIdx,
+/* Generated */                                  MInteger   outNBElement,
+/* Generated */                                  double     outLinearReg[],
+/* Generated */                                  double     outSlope[],
+/* Generated */                                  double     outAngle[],
+/* Generated */                                  double     outIntercept[],
+/* Generated */                                  double     outTSF[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_LINEARREG)( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                      const INPUT_TYPE *inReal,
+/* Generated */                                      int    optInTimePeriod, 
+/* Generated */                                      int    optInResumPeriod, 
+/* Generated */                                      int   *outBegIdx,
+/* Generated */                                      int   *outNBElement,
+/* Generated */                                      double *outLinearReg,
+/* Generated */                                      double *outSlope,
+/* Generated */                                      double *outAngle,
+/* Generated */                                      double *outIntercept,
+/* Generated */                                      double *outTSF )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    int outIdx, today, trailingIdx, resumIdx;
+/* Generated */    int i;
+/* Generated */    double SumX, SumXY, SumY, SumXSqr, Divisor;
+/* Generated */    double m, b, offset;
+/* Generated */    double tempValue1;
+/* Generated */    if( startIdx < optInTimePeriod-1 )
+/* Generated */       startIdx = optInTimePeriod-1;
 /* Generated */    if( startIdx > endIdx )
 /* Generated */    {
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
+/* Generated */    if( (optInResumPeriod > 0) && (optInResumPeriod < optInTimePeriod) )
+/* Generated */       optInResumPeriod = optInTimePeriod;
 /* Generated */    outIdx = 0; 
 /* Generated */    today = startIdx;
+/* Generated */    trailingIdx = startIdx-optInTimePeriod+1;
 /* Generated */    SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
 /* Generated */    SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
 /* Generated */    Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
+/* Generated */    resumIdx = today;
+/* Generated */    offset = 0.0;
+/* Generated */    SumXY = 0.0;
+/* Generated */    SumY = 0.0;
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */      SumXY = 0;
-/* Generated */      SumY = 0;
-/* Generated */      for( i = optInTimePeriod; i-- != 0; )
+/* Generated */      if( today == resumIdx )
 /* Generated */      {
-/* Generated */        SumY += tempValue1 = inReal[today - i];
-/* Generated */        SumXY += (double)i * tempValue1;
+/* Generated */        offset = inReal[today];
+/* Generated */        SumXY = 0.0;
+/* Generated */        SumY = 0.0;
+/* Generated */        for( i = optInTimePeriod; i-- != 0; )
+/* Generated */        {
+/* Generated */          SumY += tempValue1 = inReal[today - i] - offset;
+/* Generated */          SumXY += (double)i * tempValue1;
+/* Generated */        }
+/* Generated */        if( optInResumPeriod > 0 )
+/* Generated */          resumIdx = today + optInResumPeriod;
 /* Generated */      }
 /* Generated */      m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
-/* Generated */      b = ( SumY - m * SumX ) / (double)optInTimePeriod;
-/* Generated */      outReal[outIdx++] = b + m * (double)(optInTimePeriod-1);
-/* Generated */      today++;
+/* Generated */      b = ( SumY - m * SumX ) / (double)optInTimePeriod + offset;
+/* Generated */      tempValue1 = inReal[trailingIdx++] - offset;
+/* Generated */      if( outLinearReg )
+/* Generated */         outLinearReg[outIdx] = b + m * (double)(optInTimePeriod-1);
+/* Generated */      if( outSlope )
+/* Generated */         outSlope[outIdx] = m;
+/* Generated */      if( outAngle )
+/* Generated */         outAngle[outIdx] = std_atan(m) * ( 180.0 / PI );
+/* Generated */      if( outIntercept )
+/* Generated */         outIntercept[outIdx] = b;
+/* Generated */      if( outTSF )
+/* Generated */         outTSF[outIdx] = b + m * (double)optInTimePeriod;
+/* Generated */      outIdx++;
+/* Generated */      if( ++today <= endIdx )
+/* Generated */      {
+/* Generated */        SumXY += SumY - (double)optInTimePeriod * tempValue1;
+/* Generated */        SumY  += (inReal[today] - offset) - tempValue1;
+/* Generated */      }
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
+/* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
@@ -157,18 +157,7 @@
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
-	/* insert local variable here */
-   int outIdx;
-
-   int today, lookbackTotal;
-   double SumX, SumXY, SumY, SumXSqr, Divisor;
-
-   double m;
-
-   int i;
-
-   double tempValue1;
-
+   /* insert local variable here */
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
 /* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -199,62 +188,16 @@
 
    /* Insert TA function code here. */
 
-   /* Linear Regression is a concept also known as the
-    * "least squares method" or "best fit." Linear
-    * Regression attempts to fit a straight line between
-    * several data points in such a way that distance
-    * between each data point and the line is minimized.
-    *
-    * For each point, a straight line over the specified
-    * previous bar period is determined in terms
-    * of y = b + m*x:
-    *
-    * TA_LINEARREG          : Returns b+m*(period-1)
-    * TA_LINEARREG_SLOPE    : Returns 'm'
-    * TA_LINEARREG_ANGLE    : Returns 'm' in degree.
-    * TA_LINEARREG_INTERCEPT: Returns 'b'
-    * TA_TSF                : Returns b+m*(period)
+   /* The linear regression is evaluated by TA_INT_LINEARREG
+    * (see ta_LINEARREG.c), which is shared by TA_LINEARREG,
+    * TA_LINEARREG_SLOPE, TA_LINEARREG_ANGLE,
+    * TA_LINEARREG_INTERCEPT and TA_TSF.
     */
-
-   /* Adjust startIdx to account for the lookback period. */
-   lookbackTotal = LOOKBACK_CALL(LINEARREG_ANGLE)( optInTimePeriod );
-
-   if( startIdx < lookbackTotal )
-      startIdx = lookbackTotal;
-
-   /* Make sure there is still something to evaluate. */
-   if( startIdx > endIdx )
-   {
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-   }
-
-   outIdx = 0; /* Index into the output. */
-   today = startIdx;
-
-   SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
-   SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
-   Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
-
-   while( today <= endIdx )
-   {
-     SumXY = 0;
-     SumY = 0;
-     for( i = optInTimePeriod; i-- != 0; )
-     {
-       SumY += tempValue1 = inReal[today - i];
-       SumXY += (double)i * tempValue1;
-     }
-     m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
-     outReal[outIdx++] = std_atan(m) * ( 180.0 / PI );
-     today++;
-   }
-
-   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
-
-   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx, inReal,
+                                        optInTimePeriod,
+                                        TA_LINEARREG_RESUM_PERIOD,
+                                        outBegIdx, outNBElement,
+                                        NULL, NULL, outReal, NULL, NULL );
 }
 
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
@@ -301,12 +244,6 @@
 /* Generated */                                  double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    int outIdx;
-/* Generated */    int today, lookbackTotal;
-/* Generated */    double SumX, SumXY, SumY, SumXSqr, Divisor;
-/* Generated */    double m;
-/* Generated */    int i;
-/* Generated */    double tempValue1;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -324,36 +261,11 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
-/* Generated */    lookbackTotal = LOOKBACK_CALL(LINEARREG_ANGLE)( optInTimePeriod );
-/* Generated */    if( startIdx < lookbackTotal )
-/* Generated */       startIdx = lookbackTotal;
-/* Generated */    if( startIdx > endIdx )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-/* Generated */    }
-/* Generated */    outIdx = 0; 
-/* Generated */    today = startIdx;
-/* Generated */    SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
-/* Generated */    SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
-/* Generated */    Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
-/* Generated */    while( today <= endIdx )
-/* Generated */    {
-/* Generated */      SumXY = 0;
-/* Generated */      SumY = 0;
-/* Generated */      for( i = optInTimePeriod; i-- != 0; )
-/* Generated */      {
-/* Generated */        SumY += tempValue1 = inReal[today - i];
-/* Generated */        SumXY += (double)i * tempValue1;
-/* Generated */      }
-/* Generated */      m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
-/* Generated */      outReal[outIdx++] = std_atan(m) * ( 180.0 / PI );
-/* Generated */      today++;
-/* Generated */    }
-/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
-/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx, inReal,
+/* Generated */                                         optInTimePeriod,
+/* Generated */                                         TA_LINEARREG_RESUM_PERIOD,
+/* Generated */                                         outBegIdx, outNBElement,
+/* Generated */                                         NULL, NULL, outReal, NULL, NULL );
 /* Generated */ }
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
@@ -342,6 +342,343 @@
    return retCode;
 }
 
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+  // No INT function
+#else
+
+/* Internal function evaluating the same MA type at several periods.
+ *
+ * The output is a matrix, the row 'r' is the MA at period
+ * optInTimePeriods[r] and starts at outReal[r*(endIdx-startIdx+1)].
+ * The column 'c' is the value at startIdx+c, only the columns from
+ * outBegIdx[r]-startIdx are written, which is the lookback of the
+ * period. Unlike the TA functions, outReal must not overlap inReal.
+ *
+ * The input is processed by blocks shared by all the rows, so it
+ * is read from memory once whatever the number of periods:
+ *  - SMA, WMA and TRIMA are evaluated from prefix sums computed
+ *    once per block (see TA_PREFIX_BUILD).
+ *  - For the EMA, the recursions of all the rows are advanced
+ *    together bar by bar, they are independent so they run in
+ *    parallel in the CPU. The values are identical to TA_EMA.
+ *  - The other types, and SMA/WMA/TRIMA in compensated precision,
+ *    call TA_MA for each period.
+ */
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+enum class Core::RetCode Core::TA_INT_MA_RIBBON( int    startIdx,
+                                                 int    endIdx,
+                                                 SubArray<double>^ inReal,
+                                                 int    nbPeriod,
+                                                 cli::array<int>^ optInTimePeriods,
+                                                 MAType optInMAType,
+                                                 cli::array<int>^ outBegIdx,
+                                                 cli::array<int>^ outNBElement,
+                                                 cli::array<double>^ outReal )
+#elif defined( _MANAGED )
+enum class Core::RetCode Core::TA_INT_MA_RIBBON( int    startIdx,
+                                                 int    endIdx,
+                                                 cli::array<INPUT_TYPE>^ inReal,
+                                                 int    nbPeriod,
+                                                 cli::array<int>^ optInTimePeriods,
+                                                 MAType optInMAType,
+                                                 cli::array<int>^ outBegIdx,
+                                                 cli::array<int>^ outNBElement,
+                                                 cli::array<double>^ outReal )
+#elif defined( _JAVA )
+public RetCode TA_INT_MA_RIBBON( int        startIdx,
+                                 int        endIdx,
+                                 INPUT_TYPE inReal[],
+                                 int        nbPeriod,
+                                 int        optInTimePeriods[],
+                                 MAType     optInMAType,
+                                 int        outBegIdx[],
+                                 int        outNBElement[],
+                                 double     outReal[] )
+#else
+TA_RetCode TA_PREFIX(INT_MA_RIBBON)( int    startIdx,
+                                     int    endIdx,
+                                     const INPUT_TYPE *inReal,
+                                     int    nbPeriod,
+                                     const int *optInTimePeriods, /* From 1 to 100000 */
+                                     TA_MAType optInMAType,
+                                     int   *outBegIdx,
+                                     int   *outNBElement,
+                                     double *outReal )
+#endif
+{
+   ARRAY_REF(rowValue);
+   ARRAY_REF(rowK);
+   ARRAY_REF(emaBuffer);
+   ARRAY_REF(prefixSums);
+   ARRAY_REF(localOutputArray);
+   VALUE_HANDLE_INT(localBegIdx);
+   VALUE_HANDLE_INT(localNbElement);
+   ENUM_DECLARATION(RetCode) retCode;
+   int r, i, period, stride, rowIdx, lookback, minBegIdx, maxPeriod;
+   int prefixSize, blockSize, blockBeg, blockEnd, base, lo, hi, today, lockIdx;
+   double prevMA, k, tempReal;
+
+   if( (startIdx < 0) || (endIdx < startIdx) || (nbPeriod < 1) )
+      return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+
+   for( r=0; r < nbPeriod; r++ )
+   {
+      if( (optInTimePeriods[r] < 1) || (optInTimePeriods[r] > 100000) )
+         return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+   }
+
+   /* Output range of each row. A period of 1 is a copy of the
+    * input, as done by TA_MA.
+    */
+   stride = endIdx-startIdx+1;
+   minBegIdx = endIdx+1;
+   maxPeriod = 1;
+   for( r=0; r < nbPeriod; r++ )
+   {
+      period = optInTimePeriods[r];
+      lookback = LOOKBACK_CALL(MA)( period, optInMAType );
+      if( lookback > startIdx )
+         outBegIdx[r] = lookback;
+      else
+         outBegIdx[r] = startIdx;
+
+      if( outBegIdx[r] > endIdx )
+      {
+         outBegIdx[r] = 0;
+         outNBElement[r] = 0;
+         continue;
+      }
+      outNBElement[r] = endIdx-outBegIdx[r]+1;
+
+      if( period == 1 )
+      {
+         rowIdx = r*stride;
+         for( i=startIdx; i <= endIdx; i++ )
+            outReal[rowIdx+i-startIdx] = inReal[i];
+         continue;
+      }
+
+      if( outBegIdx[r] < minBegIdx )
+         minBegIdx = outBegIdx[r];
+      if( period > maxPeriod )
+         maxPeriod = period;
+   }
+
+   /* Nothing else to do, all the rows are empty or copies. */
+   if( minBegIdx > endIdx )
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+
+   switch( optInMAType )
+   {
+   case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+   case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+   case ENUM_CASE(MAType, TA_MAType_TRIMA, Trima):
+      if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
+         break;
+
+      blockSize = maxPeriod > TA_PREFIX_BLOCK_SIZE? maxPeriod : TA_PREFIX_BLOCK_SIZE;
+      prefixSize = blockSize+maxPeriod+1;
+      ARRAY_ALLOC(prefixSums,4*prefixSize);
+      #if !defined( _JAVA )
+         if( !prefixSums )
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+      #endif
+
+      for( blockBeg=minBegIdx; blockBeg <= endIdx; blockBeg += blockSize )
+      {
+         blockEnd = blockBeg+blockSize-1;
+         if( blockEnd > endIdx )
+            blockEnd = endIdx;
+
+         /* The windows of the block start after 'base'. */
+         base = blockBeg-maxPeriod;
+         if( base < -1 )
+            base = -1;
+         TA_PREFIX_BUILD(prefixSums,prefixSize,inReal,base,blockEnd);
+
+         for( r=0; r < nbPeriod; r++ )
+         {
+            period = optInTimePeriods[r];
+            if( (outNBElement[r] == 0) || (period == 1) )
+               continue;
+
+            i = outBegIdx[r] > blockBeg? outBegIdx[r] : blockBeg;
+            rowIdx = r*stride-startIdx;
+            switch( optInMAType )
+            {
+            case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+               for( ; i <= blockEnd; i++ )
+               {
+                  hi = i-base;
+                  lo = hi-period;
+                  TA_PREFIX_SMA(outReal[rowIdx+i],prefixSums,prefixSize,lo,hi);
+               }
+               break;
+            case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+               for( ; i <= blockEnd; i++ )
+               {
+                  hi = i-base;
+                  lo = hi-period;
+                  TA_PREFIX_WMA(outReal[rowIdx+i],prefixSums,prefixSize,lo,hi);
+               }
+               break;
+            default:
+               for( ; i <= blockEnd; i++ )
+               {
+                  hi = i-base;
+                  lo = hi-period;
+                  TA_PREFIX_TRIMA(outReal[rowIdx+i],prefixSums,prefixSize,lo,hi);
+               }
+            }
+         }
+      }
+
+      ARRAY_FREE(prefixSums);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+
+   case ENUM_CASE(MAType, TA_MAType_EMA, Ema):
+      ARRAY_ALLOC(rowValue,nbPeriod);
+      ARRAY_ALLOC(rowK,nbPeriod);
+      ARRAY_ALLOC(emaBuffer,TA_MA_RIBBON_EMA_BLOCK*nbPeriod);
+      #if !defined( _JAVA )
+         if( !rowValue || !rowK || !emaBuffer )
+         {
+            if( rowValue ) ARRAY_FREE(rowValue);
+            if( rowK ) ARRAY_FREE(rowK);
+            if( emaBuffer ) ARRAY_FREE(emaBuffer);
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+         }
+      #endif
+
+      /* Once all the rows have their first output, they are advanced
+       * together. lockIdx is the last bar done row by row.
+       */
+      lockIdx = startIdx;
+      for( r=0; r < nbPeriod; r++ )
+      {
+         if( (outNBElement[r] != 0) && (optInTimePeriods[r] != 1) && (outBegIdx[r] > lockIdx) )
+            lockIdx = outBegIdx[r];
+      }
+      if( lockIdx > endIdx )
+         lockIdx = endIdx;
+
+      /* Row by row up to lockIdx, with the same seed as TA_INT_EMA:
+       * the SMA of the first 'period' values of the lookback, or the
+       * first value of the input in Metastock compatibility.
+       */
+      for( r=0; r < nbPeriod; r++ )
+      {
+         rowValue[r] = 0.0;
+         rowK[r] = 0.0;
+         period = optInTimePeriods[r];
+         if( (outNBElement[r] == 0) || (period == 1) )
+            continue;
+
+         if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+         {
+            today = outBegIdx[r]-LOOKBACK_CALL(EMA)( period );
+            i = period;
+            prevMA = 0.0;
+            while( i-- > 0 )
+               prevMA += inReal[today++];
+            prevMA /= period;
+         }
+         else
+         {
+            prevMA = inReal[0];
+            today = 1;
+         }
+
+         rowIdx = r*stride-startIdx;
+         if( today-1 >= outBegIdx[r] )
+            outReal[rowIdx+today-1] = prevMA;
+
+         k = PER_TO_K(period);
+         while( today <= lockIdx )
+         {
+            prevMA = ((inReal[today]-prevMA)*k) + prevMA;
+            if( today >= outBegIdx[r] )
+               outReal[rowIdx+today] = prevMA;
+            today++;
+         }
+
+         rowValue[r] = prevMA;
+         rowK[r] = k;
+      }
+
+      /* All the rows together, the inner loop over the rows has no
+       * dependency and no branch, it is vectorized by the compiler.
+       * The values are buffered for a block of bars, then copied to
+       * the rows. An empty row has k=0 and stays at zero.
+       */
+      for( blockBeg=lockIdx+1; blockBeg <= endIdx; blockBeg += TA_MA_RIBBON_EMA_BLOCK )
+      {
+         blockEnd = blockBeg+TA_MA_RIBBON_EMA_BLOCK-1;
+         if( blockEnd > endIdx )
+            blockEnd = endIdx;
+
+         for( today=blockBeg, i=0; today <= blockEnd; today++, i += nbPeriod )
+         {
+            tempReal = inReal[today];
+            for( r=0; r < nbPeriod; r++ )
+            {
+               rowValue[r] = ((tempReal-rowValue[r])*rowK[r]) + rowValue[r];
+               emaBuffer[i+r] = rowValue[r];
+            }
+         }
+
+         for( r=0; r < nbPeriod; r++ )
+         {
+            if( (outNBElement[r] == 0) || (optInTimePeriods[r] == 1) )
+               continue;
+            rowIdx = r*stride-startIdx;
+            for( today=blockBeg, i=r; today <= blockEnd; today++, i += nbPeriod )
+               outReal[rowIdx+today] = emaBuffer[i];
+         }
+      }
+
+      ARRAY_FREE(rowValue);
+      ARRAY_FREE(rowK);
+      ARRAY_FREE(emaBuffer);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+
+   default:
+      break;
+   }
+
+   /* One TA_MA per period. */
+   ARRAY_ALLOC(localOutputArray,stride);
+   #if !defined( _JAVA )
+      if( !localOutputArray )
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+   #endif
+
+   for( r=0; r < nbPeriod; r++ )
+   {
+      if( (outNBElement[r] == 0) || (optInTimePeriods[r] == 1) )
+         continue;
+
+      retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
+                                   optInTimePeriods[r], optInMAType,
+                                   VALUE_HANDLE_OUT(localBegIdx), VALUE_HANDLE_OUT(localNbElement),
+                                   localOutputArray );
+      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+      {
+         ARRAY_FREE(localOutputArray);
+         return retCode;
+      }
+
+      rowIdx = r*stride+outBegIdx[r]-startIdx;
+      for( i=0; i < outNBElement[r]; i++ )
+         outReal[rowIdx+i] = localOutputArray[i];
+   }
+
+   ARRAY_FREE(localOutputArray);
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+
+#endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
+
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
 /* Generated */ #define  USE_SINGLE_PRECISION_INPUT
@@ -478,6 +815,273 @@
 /* Generated */    }
 /* Generated */    return retCode;
 /* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */   // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::TA_INT_MA_RIBBON( int    startIdx,
+/* Generated */                                                  int    endIdx,
+/* Generated */                                                  SubArray<double>^ inReal,
+/* Generated */                                                  int    nbPeriod,
+/* Generated */                                                  cli::array<int>^ optInTimePeriods,
+/* Generated */                                                  MAType optInMAType,
+/* Generated */                                                  cli::array<int>^ outBegIdx,
+/* Generated */                                                  cli::array<int>^ outNBElement,
+/* Generated */                                                  cli::array<double>^ outReal )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::TA_INT_MA_RIBBON( int    startIdx,
+/* Generated */                                                  int    endIdx,
+/* Generated */                                                  cli::array<INPUT_TYPE>^ inReal,
+/* Generated */                                                  int    nbPeriod,
+/* Generated */                                                  cli::array<int>^ optInTimePeriods,
+/* Generated */                                                  MAType optInMAType,
+/* Generated */                                                  cli::array<int>^ outBegIdx,
+/* Generated */                                                  cli::array<int>^ outNBElement,
+/* Generated */                                                  cli::array<double>^ outReal )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode TA_INT_MA_RIBBON( int        startIdx,
+/* Generated */                                  int        endIdx,
+/* Generated */                                  INPUT_TYPE inReal[],
+/* Generated */                                  int        nbPeriod,
+/* Generated */                                  int        optInTimePeriods[],
+/* Generated */                                  MAType     optInMAType,
+/* Generated */                                  int        outBegIdx[],
+/* Generated */                                  int        outNBElement[],
+/* Generated */                                  double     outReal[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_MA_RIBBON)( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                      const INPUT_TYPE *inReal,
+/* Generated */                                      int    nbPeriod,
+/* Generated */                                      const int *optInTimePeriods, 
+/* Generated */                                      TA_MAType optInMAType,
+/* Generated */                                      int   *outBegIdx,
+/* Generated */                                      int   *outNBElement,
+/* Generated */                                      double *outReal )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    ARRAY_REF(rowValue);
+/* Generated */    ARRAY_REF(rowK);
+/* Generated */    ARRAY_REF(emaBuffer);
+/* Generated */    ARRAY_REF(prefixSums);
+/* Generated */    ARRAY_REF(localOutputArray);
+/* Generated */    VALUE_HANDLE_INT(localBegIdx);
+/* Generated */    VALUE_HANDLE_INT(localNbElement);
+/* Generated */    ENUM_DECLARATION(RetCode) retCode;
+/* Generated */    int r, i, period, stride, rowIdx, lookback, minBegIdx, maxPeriod;
+/* Generated */    int prefixSize, blockSize, blockBeg, blockEnd, base, lo, hi, today, lockIdx;
+/* Generated */    double prevMA, k, tempReal;
+/* Generated */    if( (startIdx < 0) || (endIdx < startIdx) || (nbPeriod < 1) )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    for( r=0; r < nbPeriod; r++ )
+/* Generated */    {
+/* Generated */       if( (optInTimePeriods[r] < 1) || (optInTimePeriods[r] > 100000) )
+/* Generated */          return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    }
+/* Generated */    stride = endIdx-startIdx+1;
+/* Generated */    minBegIdx = endIdx+1;
+/* Generated */    maxPeriod = 1;
+/* Generated */    for( r=0; r < nbPeriod; r++ )
+/* Generated */    {
+/* Generated */       period = optInTimePeriods[r];
+/* Generated */       lookback = LOOKBACK_CALL(MA)( period, optInMAType );
+/* Generated */       if( lookback > startIdx )
+/* Generated */          outBegIdx[r] = lookback;
+/* Generated */       else
+/* Generated */          outBegIdx[r] = startIdx;
+/* Generated */       if( outBegIdx[r] > endIdx )
+/* Generated */       {
+/* Generated */          outBegIdx[r] = 0;
+/* Generated */          outNBElement[r] = 0;
+/* Generated */          continue;
+/* Generated */       }
+/* Generated */       outNBElement[r] = endIdx-outBegIdx[r]+1;
+/* Generated */       if( period == 1 )
+/* Generated */       {
+/* Generated */          rowIdx = r*stride;
+/* Generated */          for( i=startIdx; i <= endIdx; i++ )
+/* Generated */             outReal[rowIdx+i-startIdx] = inReal[i];
+/* Generated */          continue;
+/* Generated */       }
+/* Generated */       if( outBegIdx[r] < minBegIdx )
+/* Generated */          minBegIdx = outBegIdx[r];
+/* Generated */       if( period > maxPeriod )
+/* Generated */          maxPeriod = period;
+/* Generated */    }
+/* Generated */    if( minBegIdx > endIdx )
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    switch( optInMAType )
+/* Generated */    {
+/* Generated */    case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+/* Generated */    case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+/* Generated */    case ENUM_CASE(MAType, TA_MAType_TRIMA, Trima):
+/* Generated */       if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
+/* Generated */          break;
+/* Generated */       blockSize = maxPeriod > TA_PREFIX_BLOCK_SIZE? maxPeriod : TA_PREFIX_BLOCK_SIZE;
+/* Generated */       prefixSize = blockSize+maxPeriod+1;
+/* Generated */       ARRAY_ALLOC(prefixSums,4*prefixSize);
+/* Generated */       #if !defined( _JAVA )
+/* Generated */          if( !prefixSums )
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */       #endif
+/* Generated */       for( blockBeg=minBegIdx; blockBeg <= endIdx; blockBeg += blockSize )
+/* Generated */       {
+/* Generated */          blockEnd = blockBeg+blockSize-1;
+/* Generated */          if( blockEnd > endIdx )
+/* Generated */             blockEnd = endIdx;
+/* Generated */          base = blockBeg-maxPeriod;
+/* Generated */          if( base < -1 )
+/* Generated */             base = -1;
+/* Generated */          TA_PREFIX_BUILD(prefixSums,prefixSize,inReal,base,blockEnd);
+/* Generated */          for( r=0; r < nbPeriod; r++ )
+/* Generated */          {
+/* Generated */             period = optInTimePeriods[r];
+/* Generated */             if( (outNBElement[r] == 0) || (period == 1) )
+/* Generated */                continue;
+/* Generated */             i = outBegIdx[r] > blockBeg? outBegIdx[r] : blockBeg;
+/* Generated */             rowIdx = r*stride-startIdx;
+/* Generated */             switch( optInMAType )
+/* Generated */             {
+/* Generated */             case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+/* Generated */                for( ; i <= blockEnd; i++ )
+/* Generated */                {
+/* Generated */                   hi = i-base;
+/* Generated */                   lo = hi-period;
+/* Generated */                   TA_PREFIX_SMA(outReal[rowIdx+i],prefixSums,prefixSize,lo,hi);
+/* Generated */                }
+/* Generated */                break;
+/* Generated */             case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+/* Generated */                for( ; i <= blockEnd; i++ )
+/* Generated */                {
+/* Generated */                   hi = i-base;
+/* Generated */                   lo = hi-period;
+/* Generated */                   TA_PREFIX_WMA(outReal[rowIdx+i],prefixSums,prefixSize,lo,hi);
+/* Generated */                }
+/* Generated */                break;
+/* Generated */             default:
+/* Generated */                for( ; i <= blockEnd; i++ )
+/* Generated */                {
+/* Generated */                   hi = i-base;
+/* Generated */                   lo = hi-period;
+/* Generated */                   TA_PREFIX_TRIMA(outReal[rowIdx+i],prefixSums,prefixSize,lo,hi);
+/* Generated */                }
+/* Generated */             }
+/* Generated */          }
+/* Generated */       }
+/* Generated */       ARRAY_FREE(prefixSums);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    case ENUM_CASE(MAType, TA_MAType_EMA, Ema):
+/* Generated */       ARRAY_ALLOC(rowValue,nbPeriod);
+/* Generated */       ARRAY_ALLOC(rowK,nbPeriod);
+/* Generated */       ARRAY_ALLOC(emaBuffer,TA_MA_RIBBON_EMA_BLOCK*nbPeriod);
+/* Generated */       #if !defined( _JAVA )
+/* Generated */          if( !rowValue || !rowK || !emaBuffer )
+/* Generated */          {
+/* Generated */             if( rowValue ) ARRAY_FREE(rowValue);
+/* Generated */             if( rowK ) ARRAY_FREE(rowK);
+/* Generated */             if( emaBuffer ) ARRAY_FREE(emaBuffer);
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */          }
+/* Generated */       #endif
+/* Generated */       lockIdx = startIdx;
+/* Generated */       for( r=0; r < nbPeriod; r++ )
+/* Generated */       {
+/* Generated */          if( (outNBElement[r] != 0) && (optInTimePeriods[r] != 1) && (outBegIdx[r] > lockIdx) )
+/* Generated */             lockIdx = outBegIdx[r];
+/* Generated */       }
+/* Generated */       if( lockIdx > endIdx )
+/* Generated */          lockIdx = endIdx;
+/* Generated */       for( r=0; r < nbPeriod; r++ )
+/* Generated */       {
+/* Generated */          rowValue[r] = 0.0;
+/* Generated */          rowK[r] = 0.0;
+/* Generated */          period = optInTimePeriods[r];
+/* Generated */          if( (outNBElement[r] == 0) || (period == 1) )
+/* Generated */             continue;
+/* Generated */          if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+/* Generated */          {
+/* Generated */             today = outBegIdx[r]-LOOKBACK_CALL(EMA)( period );
+/* Generated */             i = period;
+/* Generated */             prevMA = 0.0;
+/* Generated */             while( i-- > 0 )
+/* Generated */                prevMA += inReal[today++];
+/* Generated */             prevMA /= period;
+/* Generated */          }
+/* Generated */          else
+/* Generated */          {
+/* Generated */             prevMA = inReal[0];
+/* Generated */             today = 1;
+/* Generated */          }
+/* Generated */          rowIdx = r*stride-startIdx;
+/* Generated */          if( today-1 >= outBegIdx[r] )
+/* Generated */             outReal[rowIdx+today-1] = prevMA;
+/* Generated */          k = PER_TO_K(period);
+/* Generated */          while( today <= lockIdx )
+/* Generated */          {
+/* Generated */             prevMA = ((inReal[today]-prevMA)*k) + prevMA;
+/* Generated */             if( today >= outBegIdx[r] )
+/* Generated */                outReal[rowIdx+today] = prevMA;
+/* Generated */             today++;
+/* Generated */          }
+/* Generated */          rowValue[r] = prevMA;
+/* Generated */          rowK[r] = k;
+/* Generated */       }
+/* Generated */       for( blockBeg=lockIdx+1; blockBeg <= endIdx; blockBeg += TA_MA_RIBBON_EMA_BLOCK )
+/* Generated */       {
+/* Generated */          blockEnd = blockBeg+TA_MA_RIBBON_EMA_BLOCK-1;
+/* Generated */          if( blockEnd > endIdx )
+/* Generated */             blockEnd = endIdx;
+/* Generated */          for( today=blockBeg, i=0; today <= blockEnd; today++, i += nbPeriod )
+/* Generated */          {
+/* Generated */             tempReal = inReal[today];
+/* Generated */             for( r=0; r < nbPeriod; r++ )
+/* Generated */             {
+/* Generated */                rowValue[r] = ((tempReal-rowValue[r])*rowK[r]) + rowValue[r];
+/* Generated */                emaBuffer[i+r] = rowValue[r];
+/* Generated */             }
+/* Generated */          }
+/* Generated */          for( r=0; r < nbPeriod; r++ )
+/* Generated */          {
+/* Generated */             if( (outNBElement[r] == 0) || (optInTimePeriods[r] == 1) )
+/* Generated */                continue;
+/* Generated */             rowIdx = r*stride-startIdx;
+/* Generated */             for( today=blockBeg, i=r; today <= blockEnd; today++, i += nbPeriod )
+/* Generated */                outReal[rowIdx+today] = emaBuffer[i];
+/* Generated */          }
+/* Generated */       }
+/* Generated */       ARRAY_FREE(rowValue);
+/* Generated */       ARRAY_FREE(rowK);
+/* Generated */       ARRAY_FREE(emaBuffer);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    default:
+/* Generated */       break;
+/* Generated */    }
+/* Generated */    ARRAY_ALLOC(localOutputArray,stride);
+/* Generated */    #if !defined( _JAVA )
+/* Generated */       if( !localOutputArray )
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */    #endif
+/* Generated */    for( r=0; r < nbPeriod; r++ )
+/* Generated */    {
+/* Generated */       if( (outNBElement[r] == 0) || (optInTimePeriods[r] == 1) )
+/* Generated */          continue;
+/* Generated */       retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
+/* Generated */                                    optInTimePeriods[r], optInMAType,
+/* Generated */                                    VALUE_HANDLE_OUT(localBegIdx), VALUE_HANDLE_OUT(localNbElement),
+/* Generated */                                    localOutputArray );
+/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */       {
+/* Generated */          ARRAY_FREE(localOutputArray);
+/* Generated */          return retCode;
+/* Generated */       }
+/* Generated */       rowIdx = r*stride+outBegIdx[r]-startIdx;
+/* Generated */       for( i=0; i < outNBElement[r]; i++ )
+/* Generated */          outReal[rowIdx+i] = localOutputArray[i];
+/* Generated */    }
+/* Generated */    ARRAY_FREE(localOutputArray);
+/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ }
+/* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
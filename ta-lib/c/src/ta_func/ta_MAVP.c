@@ -188,9 +188,11 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* insert local variable here */
-   int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
+   int i, j, lookbackTotal, outputSize, tempInt, curPeriod, lastIdx;
+   int usePrefixSum, prefixSize, blockSize, blockBeg, blockEnd, base, lo, hi;
    ARRAY_INT_REF(localPeriodArray);
    ARRAY_REF(localOutputArray);
+   ARRAY_REF(prefixSums);
    VALUE_HANDLE_INT(localBegIdx);
    VALUE_HANDLE_INT(localNbElement);
    ENUM_DECLARATION(RetCode) retCode;
@@ -272,65 +274,156 @@
    }   
    outputSize = endIdx - tempInt + 1;
 
+   /* The period is ignored by the MAMA, a single call does it all. */
+   if( optInMAType == ENUM_VALUE(MAType,TA_MAType_MAMA,Mama) )
+      return FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
+                                optInMaxPeriod, optInMAType,
+                                outBegIdx, outNBElement, outReal );
+
    /* Allocate intermediate local buffer. */
-   ARRAY_ALLOC(localOutputArray,outputSize);
    ARRAY_INT_ALLOC(localPeriodArray,outputSize);
 
    /* Copy caller array of period into local buffer.
     * At the same time, truncate to min/max.
-	*/
+    */
    for( i=0; i < outputSize; i++ )
    {
       tempInt = (int)(inPeriods[startIdx+i]);
-	  if( tempInt < optInMinPeriod )
-		  tempInt = optInMinPeriod;
-	  else if( tempInt > optInMaxPeriod )
-          tempInt = optInMaxPeriod;
+      if( tempInt < optInMinPeriod )
+         tempInt = optInMinPeriod;
+      else if( tempInt > optInMaxPeriod )
+         tempInt = optInMaxPeriod;
       localPeriodArray[i] = tempInt;
    }
 
+   /* The SMA, WMA and TRIMA are weighted sums over a window,
+    * they are evaluated for any period in O(1) from two
+    * prefix sums: the sum of the values and the sum of the
+    * values multiplied by their index (see TA_PREFIX_BUILD).
+    *
+    * In compensated precision, the MA is still done for
+    * each period (see below) to get the error bound of the
+    * compensated kernels.
+    */
+   switch( optInMAType )
+   {
+   case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+   case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+   case ENUM_CASE(MAType, TA_MAType_TRIMA, Trima):
+      usePrefixSum = TA_GLOBALS_PRECISION != ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated);
+      break;
+   default:
+      usePrefixSum = 0;
+   }
+
+   if( usePrefixSum )
+   {
+      blockSize = optInMaxPeriod > TA_PREFIX_BLOCK_SIZE? optInMaxPeriod : TA_PREFIX_BLOCK_SIZE;
+      prefixSize = blockSize+optInMaxPeriod+1;
+      ARRAY_ALLOC(prefixSums,4*prefixSize);
+      #if !defined( _JAVA )
+         if( !prefixSums )
+         {
+            ARRAY_INT_FREE(localPeriodArray);
+            VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+            VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+         }
+      #endif
+
+      /* The lookback guarantees startIdx >= optInMaxPeriod-1,
+       * so the first block reads from index 0 at the earliest.
+       * Each block reads all its inputs before writing its outputs,
+       * and the outputs written are behind the inputs of the next
+       * blocks, so outReal may be the same buffer as inReal.
+       */
+      for( blockBeg=startIdx; blockBeg <= endIdx; blockBeg += blockSize )
+      {
+         blockEnd = blockBeg+blockSize-1;
+         if( blockEnd > endIdx )
+            blockEnd = endIdx;
+
+         base = blockBeg-optInMaxPeriod;
+         TA_PREFIX_BUILD(prefixSums,prefixSize,inReal,base,blockEnd);
+
+         /* For each output, the window is (lo,hi]. */
+         for( i=blockBeg-startIdx; i <= blockEnd-startIdx; i++ )
+         {
+            hi = i+startIdx-base;
+            lo = hi-localPeriodArray[i];
+            switch( optInMAType )
+            {
+            case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+               TA_PREFIX_SMA(outReal[i],prefixSums,prefixSize,lo,hi);
+               break;
+            case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+               TA_PREFIX_WMA(outReal[i],prefixSums,prefixSize,lo,hi);
+               break;
+            default:
+               TA_PREFIX_TRIMA(outReal[i],prefixSums,prefixSize,lo,hi);
+            }
+         }
+      }
+
+      ARRAY_FREE(prefixSums);
+      ARRAY_INT_FREE(localPeriodArray);
+
+      VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+      VALUE_HANDLE_DEREF(outNBElement) = outputSize;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   ARRAY_ALLOC(localOutputArray,outputSize);
+
    /* Process each element of the input. 
     * For each possible period value, the MA is calculated 
-	* only once.
-	* The outReal is then fill up for all element with
-	* the same period.
-	* A local flag (value 0) is set in localPeriodArray
-	* to avoid doing a second time the same calculation.
-	*/   
+    * only once.
+    * The outReal is then fill up for all element with
+    * the same period.
+    * A local flag (value 0) is set in localPeriodArray
+    * to avoid doing a second time the same calculation.
+    *
+    * The other MA types are recursive, their value depends
+    * on where the calculation starts. The MA is always started
+    * at startIdx, but it is stopped at the last element using
+    * the period.
+    */
    for( i=0; i < outputSize; i++ )
    {
-	   curPeriod = localPeriodArray[i];
-	   if( curPeriod != 0 )
-	   {
-           /* TODO: This portion of the function can be slightly speed 
-            *       optimized by making the function without unstable period 
-	        *       start their calculation at 'startIdx+i' instead of startIdx.			
-	        */
+      curPeriod = localPeriodArray[i];
+      if( curPeriod != 0 )
+      {
+         lastIdx = i;
+         for( j=i+1; j < outputSize; j++ )
+         {
+            if( localPeriodArray[j] == curPeriod )
+               lastIdx = j;
+         }
+
+         /* Calculation of the MA required. */
+         retCode = FUNCTION_CALL(MA)( startIdx, startIdx+lastIdx, inReal,
+                                      curPeriod, optInMAType,
+                                      VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
 
-		   /* Calculation of the MA required. */
-		   retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
-			                            curPeriod, optInMAType,
-									    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+         if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+         {
+            ARRAY_FREE(localOutputArray);
+            ARRAY_INT_FREE(localPeriodArray);
+            VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+            VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+            return retCode;
+         }
 
-           if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-		   {
-              ARRAY_FREE(localOutputArray);
-			  ARRAY_INT_FREE(localPeriodArray);
-              VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-              VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-              return retCode;
-	       }
-		   
-		   outReal[i] = localOutputArray[i];
-		   for( j=i+1; j < outputSize; j++ )
-		   {
-			   if( localPeriodArray[j] == curPeriod )
-			   {
-				   localPeriodArray[j] = 0; /* Flag to avoid recalculation */
-				   outReal[j] = localOutputArray[j];
-			   }
-		   }		   
-	   }
+         outReal[i] = localOutputArray[i];
+         for( j=i+1; j <= lastIdx; j++ )
+         {
+            if( localPeriodArray[j] == curPeriod )
+            {
+               localPeriodArray[j] = 0; /* Flag to avoid recalculation */
+               outReal[j] = localOutputArray[j];
+            }
+         }
+      }
    }
 
    ARRAY_FREE(localOutputArray);
@@ -398,9 +491,11 @@
 /* Generated */                       double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
+/* Generated */    int i, j, lookbackTotal, outputSize, tempInt, curPeriod, lastIdx;
+/* Generated */    int usePrefixSum, prefixSize, blockSize, blockBeg, blockEnd, base, lo, hi;
 /* Generated */    ARRAY_INT_REF(localPeriodArray);
 /* Generated */    ARRAY_REF(localOutputArray);
+/* Generated */    ARRAY_REF(prefixSums);
 /* Generated */    VALUE_HANDLE_INT(localBegIdx);
 /* Generated */    VALUE_HANDLE_INT(localNbElement);
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -452,43 +547,107 @@
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);      
 /* Generated */    }   
 /* Generated */    outputSize = endIdx - tempInt + 1;
-/* Generated */    ARRAY_ALLOC(localOutputArray,outputSize);
+/* Generated */    if( optInMAType == ENUM_VALUE(MAType,TA_MAType_MAMA,Mama) )
+/* Generated */       return FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
+/* Generated */                                 optInMaxPeriod, optInMAType,
+/* Generated */                                 outBegIdx, outNBElement, outReal );
 /* Generated */    ARRAY_INT_ALLOC(localPeriodArray,outputSize);
 /* Generated */    for( i=0; i < outputSize; i++ )
 /* Generated */    {
 /* Generated */       tempInt = (int)(inPeriods[startIdx+i]);
-/* Generated */ 	  if( tempInt < optInMinPeriod )
-/* Generated */ 		  tempInt = optInMinPeriod;
-/* Generated */ 	  else if( tempInt > optInMaxPeriod )
-/* Generated */           tempInt = optInMaxPeriod;
+/* Generated */       if( tempInt < optInMinPeriod )
+/* Generated */          tempInt = optInMinPeriod;
+/* Generated */       else if( tempInt > optInMaxPeriod )
+/* Generated */          tempInt = optInMaxPeriod;
 /* Generated */       localPeriodArray[i] = tempInt;
 /* Generated */    }
+/* Generated */    switch( optInMAType )
+/* Generated */    {
+/* Generated */    case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+/* Generated */    case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+/* Generated */    case ENUM_CASE(MAType, TA_MAType_TRIMA, Trima):
+/* Generated */       usePrefixSum = TA_GLOBALS_PRECISION != ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated);
+/* Generated */       break;
+/* Generated */    default:
+/* Generated */       usePrefixSum = 0;
+/* Generated */    }
+/* Generated */    if( usePrefixSum )
+/* Generated */    {
+/* Generated */       blockSize = optInMaxPeriod > TA_PREFIX_BLOCK_SIZE? optInMaxPeriod : TA_PREFIX_BLOCK_SIZE;
+/* Generated */       prefixSize = blockSize+optInMaxPeriod+1;
+/* Generated */       ARRAY_ALLOC(prefixSums,4*prefixSize);
+/* Generated */       #if !defined( _JAVA )
+/* Generated */          if( !prefixSums )
+/* Generated */          {
+/* Generated */             ARRAY_INT_FREE(localPeriodArray);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */          }
+/* Generated */       #endif
+/* Generated */       for( blockBeg=startIdx; blockBeg <= endIdx; blockBeg += blockSize )
+/* Generated */       {
+/* Generated */          blockEnd = blockBeg+blockSize-1;
+/* Generated */          if( blockEnd > endIdx )
+/* Generated */             blockEnd = endIdx;
+/* Generated */          base = blockBeg-optInMaxPeriod;
+/* Generated */          TA_PREFIX_BUILD(prefixSums,prefixSize,inReal,base,blockEnd);
+/* Generated */          for( i=blockBeg-startIdx; i <= blockEnd-startIdx; i++ )
+/* Generated */          {
+/* Generated */             hi = i+startIdx-base;
+/* Generated */             lo = hi-localPeriodArray[i];
+/* Generated */             switch( optInMAType )
+/* Generated */             {
+/* Generated */             case ENUM_CASE(MAType, TA_MAType_SMA, Sma):
+/* Generated */                TA_PREFIX_SMA(outReal[i],prefixSums,prefixSize,lo,hi);
+/* Generated */                break;
+/* Generated */             case ENUM_CASE(MAType, TA_MAType_WMA, Wma):
+/* Generated */                TA_PREFIX_WMA(outReal[i],prefixSums,prefixSize,lo,hi);
+/* Generated */                break;
+/* Generated */             default:
+/* Generated */                TA_PREFIX_TRIMA(outReal[i],prefixSums,prefixSize,lo,hi);
+/* Generated */             }
+/* Generated */          }
+/* Generated */       }
+/* Generated */       ARRAY_FREE(prefixSums);
+/* Generated */       ARRAY_INT_FREE(localPeriodArray);
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = outputSize;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    ARRAY_ALLOC(localOutputArray,outputSize);
 /* Generated */    for( i=0; i < outputSize; i++ )
 /* Generated */    {
-/* Generated */ 	   curPeriod = localPeriodArray[i];
-/* Generated */ 	   if( curPeriod != 0 )
-/* Generated */ 	   {
-/* Generated */ 		   retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
-/* Generated */ 			                            curPeriod, optInMAType,
-/* Generated */ 									    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
-/* Generated */            if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-/* Generated */ 		   {
-/* Generated */               ARRAY_FREE(localOutputArray);
-/* Generated */ 			  ARRAY_INT_FREE(localPeriodArray);
-/* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */               return retCode;
-/* Generated */ 	       }
-/* Generated */ 		   outReal[i] = localOutputArray[i];
-/* Generated */ 		   for( j=i+1; j < outputSize; j++ )
-/* Generated */ 		   {
-/* Generated */ 			   if( localPeriodArray[j] == curPeriod )
-/* Generated */ 			   {
-/* Generated */ 				   localPeriodArray[j] = 0; 
-/* Generated */ 				   outReal[j] = localOutputArray[j];
-/* Generated */ 			   }
-/* Generated */ 		   }		   
-/* Generated */ 	   }
+/* Generated */       curPeriod = localPeriodArray[i];
+/* Generated */       if( curPeriod != 0 )
+/* Generated */       {
+/* Generated */          lastIdx = i;
+/* Generated */          for( j=i+1; j < outputSize; j++ )
+/* Generated */          {
+/* Generated */             if( localPeriodArray[j] == curPeriod )
+/* Generated */                lastIdx = j;
+/* Generated */          }
+/* Generated */          retCode = FUNCTION_CALL(MA)( startIdx, startIdx+lastIdx, inReal,
+/* Generated */                                       curPeriod, optInMAType,
+/* Generated */                                       VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+/* Generated */          if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */          {
+/* Generated */             ARRAY_FREE(localOutputArray);
+/* Generated */             ARRAY_INT_FREE(localPeriodArray);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */             return retCode;
+/* Generated */          }
+/* Generated */          outReal[i] = localOutputArray[i];
+/* Generated */          for( j=i+1; j <= lastIdx; j++ )
+/* Generated */          {
+/* Generated */             if( localPeriodArray[j] == curPeriod )
+/* Generated */             {
+/* Generated */                localPeriodArray[j] = 0; 
+/* Generated */                outReal[j] = localOutputArray[j];
+/* Generated */             }
+/* Generated */          }
+/* Generated */       }
 /* Generated */    }
 /* Generated */    ARRAY_FREE(localOutputArray);
 /* Generated */    ARRAY_INT_FREE(localPeriodArray);
@@ -231,7 +231,7 @@ TA_RetCode TA_PREFIX(INT_SMA)( int    startIdx,
                                double  *outReal )
 #endif
 {
-   double periodTotal, tempReal;
+   double periodTotal, periodComp, tempReal;
    int i, outIdx, trailingIdx, lookbackTotal;
 
    /* Identify the minimum number of price bar needed
@@ -257,26 +257,44 @@ TA_RetCode TA_PREFIX(INT_SMA)( int    startIdx,
    /* Add-up the initial period, except for the last value. */
    periodTotal = 0;
    trailingIdx = startIdx-lookbackTotal;
-   
+   outIdx = 0;
    i=trailingIdx;
-   if( optInTimePeriod > 1 )
+
+   if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
    {
+      /* Same as below with compensated sums, see TA_SetPrecision. */
+      periodComp = 0.0;
       while( i < startIdx )
-         periodTotal += inReal[i++];
-   }
+         TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
 
-   /* Proceed with the calculation for the requested range.
-    * Note that this algorithm allows the inReal and
-    * outReal to be the same buffer.
-    */
-   outIdx = 0;
-   do
+      do
+      {
+         TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
+         tempReal = periodTotal+periodComp;
+         TA_COMPENSATED_ADD( periodTotal, periodComp, -inReal[trailingIdx++] );
+         outReal[outIdx++] = tempReal / optInTimePeriod;
+      } while( i <= endIdx );
+   }
+   else
    {
-      periodTotal += inReal[i++];
-      tempReal = periodTotal;
-      periodTotal -= inReal[trailingIdx++];
-      outReal[outIdx++] = tempReal / optInTimePeriod;
-   } while( i <= endIdx );
+      if( optInTimePeriod > 1 )
+      {
+         while( i < startIdx )
+            periodTotal += inReal[i++];
+      }
+
+      /* Proceed with the calculation for the requested range.
+       * Note that this algorithm allows the inReal and
+       * outReal to be the same buffer.
+       */
+      do
+      {
+         periodTotal += inReal[i++];
+         tempReal = periodTotal;
+         periodTotal -= inReal[trailingIdx++];
+         outReal[outIdx++] = tempReal / optInTimePeriod;
+      } while( i <= endIdx );
+   }
 
    /* All done. Indicate the output limits and return. */
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
@@ -389,7 +407,7 @@ TA_RetCode TA_PREFIX(INT_SMA)( int    startIdx,
 /* Generated */                                double  *outReal )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    double periodTotal, tempReal;
+/* Generated */    double periodTotal, periodComp, tempReal;
 /* Generated */    int i, outIdx, trailingIdx, lookbackTotal;
 /* Generated */    lookbackTotal = (optInTimePeriod-1);
 /* Generated */    if( startIdx < lookbackTotal )
@@ -402,20 +420,36 @@ TA_RetCode TA_PREFIX(INT_SMA)( int    startIdx,
 /* Generated */    }
 /* Generated */    periodTotal = 0;
 /* Generated */    trailingIdx = startIdx-lookbackTotal;
+/* Generated */    outIdx = 0;
 /* Generated */    i=trailingIdx;
-/* Generated */    if( optInTimePeriod > 1 )
+/* Generated */    if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
 /* Generated */    {
+/* Generated */       periodComp = 0.0;
 /* Generated */       while( i < startIdx )
-/* Generated */          periodTotal += inReal[i++];
+/* Generated */          TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
+/* Generated */       do
+/* Generated */       {
+/* Generated */          TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
+/* Generated */          tempReal = periodTotal+periodComp;
+/* Generated */          TA_COMPENSATED_ADD( periodTotal, periodComp, -inReal[trailingIdx++] );
+/* Generated */          outReal[outIdx++] = tempReal / optInTimePeriod;
+/* Generated */       } while( i <= endIdx );
 /* Generated */    }
-/* Generated */    outIdx = 0;
-/* Generated */    do
+/* Generated */    else
 /* Generated */    {
-/* Generated */       periodTotal += inReal[i++];
-/* Generated */       tempReal = periodTotal;
-/* Generated */       periodTotal -= inReal[trailingIdx++];
-/* Generated */       outReal[outIdx++] = tempReal / optInTimePeriod;
-/* Generated */    } while( i <= endIdx );
+/* Generated */       if( optInTimePeriod > 1 )
+/* Generated */       {
+/* Generated */          while( i < startIdx )
+/* Generated */             periodTotal += inReal[i++];
+/* Generated */       }
+/* Generated */       do
+/* Generated */       {
+/* Generated */          periodTotal += inReal[i++];
+/* Generated */          tempReal = periodTotal;
+/* Generated */          periodTotal -= inReal[trailingIdx++];
+/* Generated */          outReal[outIdx++] = tempReal / optInTimePeriod;
+/* Generated */       } while( i <= endIdx );
+/* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -271,6 +271,10 @@
  *       is optimized considering it uses always a simple moving
  *       average. Still the function is put here because it is 
  *       closely related.
+ *
+ *       It is not used by TA_BBANDS anymore either, the sum of
+ *       the squares loses the precision when the values are large
+ *       compared to their spread. See TA_MOMENTS_REPLACE.
  */
 #if defined( _MANAGED ) && defined( USE_SUBARRAY )
 void Core::TA_INT_stddev_using_precalc_ma( SubArray<double>^ inReal,
@@ -244,15 +244,6 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* Insert local variables here. */
-   ENUM_DECLARATION(RetCode) retCode;
-   double lowest, highest, tmp, diff;
-   ARRAY_REF( tempBuffer );
-   int outIdx, lowestIdx, highestIdx;
-   int lookbackTotal, lookbackK, lookbackKSlow, lookbackDSlow;
-   int trailingIdx, today, i;
-   #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) &&!defined(_JAVA)
-   int bufferIsAllocated;
-   #endif
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -347,11 +338,104 @@
     * used because its higher volatility cause often whipsaws.
     */
 
+   /* The %K and the two MA are evaluated in a single pass by
+    * TA_INT_STOCH, see below.
+    */
+   return FUNCTION_CALL(INT_STOCH)( startIdx, endIdx, inHigh, inLow, inClose,
+                                    0, optInFastK_Period,
+                                    optInSlowK_Period, optInSlowK_MAType,
+                                    optInSlowD_Period, optInSlowD_MAType,
+                                    outBegIdx, outNBElement, outSlowK, outSlowD );
+}
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+  // No INT function
+#else
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+enum class Core::RetCode Core::TA_INT_STOCH( int    startIdx,
+                                             int    endIdx,
+                                             SubArray<double>^ inHigh,
+                                             SubArray<double>^ inLow,
+                                             SubArray<double>^ inClose,
+                                             int    optInRSIPeriod,
+                                             int    optInFastK_Period,
+                                             int    optInSlowK_Period,
+                                             MAType optInSlowK_MAType,
+                                             int    optInSlowD_Period,
+                                             MAType optInSlowD_MAType,
+                                             [Out]int% outBegIdx,
+                                             [Out]int% outNBElement,
+                                             SubArray<double>^ outSlowK,
+                                             SubArray<double>^ outSlowD )
+#elif defined( _MANAGED )
+enum class Core::RetCode Core::TA_INT_STOCH( int    startIdx,
+                                             int    endIdx,
+                                             cli::array<INPUT_TYPE>^ inHigh,
+                                             cli::array<INPUT_TYPE>^ inLow,
+                                             cli::array<INPUT_TYPE>^ inClose,
+                                             int    optInRSIPeriod,
+                                             int    optInFastK_Period,
+                                             int    optInSlowK_Period,
+                                             MAType optInSlowK_MAType,
+                                             int    optInSlowD_Period,
+                                             MAType optInSlowD_MAType,
+                                             [Out]int% outBegIdx,
+                                             [Out]int% outNBElement,
+                                             cli::array<double>^ outSlowK,
+                                             cli::array<double>^ outSlowD )
+#elif defined( _JAVA )
+public RetCode TA_INT_STOCH( int        startIdx,
+                             int        endIdx,
+                             INPUT_TYPE inHigh[],
+                             INPUT_TYPE inLow[],
+                             INPUT_TYPE inClose[],
+                             int        optInRSIPeriod,
+                             int        optInFastK_Period,
+                             int        optInSlowK_Period,
+                             MAType     optInSlowK_MAType,
+                             int        optInSlowD_Period,
+                             MAType     optInSlowD_MAType,
+                             MInteger   outBegIdx,
+                             MInteger   outNBElement,
+                             double     outSlowK[],
+                             double     outSlowD[] )
+#else
+TA_RetCode TA_PREFIX(INT_STOCH)( int    startIdx,
+                                 int    endIdx,
+                                 const INPUT_TYPE *inHigh,
+                                 const INPUT_TYPE *inLow,
+                                 const INPUT_TYPE *inClose,
+                                 int    optInRSIPeriod, /* 0 or from 2 to 100000 */
+                                 int    optInFastK_Period, /* From 1 to 100000 */
+                                 int    optInSlowK_Period, /* From 1 to 100000 */
+                                 TA_MAType optInSlowK_MAType,
+                                 int    optInSlowD_Period, /* From 1 to 100000 */
+                                 TA_MAType optInSlowD_MAType,
+                                 int   *outBegIdx,
+                                 int   *outNBElement,
+                                 double *outSlowK,
+                                 double *outSlowD )
+#endif
+{
+   ENUM_DECLARATION(RetCode) retCode;
+   ARRAY_REF( tempBuffer );
+   ARRAY_REF( window );
+   ARRAY_LOCAL( localWindow, 4*TA_STOCH_LOCAL_SIZE+2 );
+   double high, low, close, highest, lowest, diff, fastK, slowK, slowD;
+   double kSum, kComp, dSum, dComp, prevValue, prevGain, prevLoss, firstRSI;
+   double tempValue1, tempValue2;
+   int lookbackTotal, lookbackRSI, lookbackK, lookbackKSlow, lookbackDSlow;
+   int kKind, dKind, kCount, dCount, kRingIdx, dRingIdx, isCompensated;
+   int blockIdx, kBegIdx, rsiIdx;
+   int today, outIdx, i;
+
    /* Identify the lookback needed. */
+   lookbackRSI    = optInRSIPeriod > 0 ? LOOKBACK_CALL(RSI)( optInRSIPeriod ) : 0;
    lookbackK      = optInFastK_Period-1;
    lookbackKSlow  = LOOKBACK_CALL(MA)( optInSlowK_Period, optInSlowK_MAType );
    lookbackDSlow  = LOOKBACK_CALL(MA)( optInSlowD_Period, optInSlowD_MAType );
-   lookbackTotal  = lookbackK + lookbackDSlow + lookbackKSlow;
+   lookbackTotal  = lookbackRSI + lookbackK + lookbackKSlow + lookbackDSlow;
 
    /* Move up the start index if there is not
     * enough initial data.
@@ -368,194 +452,256 @@
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
-   /* Do the K calculation:
-    *
-    *    Kt = 100 x ((Ct-Lt)/(Ht-Lt))
-    *
-    * Kt is today stochastic
-    * Ct is today closing price.
-    * Lt is the lowest price of the last K Period (including today)
-    * Ht is the highest price of the last K Period (including today)
-    */
+   /* The first bar of the raw K. */
+   kBegIdx = startIdx-lookbackKSlow-lookbackDSlow;
 
-   /* Proceed with the calculation for the requested range.
-    * Note that this algorithm allows the input and
-    * output to be the same buffer.
-    */
-   outIdx = 0;
+   /* Which MA can be applied in the same pass as the K. */
+   if( optInSlowK_Period == 1 )
+      kKind = TA_STOCH_STAGE_COPY;
+   else if( optInSlowK_MAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
+      kKind = TA_STOCH_STAGE_SMA;
+   else if( optInSlowK_MAType == ENUM_VALUE(MAType,TA_MAType_EMA,Ema) )
+      kKind = TA_STOCH_STAGE_EMA;
+   else
+      kKind = TA_STOCH_STAGE_NONE;
 
-   /* Calculate just enough K for ending up with the caller 
-    * requested range. (The range of k must consider all
-    * the lookback involve with the smoothing).
-    */
-   trailingIdx = startIdx-lookbackTotal;
-   today       = trailingIdx+lookbackK;
-   lowestIdx   = highestIdx = -1;
-   diff = highest = lowest  = 0.0;
+   if( optInSlowD_Period == 1 )
+      dKind = TA_STOCH_STAGE_COPY;
+   else if( optInSlowD_MAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
+      dKind = TA_STOCH_STAGE_SMA;
+   else if( optInSlowD_MAType == ENUM_VALUE(MAType,TA_MAType_EMA,Ema) )
+      dKind = TA_STOCH_STAGE_EMA;
+   else
+      dKind = TA_STOCH_STAGE_NONE;
 
-   /* Allocate a temporary buffer large enough to
-    * store the K.
-    *
-    * If the output is the same as the input, great
-    * we just save ourself one memory allocation.
-    */
-   #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
-      bufferIsAllocated = 0;
-   #endif
-
-   #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-      /* Always alloc, since output is of different type and
-       * its allocated size is not guarantee to be as large as
-       * the input.
+   if( (kKind == TA_STOCH_STAGE_NONE) || (dKind == TA_STOCH_STAGE_NONE) )
+   {
+      /* Buffer the raw K, and smooth it with TA_MA as done
+       * before the MA were applied in the same pass.
        */
-      ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
-   #else
-      if( (outSlowK == inHigh) || 
-          (outSlowK == inLow)  || 
-          (outSlowK == inClose) )
+      ARRAY_ALLOC( tempBuffer, endIdx-kBegIdx+1 );
+      #if !defined( _JAVA )
+         if( !tempBuffer )
+         {
+            VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+            VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+         }
+      #endif
+
+      retCode = FUNCTION_CALL(INT_STOCH)( kBegIdx, endIdx, inHigh, inLow, inClose,
+                                          optInRSIPeriod, optInFastK_Period,
+                                          1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+                                          1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+                                          outBegIdx, outNBElement, tempBuffer, tempBuffer );
+
+      if( retCode == ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+         retCode = FUNCTION_CALL_DOUBLE(MA)( 0, (int)VALUE_HANDLE_DEREF(outNBElement)-1,
+                                             tempBuffer, optInSlowK_Period,
+                                             optInSlowK_MAType,
+                                             outBegIdx, outNBElement, tempBuffer );
+
+      if( retCode == ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+         retCode = FUNCTION_CALL_DOUBLE(MA)( 0, (int)VALUE_HANDLE_DEREF(outNBElement)-1,
+                                             tempBuffer, optInSlowD_Period,
+                                             optInSlowD_MAType,
+                                             outBegIdx, outNBElement, outSlowD );
+
+      if( retCode == ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+         ARRAY_MEMMOVE( outSlowK, 0, tempBuffer, lookbackDSlow, (int)VALUE_HANDLE_DEREF(outNBElement) );
+
+      ARRAY_FREE( tempBuffer );
+
+      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+      {
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return retCode;
+      }
+
+      VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* The high and low of the K window, and the rings of the SMA. */
+   if( (optInFastK_Period <= TA_STOCH_LOCAL_SIZE) &&
+       (optInSlowK_Period <= TA_STOCH_LOCAL_SIZE) &&
+       (optInSlowD_Period <= TA_STOCH_LOCAL_SIZE) )
+      window = localWindow;
+   else
+   {
+      ARRAY_ALLOC( window, 2*optInFastK_Period+2+optInSlowK_Period+optInSlowD_Period );
+      #if !defined( _JAVA )
+         if( !window )
+         {
+            VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+            VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+         }
+      #endif
+   }
+
+   /* The RSI, from the same price bar as TA_RSI would start
+    * from in TA_STOCHRSI. 'rsiIdx' is the last price bar
+    * included in prevGain and prevLoss. Metastock adds a first
+    * RSI where the first bar has no gain or loss, this first
+    * RSI is the one before 'rsiIdx'.
+    */
+   today = startIdx-lookbackTotal;
+   prevValue = prevGain = prevLoss = firstRSI = 0.0;
+   rsiIdx = today-1;
+   if( optInRSIPeriod > 0 )
+   {
+      prevValue = inClose[today];
+      if( (TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi) == 0) &&
+          (TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_METASTOCK,Metastock)) )
       {
-         tempBuffer = outSlowK;
+         for( i=0; i < optInRSIPeriod; i++ )
+         {
+            tempValue1 = inClose[today+i];
+            tempValue2 = tempValue1 - prevValue;
+            prevValue  = tempValue1;
+            if( tempValue2 < 0 )
+               prevLoss -= tempValue2;
+            else
+               prevGain += tempValue2;
+         }
+         tempValue1 = prevLoss/optInRSIPeriod;
+         tempValue2 = prevGain/optInRSIPeriod;
+         tempValue1 = tempValue2+tempValue1;
+         if( !TA_IS_ZERO(tempValue1) )
+            firstRSI = 100*(tempValue2/tempValue1);
+         prevValue = inClose[today];
+         prevGain = 0.0;
+         prevLoss = 0.0;
       }
-      else if( (outSlowD == inHigh) ||
-               (outSlowD == inLow)  ||
-               (outSlowD == inClose) )
+
+      for( i=1; i <= optInRSIPeriod; i++ )
       {
-         tempBuffer = outSlowD;
+         tempValue1 = inClose[today+i];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
       }
-      else
+      prevLoss /= optInRSIPeriod;
+      prevGain /= optInRSIPeriod;
+      rsiIdx = today+optInRSIPeriod;
+
+      /* Skip the unstable period. */
+      today += lookbackRSI;
+      while( rsiIdx < today-1 )
       {
-         #if !defined( _MANAGED ) && !defined(_JAVA)
-            bufferIsAllocated = 1;
-         #endif
-         ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+         tempValue1 = inClose[++rsiIdx];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+         prevLoss *= (optInRSIPeriod-1);
+         prevGain *= (optInRSIPeriod-1);
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+         prevLoss /= optInRSIPeriod;
+         prevGain /= optInRSIPeriod;
       }
-   #endif
+   }
 
-   /* Do the K calculation */
+   /* Proceed with the calculation for the requested range.
+    * The values of the K window are in the rings, so the
+    * input and the output can be the same buffer.
+    */
+   isCompensated = TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated);
+   blockIdx = 0;
+   highest = lowest = 0.0;
+   kCount = dCount = kRingIdx = dRingIdx = 0;
+   kSum = kComp = dSum = dComp = 0.0;
+   slowK = slowD = 0.0;
+   outIdx = 0;
    while( today <= endIdx )
    {
-      /* Set the lowest low */
-      tmp = inLow[today];
-      if( lowestIdx < trailingIdx )
+      if( optInRSIPeriod > 0 )
       {
-         lowestIdx = trailingIdx;
-         lowest = inLow[lowestIdx];
-         i = lowestIdx;
-         while( ++i<=today )
+         if( today > rsiIdx )
          {
-            tmp = inLow[i];
-            if( tmp < lowest )
-            {
-               lowestIdx = i;
-               lowest = tmp;
-            }
+            tempValue1 = inClose[today];
+            tempValue2 = tempValue1 - prevValue;
+            prevValue  = tempValue1;
+            prevLoss *= (optInRSIPeriod-1);
+            prevGain *= (optInRSIPeriod-1);
+            if( tempValue2 < 0 )
+               prevLoss -= tempValue2;
+            else
+               prevGain += tempValue2;
+            prevLoss /= optInRSIPeriod;
+            prevGain /= optInRSIPeriod;
+            rsiIdx = today;
          }
-         diff = (highest - lowest)/100.0;
-      }
-      else if( tmp <= lowest )
-      {
-         lowestIdx = today;
-         lowest = tmp;
-         diff = (highest - lowest)/100.0;
-      }
 
-      /* Set the highest high */
-      tmp = inHigh[today];
-      if( highestIdx < trailingIdx )
-      {
-         highestIdx = trailingIdx;
-         highest = inHigh[highestIdx];
-         i = highestIdx;
-         while( ++i<=today )
+         if( today < rsiIdx )
+            close = firstRSI;
+         else
          {
-            tmp = inHigh[i];
-            if( tmp > highest )
-            {
-               highestIdx = i;
-               highest = tmp;
-            }
+            tempValue1 = prevGain+prevLoss;
+            if( !TA_IS_ZERO(tempValue1) )
+               close = 100.0*(prevGain/tempValue1);
+            else
+               close = 0.0;
          }
-         diff = (highest - lowest)/100.0;
+         high = low = close;
       }
-      else if( tmp >= highest )
+      else
+      {
+         high  = inHigh[today];
+         low   = inLow[today];
+         close = inClose[today];
+      }
+
+      TA_WINDOW_PUSH( window, highest, blockIdx, optInFastK_Period, high, > );
+      TA_WINDOW_PUSH( &window[optInFastK_Period+1], lowest, blockIdx, optInFastK_Period, low, < );
+      high = TA_WINDOW_GET( window, highest, blockIdx, > );
+      low  = TA_WINDOW_GET( &window[optInFastK_Period+1], lowest, blockIdx, < );
+      if( ++blockIdx == optInFastK_Period )
       {
-         highestIdx = today;
-         highest = tmp;
-         diff = (highest - lowest)/100.0;
+         TA_WINDOW_END_BLOCK( window, optInFastK_Period, > );
+         TA_WINDOW_END_BLOCK( &window[optInFastK_Period+1], optInFastK_Period, < );
+         blockIdx = 0;
       }
 
-      /* Calculate stochastic. */
+      if( today++ < kBegIdx )
+         continue;
+
+      /* Kt = 100 x ((Ct-Lt)/(Ht-Lt)) */
+      diff = (high-low)/100.0;
       if( diff != 0.0 )
-        tempBuffer[outIdx++] = (inClose[today]-lowest)/diff;
+         fastK = (close-low)/diff;
       else
-        tempBuffer[outIdx++] = 0.0;
-
-      trailingIdx++;
-      today++; 
-   }
+         fastK = 0.0;
 
-   /* Un-smoothed K calculation completed. This K calculation is not returned
-    * to the caller. It is always smoothed and then return.
-    * Some documentation will refer to the smoothed version as being 
-    * "K-Slow", but often this end up to be shorten to "K".
-    */
-   retCode = FUNCTION_CALL_DOUBLE(MA)( 0, outIdx-1,
-                                       tempBuffer, optInSlowK_Period,
-                                       optInSlowK_MAType, 
-                                       outBegIdx, outNBElement, tempBuffer );
+      TA_STOCH_STAGE_FEED( kKind, slowK, kSum, kComp, &window[2*optInFastK_Period+2], kRingIdx,
+                           kCount, fastK, optInSlowK_Period, PER_TO_K(optInSlowK_Period), isCompensated );
+      if( kCount <= lookbackKSlow )
+         continue;
 
+      TA_STOCH_STAGE_FEED( dKind, slowD, dSum, dComp, &window[2*optInFastK_Period+2+optInSlowK_Period], dRingIdx,
+                           dCount, slowK, optInSlowD_Period, PER_TO_K(optInSlowD_Period), isCompensated );
+      if( dCount <= lookbackDSlow )
+         continue;
 
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || ((int)VALUE_HANDLE_DEREF(outNBElement) == 0) )
-   {
-      #if defined(USE_SINGLE_PRECISION_INPUT)
-         ARRAY_FREE( tempBuffer ); 
-      #else
-         ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-      #endif
-      /* Something wrong happen? No further data? */
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return retCode; 
+      outSlowK[outIdx] = slowK;
+      outSlowD[outIdx++] = slowD;
    }
 
-   /* Calculate the %D which is simply a moving average of
-    * the already smoothed %K.
-    */
-   retCode = FUNCTION_CALL_DOUBLE(MA)( 0, (int)VALUE_HANDLE_DEREF(outNBElement)-1,
-                                       tempBuffer, optInSlowD_Period,
-                                       optInSlowD_MAType,
-                                       outBegIdx, outNBElement, outSlowD );
-
-   /* Copy tempBuffer into the caller buffer. 
-    * (Calculation could not be done directly in the
-    *  caller buffer because more input data then the
-    *  requested range was needed for doing %D).
-    */
-   ARRAY_MEMMOVE( outSlowK, 0, tempBuffer,lookbackDSlow,(int)VALUE_HANDLE_DEREF(outNBElement));
-
-   /* Don't need K anymore, free it if it was allocated here. */
-   #if defined(USE_SINGLE_PRECISION_INPUT)
-      ARRAY_FREE( tempBuffer ); 
-   #else
-      ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-   #endif
-
-   if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-   {
-      /* Something wrong happen while processing %D? */
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return retCode;
-   }
+   if( window != localWindow )
+      ARRAY_FREE( window );
 
-   /* Note: Keep the outBegIdx relative to the
-    *       caller input before returning.
-    */
    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
-
+#endif
 
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -629,15 +775,6 @@
 /* Generated */                        double        outSlowD[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    ENUM_DECLARATION(RetCode) retCode;
-/* Generated */    double lowest, highest, tmp, diff;
-/* Generated */    ARRAY_REF( tempBuffer );
-/* Generated */    int outIdx, lowestIdx, highestIdx;
-/* Generated */    int lookbackTotal, lookbackK, lookbackKSlow, lookbackDSlow;
-/* Generated */    int trailingIdx, today, i;
-/* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) &&!defined(_JAVA)
-/* Generated */    int bufferIsAllocated;
-/* Generated */    #endif
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -678,10 +815,97 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
+/* Generated */    return FUNCTION_CALL(INT_STOCH)( startIdx, endIdx, inHigh, inLow, inClose,
+/* Generated */                                     0, optInFastK_Period,
+/* Generated */                                     optInSlowK_Period, optInSlowK_MAType,
+/* Generated */                                     optInSlowD_Period, optInSlowD_MAType,
+/* Generated */                                     outBegIdx, outNBElement, outSlowK, outSlowD );
+/* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */   // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::TA_INT_STOCH( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              SubArray<double>^ inHigh,
+/* Generated */                                              SubArray<double>^ inLow,
+/* Generated */                                              SubArray<double>^ inClose,
+/* Generated */                                              int    optInRSIPeriod,
+/* Generated */                                              int    optInFastK_Period,
+/* Generated */                                              int    optInSlowK_Period,
+/* Generated */                                              MAType optInSlowK_MAType,
+/* Generated */                                              int    optInSlowD_Period,
+/* Generated */                                              MAType optInSlowD_MAType,
+/* Generated */                                              [Out]int% outBegIdx,
+/* Generated */                                              [Out]int% outNBElement,
+/* Generated */                                              SubArray<double>^ outSlowK,
+/* Generated */                                              SubArray<double>^ outSlowD )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::TA_INT_STOCH( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              cli::array<INPUT_TYPE>^ inHigh,
+/* Generated */                                              cli::array<INPUT_TYPE>^ inLow,
+/* Generated */                                              cli::array<INPUT_TYPE>^ inClose,
+/* Generated */                                              int    optInRSIPeriod,
+/* Generated */                                              int    optInFastK_Period,
+/* Generated */                                              int    optInSlowK_Period,
+/* Generated */                                              MAType optInSlowK_MAType,
+/* Generated */                                              int    optInSlowD_Period,
+/* Generated */                                              MAType optInSlowD_MAType,
+/* Generated */                                              [Out]int% outBegIdx,
+/* Generated */                                              [Out]int% outNBElement,
+/* Generated */                                              cli::array<double>^ outSlowK,
+/* Generated */                                              cli::array<double>^ outSlowD )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode TA_INT_STOCH( int        startIdx,
+/* Generated */                              int        endIdx,
+/* Generated */                              INPUT_TYPE inHigh[],
+/* Generated */                              INPUT_TYPE inLow[],
+/* Generated */                              INPUT_TYPE inClose[],
+/* Generated */                              int        optInRSIPeriod,
+/* Generated */                              int        optInFastK_Period,
+/* Generated */                              int        optInSlowK_Period,
+/* Generated */                              MAType     optInSlowK_MAType,
+/* Generated */                              int        optInSlowD_Period,
+/* Generated */                              MAType     optInSlowD_MAType,
+/* Generated */                              MInteger   outBegIdx,
+/* Generated */                              MInteger   outNBElement,
+/* Generated */                              double     outSlowK[],
+/* Generated */                              double     outSlowD[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_STOCH)( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                  const INPUT_TYPE *inHigh,
+/* Generated */                                  const INPUT_TYPE *inLow,
+/* Generated */                                  const INPUT_TYPE *inClose,
+/* Generated */                                  int    optInRSIPeriod, 
+/* Generated */                                  int    optInFastK_Period, 
+/* Generated */                                  int    optInSlowK_Period, 
+/* Generated */                                  TA_MAType optInSlowK_MAType,
+/* Generated */                                  int    optInSlowD_Period, 
+/* Generated */                                  TA_MAType optInSlowD_MAType,
+/* Generated */                                  int   *outBegIdx,
+/* Generated */                                  int   *outNBElement,
+/* Generated */                                  double *outSlowK,
+/* Generated */                                  double *outSlowD )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    ENUM_DECLARATION(RetCode) retCode;
+/* Generated */    ARRAY_REF( tempBuffer );
+/* Generated */    ARRAY_REF( window );
+/* Generated */    ARRAY_LOCAL( localWindow, 4*TA_STOCH_LOCAL_SIZE+2 );
+/* Generated */    double high, low, close, highest, lowest, diff, fastK, slowK, slowD;
+/* Generated */    double kSum, kComp, dSum, dComp, prevValue, prevGain, prevLoss, firstRSI;
+/* Generated */    double tempValue1, tempValue2;
+/* Generated */    int lookbackTotal, lookbackRSI, lookbackK, lookbackKSlow, lookbackDSlow;
+/* Generated */    int kKind, dKind, kCount, dCount, kRingIdx, dRingIdx, isCompensated;
+/* Generated */    int blockIdx, kBegIdx, rsiIdx;
+/* Generated */    int today, outIdx, i;
+/* Generated */    lookbackRSI    = optInRSIPeriod > 0 ? LOOKBACK_CALL(RSI)( optInRSIPeriod ) : 0;
 /* Generated */    lookbackK      = optInFastK_Period-1;
 /* Generated */    lookbackKSlow  = LOOKBACK_CALL(MA)( optInSlowK_Period, optInSlowK_MAType );
 /* Generated */    lookbackDSlow  = LOOKBACK_CALL(MA)( optInSlowD_Period, optInSlowD_MAType );
-/* Generated */    lookbackTotal  = lookbackK + lookbackDSlow + lookbackKSlow;
+/* Generated */    lookbackTotal  = lookbackRSI + lookbackK + lookbackKSlow + lookbackDSlow;
 /* Generated */    if( startIdx < lookbackTotal )
 /* Generated */       startIdx = lookbackTotal;
 /* Generated */    if( startIdx > endIdx )
@@ -690,126 +914,213 @@
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
-/* Generated */    outIdx = 0;
-/* Generated */    trailingIdx = startIdx-lookbackTotal;
-/* Generated */    today       = trailingIdx+lookbackK;
-/* Generated */    lowestIdx   = highestIdx = -1;
-/* Generated */    diff = highest = lowest  = 0.0;
-/* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
-/* Generated */       bufferIsAllocated = 0;
-/* Generated */    #endif
-/* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-/* Generated */       ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
-/* Generated */    #else
-/* Generated */       if( (outSlowK == inHigh) || 
-/* Generated */           (outSlowK == inLow)  || 
-/* Generated */           (outSlowK == inClose) )
+/* Generated */    kBegIdx = startIdx-lookbackKSlow-lookbackDSlow;
+/* Generated */    if( optInSlowK_Period == 1 )
+/* Generated */       kKind = TA_STOCH_STAGE_COPY;
+/* Generated */    else if( optInSlowK_MAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
+/* Generated */       kKind = TA_STOCH_STAGE_SMA;
+/* Generated */    else if( optInSlowK_MAType == ENUM_VALUE(MAType,TA_MAType_EMA,Ema) )
+/* Generated */       kKind = TA_STOCH_STAGE_EMA;
+/* Generated */    else
+/* Generated */       kKind = TA_STOCH_STAGE_NONE;
+/* Generated */    if( optInSlowD_Period == 1 )
+/* Generated */       dKind = TA_STOCH_STAGE_COPY;
+/* Generated */    else if( optInSlowD_MAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
+/* Generated */       dKind = TA_STOCH_STAGE_SMA;
+/* Generated */    else if( optInSlowD_MAType == ENUM_VALUE(MAType,TA_MAType_EMA,Ema) )
+/* Generated */       dKind = TA_STOCH_STAGE_EMA;
+/* Generated */    else
+/* Generated */       dKind = TA_STOCH_STAGE_NONE;
+/* Generated */    if( (kKind == TA_STOCH_STAGE_NONE) || (dKind == TA_STOCH_STAGE_NONE) )
+/* Generated */    {
+/* Generated */       ARRAY_ALLOC( tempBuffer, endIdx-kBegIdx+1 );
+/* Generated */       #if !defined( _JAVA )
+/* Generated */          if( !tempBuffer )
+/* Generated */          {
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */          }
+/* Generated */       #endif
+/* Generated */       retCode = FUNCTION_CALL(INT_STOCH)( kBegIdx, endIdx, inHigh, inLow, inClose,
+/* Generated */                                           optInRSIPeriod, optInFastK_Period,
+/* Generated */                                           1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+/* Generated */                                           1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+/* Generated */                                           outBegIdx, outNBElement, tempBuffer, tempBuffer );
+/* Generated */       if( retCode == ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */          retCode = FUNCTION_CALL_DOUBLE(MA)( 0, (int)VALUE_HANDLE_DEREF(outNBElement)-1,
+/* Generated */                                              tempBuffer, optInSlowK_Period,
+/* Generated */                                              optInSlowK_MAType,
+/* Generated */                                              outBegIdx, outNBElement, tempBuffer );
+/* Generated */       if( retCode == ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */          retCode = FUNCTION_CALL_DOUBLE(MA)( 0, (int)VALUE_HANDLE_DEREF(outNBElement)-1,
+/* Generated */                                              tempBuffer, optInSlowD_Period,
+/* Generated */                                              optInSlowD_MAType,
+/* Generated */                                              outBegIdx, outNBElement, outSlowD );
+/* Generated */       if( retCode == ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */          ARRAY_MEMMOVE( outSlowK, 0, tempBuffer, lookbackDSlow, (int)VALUE_HANDLE_DEREF(outNBElement) );
+/* Generated */       ARRAY_FREE( tempBuffer );
+/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
 /* Generated */       {
-/* Generated */          tempBuffer = outSlowK;
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return retCode;
 /* Generated */       }
-/* Generated */       else if( (outSlowD == inHigh) ||
-/* Generated */                (outSlowD == inLow)  ||
-/* Generated */                (outSlowD == inClose) )
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    if( (optInFastK_Period <= TA_STOCH_LOCAL_SIZE) &&
+/* Generated */        (optInSlowK_Period <= TA_STOCH_LOCAL_SIZE) &&
+/* Generated */        (optInSlowD_Period <= TA_STOCH_LOCAL_SIZE) )
+/* Generated */       window = localWindow;
+/* Generated */    else
+/* Generated */    {
+/* Generated */       ARRAY_ALLOC( window, 2*optInFastK_Period+2+optInSlowK_Period+optInSlowD_Period );
+/* Generated */       #if !defined( _JAVA )
+/* Generated */          if( !window )
+/* Generated */          {
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */          }
+/* Generated */       #endif
+/* Generated */    }
+/* Generated */    today = startIdx-lookbackTotal;
+/* Generated */    prevValue = prevGain = prevLoss = firstRSI = 0.0;
+/* Generated */    rsiIdx = today-1;
+/* Generated */    if( optInRSIPeriod > 0 )
+/* Generated */    {
+/* Generated */       prevValue = inClose[today];
+/* Generated */       if( (TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi) == 0) &&
+/* Generated */           (TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_METASTOCK,Metastock)) )
+/* Generated */       {
+/* Generated */          for( i=0; i < optInRSIPeriod; i++ )
+/* Generated */          {
+/* Generated */             tempValue1 = inClose[today+i];
+/* Generated */             tempValue2 = tempValue1 - prevValue;
+/* Generated */             prevValue  = tempValue1;
+/* Generated */             if( tempValue2 < 0 )
+/* Generated */                prevLoss -= tempValue2;
+/* Generated */             else
+/* Generated */                prevGain += tempValue2;
+/* Generated */          }
+/* Generated */          tempValue1 = prevLoss/optInRSIPeriod;
+/* Generated */          tempValue2 = prevGain/optInRSIPeriod;
+/* Generated */          tempValue1 = tempValue2+tempValue1;
+/* Generated */          if( !TA_IS_ZERO(tempValue1) )
+/* Generated */             firstRSI = 100*(tempValue2/tempValue1);
+/* Generated */          prevValue = inClose[today];
+/* Generated */          prevGain = 0.0;
+/* Generated */          prevLoss = 0.0;
+/* Generated */       }
+/* Generated */       for( i=1; i <= optInRSIPeriod; i++ )
 /* Generated */       {
-/* Generated */          tempBuffer = outSlowD;
+/* Generated */          tempValue1 = inClose[today+i];
+/* Generated */          tempValue2 = tempValue1 - prevValue;
+/* Generated */          prevValue  = tempValue1;
+/* Generated */          if( tempValue2 < 0 )
+/* Generated */             prevLoss -= tempValue2;
+/* Generated */          else
+/* Generated */             prevGain += tempValue2;
 /* Generated */       }
-/* Generated */       else
+/* Generated */       prevLoss /= optInRSIPeriod;
+/* Generated */       prevGain /= optInRSIPeriod;
+/* Generated */       rsiIdx = today+optInRSIPeriod;
+/* Generated */       today += lookbackRSI;
+/* Generated */       while( rsiIdx < today-1 )
 /* Generated */       {
-/* Generated */          #if !defined( _MANAGED ) && !defined(_JAVA)
-/* Generated */             bufferIsAllocated = 1;
-/* Generated */          #endif
-/* Generated */          ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+/* Generated */          tempValue1 = inClose[++rsiIdx];
+/* Generated */          tempValue2 = tempValue1 - prevValue;
+/* Generated */          prevValue  = tempValue1;
+/* Generated */          prevLoss *= (optInRSIPeriod-1);
+/* Generated */          prevGain *= (optInRSIPeriod-1);
+/* Generated */          if( tempValue2 < 0 )
+/* Generated */             prevLoss -= tempValue2;
+/* Generated */          else
+/* Generated */             prevGain += tempValue2;
+/* Generated */          prevLoss /= optInRSIPeriod;
+/* Generated */          prevGain /= optInRSIPeriod;
 /* Generated */       }
-/* Generated */    #endif
+/* Generated */    }
+/* Generated */    isCompensated = TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated);
+/* Generated */    blockIdx = 0;
+/* Generated */    highest = lowest = 0.0;
+/* Generated */    kCount = dCount = kRingIdx = dRingIdx = 0;
+/* Generated */    kSum = kComp = dSum = dComp = 0.0;
+/* Generated */    slowK = slowD = 0.0;
+/* Generated */    outIdx = 0;
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       tmp = inLow[today];
-/* Generated */       if( lowestIdx < trailingIdx )
+/* Generated */       if( optInRSIPeriod > 0 )
 /* Generated */       {
-/* Generated */          lowestIdx = trailingIdx;
-/* Generated */          lowest = inLow[lowestIdx];
-/* Generated */          i = lowestIdx;
-/* Generated */          while( ++i<=today )
+/* Generated */          if( today > rsiIdx )
 /* Generated */          {
-/* Generated */             tmp = inLow[i];
-/* Generated */             if( tmp < lowest )
-/* Generated */             {
-/* Generated */                lowestIdx = i;
-/* Generated */                lowest = tmp;
-/* Generated */             }
+/* Generated */             tempValue1 = inClose[today];
+/* Generated */             tempValue2 = tempValue1 - prevValue;
+/* Generated */             prevValue  = tempValue1;
+/* Generated */             prevLoss *= (optInRSIPeriod-1);
+/* Generated */             prevGain *= (optInRSIPeriod-1);
+/* Generated */             if( tempValue2 < 0 )
+/* Generated */                prevLoss -= tempValue2;
+/* Generated */             else
+/* Generated */                prevGain += tempValue2;
+/* Generated */             prevLoss /= optInRSIPeriod;
+/* Generated */             prevGain /= optInRSIPeriod;
+/* Generated */             rsiIdx = today;
 /* Generated */          }
-/* Generated */          diff = (highest - lowest)/100.0;
-/* Generated */       }
-/* Generated */       else if( tmp <= lowest )
-/* Generated */       {
-/* Generated */          lowestIdx = today;
-/* Generated */          lowest = tmp;
-/* Generated */          diff = (highest - lowest)/100.0;
-/* Generated */       }
-/* Generated */       tmp = inHigh[today];
-/* Generated */       if( highestIdx < trailingIdx )
-/* Generated */       {
-/* Generated */          highestIdx = trailingIdx;
-/* Generated */          highest = inHigh[highestIdx];
-/* Generated */          i = highestIdx;
-/* Generated */          while( ++i<=today )
+/* Generated */          if( today < rsiIdx )
+/* Generated */             close = firstRSI;
+/* Generated */          else
 /* Generated */          {
-/* Generated */             tmp = inHigh[i];
-/* Generated */             if( tmp > highest )
-/* Generated */             {
-/* Generated */                highestIdx = i;
-/* Generated */                highest = tmp;
-/* Generated */             }
+/* Generated */             tempValue1 = prevGain+prevLoss;
+/* Generated */             if( !TA_IS_ZERO(tempValue1) )
+/* Generated */                close = 100.0*(prevGain/tempValue1);
+/* Generated */             else
+/* Generated */                close = 0.0;
 /* Generated */          }
-/* Generated */          diff = (highest - lowest)/100.0;
+/* Generated */          high = low = close;
+/* Generated */       }
+/* Generated */       else
+/* Generated */       {
+/* Generated */          high  = inHigh[today];
+/* Generated */          low   = inLow[today];
+/* Generated */          close = inClose[today];
 /* Generated */       }
-/* Generated */       else if( tmp >= highest )
+/* Generated */       TA_WINDOW_PUSH( window, highest, blockIdx, optInFastK_Period, high, > );
+/* Generated */       TA_WINDOW_PUSH( &window[optInFastK_Period+1], lowest, blockIdx, optInFastK_Period, low, < );
+/* Generated */       high = TA_WINDOW_GET( window, highest, blockIdx, > );
+/* Generated */       low  = TA_WINDOW_GET( &window[optInFastK_Period+1], lowest, blockIdx, < );
+/* Generated */       if( ++blockIdx == optInFastK_Period )
 /* Generated */       {
-/* Generated */          highestIdx = today;
-/* Generated */          highest = tmp;
-/* Generated */          diff = (highest - lowest)/100.0;
+/* Generated */          TA_WINDOW_END_BLOCK( window, optInFastK_Period, > );
+/* Generated */          TA_WINDOW_END_BLOCK( &window[optInFastK_Period+1], optInFastK_Period, < );
+/* Generated */          blockIdx = 0;
 /* Generated */       }
+/* Generated */       if( today++ < kBegIdx )
+/* Generated */          continue;
+/* Generated */       diff = (high-low)/100.0;
 /* Generated */       if( diff != 0.0 )
-/* Generated */         tempBuffer[outIdx++] = (inClose[today]-lowest)/diff;
+/* Generated */          fastK = (close-low)/diff;
 /* Generated */       else
-/* Generated */         tempBuffer[outIdx++] = 0.0;
-/* Generated */       trailingIdx++;
-/* Generated */       today++; 
-/* Generated */    }
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(MA)( 0, outIdx-1,
-/* Generated */                                        tempBuffer, optInSlowK_Period,
-/* Generated */                                        optInSlowK_MAType, 
-/* Generated */                                        outBegIdx, outNBElement, tempBuffer );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || ((int)VALUE_HANDLE_DEREF(outNBElement) == 0) )
-/* Generated */    {
-/* Generated */       #if defined(USE_SINGLE_PRECISION_INPUT)
-/* Generated */          ARRAY_FREE( tempBuffer ); 
-/* Generated */       #else
-/* Generated */          ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-/* Generated */       #endif
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return retCode; 
-/* Generated */    }
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(MA)( 0, (int)VALUE_HANDLE_DEREF(outNBElement)-1,
-/* Generated */                                        tempBuffer, optInSlowD_Period,
-/* Generated */                                        optInSlowD_MAType,
-/* Generated */                                        outBegIdx, outNBElement, outSlowD );
-/* Generated */    ARRAY_MEMMOVE( outSlowK, 0, tempBuffer,lookbackDSlow,(int)VALUE_HANDLE_DEREF(outNBElement));
-/* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT)
-/* Generated */       ARRAY_FREE( tempBuffer ); 
-/* Generated */    #else
-/* Generated */       ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-/* Generated */    #endif
-/* Generated */    if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return retCode;
+/* Generated */          fastK = 0.0;
+/* Generated */       TA_STOCH_STAGE_FEED( kKind, slowK, kSum, kComp, &window[2*optInFastK_Period+2], kRingIdx,
+/* Generated */                            kCount, fastK, optInSlowK_Period, PER_TO_K(optInSlowK_Period), isCompensated );
+/* Generated */       if( kCount <= lookbackKSlow )
+/* Generated */          continue;
+/* Generated */       TA_STOCH_STAGE_FEED( dKind, slowD, dSum, dComp, &window[2*optInFastK_Period+2+optInSlowK_Period], dRingIdx,
+/* Generated */                            dCount, slowK, optInSlowD_Period, PER_TO_K(optInSlowD_Period), isCompensated );
+/* Generated */       if( dCount <= lookbackDSlow )
+/* Generated */          continue;
+/* Generated */       outSlowK[outIdx] = slowK;
+/* Generated */       outSlowD[outIdx++] = slowD;
 /* Generated */    }
+/* Generated */    if( window != localWindow )
+/* Generated */       ARRAY_FREE( window );
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
+/* Generated */ #endif
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
@@ -209,16 +209,6 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
 	/* insert local variable here */
-   ENUM_DECLARATION(RetCode) retCode;
-   double lowest, highest, tmp, diff;
-   ARRAY_REF( tempBuffer );
-   int outIdx, lowestIdx, highestIdx;
-   int lookbackTotal, lookbackK, lookbackFastD;
-   int trailingIdx, today, i;
-
-   #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
-   int bufferIsAllocated;
-   #endif
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -300,202 +290,14 @@
     * used because its higher volatility cause often whipsaws.
     */
 
-   /* Identify the lookback needed. */
-   lookbackK      = optInFastK_Period-1;
-   lookbackFastD  = LOOKBACK_CALL(MA)( optInFastD_Period, optInFastD_MAType );
-   lookbackTotal  = lookbackK + lookbackFastD;
-
-   /* Move up the start index if there is not
-    * enough initial data.
-    */
-   if( startIdx < lookbackTotal )
-      startIdx = lookbackTotal;
-
-   /* Make sure there is still something to evaluate. */
-   if( startIdx > endIdx )
-   {
-      /* Succeed... but no data in the output. */
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-   }
-
-   /* Do the K calculation:
-    *
-    *    Kt = 100 x ((Ct-Lt)/(Ht-Lt))
-    *
-    * Kt is today stochastic
-    * Ct is today closing price.
-    * Lt is the lowest price of the last K Period (including today)
-    * Ht is the highest price of the last K Period (including today)
-    */
-
-   /* Proceed with the calculation for the requested range.
-    * Note that this algorithm allows the input and
-    * output to be the same buffer.
-    */
-   outIdx = 0;
-
-   /* Calculate just enough K for ending up with the caller 
-    * requested range. (The range of k must consider all
-    * the lookback involve with the smoothing).
-    */
-   trailingIdx = startIdx-lookbackTotal;
-   today       = trailingIdx+lookbackK;
-   lowestIdx   = highestIdx = -1;
-   diff = highest = lowest  = 0.0;
-
-   /* Allocate a temporary buffer large enough to
-    * store the K.
-    *
-    * If the output is the same as the input, great
-    * we just save ourself one memory allocation.
-    */
-   #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
-      bufferIsAllocated = 0;
-   #endif
-
-   #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-      /* Always alloc, since output is of different type and
-       * its allocated size is not guarantee to be as large as
-       * the input.
-       */
-      ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
-   #else
-      if( (outFastK == inHigh) || 
-          (outFastK == inLow)  || 
-          (outFastK == inClose) )
-      {
-         tempBuffer = outFastK;
-      }
-      else if( (outFastD == inHigh) ||
-               (outFastD == inLow)  ||
-               (outFastD == inClose) )
-      {
-         tempBuffer = outFastD;
-      }
-      else
-      {
-         #if !defined( _MANAGED ) && !defined( _JAVA )
-            bufferIsAllocated = 1;
-         #endif
-         ARRAY_ALLOC(tempBuffer, endIdx-today+1 );
-      }
-   #endif
-
-   /* Do the K calculation */
-   while( today <= endIdx )
-   {
-      /* Set the lowest low */
-      tmp = inLow[today];
-      if( lowestIdx < trailingIdx )
-      {
-         lowestIdx = trailingIdx;
-         lowest = inLow[lowestIdx];
-         i = lowestIdx;
-         while( ++i<=today )
-         {
-            tmp = inLow[i];
-            if( tmp < lowest )
-            {
-               lowestIdx = i;
-               lowest = tmp;
-            }
-         }
-         diff = (highest - lowest)/100.0;
-      }
-      else if( tmp <= lowest )
-      {
-         lowestIdx = today;
-         lowest = tmp;
-         diff = (highest - lowest)/100.0;
-      }
-
-      /* Set the highest high */
-      tmp = inHigh[today];
-      if( highestIdx < trailingIdx )
-      {
-         highestIdx = trailingIdx;
-         highest = inHigh[highestIdx];
-         i = highestIdx;
-         while( ++i<=today )
-         {
-            tmp = inHigh[i];
-            if( tmp > highest )
-            {
-               highestIdx = i;
-               highest = tmp;
-            }
-         }
-         diff = (highest - lowest)/100.0;
-      }
-      else if( tmp >= highest )
-      {
-         highestIdx = today;
-         highest = tmp;
-         diff = (highest - lowest)/100.0;
-      }
-
-      /* Calculate stochastic. */
-      if( diff != 0.0 )
-        tempBuffer[outIdx++] = (inClose[today]-lowest)/diff;
-      else
-        tempBuffer[outIdx++] = 0.0;
-
-      trailingIdx++;
-      today++; 
-   }
-
-   /* Fast-K calculation completed. This K calculation is returned
-    * to the caller. It is smoothed to become Fast-D.
+   /* The K and its MA are evaluated in a single pass by
+    * TA_INT_STOCH, see ta_STOCH.c. The K is smoothed by a copy.
     */
-   retCode = FUNCTION_CALL_DOUBLE(MA)( 0, outIdx-1,
-                                       tempBuffer, optInFastD_Period,
-                                       optInFastD_MAType, 
-                                       outBegIdx, outNBElement, outFastD );
-
-
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || ((int)VALUE_HANDLE_DEREF(outNBElement)) == 0 )
-   {
-      #if defined(USE_SINGLE_PRECISION_INPUT)
-         ARRAY_FREE( tempBuffer ); 
-      #else
-         ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-      #endif
-      /* Something wrong happen? No further data? */
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return retCode; 
-   }
-
-   /* Copy tempBuffer into the caller buffer. 
-    * (Calculation could not be done directly in the
-    *  caller buffer because more input data then the
-    *  requested range was needed for doing %D).
-    */
-   ARRAY_MEMMOVE( outFastK, 0, tempBuffer, lookbackFastD, (int)VALUE_HANDLE_DEREF(outNBElement) );
-
-   /* Don't need K anymore, free it if it was allocated here. */
-   #if defined(USE_SINGLE_PRECISION_INPUT)
-      ARRAY_FREE( tempBuffer ); 
-   #else
-      ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-   #endif
-
-   if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-   {
-      /* Something wrong happen while processing %D? */
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return retCode;
-   }
-
-   /* Note: Keep the outBegIdx relative to the
-    *       caller input before returning.
-    */
-   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-
-   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   return FUNCTION_CALL(INT_STOCH)( startIdx, endIdx, inHigh, inLow, inClose,
+                                    0, optInFastK_Period,
+                                    1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+                                    optInFastD_Period, optInFastD_MAType,
+                                    outBegIdx, outNBElement, outFastK, outFastD );
 }
 
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
@@ -562,15 +364,6 @@
 /* Generated */                         double        outFastD[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    ENUM_DECLARATION(RetCode) retCode;
-/* Generated */    double lowest, highest, tmp, diff;
-/* Generated */    ARRAY_REF( tempBuffer );
-/* Generated */    int outIdx, lowestIdx, highestIdx;
-/* Generated */    int lookbackTotal, lookbackK, lookbackFastD;
-/* Generated */    int trailingIdx, today, i;
-/* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
-/* Generated */    int bufferIsAllocated;
-/* Generated */    #endif
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -601,132 +394,11 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
-/* Generated */    lookbackK      = optInFastK_Period-1;
-/* Generated */    lookbackFastD  = LOOKBACK_CALL(MA)( optInFastD_Period, optInFastD_MAType );
-/* Generated */    lookbackTotal  = lookbackK + lookbackFastD;
-/* Generated */    if( startIdx < lookbackTotal )
-/* Generated */       startIdx = lookbackTotal;
-/* Generated */    if( startIdx > endIdx )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-/* Generated */    }
-/* Generated */    outIdx = 0;
-/* Generated */    trailingIdx = startIdx-lookbackTotal;
-/* Generated */    today       = trailingIdx+lookbackK;
-/* Generated */    lowestIdx   = highestIdx = -1;
-/* Generated */    diff = highest = lowest  = 0.0;
-/* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
-/* Generated */       bufferIsAllocated = 0;
-/* Generated */    #endif
-/* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-/* Generated */       ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
-/* Generated */    #else
-/* Generated */       if( (outFastK == inHigh) || 
-/* Generated */           (outFastK == inLow)  || 
-/* Generated */           (outFastK == inClose) )
-/* Generated */       {
-/* Generated */          tempBuffer = outFastK;
-/* Generated */       }
-/* Generated */       else if( (outFastD == inHigh) ||
-/* Generated */                (outFastD == inLow)  ||
-/* Generated */                (outFastD == inClose) )
-/* Generated */       {
-/* Generated */          tempBuffer = outFastD;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          #if !defined( _MANAGED ) && !defined( _JAVA )
-/* Generated */             bufferIsAllocated = 1;
-/* Generated */          #endif
-/* Generated */          ARRAY_ALLOC(tempBuffer, endIdx-today+1 );
-/* Generated */       }
-/* Generated */    #endif
-/* Generated */    while( today <= endIdx )
-/* Generated */    {
-/* Generated */       tmp = inLow[today];
-/* Generated */       if( lowestIdx < trailingIdx )
-/* Generated */       {
-/* Generated */          lowestIdx = trailingIdx;
-/* Generated */          lowest = inLow[lowestIdx];
-/* Generated */          i = lowestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inLow[i];
-/* Generated */             if( tmp < lowest )
-/* Generated */             {
-/* Generated */                lowestIdx = i;
-/* Generated */                lowest = tmp;
-/* Generated */             }
-/* Generated */          }
-/* Generated */          diff = (highest - lowest)/100.0;
-/* Generated */       }
-/* Generated */       else if( tmp <= lowest )
-/* Generated */       {
-/* Generated */          lowestIdx = today;
-/* Generated */          lowest = tmp;
-/* Generated */          diff = (highest - lowest)/100.0;
-/* Generated */       }
-/* Generated */       tmp = inHigh[today];
-/* Generated */       if( highestIdx < trailingIdx )
-/* Generated */       {
-/* Generated */          highestIdx = trailingIdx;
-/* Generated */          highest = inHigh[highestIdx];
-/* Generated */          i = highestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inHigh[i];
-/* Generated */             if( tmp > highest )
-/* Generated */             {
-/* Generated */                highestIdx = i;
-/* Generated */                highest = tmp;
-/* Generated */             }
-/* Generated */          }
-/* Generated */          diff = (highest - lowest)/100.0;
-/* Generated */       }
-/* Generated */       else if( tmp >= highest )
-/* Generated */       {
-/* Generated */          highestIdx = today;
-/* Generated */          highest = tmp;
-/* Generated */          diff = (highest - lowest)/100.0;
-/* Generated */       }
-/* Generated */       if( diff != 0.0 )
-/* Generated */         tempBuffer[outIdx++] = (inClose[today]-lowest)/diff;
-/* Generated */       else
-/* Generated */         tempBuffer[outIdx++] = 0.0;
-/* Generated */       trailingIdx++;
-/* Generated */       today++; 
-/* Generated */    }
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(MA)( 0, outIdx-1,
-/* Generated */                                        tempBuffer, optInFastD_Period,
-/* Generated */                                        optInFastD_MAType, 
-/* Generated */                                        outBegIdx, outNBElement, outFastD );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || ((int)VALUE_HANDLE_DEREF(outNBElement)) == 0 )
-/* Generated */    {
-/* Generated */       #if defined(USE_SINGLE_PRECISION_INPUT)
-/* Generated */          ARRAY_FREE( tempBuffer ); 
-/* Generated */       #else
-/* Generated */          ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-/* Generated */       #endif
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return retCode; 
-/* Generated */    }
-/* Generated */    ARRAY_MEMMOVE( outFastK, 0, tempBuffer, lookbackFastD, (int)VALUE_HANDLE_DEREF(outNBElement) );
-/* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT)
-/* Generated */       ARRAY_FREE( tempBuffer ); 
-/* Generated */    #else
-/* Generated */       ARRAY_FREE_COND( bufferIsAllocated, tempBuffer ); 
-/* Generated */    #endif
-/* Generated */    if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    return FUNCTION_CALL(INT_STOCH)( startIdx, endIdx, inHigh, inLow, inClose,
+/* Generated */                                     0, optInFastK_Period,
+/* Generated */                                     1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+/* Generated */                                     optInFastD_Period, optInFastD_MAType,
+/* Generated */                                     outBegIdx, outNBElement, outFastK, outFastD );
 /* Generated */ }
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
@@ -213,13 +213,6 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* insert local variable here */
-   ARRAY_REF(tempRSIBuffer);
-
-   ENUM_DECLARATION(RetCode) retCode;
-   int lookbackTotal, lookbackSTOCHF, tempArraySize;
-   VALUE_HANDLE_INT(outBegIdx1);
-   VALUE_HANDLE_INT(outBegIdx2);
-   VALUE_HANDLE_INT(outNbElement1);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -298,69 +291,15 @@
     * the StochRSI, just leave optInFastD_Period to 1 and ignore outFastD.
     */
 
-   VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-   VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-
-   /* Adjust startIdx to account for the lookback period. */
-   lookbackSTOCHF  = LOOKBACK_CALL(STOCHF)( optInFastK_Period, optInFastD_Period, optInFastD_MAType );
-   lookbackTotal   = LOOKBACK_CALL(RSI)( optInTimePeriod ) + lookbackSTOCHF;
-
-   if( startIdx < lookbackTotal )
-      startIdx = lookbackTotal;
-
-   /* Make sure there is still something to evaluate. */
-   if( startIdx > endIdx )
-   {
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-   }
-
-   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-
-   tempArraySize = (endIdx - startIdx) + 1 + lookbackSTOCHF;
-
-   ARRAY_ALLOC( tempRSIBuffer, tempArraySize );
-
-   retCode = FUNCTION_CALL(RSI)(startIdx-lookbackSTOCHF, 
-                                endIdx, 
-                                inReal, 
-                                optInTimePeriod, 
-                                VALUE_HANDLE_OUT(outBegIdx1),
-                                VALUE_HANDLE_OUT(outNbElement1), 
-                                tempRSIBuffer);
-
-   if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) || VALUE_HANDLE_GET(outNbElement1) == 0 )
-   {
-      ARRAY_FREE( tempRSIBuffer );
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return retCode;
-   }
-   
-   retCode = FUNCTION_CALL_DOUBLE(STOCHF)(0,
-                                          tempArraySize-1,
-                                          tempRSIBuffer,
-                                          tempRSIBuffer,
-                                          tempRSIBuffer,
-                                          optInFastK_Period,
-                                          optInFastD_Period,
-                                          optInFastD_MAType,
-                                          VALUE_HANDLE_OUT(outBegIdx2),
-                                          outNBElement,
-                                          outFastK,
-                                          outFastD);
- 
-   ARRAY_FREE( tempRSIBuffer );
-
-   if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) || ((int)VALUE_HANDLE_DEREF(outNBElement)) == 0 )
-   {
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return retCode;
-   }
-
-   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   /* The RSI, the stochastic of the RSI and its MA are
+    * evaluated in a single pass by TA_INT_STOCH, see ta_STOCH.c.
+    * The RSI is not buffered.
+    */
+   return FUNCTION_CALL(INT_STOCH)( startIdx, endIdx, inReal, inReal, inReal,
+                                    optInTimePeriod, optInFastK_Period,
+                                    1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+                                    optInFastD_Period, optInFastD_MAType,
+                                    outBegIdx, outNBElement, outFastK, outFastD );
 }
 
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
@@ -423,12 +362,6 @@
 /* Generated */                           double        outFastD[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    ARRAY_REF(tempRSIBuffer);
-/* Generated */    ENUM_DECLARATION(RetCode) retCode;
-/* Generated */    int lookbackTotal, lookbackSTOCHF, tempArraySize;
-/* Generated */    VALUE_HANDLE_INT(outBegIdx1);
-/* Generated */    VALUE_HANDLE_INT(outBegIdx2);
-/* Generated */    VALUE_HANDLE_INT(outNbElement1);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -462,55 +395,11 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
-/* Generated */    VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */    VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */    lookbackSTOCHF  = LOOKBACK_CALL(STOCHF)( optInFastK_Period, optInFastD_Period, optInFastD_MAType );
-/* Generated */    lookbackTotal   = LOOKBACK_CALL(RSI)( optInTimePeriod ) + lookbackSTOCHF;
-/* Generated */    if( startIdx < lookbackTotal )
-/* Generated */       startIdx = lookbackTotal;
-/* Generated */    if( startIdx > endIdx )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-/* Generated */    }
-/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-/* Generated */    tempArraySize = (endIdx - startIdx) + 1 + lookbackSTOCHF;
-/* Generated */    ARRAY_ALLOC( tempRSIBuffer, tempArraySize );
-/* Generated */    retCode = FUNCTION_CALL(RSI)(startIdx-lookbackSTOCHF, 
-/* Generated */                                 endIdx, 
-/* Generated */                                 inReal, 
-/* Generated */                                 optInTimePeriod, 
-/* Generated */                                 VALUE_HANDLE_OUT(outBegIdx1),
-/* Generated */                                 VALUE_HANDLE_OUT(outNbElement1), 
-/* Generated */                                 tempRSIBuffer);
-/* Generated */    if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) || VALUE_HANDLE_GET(outNbElement1) == 0 )
-/* Generated */    {
-/* Generated */       ARRAY_FREE( tempRSIBuffer );
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(STOCHF)(0,
-/* Generated */                                           tempArraySize-1,
-/* Generated */                                           tempRSIBuffer,
-/* Generated */                                           tempRSIBuffer,
-/* Generated */                                           tempRSIBuffer,
-/* Generated */                                           optInFastK_Period,
-/* Generated */                                           optInFastD_Period,
-/* Generated */                                           optInFastD_MAType,
-/* Generated */                                           VALUE_HANDLE_OUT(outBegIdx2),
-/* Generated */                                           outNBElement,
-/* Generated */                                           outFastK,
-/* Generated */                                           outFastD);
-/* Generated */    ARRAY_FREE( tempRSIBuffer );
-/* Generated */    if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) || ((int)VALUE_HANDLE_DEREF(outNBElement)) == 0 )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    return FUNCTION_CALL(INT_STOCH)( startIdx, endIdx, inReal, inReal, inReal,
+/* Generated */                                     optInTimePeriod, optInFastK_Period,
+/* Generated */                                     1, ENUM_VALUE(MAType,TA_MAType_SMA,Sma),
+/* Generated */                                     optInFastD_Period, optInFastD_MAType,
+/* Generated */                                     outBegIdx, outNBElement, outFastK, outFastD );
 /* Generated */ }
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
@@ -157,7 +157,7 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
 	/* insert local variable here */
-   double periodTotal, tempReal;
+   double periodTotal, periodComp, tempReal;
    int i, outIdx, trailingIdx, lookbackTotal;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
@@ -216,28 +216,46 @@
    trailingIdx = startIdx-lookbackTotal;
    
    i=trailingIdx;
-   if( optInTimePeriod > 1 )
+   outIdx = 0;
+   if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
    {
+      /* Same as below with compensated sums, see TA_SetPrecision. */
+      periodComp = 0.0;
       while( i < startIdx )
-         periodTotal += inReal[i++];
+         TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
+
+      do
+      {
+         TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
+         tempReal = periodTotal+periodComp;
+         TA_COMPENSATED_ADD( periodTotal, periodComp, -inReal[trailingIdx++] );
+         outReal[outIdx++] = tempReal;
+      } while( i <= endIdx );
    }
+   else
+   {
+      if( optInTimePeriod > 1 )
+      {
+         while( i < startIdx )
+            periodTotal += inReal[i++];
+      }
 
-   /* Proceed with the calculation for the requested range.
-    * Note that this algorithm allows the inReal and
-    * outReal to be the same buffer.
-    */
-   outIdx = 0;
+      /* Proceed with the calculation for the requested range.
+       * Note that this algorithm allows the inReal and
+       * outReal to be the same buffer.
+       */
 #ifdef TA_LIB_PRO
       /* Section for code distributed with TA-Lib Pro only. */
 #else
-   do
-   {
-      periodTotal += inReal[i++];
-      tempReal = periodTotal;
-      periodTotal -= inReal[trailingIdx++];
-      outReal[outIdx++] = tempReal;
-   } while( i <= endIdx );
+      do
+      {
+         periodTotal += inReal[i++];
+         tempReal = periodTotal;
+         periodTotal -= inReal[trailingIdx++];
+         outReal[outIdx++] = tempReal;
+      } while( i <= endIdx );
 #endif
+   }
    /* All done. Indicate the output limits and return. */
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
@@ -289,7 +307,7 @@
 /* Generated */                      double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    double periodTotal, tempReal;
+/* Generated */    double periodTotal, periodComp, tempReal;
 /* Generated */    int i, outIdx, trailingIdx, lookbackTotal;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
@@ -320,22 +338,38 @@
 /* Generated */    periodTotal = 0;
 /* Generated */    trailingIdx = startIdx-lookbackTotal;
 /* Generated */    i=trailingIdx;
-/* Generated */    if( optInTimePeriod > 1 )
+/* Generated */    outIdx = 0;
+/* Generated */    if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
 /* Generated */    {
+/* Generated */       periodComp = 0.0;
 /* Generated */       while( i < startIdx )
-/* Generated */          periodTotal += inReal[i++];
+/* Generated */          TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
+/* Generated */       do
+/* Generated */       {
+/* Generated */          TA_COMPENSATED_ADD( periodTotal, periodComp, inReal[i++] );
+/* Generated */          tempReal = periodTotal+periodComp;
+/* Generated */          TA_COMPENSATED_ADD( periodTotal, periodComp, -inReal[trailingIdx++] );
+/* Generated */          outReal[outIdx++] = tempReal;
+/* Generated */       } while( i <= endIdx );
 /* Generated */    }
-/* Generated */    outIdx = 0;
+/* Generated */    else
+/* Generated */    {
+/* Generated */       if( optInTimePeriod > 1 )
+/* Generated */       {
+/* Generated */          while( i < startIdx )
+/* Generated */             periodTotal += inReal[i++];
+/* Generated */       }
 /* Generated */ #ifdef TA_LIB_PRO
 /* Generated */ #else
-/* Generated */    do
-/* Generated */    {
-/* Generated */       periodTotal += inReal[i++];
-/* Generated */       tempReal = periodTotal;
-/* Generated */       periodTotal -= inReal[trailingIdx++];
-/* Generated */       outReal[outIdx++] = tempReal;
-/* Generated */    } while( i <= endIdx );
+/* Generated */       do
+/* Generated */       {
+/* Generated */          periodTotal += inReal[i++];
+/* Generated */          tempReal = periodTotal;
+/* Generated */          periodTotal -= inReal[trailingIdx++];
+/* Generated */          outReal[outIdx++] = tempReal;
+/* Generated */       } while( i <= endIdx );
 /* Generated */ #endif
+/* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
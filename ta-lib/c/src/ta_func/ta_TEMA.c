@@ -163,21 +163,9 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* Insert local variables here. */
-   ARRAY_REF(firstEMA);
-   ARRAY_REF(secondEMA);
-   double k;
-
-   VALUE_HANDLE_INT(firstEMABegIdx);
-   VALUE_HANDLE_INT(firstEMANbElement);
-   VALUE_HANDLE_INT(secondEMABegIdx);
-   VALUE_HANDLE_INT(secondEMANbElement);
-   VALUE_HANDLE_INT(thirdEMABegIdx);
-   VALUE_HANDLE_INT(thirdEMANbElement);
-
-   int tempInt, outIdx, lookbackTotal, lookbackEMA;
-   int firstEMAIdx, secondEMAIdx;
-
-   ENUM_DECLARATION(RetCode) retCode;
+   double k, firstEMA, secondEMA, thirdEMA;
+   int today, outIdx, firstEMABegIdx, lookbackTotal, lookbackEMA;
+   int firstEMACount, secondEMACount, thirdEMACount;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -248,101 +236,55 @@
    if( startIdx > endIdx )
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success); 
 
-   /* Allocate a temporary buffer for the firstEMA. */
-   tempInt = lookbackTotal+(endIdx-startIdx)+1;
-   ARRAY_ALLOC(firstEMA,tempInt);
-   #if !defined( _JAVA )
-      if( !firstEMA )
-         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-   #endif
-
-   /* Calculate the first EMA */   
-   k = PER_TO_K(optInTimePeriod);
-   retCode = FUNCTION_CALL(INT_EMA)( startIdx-(lookbackEMA*2), endIdx, inReal,
-                                     optInTimePeriod, k,
-                                     VALUE_HANDLE_OUT(firstEMABegIdx), VALUE_HANDLE_OUT(firstEMANbElement),
-								     firstEMA );
-   
-   /* Verify for failure or if not enough data after
-    * calculating the first EMA.
-    */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(firstEMANbElement) == 0) )
-   {
-      ARRAY_FREE( firstEMA );
-      return retCode;
-   }
-
-   /* Allocate a temporary buffer for storing the EMA2 */
-   ARRAY_ALLOC(secondEMA,VALUE_HANDLE_GET(firstEMANbElement));
-   #if !defined( _JAVA ) && !defined( USE_SUBARRAY )
-      if( !secondEMA )
-      {
-         ARRAY_FREE( firstEMA );
-         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-      }   
-   #endif
-
-   retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(firstEMANbElement)-1, firstEMA,
-                                            optInTimePeriod, k,
-                                            VALUE_HANDLE_OUT(secondEMABegIdx), VALUE_HANDLE_OUT(secondEMANbElement), 
-						                    secondEMA );
-
-   /* Return empty output on failure or if not enough data after
-    * calculating the second EMA.
-    */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(secondEMANbElement) == 0) )      
-   {
-      ARRAY_FREE( firstEMA );
-      ARRAY_FREE( secondEMA );
-      return retCode;
-   }
-
-   /* Calculate the EMA3 into the caller provided output. */
-   retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(secondEMANbElement)-1, secondEMA,
-                                            optInTimePeriod, k,
-                                            VALUE_HANDLE_OUT(thirdEMABegIdx), VALUE_HANDLE_OUT(thirdEMANbElement),
-                                            outReal );
-
-   /* Return empty output on failure or if not enough data after
-    * calculating the third EMA.
+   /* The three EMAs are evaluated in a single pass, each one is
+    * fed each value of the previous one as soon as it is computed.
+    * The values are the same as running TA_INT_EMA on the input
+    * from 'firstEMABegIdx', then on the buffer of the output of
+    * the previous EMA (see TA_EMA_CASCADE_FEED).
     */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(thirdEMANbElement) == 0) )
+   k = PER_TO_K(optInTimePeriod);
+   firstEMABegIdx = startIdx-(lookbackEMA*2);
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+      today = firstEMABegIdx-lookbackEMA;
+   else
+      today = 0;
+   firstEMA  = 0.0;
+   secondEMA = 0.0;
+   thirdEMA  = 0.0;
+   firstEMACount  = 0;
+   secondEMACount = 0;
+   thirdEMACount  = 0;
+
+   /* Seed the EMAs, up to the first output. */
+   while( today <= startIdx )
    {
-      ARRAY_FREE( firstEMA );
-      ARRAY_FREE( secondEMA );
-      return retCode;
+      TA_EMA_CASCADE_FEED(firstEMA,firstEMACount,inReal[today],optInTimePeriod,k);
+      if( today >= firstEMABegIdx )
+         TA_EMA_CASCADE_FEED(secondEMA,secondEMACount,firstEMA,optInTimePeriod,k);
+      if( today >= firstEMABegIdx+lookbackEMA )
+         TA_EMA_CASCADE_FEED(thirdEMA,thirdEMACount,secondEMA,optInTimePeriod,k);
+      today++;
    }
+   outReal[0] = thirdEMA + ((3.0*firstEMA) - (3.0*secondEMA));
+   outIdx = 1;
 
-   /* Indicate where the output starts relative to
-    * the caller input.
+   /* Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
     */
-   firstEMAIdx  = VALUE_HANDLE_GET(thirdEMABegIdx) + VALUE_HANDLE_GET(secondEMABegIdx);
-   secondEMAIdx = VALUE_HANDLE_GET(thirdEMABegIdx);
-   VALUE_HANDLE_DEREF(outBegIdx) = firstEMAIdx + VALUE_HANDLE_GET(firstEMABegIdx);
-
-   /* Do the TEMA:
-    *  Iterate through the EMA3 (output buffer) and adjust
-    *  the value by using the EMA2 and EMA1.
-    */
-   outIdx = 0;
-   while( outIdx < VALUE_HANDLE_GET(thirdEMANbElement) ) 
+   while( today <= endIdx )
    {
-      outReal[outIdx] += (3.0*firstEMA[firstEMAIdx++]) - (3.0*secondEMA[secondEMAIdx++]);
-      outIdx++;
+      firstEMA  = ((inReal[today++]-firstEMA)*k) + firstEMA;
+      secondEMA = ((firstEMA-secondEMA)*k) + secondEMA;
+      thirdEMA  = ((secondEMA-thirdEMA)*k) + thirdEMA;
+      outReal[outIdx++] = thirdEMA + ((3.0*firstEMA) - (3.0*secondEMA));
    }
 
-   ARRAY_FREE( firstEMA );
-   ARRAY_FREE( secondEMA );
-
-   /* Indicates to the caller the number of output
-    * successfully calculated.
-    */
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
 
-
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
 /* Generated */ #define  USE_SINGLE_PRECISION_INPUT
@@ -387,18 +329,9 @@
 /* Generated */                       double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    ARRAY_REF(firstEMA);
-/* Generated */    ARRAY_REF(secondEMA);
-/* Generated */    double k;
-/* Generated */    VALUE_HANDLE_INT(firstEMABegIdx);
-/* Generated */    VALUE_HANDLE_INT(firstEMANbElement);
-/* Generated */    VALUE_HANDLE_INT(secondEMABegIdx);
-/* Generated */    VALUE_HANDLE_INT(secondEMANbElement);
-/* Generated */    VALUE_HANDLE_INT(thirdEMABegIdx);
-/* Generated */    VALUE_HANDLE_INT(thirdEMANbElement);
-/* Generated */    int tempInt, outIdx, lookbackTotal, lookbackEMA;
-/* Generated */    int firstEMAIdx, secondEMAIdx;
-/* Generated */    ENUM_DECLARATION(RetCode) retCode;
+/* Generated */    double k, firstEMA, secondEMA, thirdEMA;
+/* Generated */    int today, outIdx, firstEMABegIdx, lookbackTotal, lookbackEMA;
+/* Generated */    int firstEMACount, secondEMACount, thirdEMACount;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -424,61 +357,37 @@
 /* Generated */       startIdx = lookbackTotal;
 /* Generated */    if( startIdx > endIdx )
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success); 
-/* Generated */    tempInt = lookbackTotal+(endIdx-startIdx)+1;
-/* Generated */    ARRAY_ALLOC(firstEMA,tempInt);
-/* Generated */    #if !defined( _JAVA )
-/* Generated */       if( !firstEMA )
-/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-/* Generated */    #endif
 /* Generated */    k = PER_TO_K(optInTimePeriod);
-/* Generated */    retCode = FUNCTION_CALL(INT_EMA)( startIdx-(lookbackEMA*2), endIdx, inReal,
-/* Generated */                                      optInTimePeriod, k,
-/* Generated */                                      VALUE_HANDLE_OUT(firstEMABegIdx), VALUE_HANDLE_OUT(firstEMANbElement),
-/* Generated */ 								     firstEMA );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(firstEMANbElement) == 0) )
-/* Generated */    {
-/* Generated */       ARRAY_FREE( firstEMA );
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    ARRAY_ALLOC(secondEMA,VALUE_HANDLE_GET(firstEMANbElement));
-/* Generated */    #if !defined( _JAVA ) && !defined( USE_SUBARRAY )
-/* Generated */       if( !secondEMA )
-/* Generated */       {
-/* Generated */          ARRAY_FREE( firstEMA );
-/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-/* Generated */       }   
-/* Generated */    #endif
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(firstEMANbElement)-1, firstEMA,
-/* Generated */                                             optInTimePeriod, k,
-/* Generated */                                             VALUE_HANDLE_OUT(secondEMABegIdx), VALUE_HANDLE_OUT(secondEMANbElement), 
-/* Generated */ 						                    secondEMA );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(secondEMANbElement) == 0) )      
-/* Generated */    {
-/* Generated */       ARRAY_FREE( firstEMA );
-/* Generated */       ARRAY_FREE( secondEMA );
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, VALUE_HANDLE_GET(secondEMANbElement)-1, secondEMA,
-/* Generated */                                             optInTimePeriod, k,
-/* Generated */                                             VALUE_HANDLE_OUT(thirdEMABegIdx), VALUE_HANDLE_OUT(thirdEMANbElement),
-/* Generated */                                             outReal );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(thirdEMANbElement) == 0) )
+/* Generated */    firstEMABegIdx = startIdx-(lookbackEMA*2);
+/* Generated */    if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+/* Generated */       today = firstEMABegIdx-lookbackEMA;
+/* Generated */    else
+/* Generated */       today = 0;
+/* Generated */    firstEMA  = 0.0;
+/* Generated */    secondEMA = 0.0;
+/* Generated */    thirdEMA  = 0.0;
+/* Generated */    firstEMACount  = 0;
+/* Generated */    secondEMACount = 0;
+/* Generated */    thirdEMACount  = 0;
+/* Generated */    while( today <= startIdx )
 /* Generated */    {
-/* Generated */       ARRAY_FREE( firstEMA );
-/* Generated */       ARRAY_FREE( secondEMA );
-/* Generated */       return retCode;
+/* Generated */       TA_EMA_CASCADE_FEED(firstEMA,firstEMACount,inReal[today],optInTimePeriod,k);
+/* Generated */       if( today >= firstEMABegIdx )
+/* Generated */          TA_EMA_CASCADE_FEED(secondEMA,secondEMACount,firstEMA,optInTimePeriod,k);
+/* Generated */       if( today >= firstEMABegIdx+lookbackEMA )
+/* Generated */          TA_EMA_CASCADE_FEED(thirdEMA,thirdEMACount,secondEMA,optInTimePeriod,k);
+/* Generated */       today++;
 /* Generated */    }
-/* Generated */    firstEMAIdx  = VALUE_HANDLE_GET(thirdEMABegIdx) + VALUE_HANDLE_GET(secondEMABegIdx);
-/* Generated */    secondEMAIdx = VALUE_HANDLE_GET(thirdEMABegIdx);
-/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = firstEMAIdx + VALUE_HANDLE_GET(firstEMABegIdx);
-/* Generated */    outIdx = 0;
-/* Generated */    while( outIdx < VALUE_HANDLE_GET(thirdEMANbElement) ) 
+/* Generated */    outReal[0] = thirdEMA + ((3.0*firstEMA) - (3.0*secondEMA));
+/* Generated */    outIdx = 1;
+/* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       outReal[outIdx] += (3.0*firstEMA[firstEMAIdx++]) - (3.0*secondEMA[secondEMAIdx++]);
-/* Generated */       outIdx++;
+/* Generated */       firstEMA  = ((inReal[today++]-firstEMA)*k) + firstEMA;
+/* Generated */       secondEMA = ((firstEMA-secondEMA)*k) + secondEMA;
+/* Generated */       thirdEMA  = ((secondEMA-thirdEMA)*k) + thirdEMA;
+/* Generated */       outReal[outIdx++] = thirdEMA + ((3.0*firstEMA) - (3.0*secondEMA));
 /* Generated */    }
-/* Generated */    ARRAY_FREE( firstEMA );
-/* Generated */    ARRAY_FREE( secondEMA );
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
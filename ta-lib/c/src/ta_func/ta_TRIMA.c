@@ -168,6 +168,7 @@
 
    int i, outIdx, todayIdx, trailingIdx, middleIdx;
    double factor, tempReal;
+   double numeratorComp, numeratorSubComp, numeratorAddComp;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -306,6 +307,82 @@
 
    outIdx = 0;
 
+   if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
+   {
+      /* Same as below with compensated sums, see TA_SetPrecision.
+       * The odd and even periods only differ by the initial
+       * indexes, the factor and the order of the update of
+       * numeratorAdd.
+       */
+      i = (optInTimePeriod>>1);
+      trailingIdx = startIdx-lookbackTotal;
+      if( (optInTimePeriod % 2) == 1 )
+      {
+         factor    = 1.0/((double)(i+1)*(i+1));
+         middleIdx = trailingIdx + i;
+      }
+      else
+      {
+         factor    = 1.0/((double)i*(i+1));
+         middleIdx = trailingIdx + i - 1;
+      }
+      todayIdx = middleIdx + i;
+
+      numerator = numeratorSub = numeratorAdd = 0.0;
+      numeratorComp = numeratorSubComp = numeratorAddComp = 0.0;
+      for( i=middleIdx; i >= trailingIdx; i-- )
+      {
+         TA_COMPENSATED_ADD( numeratorSub, numeratorSubComp, inReal[i] );
+         TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorSub );
+         numeratorComp += numeratorSubComp;
+      }
+      middleIdx++;
+      for( i=middleIdx; i <= todayIdx; i++ )
+      {
+         TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, inReal[i] );
+         TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorAdd );
+         numeratorComp += numeratorAddComp;
+      }
+
+      tempReal = inReal[trailingIdx++];
+      outReal[outIdx++] = (numerator+numeratorComp) * factor;
+      todayIdx++;
+
+      while( todayIdx <= endIdx )
+      {
+         TA_COMPENSATED_ADD( numerator, numeratorComp, -numeratorSub );
+         numeratorComp -= numeratorSubComp;
+         TA_COMPENSATED_ADD( numeratorSub, numeratorSubComp, -tempReal );
+         tempReal = inReal[middleIdx++];
+         TA_COMPENSATED_ADD( numeratorSub, numeratorSubComp, tempReal );
+
+         if( (optInTimePeriod % 2) == 1 )
+         {
+            TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorAdd );
+            numeratorComp += numeratorAddComp;
+            TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, -tempReal );
+         }
+         else
+         {
+            TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, -tempReal );
+            TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorAdd );
+            numeratorComp += numeratorAddComp;
+         }
+         tempReal = inReal[todayIdx++];
+         TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, tempReal );
+
+         TA_COMPENSATED_ADD( numerator, numeratorComp, tempReal );
+
+         tempReal = inReal[trailingIdx++];
+         outReal[outIdx++] = (numerator+numeratorComp) * factor;
+      }
+
+      VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
    if( (optInTimePeriod % 2) == 1 )
    {
       /* Logic for Odd period */
@@ -532,6 +609,7 @@
 /* Generated */    double numeratorAdd;
 /* Generated */    int i, outIdx, todayIdx, trailingIdx, middleIdx;
 /* Generated */    double factor, tempReal;
+/* Generated */    double numeratorComp, numeratorSubComp, numeratorAddComp;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -559,6 +637,68 @@
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
 /* Generated */    outIdx = 0;
+/* Generated */    if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
+/* Generated */    {
+/* Generated */       i = (optInTimePeriod>>1);
+/* Generated */       trailingIdx = startIdx-lookbackTotal;
+/* Generated */       if( (optInTimePeriod % 2) == 1 )
+/* Generated */       {
+/* Generated */          factor    = 1.0/((double)(i+1)*(i+1));
+/* Generated */          middleIdx = trailingIdx + i;
+/* Generated */       }
+/* Generated */       else
+/* Generated */       {
+/* Generated */          factor    = 1.0/((double)i*(i+1));
+/* Generated */          middleIdx = trailingIdx + i - 1;
+/* Generated */       }
+/* Generated */       todayIdx = middleIdx + i;
+/* Generated */       numerator = numeratorSub = numeratorAdd = 0.0;
+/* Generated */       numeratorComp = numeratorSubComp = numeratorAddComp = 0.0;
+/* Generated */       for( i=middleIdx; i >= trailingIdx; i-- )
+/* Generated */       {
+/* Generated */          TA_COMPENSATED_ADD( numeratorSub, numeratorSubComp, inReal[i] );
+/* Generated */          TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorSub );
+/* Generated */          numeratorComp += numeratorSubComp;
+/* Generated */       }
+/* Generated */       middleIdx++;
+/* Generated */       for( i=middleIdx; i <= todayIdx; i++ )
+/* Generated */       {
+/* Generated */          TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, inReal[i] );
+/* Generated */          TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorAdd );
+/* Generated */          numeratorComp += numeratorAddComp;
+/* Generated */       }
+/* Generated */       tempReal = inReal[trailingIdx++];
+/* Generated */       outReal[outIdx++] = (numerator+numeratorComp) * factor;
+/* Generated */       todayIdx++;
+/* Generated */       while( todayIdx <= endIdx )
+/* Generated */       {
+/* Generated */          TA_COMPENSATED_ADD( numerator, numeratorComp, -numeratorSub );
+/* Generated */          numeratorComp -= numeratorSubComp;
+/* Generated */          TA_COMPENSATED_ADD( numeratorSub, numeratorSubComp, -tempReal );
+/* Generated */          tempReal = inReal[middleIdx++];
+/* Generated */          TA_COMPENSATED_ADD( numeratorSub, numeratorSubComp, tempReal );
+/* Generated */          if( (optInTimePeriod % 2) == 1 )
+/* Generated */          {
+/* Generated */             TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorAdd );
+/* Generated */             numeratorComp += numeratorAddComp;
+/* Generated */             TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, -tempReal );
+/* Generated */          }
+/* Generated */          else
+/* Generated */          {
+/* Generated */             TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, -tempReal );
+/* Generated */             TA_COMPENSATED_ADD( numerator, numeratorComp, numeratorAdd );
+/* Generated */             numeratorComp += numeratorAddComp;
+/* Generated */          }
+/* Generated */          tempReal = inReal[todayIdx++];
+/* Generated */          TA_COMPENSATED_ADD( numeratorAdd, numeratorAddComp, tempReal );
+/* Generated */          TA_COMPENSATED_ADD( numerator, numeratorComp, tempReal );
+/* Generated */          tempReal = inReal[trailingIdx++];
+/* Generated */          outReal[outIdx++] = (numerator+numeratorComp) * factor;
+/* Generated */       }
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
 /* Generated */    if( (optInTimePeriod % 2) == 1 )
 /* Generated */    {
 /* Generated */       i = (optInTimePeriod>>1);
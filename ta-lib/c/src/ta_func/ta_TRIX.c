@@ -105,6 +105,8 @@
 
    /* insert lookback code here. */
    emaLookback = LOOKBACK_CALL(EMA)( optInTimePeriod );
+   if( emaLookback < 0 )
+      emaLookback = 0; /* EMA rejects a period of 1, the EMA is the input. */
    return (emaLookback*3) + LOOKBACK_CALL(ROCR)( 1 );
 }
 
@@ -159,14 +161,11 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* Insert local variables here. */
-   double k;
-   ARRAY_REF(tempBuffer);
-   VALUE_HANDLE_INT(nbElement);
-   VALUE_HANDLE_INT(begIdx);
+   double k, firstEMA, secondEMA, thirdEMA, prevThirdEMA;
+   int today, outIdx, firstEMABegIdx, rocBegIdx, nbElementToOutput;
+   int firstEMACount, secondEMACount, thirdEMACount;
    int totalLookback;
    int emaLookback, rocLookback;
-   ENUM_DECLARATION(RetCode) retCode;
-   int nbElementToOutput;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -200,6 +199,8 @@
 
    /* Adjust the startIdx to account for the lookback. */
    emaLookback   = LOOKBACK_CALL(EMA)( optInTimePeriod );
+   if( emaLookback < 0 )
+      emaLookback = 0; /* EMA rejects a period of 1, the EMA is the input. */
    rocLookback   = LOOKBACK_CALL(ROCR)( 1 );
    totalLookback = (emaLookback*3) + rocLookback;
 
@@ -216,95 +217,66 @@
 
    VALUE_HANDLE_DEREF(outBegIdx) = startIdx; 
 
-   nbElementToOutput = (endIdx-startIdx)+1+totalLookback;
+   nbElementToOutput = (endIdx-startIdx)+1;
 
-   /* Allocate a temporary buffer for performing
-    * the calculation.
+   /* The three EMAs and the 1-day Rate-Of-Change are evaluated in
+    * a single pass, each EMA is fed each value of the previous one
+    * as soon as it is computed. The values are the same as running
+    * TA_INT_EMA on the input from 'firstEMABegIdx', then on the
+    * buffer of the output of the previous EMA (see
+    * TA_EMA_CASCADE_FEED), and TA_ROC on the third EMA.
+    *
+    * The first EMA used to start at startIdx-totalLookback, but
+    * the following stages were aligned as if it started at
+    * startIdx-totalLookback+emaLookback. The ROC begins at
+    * 'rocBegIdx' to give the same values: it is startIdx when
+    * startIdx is the lookback, and startIdx-emaLookback when the
+    * first EMA has enough input before startIdx-totalLookback.
     */
-   ARRAY_ALLOC(tempBuffer, nbElementToOutput );
+   k = PER_TO_K(optInTimePeriod);
+   firstEMABegIdx = startIdx-totalLookback;
+   if( firstEMABegIdx < emaLookback )
+      firstEMABegIdx = emaLookback;
+   rocBegIdx = firstEMABegIdx+(emaLookback*2)+rocLookback;
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+      today = firstEMABegIdx-emaLookback;
+   else
+      today = 0;
+   firstEMA  = 0.0;
+   secondEMA = 0.0;
+   thirdEMA  = 0.0;
+   firstEMACount  = 0;
+   secondEMACount = 0;
+   thirdEMACount  = 0;
 
-   #if !defined( _JAVA ) && !defined( USE_SUBARRAY )
-      if( !tempBuffer )
-      {
-         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-      }
-   #endif
-
-   /* Calculate the first EMA */   
-   k = PER_TO_K(optInTimePeriod);  
-   retCode = FUNCTION_CALL(INT_EMA)( (startIdx-totalLookback), endIdx, inReal,
-                                     optInTimePeriod, k,
-                                     VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
-								     tempBuffer );
-   
-   /* Verify for failure or if not enough data after
-    * calculating the EMA.
-    */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(nbElement) == 0) )
-   {
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      ARRAY_FREE( tempBuffer );
-      return retCode;
-   }
-
-   nbElementToOutput--; /* Make this variable zero base from now on. */
-
-   /* Calculate the second EMA */   
-   nbElementToOutput -= emaLookback;
-   retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, nbElementToOutput, tempBuffer,
-                                            optInTimePeriod, k,
-                                            VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
-						                    tempBuffer );
-   
-   /* Verify for failure or if not enough data after
-    * calculating the EMA.
-    */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(nbElement) == 0) )
+   /* Seed the EMAs, up to the value before the first ROC. */
+   while( today < rocBegIdx )
    {
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      ARRAY_FREE( tempBuffer );
-      return retCode;
+      TA_EMA_CASCADE_FEED(firstEMA,firstEMACount,inReal[today],optInTimePeriod,k);
+      if( today >= firstEMABegIdx )
+         TA_EMA_CASCADE_FEED(secondEMA,secondEMACount,firstEMA,optInTimePeriod,k);
+      if( today >= firstEMABegIdx+emaLookback )
+         TA_EMA_CASCADE_FEED(thirdEMA,thirdEMACount,secondEMA,optInTimePeriod,k);
+      today++;
    }
 
-   /* Calculate the third EMA */   
-   nbElementToOutput -= emaLookback;
-   retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, nbElementToOutput, tempBuffer,
-                                            optInTimePeriod, k,
-                                            VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
-						                    tempBuffer );
-   
-   /* Verify for failure or if not enough data after
-    * calculating the EMA.
+   /* Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
     */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(nbElement) == 0) )
+   outIdx = 0;
+   while( outIdx < nbElementToOutput )
    {
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      ARRAY_FREE( tempBuffer );
-      return retCode;
+      prevThirdEMA = thirdEMA;
+      firstEMA  = ((inReal[today++]-firstEMA)*k) + firstEMA;
+      secondEMA = ((firstEMA-secondEMA)*k) + secondEMA;
+      thirdEMA  = ((secondEMA-thirdEMA)*k) + thirdEMA;
+      if( prevThirdEMA != 0.0 )
+         outReal[outIdx++] = ((thirdEMA / prevThirdEMA)-1.0)*100.0;
+      else
+         outReal[outIdx++] = 0.0;
    }
 
-   /* Calculate the 1-day Rate-Of-Change */
-   nbElementToOutput -= emaLookback;
-   retCode = FUNCTION_CALL_DOUBLE(ROC)( 0, nbElementToOutput,
-                                        tempBuffer,
-                                        1,  VALUE_HANDLE_OUT(begIdx), outNBElement,
-                                        outReal );
-
-   ARRAY_FREE( tempBuffer );
-   /* Verify for failure or if not enough data after
-    * calculating the rate-of-change.
-    */
-   if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || ((int)VALUE_HANDLE_DEREF(outNBElement) == 0) )
-   {
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      return retCode;
-   }
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
@@ -353,14 +325,11 @@
 /* Generated */                       double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    double k;
-/* Generated */    ARRAY_REF(tempBuffer);
-/* Generated */    VALUE_HANDLE_INT(nbElement);
-/* Generated */    VALUE_HANDLE_INT(begIdx);
+/* Generated */    double k, firstEMA, secondEMA, thirdEMA, prevThirdEMA;
+/* Generated */    int today, outIdx, firstEMABegIdx, rocBegIdx, nbElementToOutput;
+/* Generated */    int firstEMACount, secondEMACount, thirdEMACount;
 /* Generated */    int totalLookback;
 /* Generated */    int emaLookback, rocLookback;
-/* Generated */    ENUM_DECLARATION(RetCode) retCode;
-/* Generated */    int nbElementToOutput;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -379,6 +348,8 @@
 /* Generated */     #endif 
 /* Generated */  #endif 
 /* Generated */    emaLookback   = LOOKBACK_CALL(EMA)( optInTimePeriod );
+/* Generated */    if( emaLookback < 0 )
+/* Generated */       emaLookback = 0; 
 /* Generated */    rocLookback   = LOOKBACK_CALL(ROCR)( 1 );
 /* Generated */    totalLookback = (emaLookback*3) + rocLookback;
 /* Generated */    if( startIdx < totalLookback )
@@ -390,65 +361,44 @@
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success); 
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx; 
-/* Generated */    nbElementToOutput = (endIdx-startIdx)+1+totalLookback;
-/* Generated */    ARRAY_ALLOC(tempBuffer, nbElementToOutput );
-/* Generated */    #if !defined( _JAVA ) && !defined( USE_SUBARRAY )
-/* Generated */       if( !tempBuffer )
-/* Generated */       {
-/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
-/* Generated */       }
-/* Generated */    #endif
-/* Generated */    k = PER_TO_K(optInTimePeriod);  
-/* Generated */    retCode = FUNCTION_CALL(INT_EMA)( (startIdx-totalLookback), endIdx, inReal,
-/* Generated */                                      optInTimePeriod, k,
-/* Generated */                                      VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
-/* Generated */ 								     tempBuffer );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(nbElement) == 0) )
+/* Generated */    nbElementToOutput = (endIdx-startIdx)+1;
+/* Generated */    k = PER_TO_K(optInTimePeriod);
+/* Generated */    firstEMABegIdx = startIdx-totalLookback;
+/* Generated */    if( firstEMABegIdx < emaLookback )
+/* Generated */       firstEMABegIdx = emaLookback;
+/* Generated */    rocBegIdx = firstEMABegIdx+(emaLookback*2)+rocLookback;
+/* Generated */    if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+/* Generated */       today = firstEMABegIdx-emaLookback;
+/* Generated */    else
+/* Generated */       today = 0;
+/* Generated */    firstEMA  = 0.0;
+/* Generated */    secondEMA = 0.0;
+/* Generated */    thirdEMA  = 0.0;
+/* Generated */    firstEMACount  = 0;
+/* Generated */    secondEMACount = 0;
+/* Generated */    thirdEMACount  = 0;
+/* Generated */    while( today < rocBegIdx )
 /* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       ARRAY_FREE( tempBuffer );
-/* Generated */       return retCode;
+/* Generated */       TA_EMA_CASCADE_FEED(firstEMA,firstEMACount,inReal[today],optInTimePeriod,k);
+/* Generated */       if( today >= firstEMABegIdx )
+/* Generated */          TA_EMA_CASCADE_FEED(secondEMA,secondEMACount,firstEMA,optInTimePeriod,k);
+/* Generated */       if( today >= firstEMABegIdx+emaLookback )
+/* Generated */          TA_EMA_CASCADE_FEED(thirdEMA,thirdEMACount,secondEMA,optInTimePeriod,k);
+/* Generated */       today++;
 /* Generated */    }
-/* Generated */    nbElementToOutput--; 
-/* Generated */    nbElementToOutput -= emaLookback;
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, nbElementToOutput, tempBuffer,
-/* Generated */                                             optInTimePeriod, k,
-/* Generated */                                             VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
-/* Generated */ 						                    tempBuffer );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(nbElement) == 0) )
+/* Generated */    outIdx = 0;
+/* Generated */    while( outIdx < nbElementToOutput )
 /* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       ARRAY_FREE( tempBuffer );
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    nbElementToOutput -= emaLookback;
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(INT_EMA)( 0, nbElementToOutput, tempBuffer,
-/* Generated */                                             optInTimePeriod, k,
-/* Generated */                                             VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
-/* Generated */ 						                    tempBuffer );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || (VALUE_HANDLE_GET(nbElement) == 0) )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       ARRAY_FREE( tempBuffer );
-/* Generated */       return retCode;
-/* Generated */    }
-/* Generated */    nbElementToOutput -= emaLookback;
-/* Generated */    retCode = FUNCTION_CALL_DOUBLE(ROC)( 0, nbElementToOutput,
-/* Generated */                                         tempBuffer,
-/* Generated */                                         1,  VALUE_HANDLE_OUT(begIdx), outNBElement,
-/* Generated */                                         outReal );
-/* Generated */    ARRAY_FREE( tempBuffer );
-/* Generated */    if( (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) || ((int)VALUE_HANDLE_DEREF(outNBElement) == 0) )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       return retCode;
+/* Generated */       prevThirdEMA = thirdEMA;
+/* Generated */       firstEMA  = ((inReal[today++]-firstEMA)*k) + firstEMA;
+/* Generated */       secondEMA = ((firstEMA-secondEMA)*k) + secondEMA;
+/* Generated */       thirdEMA  = ((secondEMA-thirdEMA)*k) + thirdEMA;
+/* Generated */       if( prevThirdEMA != 0.0 )
+/* Generated */          outReal[outIdx++] = ((thirdEMA / prevThirdEMA)-1.0)*100.0;
+/* Generated */       else
+/* Generated */          outReal[outIdx++] = 0.0;
 /* Generated */    }
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
@@ -254,8 +254,8 @@ TA_RetCode TA_PREFIX(INT_VAR)( int    startIdx,
                                double      *outReal )
 #endif
 {
-   double tempReal, periodTotal1, periodTotal2, meanValue1, meanValue2;
-   int i, outIdx, trailingIdx, nbInitialElementNeeded;
+   double tempReal, meanValue, sumDev2, trailingValue, offset;
+   int i, today, outIdx, trailingIdx, nbInitialElementNeeded;
 
    /* Validate the calculation method type and
     * identify the minimum number of price bar needed
@@ -277,54 +277,59 @@ TA_RetCode TA_PREFIX(INT_VAR)( int    startIdx,
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
-   /* Do the MA calculation using tight loops. */
-   /* Add-up the initial periods, except for the last value. */
-   periodTotal1 = 0;
-   periodTotal2 = 0;
-   trailingIdx = startIdx-nbInitialElementNeeded;
-
-   i=trailingIdx;
-   if( optInTimePeriod > 1 )
-   {
-      while( i < startIdx ) {
-         tempReal = inReal[i++];
-         periodTotal1 += tempReal;
-         tempReal *= tempReal;
-         periodTotal2 += tempReal;
-      }
-   }
-
-   /* Proceed with the calculation for the requested range.
+   /* The variance is the mean of the squared deviations (sumDev2)
+    * over the period. The mean and sumDev2 are rolled with the
+    * Welford update of TA_MOMENTS_REPLACE instead of keeping the
+    * sums of x and x*x, these sums lose all the precision when the
+    * values are large compared to their spread.
+    *
+    * Every TA_MOMENTS_RESUM_PERIOD outputs, the moments are
+    * rebuilt from the whole period with two passes. The values
+    * are taken relative to the last value at that time, so the
+    * rounding of the mean is relative to the spread of the
+    * values rather than to their magnitude.
+    *
     * Note that this algorithm allows the inReal and
     * outReal to be the same buffer.
     */
+   meanValue = sumDev2 = trailingValue = offset = 0.0;
+   today  = startIdx;
    outIdx = 0;
    do
    {
-      tempReal = inReal[i++];
-
-      /* Square and add all the deviation over
-       * the same periods.
-       */
+      if( (outIdx % TA_MOMENTS_RESUM_PERIOD) == 0 )
+      {
+         trailingIdx = today-nbInitialElementNeeded;
+         offset = inReal[today];
+         meanValue = 0.0;
+         for( i=trailingIdx; i <= today; i++ )
+            meanValue += inReal[i]-offset;
+         meanValue /= optInTimePeriod;
 
-      periodTotal1 += tempReal;
-      tempReal *= tempReal;
-      periodTotal2 += tempReal;
+         sumDev2 = 0.0;
+         for( i=trailingIdx; i <= today; i++ )
+         {
+            tempReal = (inReal[i]-offset)-meanValue;
+            sumDev2 += tempReal*tempReal;
+         }
+      }
+      else
+      {
+         tempReal = inReal[today]-offset;
+         TA_MOMENTS_REPLACE( optInTimePeriod, meanValue, sumDev2, tempReal, trailingValue );
+      }
 
-      /* Square and add all the deviation over
-       * the same period.
+      /* Read the value leaving the period on the next
+       * iteration before writing the output, the input
+       * and output might be the same buffer.
        */
+      trailingValue = inReal[today-nbInitialElementNeeded]-offset;
 
-      meanValue1 = periodTotal1 / optInTimePeriod;
-      meanValue2 = periodTotal2 / optInTimePeriod;
-
-      tempReal = inReal[trailingIdx++];
-      periodTotal1 -= tempReal;
-      tempReal *= tempReal;
-      periodTotal2 -= tempReal;
-
-      outReal[outIdx++] = meanValue2-meanValue1*meanValue1;
-   } while( i <= endIdx );
+      if( sumDev2 > 0.0 )
+         outReal[outIdx++] = sumDev2/optInTimePeriod;
+      else
+         outReal[outIdx++] = 0.0;
+   } while( ++today <= endIdx );
 
    /* All done. Indicate the output limits and return. */
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
@@ -444,8 +449,8 @@ TA_RetCode TA_PREFIX(INT_VAR)( int    startIdx,
 /* Generated */                                double      *outReal )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    double tempReal, periodTotal1, periodTotal2, meanValue1, meanValue2;
-/* Generated */    int i, outIdx, trailingIdx, nbInitialElementNeeded;
+/* Generated */    double tempReal, meanValue, sumDev2, trailingValue, offset;
+/* Generated */    int i, today, outIdx, trailingIdx, nbInitialElementNeeded;
 /* Generated */    nbInitialElementNeeded = (optInTimePeriod-1);
 /* Generated */    if( startIdx < nbInitialElementNeeded )
 /* Generated */       startIdx = nbInitialElementNeeded;
@@ -455,34 +460,37 @@ TA_RetCode TA_PREFIX(INT_VAR)( int    startIdx,
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
-/* Generated */    periodTotal1 = 0;
-/* Generated */    periodTotal2 = 0;
-/* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
-/* Generated */    i=trailingIdx;
-/* Generated */    if( optInTimePeriod > 1 )
-/* Generated */    {
-/* Generated */       while( i < startIdx ) {
-/* Generated */          tempReal = inReal[i++];
-/* Generated */          periodTotal1 += tempReal;
-/* Generated */          tempReal *= tempReal;
-/* Generated */          periodTotal2 += tempReal;
-/* Generated */       }
-/* Generated */    }
+/* Generated */    meanValue = sumDev2 = trailingValue = offset = 0.0;
+/* Generated */    today  = startIdx;
 /* Generated */    outIdx = 0;
 /* Generated */    do
 /* Generated */    {
-/* Generated */       tempReal = inReal[i++];
-/* Generated */       periodTotal1 += tempReal;
-/* Generated */       tempReal *= tempReal;
-/* Generated */       periodTotal2 += tempReal;
-/* Generated */       meanValue1 = periodTotal1 / optInTimePeriod;
-/* Generated */       meanValue2 = periodTotal2 / optInTimePeriod;
-/* Generated */       tempReal = inReal[trailingIdx++];
-/* Generated */       periodTotal1 -= tempReal;
-/* Generated */       tempReal *= tempReal;
-/* Generated */       periodTotal2 -= tempReal;
-/* Generated */       outReal[outIdx++] = meanValue2-meanValue1*meanValue1;
-/* Generated */    } while( i <= endIdx );
+/* Generated */       if( (outIdx % TA_MOMENTS_RESUM_PERIOD) == 0 )
+/* Generated */       {
+/* Generated */          trailingIdx = today-nbInitialElementNeeded;
+/* Generated */          offset = inReal[today];
+/* Generated */          meanValue = 0.0;
+/* Generated */          for( i=trailingIdx; i <= today; i++ )
+/* Generated */             meanValue += inReal[i]-offset;
+/* Generated */          meanValue /= optInTimePeriod;
+/* Generated */          sumDev2 = 0.0;
+/* Generated */          for( i=trailingIdx; i <= today; i++ )
+/* Generated */          {
+/* Generated */             tempReal = (inReal[i]-offset)-meanValue;
+/* Generated */             sumDev2 += tempReal*tempReal;
+/* Generated */          }
+/* Generated */       }
+/* Generated */       else
+/* Generated */       {
+/* Generated */          tempReal = inReal[today]-offset;
+/* Generated */          TA_MOMENTS_REPLACE( optInTimePeriod, meanValue, sumDev2, tempReal, trailingValue );
+/* Generated */       }
+/* Generated */       trailingValue = inReal[today-nbInitialElementNeeded]-offset;
+/* Generated */       if( sumDev2 > 0.0 )
+/* Generated */          outReal[outIdx++] = sumDev2/optInTimePeriod;
+/* Generated */       else
+/* Generated */          outReal[outIdx++] = 0.0;
+/* Generated */    } while( ++today <= endIdx );
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -160,6 +160,7 @@
    /* Insert local variables here. */
    int inIdx, outIdx, i, trailingIdx, divider;
    double periodSum, periodSub, tempReal, trailingValue;
+   double periodSumComp, periodSubComp;
    int lookbackTotal;
 
    #if defined( USE_SINGLE_PRECISION_INPUT )
@@ -266,6 +267,45 @@
    outIdx      = 0;
    trailingIdx = startIdx - lookbackTotal;
 
+   if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
+   {
+      /* Same as below with compensated sums, see TA_SetPrecision.
+       * The products by the weights are added without rounding
+       * error by TA_COMPENSATED_ADD_PRODUCT.
+       */
+      periodSum = periodSub = periodSumComp = periodSubComp = 0.0;
+      inIdx=trailingIdx;
+      i = 1;
+      while( inIdx < startIdx )
+      {
+         tempReal = inReal[inIdx++];
+         TA_COMPENSATED_ADD( periodSub, periodSubComp, tempReal );
+         TA_COMPENSATED_ADD_PRODUCT( periodSum, periodSumComp, tempReal, i );
+         i++;
+      }
+      trailingValue = 0.0;
+
+      while( inIdx <= endIdx )
+      {
+         tempReal = inReal[inIdx++];
+         TA_COMPENSATED_ADD( periodSub, periodSubComp, tempReal );
+         TA_COMPENSATED_ADD( periodSub, periodSubComp, -trailingValue );
+         TA_COMPENSATED_ADD_PRODUCT( periodSum, periodSumComp, tempReal, optInTimePeriod );
+
+         trailingValue = inReal[trailingIdx++];
+
+         outReal[outIdx++] = (periodSum+periodSumComp) / divider;
+
+         TA_COMPENSATED_ADD( periodSum, periodSumComp, -periodSub );
+         periodSumComp -= periodSubComp;
+      }
+
+      VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
    /* Evaluate the initial periodSum/periodSub and trailingValue. */
    periodSum = periodSub = (double)0.0;
    inIdx=trailingIdx;
@@ -357,6 +397,7 @@
 /* Generated */ {
 /* Generated */    int inIdx, outIdx, i, trailingIdx, divider;
 /* Generated */    double periodSum, periodSub, tempReal, trailingValue;
+/* Generated */    double periodSumComp, periodSubComp;
 /* Generated */    int lookbackTotal;
 /* Generated */    #if defined( USE_SINGLE_PRECISION_INPUT )
 /* Generated */       ARRAY_MEMMOVEMIX_VAR;
@@ -401,6 +442,34 @@
 /* Generated */    divider = (optInTimePeriod*(optInTimePeriod+1))>>1;
 /* Generated */    outIdx      = 0;
 /* Generated */    trailingIdx = startIdx - lookbackTotal;
+/* Generated */    if( TA_GLOBALS_PRECISION == ENUM_VALUE(Precision,TA_PRECISION_COMPENSATED,Compensated) )
+/* Generated */    {
+/* Generated */       periodSum = periodSub = periodSumComp = periodSubComp = 0.0;
+/* Generated */       inIdx=trailingIdx;
+/* Generated */       i = 1;
+/* Generated */       while( inIdx < startIdx )
+/* Generated */       {
+/* Generated */          tempReal = inReal[inIdx++];
+/* Generated */          TA_COMPENSATED_ADD( periodSub, periodSubComp, tempReal );
+/* Generated */          TA_COMPENSATED_ADD_PRODUCT( periodSum, periodSumComp, tempReal, i );
+/* Generated */          i++;
+/* Generated */       }
+/* Generated */       trailingValue = 0.0;
+/* Generated */       while( inIdx <= endIdx )
+/* Generated */       {
+/* Generated */          tempReal = inReal[inIdx++];
+/* Generated */          TA_COMPENSATED_ADD( periodSub, periodSubComp, tempReal );
+/* Generated */          TA_COMPENSATED_ADD( periodSub, periodSubComp, -trailingValue );
+/* Generated */          TA_COMPENSATED_ADD_PRODUCT( periodSum, periodSumComp, tempReal, optInTimePeriod );
+/* Generated */          trailingValue = inReal[trailingIdx++];
+/* Generated */          outReal[outIdx++] = (periodSum+periodSumComp) / divider;
+/* Generated */          TA_COMPENSATED_ADD( periodSum, periodSumComp, -periodSub );
+/* Generated */          periodSumComp -= periodSubComp;
+/* Generated */       }
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
 /* Generated */    periodSum = periodSub = (double)0.0;
 /* Generated */    inIdx=trailingIdx;
 /* Generated */    i = 1;
@@ -0,0 +1,2366 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Scan of all the candlestick patterns.
+ *
+ * Each TA_CDL function makes its own pass over the prices: it
+ * recomputes the real body, the shadows and the range of every
+ * candle, and keeps its own running total for each candle setting
+ * it compares to. TA_INT_CDL evaluates any set of these patterns
+ * from a single copy of that state:
+ *
+ *  - the features of a candle (real body, shadows, high-low range,
+ *    color) are computed once per bar.
+ *  - the average of each candle setting, the TA_CANDLEAVERAGE of
+ *    the functions, is computed once per bar from one running total
+ *    per setting.
+ *  - the rule of each requested pattern, the same code as in its
+ *    TA_CDL function, then reads the features and the averages.
+ *
+ * The bars are processed by blocks small enough for the features
+ * and the averages to stay in the cache while all the rules of a
+ * block are evaluated. The running totals are restarted at each
+ * block, so an average may differ from the one of the function in
+ * the last bits: the result of a pattern can only differ from its
+ * TA_CDL function when a candle is within rounding of the limit.
+ */
+
+#if !defined( _MANAGED ) && !defined( _JAVA )
+   #include <math.h>
+   #include "ta_utility.h"
+   #include "ta_func.h"
+   #include "ta_memory.h"
+
+/* Number of output bars per block. */
+#define TA_CANDLE_BLOCK 1024
+
+/* Number of bars before the first output of a block read by the
+ * rules: the 1st candle of the 5 candles patterns, and the 2nd
+ * candle of the patterns preceding a block for the hikkake.
+ */
+#define TA_CANDLE_BACK 5
+
+typedef struct
+{
+   const double *realBody;
+   const double *upperShadow;
+   const double *lowerShadow;
+   const double *highLowRange;
+   const int    *candleColor;
+   const double *average[TA_AllCandleSettings];
+} TA_CandleFeatures;
+
+/* Evaluate a pattern from bar i to endIdx, the indexes are relative
+ * to the first bar of the features.
+ */
+typedef void (*TA_CandleRule)( const TA_CandleFeatures *features,
+                               const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                               double optInPenetration, int i, int endIdx, int outInteger[] );
+
+typedef struct
+{
+   TA_CandleRule rule;
+   int (*lookback)( void );
+   int (*lookbackPenetration)( double optInPenetration );
+   double optInPenetration;
+   unsigned int settings; /* The averages read by the rule. */
+} TA_CandlePattern;
+
+#define TA_CANDLE_SETTING(SET) (1u << TA_##SET)
+
+/* The candlestick macros of the rules read the features. */
+#undef TA_REALBODY
+#undef TA_UPPERSHADOW
+#undef TA_LOWERSHADOW
+#undef TA_HIGHLOWRANGE
+#undef TA_CANDLECOLOR
+#undef TA_CANDLEAVERAGE
+#define TA_REALBODY(IDX)          ( features->realBody[IDX] )
+#define TA_UPPERSHADOW(IDX)       ( features->upperShadow[IDX] )
+#define TA_LOWERSHADOW(IDX)       ( features->lowerShadow[IDX] )
+#define TA_HIGHLOWRANGE(IDX)      ( features->highLowRange[IDX] )
+#define TA_CANDLECOLOR(IDX)       ( features->candleColor[IDX] )
+#define TA_CANDLEAVERAGE(SET,IDX) ( features->average[TA_##SET][IDX] )
+
+static void scanCDL2CROWS( const TA_CandleFeatures *features,
+                           const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                           double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == 1 &&                                                         // 1st: white
+            TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                          //      long
+            TA_CANDLECOLOR(i-1) == -1 &&                                                        // 2nd: black
+            TA_REALBODYGAPUP(i-1,i-2) &&                                                        //      gapping up
+            TA_CANDLECOLOR(i) == -1 &&                                                          // 3rd: black
+            inOpen[i] < inOpen[i-1] && inOpen[i] > inClose[i-1] &&                              //      opening within 2nd rb
+            inClose[i] > inOpen[i-2] && inClose[i] < inClose[i-2]                               //      closing within 1st rb
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDL3BLACKCROWS( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-3) == 1 &&                                         // white
+            TA_CANDLECOLOR(i-2) == -1 &&                                        // 1st black
+            TA_LOWERSHADOW(i-2) < TA_CANDLEAVERAGE( ShadowVeryShort, i-2 ) &&
+                                                                                // very short lower shadow
+            TA_CANDLECOLOR(i-1) == -1 &&                                        // 2nd black
+            TA_LOWERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+                                                                                // very short lower shadow
+            TA_CANDLECOLOR(i) == -1 &&                                          // 3rd black
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+                                                                                // very short lower shadow
+            inOpen[i-1] < inOpen[i-2] && inOpen[i-1] > inClose[i-2] &&          // 2nd black opens within 1st black's rb
+            inOpen[i] < inOpen[i-1] && inOpen[i] > inClose[i-1] &&              // 3rd black opens within 2nd black's rb
+            inHigh[i-3] > inClose[i-2] &&                                       // 1st black closes under prior candle's high
+            inClose[i-2] > inClose[i-1] &&                                      // three declining
+            inClose[i-1] > inClose[i]                                           // three declining
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDL3INSIDE( const TA_CandleFeatures *features,
+                            const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                            double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              // 1st: long
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyShort, i-1 ) &&                            // 2nd: short
+            max( inClose[i-1], inOpen[i-1] ) < max( inClose[i-2], inOpen[i-2] ) &&                  //      engulfed by 1st
+            min( inClose[i-1], inOpen[i-1] ) > min( inClose[i-2], inOpen[i-2] ) &&
+            ( ( TA_CANDLECOLOR(i-2) == 1 && TA_CANDLECOLOR(i) == -1 && inClose[i] < inOpen[i-2] )   // 3rd: opposite to 1st
+              ||                                                                                    //      and closing out
+              ( TA_CANDLECOLOR(i-2) == -1 && TA_CANDLECOLOR(i) == 1 && inClose[i] > inOpen[i-2] )
+            )
+          )
+            outInteger[outIdx++] = -TA_CANDLECOLOR(i-2) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDL3LINESTRIKE( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-3) == TA_CANDLECOLOR(i-2) &&                                   // three with same color
+            TA_CANDLECOLOR(i-2) == TA_CANDLECOLOR(i-1) &&
+            TA_CANDLECOLOR(i) == -TA_CANDLECOLOR(i-1) &&                                    // 4th opposite color
+                                                                                            // 2nd opens within/near 1st rb
+            inOpen[i-2] >= min( inOpen[i-3], inClose[i-3] ) - TA_CANDLEAVERAGE( Near, i-3 ) &&
+            inOpen[i-2] <= max( inOpen[i-3], inClose[i-3] ) + TA_CANDLEAVERAGE( Near, i-3 ) &&
+                                                                                            // 3rd opens within/near 2nd rb
+            inOpen[i-1] >= min( inOpen[i-2], inClose[i-2] ) - TA_CANDLEAVERAGE( Near, i-2 ) &&
+            inOpen[i-1] <= max( inOpen[i-2], inClose[i-2] ) + TA_CANDLEAVERAGE( Near, i-2 ) &&
+            (
+                (   // if three white
+                    TA_CANDLECOLOR(i-1) == 1 &&
+                    inClose[i-1] > inClose[i-2] && inClose[i-2] > inClose[i-3] &&           // consecutive higher closes
+                    inOpen[i] > inClose[i-1] &&                                             // 4th opens above prior close
+                    inClose[i] < inOpen[i-3]                                                // 4th closes below 1st open
+                ) ||
+                (   // if three black
+                    TA_CANDLECOLOR(i-1) == -1 &&
+                    inClose[i-1] < inClose[i-2] && inClose[i-2] < inClose[i-3] &&           // consecutive lower closes
+                    inOpen[i] < inClose[i-1] &&                                             // 4th opens below prior close
+                    inClose[i] > inOpen[i-3]                                                // 4th closes above 1st open
+                )
+            )
+          )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i-1) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDL3OUTSIDE( const TA_CandleFeatures *features,
+                             const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                             double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( ( TA_CANDLECOLOR(i-1) == 1 && TA_CANDLECOLOR(i-2) == -1 &&          // white engulfs black
+              inClose[i-1] > inOpen[i-2] && inOpen[i-1] < inClose[i-2] &&
+              inClose[i] > inClose[i-1]                                         // third candle higher
+            )
+            ||
+            ( TA_CANDLECOLOR(i-1) == -1 && TA_CANDLECOLOR(i-2) == 1 &&          // black engulfs white
+              inOpen[i-1] > inClose[i-2] && inClose[i-1] < inOpen[i-2] &&
+              inClose[i] < inClose[i-1]                                         // third candle lower
+            )
+          )
+       {
+            outInteger[outIdx++] = TA_CANDLECOLOR(i-1) * 100;
+        }
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDL3STARSINSOUTH( const TA_CandleFeatures *features,
+                                  const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                  double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == -1 &&                                    // 1st black
+            TA_CANDLECOLOR(i-1) == -1 &&                                    // 2nd black
+            TA_CANDLECOLOR(i) == -1 &&                                      // 3rd black
+                                                                            // 1st: long
+            TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&
+                                                                            //      with long lower shadow
+            TA_LOWERSHADOW(i-2) > TA_CANDLEAVERAGE( ShadowLong, i-2 ) &&
+            TA_REALBODY(i-1) < TA_REALBODY(i-2) &&                          // 2nd: smaller candle
+            inOpen[i-1] > inClose[i-2] && inOpen[i-1] <= inHigh[i-2] &&     //      that opens higher but within 1st range
+            inLow[i-1] < inClose[i-2] &&                                    //      and trades lower than 1st close
+            inLow[i-1] >= inLow[i-2] &&                                     //      but not lower than 1st low
+                                                                            //      and has a lower shadow
+            TA_LOWERSHADOW(i-1) > TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+                                                                            // 3rd: small marubozu
+            TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            inLow[i] > inLow[i-1] && inHigh[i] < inHigh[i-1]                //      engulfed by prior candle's range
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDL3WHITESOLDIERS( const TA_CandleFeatures *features,
+                                   const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                   double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == 1 &&                                                     // 1st white
+            TA_UPPERSHADOW(i-2) < TA_CANDLEAVERAGE( ShadowVeryShort, i-2 ) &&
+                                                                                            // very short upper shadow
+            TA_CANDLECOLOR(i-1) == 1 &&                                                     // 2nd white
+            TA_UPPERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+                                                                                            // very short upper shadow
+            TA_CANDLECOLOR(i) == 1 &&                                                       // 3rd white
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+                                                                                            // very short upper shadow
+            inClose[i] > inClose[i-1] && inClose[i-1] > inClose[i-2] &&                     // consecutive higher closes
+            inOpen[i-1] > inOpen[i-2] &&                                                    // 2nd opens within/near 1st real body
+            inOpen[i-1] <= inClose[i-2] + TA_CANDLEAVERAGE( Near, i-2 ) &&
+            inOpen[i] > inOpen[i-1] &&                                                      // 3rd opens within/near 2nd real body
+            inOpen[i] <= inClose[i-1] + TA_CANDLEAVERAGE( Near, i-1 ) &&
+            TA_REALBODY(i-1) > TA_REALBODY(i-2) - TA_CANDLEAVERAGE( Far, i-2 ) &&
+                                                                                            // 2nd not far shorter than 1st
+            TA_REALBODY(i) > TA_REALBODY(i-1) - TA_CANDLEAVERAGE( Far, i-1 ) &&
+                                                                                            // 3rd not far shorter than 2nd
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyShort, i )                            // not short real body
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLABANDONEDBABY( const TA_CandleFeatures *features,
+                                  const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                  double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              // 1st: long
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyDoji, i-1 ) &&                             // 2nd: doji
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyShort, i ) &&                                 // 3rd: longer than short
+            ( ( TA_CANDLECOLOR(i-2) == 1 &&                                                         // 1st white
+                TA_CANDLECOLOR(i) == -1 &&                                                          // 3rd black
+                inClose[i] < inClose[i-2] - TA_REALBODY(i-2) * optInPenetration &&                  // 3rd closes well within 1st rb
+                TA_CANDLEGAPUP(i-1,i-2) &&                                                          // upside gap between 1st and 2nd
+                TA_CANDLEGAPDOWN(i,i-1)                                                             // downside gap between 2nd and 3rd
+              )
+              ||
+              (
+                TA_CANDLECOLOR(i-2) == -1 &&                                                        // 1st black
+                TA_CANDLECOLOR(i) == 1 &&                                                           // 3rd white
+                inClose[i] > inClose[i-2] + TA_REALBODY(i-2) * optInPenetration &&                  // 3rd closes well within 1st rb
+                TA_CANDLEGAPDOWN(i-1,i-2) &&                                                        // downside gap between 1st and 2nd
+                TA_CANDLEGAPUP(i,i-1)                                                               // upside gap between 2nd and 3rd
+              )
+            )
+          )
+		{
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+		}
+        else
+		{
+            outInteger[outIdx++] = 0;
+		}
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLADVANCEBLOCK( const TA_CandleFeatures *features,
+                                 const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                 double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == 1 &&                                                     // 1st white
+            TA_CANDLECOLOR(i-1) == 1 &&                                                     // 2nd white
+            TA_CANDLECOLOR(i) == 1 &&                                                       // 3rd white
+            inClose[i] > inClose[i-1] && inClose[i-1] > inClose[i-2] &&                     // consecutive higher closes
+            inOpen[i-1] > inOpen[i-2] &&                                                    // 2nd opens within/near 1st real body
+            inOpen[i-1] <= inClose[i-2] + TA_CANDLEAVERAGE( Near, i-2 ) &&
+            inOpen[i] > inOpen[i-1] &&                                                      // 3rd opens within/near 2nd real body
+            inOpen[i] <= inClose[i-1] + TA_CANDLEAVERAGE( Near, i-1 ) &&
+            TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                      // 1st: long real body
+            TA_UPPERSHADOW(i-2) < TA_CANDLEAVERAGE( ShadowShort, i-2 ) &&
+                                                                                            // 1st: short upper shadow
+            (
+                // ( 2 far smaller than 1 && 3 not longer than 2 )
+                // advance blocked with the 2nd, 3rd must not carry on the advance
+                (
+                    TA_REALBODY(i-1) < TA_REALBODY(i-2) - TA_CANDLEAVERAGE( Far, i-2 ) &&
+                    TA_REALBODY(i) < TA_REALBODY(i-1) + TA_CANDLEAVERAGE( Near, i-1 )
+                ) ||
+                // 3 far smaller than 2
+                // advance blocked with the 3rd
+                (
+                    TA_REALBODY(i) < TA_REALBODY(i-1) - TA_CANDLEAVERAGE( Far, i-1 )
+                ) ||
+                // ( 3 smaller than 2 && 2 smaller than 1 && (3 or 2 not short upper shadow) )
+                // advance blocked with progressively smaller real bodies and some upper shadows
+                (
+                    TA_REALBODY(i) < TA_REALBODY(i-1) &&
+                    TA_REALBODY(i-1) < TA_REALBODY(i-2) &&
+                    (
+                        TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowShort, i ) ||
+                        TA_UPPERSHADOW(i-1) > TA_CANDLEAVERAGE( ShadowShort, i-1 )
+                    )
+                ) ||
+                // ( 3 smaller than 2 && 3 long upper shadow )
+                // advance blocked with 3rd candle's long upper shadow and smaller body
+                (
+                    TA_REALBODY(i) < TA_REALBODY(i-1) &&
+                    TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i )
+                )
+            )
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLBELTHOLD( const TA_CandleFeatures *features,
+                             const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                             double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&                                  // long body
+            (
+              ( // white body and very short lower shadow
+                TA_CANDLECOLOR(i) == 1 &&
+                TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i )
+              ) ||
+              ( // black body and very short upper shadow
+                TA_CANDLECOLOR(i) == -1 &&
+                TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i )
+              )
+            ) )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLBREAKAWAY( const TA_CandleFeatures *features,
+                              const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                              double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-4) > TA_CANDLEAVERAGE( BodyLong, i-4 ) &&                          // 1st long
+            TA_CANDLECOLOR(i-4) == TA_CANDLECOLOR(i-3) &&                   // 1st, 2nd, 4th same color, 5th opposite
+            TA_CANDLECOLOR(i-3) == TA_CANDLECOLOR(i-1) &&
+            TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&
+            (
+              ( TA_CANDLECOLOR(i-4) == -1 &&                                // when 1st is black:
+                TA_REALBODYGAPDOWN(i-3,i-4) &&                              // 2nd gaps down
+                inHigh[i-2] < inHigh[i-3] && inLow[i-2] < inLow[i-3] &&     // 3rd has lower high and low than 2nd
+                inHigh[i-1] < inHigh[i-2] && inLow[i-1] < inLow[i-2] &&     // 4th has lower high and low than 3rd
+                inClose[i] > inOpen[i-3] && inClose[i] < inClose[i-4]       // 5th closes inside the gap
+              )
+              ||
+              ( TA_CANDLECOLOR(i-4) == 1 &&                                 // when 1st is white:
+                TA_REALBODYGAPUP(i-3,i-4) &&                                // 2nd gaps up
+                inHigh[i-2] > inHigh[i-3] && inLow[i-2] > inLow[i-3] &&     // 3rd has higher high and low than 2nd
+                inHigh[i-1] > inHigh[i-2] && inLow[i-1] > inLow[i-2] &&     // 4th has higher high and low than 3rd
+                inClose[i] < inOpen[i-3] && inClose[i] > inClose[i-4]       // 5th closes inside the gap
+              )
+            )
+          )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLCLOSINGMARUBOZU( const TA_CandleFeatures *features,
+                                    const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                    double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&                                  // long body
+            (
+              ( // white body and very short lower shadow
+                TA_CANDLECOLOR(i) == 1 &&
+                TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i )
+              ) ||
+              ( // black body and very short upper shadow
+                TA_CANDLECOLOR(i) == -1 &&
+                TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i )
+              )
+            ) )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLCONCEALBABYSWALL( const TA_CandleFeatures *features,
+                                     const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                     double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-3) == -1 &&                                    // 1st black
+            TA_CANDLECOLOR(i-2) == -1 &&                                    // 2nd black
+            TA_CANDLECOLOR(i-1) == -1 &&                                    // 3rd black
+            TA_CANDLECOLOR(i) == -1 &&                                      // 4th black
+                                                                            // 1st: marubozu
+            TA_LOWERSHADOW(i-3) < TA_CANDLEAVERAGE( ShadowVeryShort, i-3 ) &&
+            TA_UPPERSHADOW(i-3) < TA_CANDLEAVERAGE( ShadowVeryShort, i-3 ) &&
+                                                                            // 2nd: marubozu
+            TA_LOWERSHADOW(i-2) < TA_CANDLEAVERAGE( ShadowVeryShort, i-2 ) &&
+            TA_UPPERSHADOW(i-2) < TA_CANDLEAVERAGE( ShadowVeryShort, i-2 ) &&
+            TA_REALBODYGAPDOWN(i-1,i-2) &&                                  // 3rd: opens gapping down
+                                                                            //      and HAS an upper shadow
+            TA_UPPERSHADOW(i-1) > TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+            inHigh[i-1] > inClose[i-2] &&                                   //      that extends into the prior body
+            inHigh[i] > inHigh[i-1] && inLow[i] < inLow[i-1]                // 4th: engulfs the 3rd including the shadows
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLCOUNTERATTACK( const TA_CandleFeatures *features,
+                                  const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                  double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&                                        // opposite candles
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                             // 1st long
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&                                 // 2nd long
+            inClose[i] <= inClose[i-1] + TA_CANDLEAVERAGE( Equal, i-1 ) &&                   // equal closes
+            inClose[i] >= inClose[i-1] - TA_CANDLEAVERAGE( Equal, i-1 )
+          )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLDARKCLOUDCOVER( const TA_CandleFeatures *features,
+                                   const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                   double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inLow);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == 1 &&                                                     // 1st: white
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                      //      long
+            TA_CANDLECOLOR(i) == -1 &&                                                      // 2nd: black
+            inOpen[i] > inHigh[i-1] &&                                                      //      open above prior high
+            inClose[i] > inOpen[i-1] &&                                                     //      close within prior body
+            inClose[i] < inClose[i-1] - TA_REALBODY(i-1) * optInPenetration
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLDOJI( const TA_CandleFeatures *features,
+                         const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                         double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLDOJISTAR( const TA_CandleFeatures *features,
+                             const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                             double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                          // 1st: long real body
+            TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) &&                             // 2nd: doji
+            ( ( TA_CANDLECOLOR(i-1) == 1 && TA_REALBODYGAPUP(i,i-1) )                        //        that gaps up if 1st is white
+                ||
+              ( TA_CANDLECOLOR(i-1) == -1 && TA_REALBODYGAPDOWN(i,i-1) )                        //      or down if 1st is black
+            ) )
+            outInteger[outIdx++] = -TA_CANDLECOLOR(i-1) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLDRAGONFLYDOJI( const TA_CandleFeatures *features,
+                                  const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                  double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            TA_LOWERSHADOW(i) > TA_CANDLEAVERAGE( ShadowVeryShort, i )
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLENGULFING( const TA_CandleFeatures *features,
+                              const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                              double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( ( TA_CANDLECOLOR(i) == 1 && TA_CANDLECOLOR(i-1) == -1 &&            // white engulfs black
+              ( ( inClose[i] >= inOpen[i-1] && inOpen[i] < inClose[i-1] ) ||
+                ( inClose[i] > inOpen[i-1] && inOpen[i] <= inClose[i-1] )
+              )
+            )
+            ||
+            ( TA_CANDLECOLOR(i) == -1 && TA_CANDLECOLOR(i-1) == 1 &&            // black engulfs white
+              ( ( inOpen[i] >= inClose[i-1] && inClose[i] < inOpen[i-1] ) ||
+                ( inOpen[i] > inClose[i-1] && inClose[i] <= inOpen[i-1] )
+              )
+            )
+          )
+            if( inOpen[i] != inClose[i-1] && inClose[i] != inOpen[i-1] )
+                outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+            else
+                outInteger[outIdx++] = TA_CANDLECOLOR(i) * 80;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLEVENINGDOJISTAR( const TA_CandleFeatures *features,
+                                    const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                    double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              // 1st: long
+            TA_CANDLECOLOR(i-2) == 1 &&                                                             //           white
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyDoji, i-1 ) &&                             // 2nd: doji
+            TA_REALBODYGAPUP(i-1,i-2) &&                                                            //           gapping up
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyShort, i ) &&                                 // 3rd: longer than short
+            TA_CANDLECOLOR(i) == -1 &&                                                              //          black real body
+            inClose[i] < inClose[i-2] - TA_REALBODY(i-2) * optInPenetration                         //               closing well within 1st rb
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLEVENINGSTAR( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+
+   outIdx = 0;
+   do
+   {
+
+        if( TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              // 1st: long
+            TA_CANDLECOLOR(i-2) == 1 &&                                                             //           white
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyShort, i-1 ) &&                            // 2nd: short
+            TA_REALBODYGAPUP(i-1,i-2) &&                                                            //            gapping up
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyShort, i ) &&                                 // 3rd: longer than short
+            TA_CANDLECOLOR(i) == -1 &&                                                              //          black real body
+            inClose[i] < inClose[i-2] - TA_REALBODY(i-2) * optInPenetration                         //               closing well within 1st rb
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLGAPSIDESIDEWHITE( const TA_CandleFeatures *features,
+                                     const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                     double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if(
+            ( // upside or downside gap between the 1st candle and both the next 2 candles
+              ( TA_REALBODYGAPUP(i-1,i-2) && TA_REALBODYGAPUP(i,i-2) )
+              ||
+              ( TA_REALBODYGAPDOWN(i-1,i-2) && TA_REALBODYGAPDOWN(i,i-2) )
+            ) &&
+            TA_CANDLECOLOR(i-1) == 1 &&                                                                 // 2nd: white
+            TA_CANDLECOLOR(i) == 1 &&                                                                   // 3rd: white
+            TA_REALBODY(i) >= TA_REALBODY(i-1) - TA_CANDLEAVERAGE( Near, i-1 ) &&                    // same size 2 and 3
+            TA_REALBODY(i) <= TA_REALBODY(i-1) + TA_CANDLEAVERAGE( Near, i-1 ) &&
+            inOpen[i] >= inOpen[i-1] - TA_CANDLEAVERAGE( Equal, i-1 ) &&                             // same open 2 and 3
+            inOpen[i] <= inOpen[i-1] + TA_CANDLEAVERAGE( Equal, i-1 )
+          )
+            outInteger[outIdx++] = ( TA_REALBODYGAPUP(i-1,i-2) ? 100 : -100 );
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLGRAVESTONEDOJI( const TA_CandleFeatures *features,
+                                   const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                   double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) &&
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowVeryShort, i )
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHAMMER( const TA_CandleFeatures *features,
+                           const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                           double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&                                         // small rb
+            TA_LOWERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i ) &&                                     // long lower shadow
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&                                // very short upper shadow
+            min( inClose[i], inOpen[i] ) <= inLow[i-1] + TA_CANDLEAVERAGE( Near, i-1 )                   // rb near the prior candle's lows
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHANGINGMAN( const TA_CandleFeatures *features,
+                               const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                               double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&                                         // small rb
+            TA_LOWERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i ) &&                                     // long lower shadow
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&                                // very short upper shadow
+            min( inClose[i], inOpen[i] ) >= inHigh[i-1] - TA_CANDLEAVERAGE( Near, i-1 )                  // rb near the prior candle's highs
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHARAMI( const TA_CandleFeatures *features,
+                           const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                           double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+	    if( TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                              // 1st: long
+            TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyShort, i )                                   // 2nd: short
+          )
+            if ( max( inClose[i], inOpen[i] ) < max( inClose[i-1], inOpen[i-1] ) &&              // 2nd is engulfed by 1st
+                 min( inClose[i], inOpen[i] ) > min( inClose[i-1], inOpen[i-1] )
+               )
+                outInteger[outIdx++] = -TA_CANDLECOLOR(i-1) * 100;
+            else
+                if ( max( inClose[i], inOpen[i] ) <= max( inClose[i-1], inOpen[i-1] ) &&         // 2nd is engulfed by 1st
+                     min( inClose[i], inOpen[i] ) >= min( inClose[i-1], inOpen[i-1] )            // (one end of real body can match;
+                   )                                                                             // engulfing guaranteed by "long" and "short")
+                    outInteger[outIdx++] = -TA_CANDLECOLOR(i-1) * 80;
+                else
+                    outInteger[outIdx++] = 0;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHARAMICROSS( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                              // 1st: long
+            TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) )                                  // 2nd: doji
+            if ( max( inClose[i], inOpen[i] ) < max( inClose[i-1], inOpen[i-1] ) &&              // 2nd is engulfed by 1st
+                 min( inClose[i], inOpen[i] ) > min( inClose[i-1], inOpen[i-1] )
+               )
+                outInteger[outIdx++] = -TA_CANDLECOLOR(i-1) * 100;
+            else
+                if ( max( inClose[i], inOpen[i] ) <= max( inClose[i-1], inOpen[i-1] ) &&         // 2nd is engulfed by 1st
+                     min( inClose[i], inOpen[i] ) >= min( inClose[i-1], inOpen[i-1] )            // (one end of real body can match;
+                   )                                                                             // engulfing guaranteed by "long" and "doji")
+                    outInteger[outIdx++] = -TA_CANDLECOLOR(i-1) * 80;
+                else
+                    outInteger[outIdx++] = 0;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHIGHWAVE( const TA_CandleFeatures *features,
+                             const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                             double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&
+            TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowVeryLong, i ) &&
+            TA_LOWERSHADOW(i) > TA_CANDLEAVERAGE( ShadowVeryLong, i ) )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHIKKAKE( const TA_CandleFeatures *features,
+                            const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                            double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx, patternIdx, patternResult, startIdx;
+
+   UNUSED_VARIABLE(features);
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(optInPenetration);
+
+   /* Rebuild the state from the 3 bars before the first output, as the function does. */
+   startIdx = i;
+   patternIdx = 0;
+   patternResult = 0;
+
+   i = startIdx - 3;
+   while( i < startIdx ) {
+        if( inHigh[i-1] < inHigh[i-2] && inLow[i-1] > inLow[i-2] &&             // 1st + 2nd: lower high and higher low
+            ( ( inHigh[i] < inHigh[i-1] && inLow[i] < inLow[i-1] )              // (bull) 3rd: lower high and lower low
+              ||
+              ( inHigh[i] > inHigh[i-1] && inLow[i] > inLow[i-1] )              // (bear) 3rd: higher high and higher low
+            )
+        ) {
+            patternResult = 100 * ( inHigh[i] < inHigh[i-1] ? 1 : -1 );
+            patternIdx = i;
+        } else
+            /* search for confirmation if hikkake was no more than 3 bars ago */
+            if( i <= patternIdx+3 &&
+                ( ( patternResult > 0 && inClose[i] > inHigh[patternIdx-1] )    // close higher than the high of 2nd
+                  ||
+                  ( patternResult < 0 && inClose[i] < inLow[patternIdx-1] )     // close lower than the low of 2nd
+                )
+            )
+                patternIdx = 0;
+        i++;
+   }
+
+   outIdx = 0;
+   do
+   {
+        if( inHigh[i-1] < inHigh[i-2] && inLow[i-1] > inLow[i-2] &&             // 1st + 2nd: lower high and higher low
+            ( ( inHigh[i] < inHigh[i-1] && inLow[i] < inLow[i-1] )              // (bull) 3rd: lower high and lower low
+              ||
+              ( inHigh[i] > inHigh[i-1] && inLow[i] > inLow[i-1] )              // (bear) 3rd: higher high and higher low
+            )
+        ) {
+            patternResult = 100 * ( inHigh[i] < inHigh[i-1] ? 1 : -1 );
+            patternIdx = i;
+            outInteger[outIdx++] = patternResult;
+        } else
+            /* search for confirmation if hikkake was no more than 3 bars ago */
+            if( i <= patternIdx+3 &&
+                ( ( patternResult > 0 && inClose[i] > inHigh[patternIdx-1] )    // close higher than the high of 2nd
+                  ||
+                  ( patternResult < 0 && inClose[i] < inLow[patternIdx-1] )     // close lower than the low of 2nd
+                )
+            ) {
+                outInteger[outIdx++] = patternResult + 100 * ( patternResult > 0 ? 1 : -1 );
+                patternIdx = 0;
+            } else
+                outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHIKKAKEMOD( const TA_CandleFeatures *features,
+                               const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                               double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx, patternIdx, patternResult, startIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(optInPenetration);
+
+   /* Rebuild the state from the 3 bars before the first output, as the function does. */
+   startIdx = i;
+   patternIdx = 0;
+   patternResult = 0;
+
+   i = startIdx - 3;
+   while( i < startIdx ) {
+        if( inHigh[i-2] < inHigh[i-3] && inLow[i-2] > inLow[i-3] &&             // 2nd: lower high and higher low than 1st
+            inHigh[i-1] < inHigh[i-2] && inLow[i-1] > inLow[i-2] &&             // 3rd: lower high and higher low than 2nd
+            ( ( inHigh[i] < inHigh[i-1] && inLow[i] < inLow[i-1] &&             // (bull) 4th: lower high and lower low
+                inClose[i-2] <= inLow[i-2] + TA_CANDLEAVERAGE( Near, i-2 )
+                                                                                // (bull) 2nd: close near the low
+              )
+              ||
+              ( inHigh[i] > inHigh[i-1] && inLow[i] > inLow[i-1] &&             // (bear) 4th: higher high and higher low
+                inClose[i-2] >= inHigh[i-2] - TA_CANDLEAVERAGE( Near, i-2 )
+                                                                                // (bull) 2nd: close near the top
+              )
+            )
+        ) {
+            patternResult = 100 * ( inHigh[i] < inHigh[i-1] ? 1 : -1 );
+            patternIdx = i;
+        } else
+            /* search for confirmation if modified hikkake was no more than 3 bars ago */
+            if( i <= patternIdx+3 &&
+                ( ( patternResult > 0 && inClose[i] > inHigh[patternIdx-1] )    // close higher than the high of 3rd
+                  ||
+                  ( patternResult < 0 && inClose[i] < inLow[patternIdx-1] )     // close lower than the low of 3rd
+                )
+            )
+                patternIdx = 0;
+        i++;
+   }
+
+   outIdx = 0;
+   do
+   {
+        if( inHigh[i-2] < inHigh[i-3] && inLow[i-2] > inLow[i-3] &&             // 2nd: lower high and higher low than 1st
+            inHigh[i-1] < inHigh[i-2] && inLow[i-1] > inLow[i-2] &&             // 3rd: lower high and higher low than 2nd
+            ( ( inHigh[i] < inHigh[i-1] && inLow[i] < inLow[i-1] &&             // (bull) 4th: lower high and lower low
+                inClose[i-2] <= inLow[i-2] + TA_CANDLEAVERAGE( Near, i-2 )
+                                                                                // (bull) 2nd: close near the low
+              )
+              ||
+              ( inHigh[i] > inHigh[i-1] && inLow[i] > inLow[i-1] &&             // (bear) 4th: higher high and higher low
+                inClose[i-2] >= inHigh[i-2] - TA_CANDLEAVERAGE( Near, i-2 )
+                                                                                // (bull) 2nd: close near the top
+              )
+            )
+        ) {
+            patternResult = 100 * ( inHigh[i] < inHigh[i-1] ? 1 : -1 );
+            patternIdx = i;
+            outInteger[outIdx++] = patternResult;
+        } else
+            /* search for confirmation if modified hikkake was no more than 3 bars ago */
+            if( i <= patternIdx+3 &&
+                ( ( patternResult > 0 && inClose[i] > inHigh[patternIdx-1] )    // close higher than the high of 3rd
+                  ||
+                  ( patternResult < 0 && inClose[i] < inLow[patternIdx-1] )     // close lower than the low of 3rd
+                )
+            ) {
+                outInteger[outIdx++] = patternResult + 100 * ( patternResult > 0 ? 1 : -1 );
+                patternIdx = 0;
+            } else
+                outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLHOMINGPIGEON( const TA_CandleFeatures *features,
+                                 const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                 double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -1 &&                                                            // 1st black
+            TA_CANDLECOLOR(i) == -1 &&                                                              // 2nd black
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                              // 1st long
+            TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyShort, i ) &&                                // 2nd short
+            inOpen[i] < inOpen[i-1] &&                                                              // 2nd engulfed by 1st
+            inClose[i] > inClose[i-1]
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLIDENTICAL3CROWS( const TA_CandleFeatures *features,
+                                    const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                    double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == -1 &&                                    // 1st black
+                                                                            // very short lower shadow
+            TA_LOWERSHADOW(i-2) < TA_CANDLEAVERAGE( ShadowVeryShort, i-2 ) &&
+            TA_CANDLECOLOR(i-1) == -1 &&                                    // 2nd black
+                                                                            // very short lower shadow
+            TA_LOWERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+            TA_CANDLECOLOR(i) == -1 &&                                      // 3rd black
+                                                                            // very short lower shadow
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            inClose[i-2] > inClose[i-1] &&                                  // three declining
+            inClose[i-1] > inClose[i] &&
+                                                                            // 2nd black opens very close to 1st close
+            inOpen[i-1] <= inClose[i-2] + TA_CANDLEAVERAGE( Equal, i-2 ) &&
+            inOpen[i-1] >= inClose[i-2] - TA_CANDLEAVERAGE( Equal, i-2 ) &&
+                                                                            // 3rd black opens very close to 2nd close
+            inOpen[i] <= inClose[i-1] + TA_CANDLEAVERAGE( Equal, i-1 ) &&
+            inOpen[i] >= inClose[i-1] - TA_CANDLEAVERAGE( Equal, i-1 )
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLINNECK( const TA_CandleFeatures *features,
+                           const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                           double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -1 &&                                                        // 1st: black
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                          //  long
+            TA_CANDLECOLOR(i) == 1 &&                                                           // 2nd: white
+            inOpen[i] < inLow[i-1] &&                                                           //  open below prior low
+            inClose[i] <= inClose[i-1] + TA_CANDLEAVERAGE( Equal, i-1 ) &&                   //  close slightly into prior body
+            inClose[i] >= inClose[i-1]
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLINVERTEDHAMMER( const TA_CandleFeatures *features,
+                                   const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                   double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&                                         // small rb
+            TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i ) &&                                     // long upper shadow
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&                                // very short lower shadow
+            TA_REALBODYGAPDOWN(i, i-1) )                                                                    // gap down
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLKICKING( const TA_CandleFeatures *features,
+                            const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                            double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&                                        // opposite candles
+            // 1st marubozu
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&
+            TA_UPPERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+            TA_LOWERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+            // 2nd marubozu
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            // gap
+            (
+              ( TA_CANDLECOLOR(i-1) == -1 && TA_CANDLEGAPUP(i,i-1) )
+              ||
+              ( TA_CANDLECOLOR(i-1) == 1 && TA_CANDLEGAPDOWN(i,i-1) )
+            )
+          )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLKICKINGBYLENGTH( const TA_CandleFeatures *features,
+                                    const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                    double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&                                        // opposite candles
+            // 1st marubozu
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&
+            TA_UPPERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+            TA_LOWERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+            // 2nd marubozu
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            // gap
+            (
+              ( TA_CANDLECOLOR(i-1) == -1 && TA_CANDLEGAPUP(i,i-1) )
+              ||
+              ( TA_CANDLECOLOR(i-1) == 1 && TA_CANDLEGAPDOWN(i,i-1) )
+            )
+          )
+            outInteger[outIdx++] = TA_CANDLECOLOR( ( TA_REALBODY(i) > TA_REALBODY(i-1) ? i : i-1 ) ) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLLADDERBOTTOM( const TA_CandleFeatures *features,
+                                 const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                 double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if(
+            TA_CANDLECOLOR(i-4) == -1 && TA_CANDLECOLOR(i-3) == -1 && TA_CANDLECOLOR(i-2) == -1 &&  // 3 black candlesticks
+            inOpen[i-4] > inOpen[i-3] && inOpen[i-3] > inOpen[i-2] &&           // with consecutively lower opens
+            inClose[i-4] > inClose[i-3] && inClose[i-3] > inClose[i-2] &&       // and closes
+            TA_CANDLECOLOR(i-1) == -1 &&                                        // 4th: black with an upper shadow
+            TA_UPPERSHADOW(i-1) > TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+            TA_CANDLECOLOR(i) == 1 &&                                           // 5th: white
+            inOpen[i] > inOpen[i-1] &&                                          // that opens above prior candle's body
+            inClose[i] > inHigh[i-1]                                            // and closes above prior candle's high
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLLONGLEGGEDDOJI( const TA_CandleFeatures *features,
+                                   const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                   double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) &&
+            ( TA_LOWERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i )
+              ||
+              TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i )
+            )
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLLONGLINE( const TA_CandleFeatures *features,
+                             const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                             double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowShort, i ) &&
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowShort, i ) )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLMARUBOZU( const TA_CandleFeatures *features,
+                             const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                             double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLMATCHINGLOW( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -1 &&                                                        // first black
+            TA_CANDLECOLOR(i) == -1 &&                                                          // second black
+            inClose[i] <= inClose[i-1] + TA_CANDLEAVERAGE( Equal, i-1 ) &&                   // 1st and 2nd same close
+            inClose[i] >= inClose[i-1] - TA_CANDLEAVERAGE( Equal, i-1 )
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLMATHOLD( const TA_CandleFeatures *features,
+                            const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                            double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inLow);
+
+   outIdx = 0;
+   do
+   {
+        if( // 1st long, then 3 small
+            TA_REALBODY(i-4) > TA_CANDLEAVERAGE( BodyLong, i-4 ) &&
+            TA_REALBODY(i-3) < TA_CANDLEAVERAGE( BodyShort, i-3 ) &&
+            TA_REALBODY(i-2) < TA_CANDLEAVERAGE( BodyShort, i-2 ) &&
+            TA_REALBODY(i-1) < TA_CANDLEAVERAGE( BodyShort, i-1 ) &&
+            // white, black, 2 black or white, white
+            TA_CANDLECOLOR(i-4) == 1 &&
+            TA_CANDLECOLOR(i-3) == -1 &&
+            TA_CANDLECOLOR(i) == 1 &&
+            // upside gap 1st to 2nd
+            TA_REALBODYGAPUP(i-3,i-4) &&
+            // 3rd to 4th hold within 1st: a part of the real body must be within 1st real body
+            min(inOpen[i-2], inClose[i-2]) < inClose[i-4] &&
+            min(inOpen[i-1], inClose[i-1]) < inClose[i-4] &&
+            // reaction days penetrate first body less than optInPenetration percent
+            min(inOpen[i-2], inClose[i-2]) > inClose[i-4] - TA_REALBODY(i-4) * optInPenetration &&
+            min(inOpen[i-1], inClose[i-1]) > inClose[i-4] - TA_REALBODY(i-4) * optInPenetration &&
+            // 2nd to 4th are falling
+            max(inClose[i-2], inOpen[i-2]) < inOpen[i-3] &&
+            max(inClose[i-1], inOpen[i-1]) < max(inClose[i-2], inOpen[i-2]) &&
+            // 5th opens above the prior close
+            inOpen[i] > inClose[i-1] &&
+            // 5th closes above the highest high of the reaction days
+            inClose[i] > max(max(inHigh[i-3], inHigh[i-2]), inHigh[i-1])
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLMORNINGDOJISTAR( const TA_CandleFeatures *features,
+                                    const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                    double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              // 1st: long
+            TA_CANDLECOLOR(i-2) == -1 &&                                                            //           black
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyDoji, i-1 ) &&                             // 2nd: doji
+            TA_REALBODYGAPDOWN(i-1,i-2) &&                                                          //           gapping down
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyShort, i ) &&                                 // 3rd: longer than short
+            TA_CANDLECOLOR(i) == 1 &&                                                               //          white real body
+            inClose[i] > inClose[i-2] + TA_REALBODY(i-2) * optInPenetration                         //               closing well within 1st rb
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLMORNINGSTAR( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              // 1st: long
+            TA_CANDLECOLOR(i-2) == -1 &&                                                            //           black
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyShort, i-1 ) &&                            // 2nd: short
+            TA_REALBODYGAPDOWN(i-1,i-2) &&                                                          //            gapping down
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyShort, i ) &&                                 // 3rd: longer than short
+            TA_CANDLECOLOR(i) == 1 &&                                                               //          black real body
+            inClose[i] > inClose[i-2] + TA_REALBODY(i-2) * optInPenetration                         //               closing well within 1st rb
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLONNECK( const TA_CandleFeatures *features,
+                           const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                           double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -1 &&                                                        // 1st: black
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                          //      long
+            TA_CANDLECOLOR(i) == 1 &&                                                           // 2nd: white
+            inOpen[i] < inLow[i-1] &&                                                           //   open below prior low
+            inClose[i] <= inLow[i-1] + TA_CANDLEAVERAGE( Equal, i-1 ) &&                     //   close equal to prior low
+            inClose[i] >= inLow[i-1] - TA_CANDLEAVERAGE( Equal, i-1 )
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLPIERCING( const TA_CandleFeatures *features,
+                             const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                             double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -1 &&                                                        // 1st: black
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                          //      long
+            TA_CANDLECOLOR(i) == 1 &&                                                           // 2nd: white
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&                              //      long
+            inOpen[i] < inLow[i-1] &&                                                           //      open below prior low
+            inClose[i] < inOpen[i-1] &&                                                         //      close within prior body
+            inClose[i] > inClose[i-1] + TA_REALBODY(i-1) * 0.5                                  //        above midpoint
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLRICKSHAWMAN( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) &&                                 // doji
+            TA_LOWERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i ) &&                             // long shadow
+            TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i ) &&                             // long shadow
+            (                                                                                       // body near midpoint
+                min( inOpen[i], inClose[i] )
+                    <= inLow[i] + TA_HIGHLOWRANGE(i) / 2 + TA_CANDLEAVERAGE( Near, i )
+                &&
+                max( inOpen[i], inClose[i] )
+                    >= inLow[i] + TA_HIGHLOWRANGE(i) / 2 - TA_CANDLEAVERAGE( Near, i )
+            )
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLRISEFALL3METHODS( const TA_CandleFeatures *features,
+                                     const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                     double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( // 1st long, then 3 small, 5th long
+            TA_REALBODY(i-4) > TA_CANDLEAVERAGE( BodyLong, i-4 ) &&
+            TA_REALBODY(i-3) < TA_CANDLEAVERAGE( BodyShort, i-3 ) &&
+            TA_REALBODY(i-2) < TA_CANDLEAVERAGE( BodyShort, i-2 ) &&
+            TA_REALBODY(i-1) < TA_CANDLEAVERAGE( BodyShort, i-1 ) &&
+            TA_REALBODY(i)   > TA_CANDLEAVERAGE( BodyLong, i ) &&
+            // white, 3 black, white  ||  black, 3 white, black
+            TA_CANDLECOLOR(i-4) == -TA_CANDLECOLOR(i-3) &&
+            TA_CANDLECOLOR(i-3) ==  TA_CANDLECOLOR(i-2) &&
+            TA_CANDLECOLOR(i-2) ==  TA_CANDLECOLOR(i-1) &&
+            TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&
+            // 2nd to 4th hold within 1st: a part of the real body must be within 1st range
+            min(inOpen[i-3], inClose[i-3]) < inHigh[i-4] && max(inOpen[i-3], inClose[i-3]) > inLow[i-4] &&
+            min(inOpen[i-2], inClose[i-2]) < inHigh[i-4] && max(inOpen[i-2], inClose[i-2]) > inLow[i-4] &&
+            min(inOpen[i-1], inClose[i-1]) < inHigh[i-4] && max(inOpen[i-1], inClose[i-1]) > inLow[i-4] &&
+            // 2nd to 4th are falling (rising)
+            inClose[i-2] * TA_CANDLECOLOR(i-4) < inClose[i-3] * TA_CANDLECOLOR(i-4) &&
+            inClose[i-1] * TA_CANDLECOLOR(i-4) < inClose[i-2] * TA_CANDLECOLOR(i-4) &&
+            // 5th opens above (below) the prior close
+            inOpen[i] * TA_CANDLECOLOR(i-4) > inClose[i-1] * TA_CANDLECOLOR(i-4) &&
+            // 5th closes above (below) the 1st close
+            inClose[i] * TA_CANDLECOLOR(i-4) > inClose[i-4] * TA_CANDLECOLOR(i-4)
+          )
+            outInteger[outIdx++] = 100 * TA_CANDLECOLOR(i-4);
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLSEPARATINGLINES( const TA_CandleFeatures *features,
+                                    const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                    double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&                                        // opposite candles
+            inOpen[i] <= inOpen[i-1] + TA_CANDLEAVERAGE( Equal, i-1 ) &&                     // same open
+            inOpen[i] >= inOpen[i-1] - TA_CANDLEAVERAGE( Equal, i-1 ) &&
+            TA_REALBODY(i) > TA_CANDLEAVERAGE( BodyLong, i ) &&                              // belt hold: long body
+            (
+              ( TA_CANDLECOLOR(i) == 1 &&                                               // with no lower shadow if bullish
+                TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i )
+              )
+              ||
+              ( TA_CANDLECOLOR(i) == -1 &&                                              // with no upper shadow if bearish
+                TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i )
+              )
+            )
+          )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLSHOOTINGSTAR( const TA_CandleFeatures *features,
+                                 const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                 double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&                                         // small rb
+            TA_UPPERSHADOW(i) > TA_CANDLEAVERAGE( ShadowLong, i ) &&                                     // long upper shadow
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&                                // very short lower shadow
+            TA_REALBODYGAPUP(i, i-1) )                                                                      // gap up
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLSHORTLINE( const TA_CandleFeatures *features,
+                              const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                              double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowShort, i ) &&
+            TA_LOWERSHADOW(i) < TA_CANDLEAVERAGE( ShadowShort, i ) )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLSPINNINGTOP( const TA_CandleFeatures *features,
+                                const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&
+            TA_UPPERSHADOW(i) > TA_REALBODY(i) &&
+            TA_LOWERSHADOW(i) > TA_REALBODY(i)
+          )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLSTALLEDPATTERN( const TA_CandleFeatures *features,
+                                   const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                   double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == 1 &&                                             // 1st white
+            TA_CANDLECOLOR(i-1) == 1 &&                                             // 2nd white
+            TA_CANDLECOLOR(i) == 1 &&                                               // 3rd white
+            inClose[i] > inClose[i-1] && inClose[i-1] > inClose[i-2] &&             // consecutive higher closes
+            TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                          // 1st: long real body
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                          // 2nd: long real body
+                                                                                    // very short upper shadow
+            TA_UPPERSHADOW(i-1) < TA_CANDLEAVERAGE( ShadowVeryShort, i-1 ) &&
+                                                                                    // opens within/near 1st real body
+            inOpen[i-1] > inOpen[i-2] &&
+            inOpen[i-1] <= inClose[i-2] + TA_CANDLEAVERAGE( Near, i-2 ) &&
+            TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&                             // 3rd: small real body
+                                                                                    // rides on the shoulder of 2nd real body
+            inOpen[i] >= inClose[i-1] - TA_REALBODY(i) - TA_CANDLEAVERAGE( Near, i-1 )
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLSTICKSANDWICH( const TA_CandleFeatures *features,
+                                  const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                  double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == -1 &&                                                        // first black
+            TA_CANDLECOLOR(i-1) == 1 &&                                                         // second white
+            TA_CANDLECOLOR(i) == -1 &&                                                          // third black
+            inLow[i-1] > inClose[i-2] &&                                                        // 2nd low > prior close
+            inClose[i] <= inClose[i-2] + TA_CANDLEAVERAGE( Equal, i-2 ) &&                   // 1st and 3rd same close
+            inClose[i] >= inClose[i-2] - TA_CANDLEAVERAGE( Equal, i-2 )
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLTAKURI( const TA_CandleFeatures *features,
+                           const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                           double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inOpen);
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(inClose);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i ) &&
+            TA_UPPERSHADOW(i) < TA_CANDLEAVERAGE( ShadowVeryShort, i ) &&
+            TA_LOWERSHADOW(i) > TA_CANDLEAVERAGE( ShadowVeryLong, i )
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLTASUKIGAP( const TA_CandleFeatures *features,
+                              const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                              double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if(
+            (
+                TA_REALBODYGAPUP(i-1,i-2) &&                                // upside gap
+                TA_CANDLECOLOR(i-1) == 1 &&                                 // 1st: white
+                TA_CANDLECOLOR(i) == -1 &&                                  // 2nd: black
+                inOpen[i] < inClose[i-1] && inOpen[i] > inOpen[i-1] &&      //      that opens within the white rb
+                inClose[i] < inOpen[i-1] &&                                 //      and closes under the white rb
+                inClose[i] > max(inClose[i-2], inOpen[i-2]) &&              //      inside the gap
+                                                                            // size of 2 rb near the same
+                std_fabs(TA_REALBODY(i-1) - TA_REALBODY(i)) < TA_CANDLEAVERAGE( Near, i-1 )
+            ) ||
+            (
+                TA_REALBODYGAPDOWN(i-1,i-2) &&                              // downside gap
+                TA_CANDLECOLOR(i-1) == -1 &&                                // 1st: black
+                TA_CANDLECOLOR(i) == 1 &&                                   // 2nd: white
+                inOpen[i] < inOpen[i-1] && inOpen[i] > inClose[i-1] &&      //      that opens within the black rb
+                inClose[i] > inOpen[i-1] &&                                 //      and closes above the black rb
+                inClose[i] < min(inClose[i-2], inOpen[i-2]) &&              //      inside the gap
+                                                                            // size of 2 rb near the same
+                std_fabs(TA_REALBODY(i-1) - TA_REALBODY(i)) < TA_CANDLEAVERAGE( Near, i-1 )
+            )
+        )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i-1) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLTHRUSTING( const TA_CandleFeatures *features,
+                              const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                              double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-1) == -1 &&                                                        // 1st: black
+            TA_REALBODY(i-1) > TA_CANDLEAVERAGE( BodyLong, i-1 ) &&                          //  long
+            TA_CANDLECOLOR(i) == 1 &&                                                           // 2nd: white
+            inOpen[i] < inLow[i-1] &&                                                           //  open below prior low
+            inClose[i] > inClose[i-1] + TA_CANDLEAVERAGE( Equal, i-1 ) &&                    //  close into prior body
+            inClose[i] <= inClose[i-1] + TA_REALBODY(i-1) * 0.5                                 //   under the midpoint
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLTRISTAR( const TA_CandleFeatures *features,
+                            const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                            double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-2) <= TA_CANDLEAVERAGE( BodyDoji, i-2 ) &&                     // 1st: doji
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyDoji, i-2 ) &&                     // 2nd: doji
+            TA_REALBODY(i) <= TA_CANDLEAVERAGE( BodyDoji, i-2 ) ) {                      // 3rd: doji
+            outInteger[outIdx] = 0;
+            if ( TA_REALBODYGAPUP(i-1,i-2)                                                  // 2nd gaps up
+                 &&
+                 max(inOpen[i],inClose[i]) < max(inOpen[i-1],inClose[i-1])                  // 3rd is not higher than 2nd
+               )
+                outInteger[outIdx] = -100;
+            if ( TA_REALBODYGAPDOWN(i-1,i-2)                                                // 2nd gaps down
+                 &&
+                 min(inOpen[i],inClose[i]) > min(inOpen[i-1],inClose[i-1])                  // 3rd is not lower than 2nd
+               )
+                outInteger[outIdx] = +100;
+            outIdx++;
+        }
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLUNIQUE3RIVER( const TA_CandleFeatures *features,
+                                 const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                 double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              // 1st: long
+            TA_CANDLECOLOR(i-2) == -1 &&                                                            //      black
+            TA_CANDLECOLOR(i-1) == -1 &&                                                            // 2nd: black
+            inClose[i-1] > inClose[i-2] && inOpen[i-1] <= inOpen[i-2] &&                            //      harami
+            inLow[i-1] < inLow[i-2] &&                                                              //      lower low
+            TA_REALBODY(i) < TA_CANDLEAVERAGE( BodyShort, i ) &&                                 // 3rd: short
+            TA_CANDLECOLOR(i) == 1 &&                                                               //      white
+            inOpen[i] > inLow[i-1]                                                                  //      open not lower
+          )
+            outInteger[outIdx++] = 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLUPSIDEGAP2CROWS( const TA_CandleFeatures *features,
+                                    const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                    double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == 1 &&                                                             // 1st: white
+            TA_REALBODY(i-2) > TA_CANDLEAVERAGE( BodyLong, i-2 ) &&                              //      long
+            TA_CANDLECOLOR(i-1) == -1 &&                                                            // 2nd: black
+            TA_REALBODY(i-1) <= TA_CANDLEAVERAGE( BodyShort, i-1 ) &&                            //      short
+            TA_REALBODYGAPUP(i-1,i-2) &&                                                            //      gapping up
+            TA_CANDLECOLOR(i) == -1 &&                                                              // 3rd: black
+            inOpen[i] > inOpen[i-1] && inClose[i] < inClose[i-1] &&                                 // 3rd: engulfing prior rb
+            inClose[i] > inClose[i-2]                                                               //      closing above 1st
+          )
+            outInteger[outIdx++] = -100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static void scanCDLXSIDEGAP3METHODS( const TA_CandleFeatures *features,
+                                     const double inOpen[], const double inHigh[], const double inLow[], const double inClose[],
+                                     double optInPenetration, int i, int endIdx, int outInteger[] )
+{
+   int outIdx;
+
+   UNUSED_VARIABLE(inHigh);
+   UNUSED_VARIABLE(inLow);
+   UNUSED_VARIABLE(optInPenetration);
+
+   outIdx = 0;
+   do
+   {
+        if( TA_CANDLECOLOR(i-2) == TA_CANDLECOLOR(i-1) &&                   // 1st and 2nd of same color
+            TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&                    // 3rd opposite color
+            inOpen[i] < max(inClose[i-1], inOpen[i-1]) &&                   // 3rd opens within 2nd rb
+            inOpen[i] > min(inClose[i-1], inOpen[i-1]) &&
+            inClose[i] < max(inClose[i-2], inOpen[i-2]) &&                  // 3rd closes within 1st rb
+            inClose[i] > min(inClose[i-2], inOpen[i-2]) &&
+            ( (
+                TA_CANDLECOLOR(i-2) == 1 &&                                 // when 1st is white
+                TA_REALBODYGAPUP(i-1,i-2)                                   // upside gap
+              ) ||
+              (
+                TA_CANDLECOLOR(i-2) == -1 &&                                // when 1st is black
+                TA_REALBODYGAPDOWN(i-1,i-2)                                 // downside gap
+              )
+            )
+        )
+            outInteger[outIdx++] = TA_CANDLECOLOR(i-2) * 100;
+        else
+            outInteger[outIdx++] = 0;
+        i++;
+   } while( i <= endIdx );
+}
+
+static const TA_CandlePattern TA_CandlePatterns[TA_CDL_NB_PATTERN] =
+{
+   { scanCDL2CROWS, TA_CDL2CROWS_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) },
+   { scanCDL3BLACKCROWS, TA_CDL3BLACKCROWS_Lookback, NULL, 0.0, TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDL3INSIDE, TA_CDL3INSIDE_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDL3LINESTRIKE, TA_CDL3LINESTRIKE_Lookback, NULL, 0.0, TA_CANDLE_SETTING(Near) },
+   { scanCDL3OUTSIDE, TA_CDL3OUTSIDE_Lookback, NULL, 0.0, 0 },
+   { scanCDL3STARSINSOUTH, TA_CDL3STARSINSOUTH_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(ShadowLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDL3WHITESOLDIERS, TA_CDL3WHITESOLDIERS_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(Far) | TA_CANDLE_SETTING(Near) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLABANDONEDBABY, NULL, TA_CDLABANDONEDBABY_Lookback, 3.000000e-1, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLADVANCEBLOCK, TA_CDLADVANCEBLOCK_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(Far) | TA_CANDLE_SETTING(Near) | TA_CANDLE_SETTING(ShadowLong) | TA_CANDLE_SETTING(ShadowShort) },
+   { scanCDLBELTHOLD, TA_CDLBELTHOLD_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLBREAKAWAY, TA_CDLBREAKAWAY_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) },
+   { scanCDLCLOSINGMARUBOZU, TA_CDLCLOSINGMARUBOZU_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLCONCEALBABYSWALL, TA_CDLCONCEALBABYSWALL_Lookback, NULL, 0.0, TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLCOUNTERATTACK, TA_CDLCOUNTERATTACK_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(Equal) },
+   { scanCDLDARKCLOUDCOVER, NULL, TA_CDLDARKCLOUDCOVER_Lookback, 5.000000e-1, TA_CANDLE_SETTING(BodyLong) },
+   { scanCDLDOJI, TA_CDLDOJI_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) },
+   { scanCDLDOJISTAR, TA_CDLDOJISTAR_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(BodyLong) },
+   { scanCDLDRAGONFLYDOJI, TA_CDLDRAGONFLYDOJI_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLENGULFING, TA_CDLENGULFING_Lookback, NULL, 0.0, 0 },
+   { scanCDLEVENINGDOJISTAR, NULL, TA_CDLEVENINGDOJISTAR_Lookback, 3.000000e-1, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLEVENINGSTAR, NULL, TA_CDLEVENINGSTAR_Lookback, 3.000000e-1, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLGAPSIDESIDEWHITE, TA_CDLGAPSIDESIDEWHITE_Lookback, NULL, 0.0, TA_CANDLE_SETTING(Equal) | TA_CANDLE_SETTING(Near) },
+   { scanCDLGRAVESTONEDOJI, TA_CDLGRAVESTONEDOJI_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLHAMMER, TA_CDLHAMMER_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(Near) | TA_CANDLE_SETTING(ShadowLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLHANGINGMAN, TA_CDLHANGINGMAN_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(Near) | TA_CANDLE_SETTING(ShadowLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLHARAMI, TA_CDLHARAMI_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLHARAMICROSS, TA_CDLHARAMICROSS_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(BodyLong) },
+   { scanCDLHIGHWAVE, TA_CDLHIGHWAVE_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(ShadowVeryLong) },
+   { scanCDLHIKKAKE, TA_CDLHIKKAKE_Lookback, NULL, 0.0, 0 },
+   { scanCDLHIKKAKEMOD, TA_CDLHIKKAKEMOD_Lookback, NULL, 0.0, TA_CANDLE_SETTING(Near) },
+   { scanCDLHOMINGPIGEON, TA_CDLHOMINGPIGEON_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLIDENTICAL3CROWS, TA_CDLIDENTICAL3CROWS_Lookback, NULL, 0.0, TA_CANDLE_SETTING(Equal) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLINNECK, TA_CDLINNECK_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(Equal) },
+   { scanCDLINVERTEDHAMMER, TA_CDLINVERTEDHAMMER_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(ShadowLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLKICKING, TA_CDLKICKING_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLKICKINGBYLENGTH, TA_CDLKICKINGBYLENGTH_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLLADDERBOTTOM, TA_CDLLADDERBOTTOM_Lookback, NULL, 0.0, TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLLONGLEGGEDDOJI, TA_CDLLONGLEGGEDDOJI_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(ShadowLong) },
+   { scanCDLLONGLINE, TA_CDLLONGLINE_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(ShadowShort) },
+   { scanCDLMARUBOZU, TA_CDLMARUBOZU_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLMATCHINGLOW, TA_CDLMATCHINGLOW_Lookback, NULL, 0.0, TA_CANDLE_SETTING(Equal) },
+   { scanCDLMATHOLD, NULL, TA_CDLMATHOLD_Lookback, 5.000000e-1, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLMORNINGDOJISTAR, NULL, TA_CDLMORNINGDOJISTAR_Lookback, 3.000000e-1, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLMORNINGSTAR, NULL, TA_CDLMORNINGSTAR_Lookback, 3.000000e-1, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLONNECK, TA_CDLONNECK_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(Equal) },
+   { scanCDLPIERCING, TA_CDLPIERCING_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) },
+   { scanCDLRICKSHAWMAN, TA_CDLRICKSHAWMAN_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(Near) | TA_CANDLE_SETTING(ShadowLong) },
+   { scanCDLRISEFALL3METHODS, TA_CDLRISEFALL3METHODS_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLSEPARATINGLINES, TA_CDLSEPARATINGLINES_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(Equal) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLSHOOTINGSTAR, TA_CDLSHOOTINGSTAR_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(ShadowLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLSHORTLINE, TA_CDLSHORTLINE_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(ShadowShort) },
+   { scanCDLSPINNINGTOP, TA_CDLSPINNINGTOP_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLSTALLEDPATTERN, TA_CDLSTALLEDPATTERN_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) | TA_CANDLE_SETTING(Near) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLSTICKSANDWICH, TA_CDLSTICKSANDWICH_Lookback, NULL, 0.0, TA_CANDLE_SETTING(Equal) },
+   { scanCDLTAKURI, TA_CDLTAKURI_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) | TA_CANDLE_SETTING(ShadowVeryLong) | TA_CANDLE_SETTING(ShadowVeryShort) },
+   { scanCDLTASUKIGAP, TA_CDLTASUKIGAP_Lookback, NULL, 0.0, TA_CANDLE_SETTING(Near) },
+   { scanCDLTHRUSTING, TA_CDLTHRUSTING_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(Equal) },
+   { scanCDLTRISTAR, TA_CDLTRISTAR_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyDoji) },
+   { scanCDLUNIQUE3RIVER, TA_CDLUNIQUE3RIVER_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLUPSIDEGAP2CROWS, TA_CDLUPSIDEGAP2CROWS_Lookback, NULL, 0.0, TA_CANDLE_SETTING(BodyLong) | TA_CANDLE_SETTING(BodyShort) },
+   { scanCDLXSIDEGAP3METHODS, TA_CDLXSIDEGAP3METHODS_Lookback, NULL, 0.0, 0 }
+};
+
+/* Range of a candle for a setting, as TA_CANDLERANGE. */
+static double candleRange( TA_RangeType rangeType, double open, double high, double low, double close )
+{
+   switch( rangeType )
+   {
+   case TA_RangeType_RealBody:
+      return std_fabs( close - open );
+   case TA_RangeType_HighLow:
+      return high - low;
+   case TA_RangeType_Shadows:
+      return ( high - ( close >= open ? close : open ) ) + ( ( close >= open ? open : close ) - low );
+   default:
+      return 0.0;
+   }
+}
+
+/* The penetration of a pattern, its default unless optInPenetration
+ * is given.
+ */
+static double candlePenetration( int pattern, double optInPenetration )
+{
+   if( optInPenetration == TA_REAL_DEFAULT )
+      return TA_CandlePatterns[pattern].optInPenetration;
+   return optInPenetration;
+}
+
+static int candleLookback( int pattern, double optInPenetration )
+{
+   const TA_CandlePattern *candlePattern = &TA_CandlePatterns[pattern];
+
+   if( candlePattern->lookback )
+      return candlePattern->lookback();
+   return candlePattern->lookbackPenetration( candlePenetration( pattern, optInPenetration ) );
+}
+
+TA_RetCode TA_INT_CDL( int           startIdx,
+                       int           endIdx,
+                       const double *inOpen,
+                       const double *inHigh,
+                       const double *inLow,
+                       const double *inClose,
+                       int           nbPattern,
+                       const int    *pattern,
+                       double        optInPenetration,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       int          *outInteger )
+{
+   ARRAY_REF( buffer );
+   ARRAY_INT_REF( candleColor );
+   TA_CandleFeatures features;
+   double *realBody, *upperShadow, *lowerShadow, *highLowRange, *shadows;
+   double *average[TA_AllCandleSettings];
+   const double *range;
+   const TA_CandleSetting *setting;
+   double total, trailing;
+   unsigned int settings;
+   int p, s, j, k, nbSetting, blockSize, blockStart, blockEnd, base, begIdx, outLength;
+   int *outRow;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+   if( !inOpen || !inHigh || !inLow || !inClose || (nbPattern < 0) || (nbPattern && !pattern) )
+      return TA_BAD_PARAM;
+   if( !outBegIdx || !outNBElement || !outInteger )
+      return TA_BAD_PARAM;
+   if( (optInPenetration != TA_REAL_DEFAULT) &&
+       ((optInPenetration < 0.000000e+0) || (optInPenetration > 3.000000e+37)) )
+      return TA_BAD_PARAM;
+
+   settings = 0;
+   for( p=0; p < nbPattern; p++ )
+   {
+      if( (pattern[p] < 0) || (pattern[p] >= TA_CDL_NB_PATTERN) )
+         return TA_BAD_PARAM;
+      settings |= TA_CandlePatterns[pattern[p]].settings;
+   }
+
+   /* One buffer for the features and the averages read by the
+    * requested patterns.
+    */
+   nbSetting = 0;
+   for( s=0; s < TA_AllCandleSettings; s++ )
+      if( settings & (1u << s) )
+         nbSetting++;
+   blockSize = TA_CANDLE_BACK + TA_CANDLE_BLOCK;
+   ARRAY_ALLOC( buffer, (5+nbSetting)*blockSize );
+   if( !buffer )
+      return TA_ALLOC_ERR;
+   ARRAY_INT_ALLOC( candleColor, blockSize );
+   if( !candleColor )
+   {
+      ARRAY_FREE( buffer );
+      return TA_ALLOC_ERR;
+   }
+   realBody     = buffer;
+   upperShadow  = buffer + blockSize;
+   lowerShadow  = buffer + 2*blockSize;
+   highLowRange = buffer + 3*blockSize;
+   shadows      = buffer + 4*blockSize;
+   k = 5;
+   for( s=0; s < TA_AllCandleSettings; s++ )
+   {
+      average[s] = NULL;
+      if( settings & (1u << s) )
+         average[s] = buffer + (k++)*blockSize;
+      features.average[s] = average[s];
+   }
+   features.realBody     = realBody;
+   features.upperShadow  = upperShadow;
+   features.lowerShadow  = lowerShadow;
+   features.highLowRange = highLowRange;
+   features.candleColor  = candleColor;
+
+   outLength = endIdx-startIdx+1;
+   for( blockStart=startIdx; blockStart <= endIdx; blockStart=blockEnd+1 )
+   {
+      blockEnd = blockStart+TA_CANDLE_BLOCK-1;
+      if( blockEnd > endIdx )
+         blockEnd = endIdx;
+      base = blockStart-TA_CANDLE_BACK;
+      if( base < 0 )
+         base = 0;
+
+      /* The features of the candles. */
+      for( j=base, k=0; j <= blockEnd; j++, k++ )
+      {
+         realBody[k]     = std_fabs( inClose[j] - inOpen[j] );
+         highLowRange[k] = inHigh[j] - inLow[j];
+         if( inClose[j] >= inOpen[j] )
+         {
+            candleColor[k] = 1;
+            upperShadow[k] = inHigh[j] - inClose[j];
+            lowerShadow[k] = inOpen[j] - inLow[j];
+         }
+         else
+         {
+            candleColor[k] = -1;
+            upperShadow[k] = inHigh[j] - inOpen[j];
+            lowerShadow[k] = inClose[j] - inLow[j];
+         }
+         shadows[k] = upperShadow[k] + lowerShadow[k];
+      }
+
+      /* The average of each setting, over the avgPeriod candles
+       * before the candle, or the candle itself when avgPeriod is 0.
+       */
+      for( s=0; s < TA_AllCandleSettings; s++ )
+      {
+         if( !average[s] )
+            continue;
+         setting = &TA_ThreadContext->candleSettings[s];
+         switch( setting->rangeType )
+         {
+         case TA_RangeType_RealBody: range = realBody; break;
+         case TA_RangeType_HighLow:  range = highLowRange; break;
+         case TA_RangeType_Shadows:  range = shadows; break;
+         default:                    range = NULL; break;
+         }
+         total = 0.0;
+         for( j=base-setting->avgPeriod; j < base; j++ )
+            if( j >= 0 )
+               total += candleRange( setting->rangeType, inOpen[j], inHigh[j], inLow[j], inClose[j] );
+         for( j=base, k=0; j <= blockEnd; j++, k++ )
+         {
+            average[s][k] = setting->factor
+                          * ( setting->avgPeriod != 0.0? total / setting->avgPeriod : (range? range[k] : 0.0) )
+                          / ( setting->rangeType == TA_RangeType_Shadows ? 2.0 : 1.0 );
+            if( range )
+            {
+               if( k >= setting->avgPeriod )
+                  trailing = range[k-setting->avgPeriod];
+               else if( j >= setting->avgPeriod )
+                  trailing = candleRange( setting->rangeType, inOpen[j-setting->avgPeriod], inHigh[j-setting->avgPeriod],
+                                          inLow[j-setting->avgPeriod], inClose[j-setting->avgPeriod] );
+               else
+                  trailing = 0.0;
+               total += range[k] - trailing;
+            }
+         }
+      }
+
+      /* The rules, the bars before the lookback of a pattern are 0. */
+      for( p=0; p < nbPattern; p++ )
+      {
+         outRow = outInteger + p*outLength;
+         begIdx = candleLookback( pattern[p], optInPenetration );
+         if( begIdx < blockStart )
+            begIdx = blockStart;
+         for( j=blockStart; (j < begIdx) && (j <= blockEnd); j++ )
+            outRow[j-startIdx] = 0;
+         if( begIdx <= blockEnd )
+            TA_CandlePatterns[pattern[p]].rule( &features, inOpen+base, inHigh+base, inLow+base, inClose+base,
+                                                candlePenetration( pattern[p], optInPenetration ),
+                                                begIdx-base, blockEnd-base, outRow+begIdx-startIdx );
+      }
+   }
+
+   ARRAY_INT_FREE( candleColor );
+   ARRAY_FREE( buffer );
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outLength;
+
+   return TA_SUCCESS;
+}
+
+#endif /* !defined( _MANAGED ) && !defined( _JAVA ) */
@@ -61,74 +61,145 @@ namespace TicTacTec { namespace TA { namespace Library {
 #if defined( _MANAGED )
  enum class Core::RetCode Core::SetUnstablePeriod(  enum class FuncUnstId id,
                                                     unsigned int unstablePeriod )
-#else
-TA_RetCode TA_SetUnstablePeriod( TA_FuncUnstId id,
-                                 unsigned int  unstablePeriod )
-#endif
 {
    int i;
 
-   if( id > ENUM_VALUE(FuncUnstId,TA_FUNC_UNST_ALL,FuncUnstAll) )
-      return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+   if( id > FuncUnstId::FuncUnstAll )
+      return RetCode::BadParam;
 
-   if( id == ENUM_VALUE(FuncUnstId,TA_FUNC_UNST_ALL,FuncUnstAll) )
+   if( id == FuncUnstId::FuncUnstAll )
    {
-      for( i=0; i < (int)ENUM_VALUE(FuncUnstId,TA_FUNC_UNST_ALL,FuncUnstAll); i++ )
-	  {		  
-         #if defined( _MANAGED )
-            Globals->unstablePeriod[(int)i] = unstablePeriod;
-         #else
-            TA_Globals->unstablePeriod[i] = unstablePeriod;   
-         #endif
-	  }
+      for( i=0; i < (int)FuncUnstId::FuncUnstAll; i++ )
+         Globals->unstablePeriod[(int)i] = unstablePeriod;
    }
    else
-   {
-         #if defined( _MANAGED )
-            Globals->unstablePeriod[(int)id] = unstablePeriod;
-         #else
-            TA_Globals->unstablePeriod[id] = unstablePeriod;   
-         #endif      
-   }
+      Globals->unstablePeriod[(int)id] = unstablePeriod;
 
-   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   return RetCode::Success;
 }
 
-#if defined( _MANAGED )
 unsigned int Core::GetUnstablePeriod( enum class FuncUnstId id )
-#else
-unsigned int TA_GetUnstablePeriod( TA_FuncUnstId id )
-#endif
 {
-   if( id >= ENUM_VALUE(FuncUnstId,TA_FUNC_UNST_ALL,FuncUnstAll) )
+   if( id >= FuncUnstId::FuncUnstAll )
 	   return 0;
 
-   #if defined( _MANAGED )
-      return Globals->unstablePeriod[(int)id];
-   #else
-      return TA_Globals->unstablePeriod[id];
-   #endif
+   return Globals->unstablePeriod[(int)id];
 }
 
-#if defined( _MANAGED )
  enum class Core::RetCode Core::SetCompatibility(  enum class Compatibility value )
-#else
-TA_RetCode TA_SetCompatibility( TA_Compatibility value )
-#endif
 {
    TA_GLOBALS_COMPATIBILITY = value;
-   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   return RetCode::Success;
 }
 
-#if defined( _MANAGED )
  enum class Core::Compatibility Core::GetCompatibility( void )
+{
+   return TA_GLOBALS_COMPATIBILITY;
+}
+
+ enum class Core::RetCode Core::SetPrecision(  enum class Precision value )
+{
+   TA_GLOBALS_PRECISION = value;
+   return RetCode::Success;
+}
+
+ enum class Core::Precision Core::GetPrecision( void )
+{
+   return TA_GLOBALS_PRECISION;
+}
 #else
+/* The TA_Set and TA_Get functions change the global settings, the
+ * TA_Context versions change a context, see TA_SetThreadContext.
+ */
+TA_RetCode TA_SetUnstablePeriod( TA_FuncUnstId id,
+                                 unsigned int  unstablePeriod )
+{
+   return TA_ContextSetUnstablePeriod( &TA_Globals->settings, id, unstablePeriod );
+}
+
+unsigned int TA_GetUnstablePeriod( TA_FuncUnstId id )
+{
+   return TA_ContextGetUnstablePeriod( &TA_Globals->settings, id );
+}
+
+TA_RetCode TA_SetCompatibility( TA_Compatibility value )
+{
+   return TA_ContextSetCompatibility( &TA_Globals->settings, value );
+}
+
 TA_Compatibility TA_GetCompatibility( void )
-#endif
 {
-   return TA_GLOBALS_COMPATIBILITY;
+   return TA_ContextGetCompatibility( &TA_Globals->settings );
+}
+
+TA_RetCode TA_SetPrecision( TA_Precision value )
+{
+   return TA_ContextSetPrecision( &TA_Globals->settings, value );
+}
+
+TA_Precision TA_GetPrecision( void )
+{
+   return TA_ContextGetPrecision( &TA_Globals->settings );
+}
+
+TA_RetCode TA_ContextSetUnstablePeriod( TA_Context    *context,
+                                        TA_FuncUnstId  id,
+                                        unsigned int   unstablePeriod )
+{
+   int i;
+
+   if( !context || id > TA_FUNC_UNST_ALL )
+      return TA_BAD_PARAM;
+
+   if( id == TA_FUNC_UNST_ALL )
+   {
+      for( i=0; i < (int)TA_FUNC_UNST_ALL; i++ )
+         context->unstablePeriod[i] = unstablePeriod;
+   }
+   else
+      context->unstablePeriod[id] = unstablePeriod;
+
+   return TA_SUCCESS;
+}
+
+unsigned int TA_ContextGetUnstablePeriod( const TA_Context *context,
+                                          TA_FuncUnstId     id )
+{
+   if( !context || id >= TA_FUNC_UNST_ALL )
+	   return 0;
+
+   return context->unstablePeriod[id];
+}
+
+TA_RetCode TA_ContextSetCompatibility( TA_Context *context, TA_Compatibility value )
+{
+   if( !context )
+      return TA_BAD_PARAM;
+
+   context->compatibility = value;
+   return TA_SUCCESS;
 }
 
+TA_Compatibility TA_ContextGetCompatibility( const TA_Context *context )
+{
+   return context? context->compatibility : TA_COMPATIBILITY_DEFAULT;
+}
+
+TA_RetCode TA_ContextSetPrecision( TA_Context *context, TA_Precision value )
+{
+   if( !context )
+      return TA_BAD_PARAM;
+
+   context->precision = value;
+   return TA_SUCCESS;
+}
+
+TA_Precision TA_ContextGetPrecision( const TA_Context *context )
+{
+   return context? context->precision : TA_PRECISION_DEFAULT;
+}
+#endif
+
 #if defined( _MANAGED )
 }}} // Close namespace TicTacTec::TA::Lib
 #endif
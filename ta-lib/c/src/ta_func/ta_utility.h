@@ -149,6 +149,516 @@ TA_RetCode TA_S_INT_VAR( int           startIdx,
                          double       *outReal );
 #endif
 
+/* Internal linear regression function.
+ *
+ * Evaluates the outputs of TA_LINEARREG, TA_LINEARREG_SLOPE,
+ * TA_LINEARREG_ANGLE, TA_LINEARREG_INTERCEPT and TA_TSF in
+ * a single pass using sliding sums. Any output can be NULL.
+ *
+ * The sliding sums are rebuilt from scratch every
+ * optInResumPeriod bars (0 disables it) to bound the
+ * accumulated rounding error.
+ */
+#define TA_LINEARREG_RESUM_PERIOD 1024
+
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_LINEARREG( int           startIdx,
+                             int           endIdx,
+                             const double *inReal,
+                             int           optInTimePeriod,
+                             int           optInResumPeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double       *outLinearReg,
+                             double       *outSlope,
+                             double       *outAngle,
+                             double       *outIntercept,
+                             double       *outTSF );
+
+TA_RetCode TA_S_INT_LINEARREG( int           startIdx,
+                               int           endIdx,
+                               const float  *inReal,
+                               int           optInTimePeriod,
+                               int           optInResumPeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double       *outLinearReg,
+                               double       *outSlope,
+                               double       *outAngle,
+                               double       *outIntercept,
+                               double       *outTSF );
+#endif
+
+/* Internal function evaluating the same MA type at several
+ * periods in a single pass over the input, see ta_MA.c.
+ *
+ * The EMA of all the periods are buffered for
+ * TA_MA_RIBBON_EMA_BLOCK bars before being copied to the
+ * output rows.
+ */
+#define TA_MA_RIBBON_EMA_BLOCK 64
+
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_MA_RIBBON( int           startIdx,
+                             int           endIdx,
+                             const double *inReal,
+                             int           nbPeriod,
+                             const int    *optInTimePeriods,
+                             TA_MAType     optInMAType,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double       *outReal );
+
+TA_RetCode TA_S_INT_MA_RIBBON( int           startIdx,
+                               int           endIdx,
+                               const float  *inReal,
+                               int           nbPeriod,
+                               const int    *optInTimePeriods,
+                               TA_MAType     optInMAType,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double       *outReal );
+#endif
+
+/* Internal directional movement function evaluating the outputs of
+ * TA_ADX, TA_ADXR, TA_DX, TA_PLUS_DI, TA_MINUS_DI, TA_PLUS_DM,
+ * TA_MINUS_DM and TA_ATR from the same smoothed DM and TR, see
+ * ta_ADX.c. Any output can be NULL.
+ *
+ * outBegIdx and outNBElement are arrays of TA_DMI_NB_OUTPUT
+ * integers, one for each output in the order of the arguments.
+ * The outputs whose function starts from the same price bar
+ * share the same pass over the input, which is the case of all
+ * of them when startIdx is not beyond the lookback.
+ */
+#define TA_DMI_NB_OUTPUT 8
+
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_DMI( int           startIdx,
+                       int           endIdx,
+                       const double *inHigh,
+                       const double *inLow,
+                       const double *inClose,
+                       int           optInTimePeriod,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double       *outADX,
+                       double       *outADXR,
+                       double       *outDX,
+                       double       *outPlusDI,
+                       double       *outMinusDI,
+                       double       *outPlusDM,
+                       double       *outMinusDM,
+                       double       *outATR );
+
+TA_RetCode TA_S_INT_DMI( int           startIdx,
+                         int           endIdx,
+                         const float  *inHigh,
+                         const float  *inLow,
+                         const float  *inClose,
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double       *outADX,
+                         double       *outADXR,
+                         double       *outDX,
+                         double       *outPlusDI,
+                         double       *outMinusDI,
+                         double       *outPlusDM,
+                         double       *outMinusDM,
+                         double       *outATR );
+#endif
+
+/* Internal Hilbert Transform function evaluating the outputs of
+ * TA_HT_DCPERIOD, TA_HT_PHASOR, TA_HT_DCPHASE, TA_HT_SINE,
+ * TA_HT_TRENDLINE and TA_HT_TRENDMODE in a single pass, see
+ * ta_HT_TRENDMODE.c. Any output can be NULL.
+ *
+ * The first three come from the 32 bars pipeline of TA_HT_DCPERIOD
+ * and TA_HT_PHASOR, the others from the 63 bars pipeline of the
+ * other functions. The two pipelines do not warm up from the same
+ * price bar, so one call evaluates the outputs of only one of them.
+ * optInUnstablePeriod is the unstable period of the functions.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_HT( int           startIdx,
+                      int           endIdx,
+                      const double *inReal,
+                      int           optInUnstablePeriod,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double       *outDCPeriod,
+                      double       *outInPhase,
+                      double       *outQuadrature,
+                      double       *outDCPhase,
+                      double       *outSine,
+                      double       *outLeadSine,
+                      double       *outTrendline,
+                      int          *outTrendMode );
+
+TA_RetCode TA_S_INT_HT( int           startIdx,
+                        int           endIdx,
+                        const float  *inReal,
+                        int           optInUnstablePeriod,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double       *outDCPeriod,
+                        double       *outInPhase,
+                        double       *outQuadrature,
+                        double       *outDCPhase,
+                        double       *outSine,
+                        double       *outLeadSine,
+                        double       *outTrendline,
+                        int          *outTrendMode );
+#endif
+
+/* Internal candlestick function evaluating any of the TA_CDL
+ * functions from the same candle features and averages, see
+ * ta_candle.c.
+ *
+ * pattern holds nbPattern indexes in the alphabetical order of the
+ * TA_CDL functions, from 0 for TA_CDL2CROWS to TA_CDL_NB_PATTERN-1
+ * for TA_CDLXSIDEGAP3METHODS. optInPenetration is the one of all the
+ * patterns which have an optInPenetration, TA_REAL_DEFAULT keeps the
+ * default of each pattern. outInteger holds one row of
+ * endIdx-startIdx+1 integers per pattern, the bars before the lookback
+ * of a pattern are 0.
+ */
+#define TA_CDL_NB_PATTERN 61
+
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_CDL( int           startIdx,
+                       int           endIdx,
+                       const double *inOpen,
+                       const double *inHigh,
+                       const double *inLow,
+                       const double *inClose,
+                       int           nbPattern,
+                       const int    *pattern,
+                       double        optInPenetration,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       int          *outInteger );
+#endif
+
+/* Internal stochastic function evaluating TA_STOCH, TA_STOCHF and
+ * TA_STOCHRSI, see ta_STOCH.c.
+ *
+ * The raw %K is the position of the close among the extrema of the
+ * last optInFastK_Period bars, it is smoothed by the MA of
+ * optInSlowK_Period (outSlowK) which is smoothed by the MA of
+ * optInSlowD_Period (outSlowD). A period of 1 copies its input, so
+ * TA_STOCHF has an optInSlowK_Period of 1. When optInRSIPeriod is not
+ * 0, the high, low and close are all the RSI of inClose (TA_STOCHRSI).
+ *
+ * The extrema are sliding window extrema (see TA_WINDOW_PUSH).
+ * When both MA are a copy, an SMA or an EMA, they are applied in the
+ * same pass (see TA_STOCH_STAGE_FEED) and nothing is allocated beyond
+ * the windows, which are on the stack up to TA_STOCH_LOCAL_SIZE bars.
+ * Otherwise the raw %K is buffered and smoothed by TA_MA.
+ */
+#define TA_STOCH_LOCAL_SIZE 64
+
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_STOCH( int           startIdx,
+                         int           endIdx,
+                         const double *inHigh,
+                         const double *inLow,
+                         const double *inClose,
+                         int           optInRSIPeriod,
+                         int           optInFastK_Period,
+                         int           optInSlowK_Period,
+                         TA_MAType     optInSlowK_MAType,
+                         int           optInSlowD_Period,
+                         TA_MAType     optInSlowD_MAType,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double       *outSlowK,
+                         double       *outSlowD );
+
+TA_RetCode TA_S_INT_STOCH( int           startIdx,
+                           int           endIdx,
+                           const float  *inHigh,
+                           const float  *inLow,
+                           const float  *inClose,
+                           int           optInRSIPeriod,
+                           int           optInFastK_Period,
+                           int           optInSlowK_Period,
+                           TA_MAType     optInSlowK_MAType,
+                           int           optInSlowD_Period,
+                           TA_MAType     optInSlowD_MAType,
+                           int          *outBegIdx,
+                           int          *outNBElement,
+                           double       *outSlowK,
+                           double       *outSlowD );
+#endif
+
+/* Moving averages of a window from prefix sums.
+ *
+ * TA_PREFIX_BUILD stores, for each k, the sum of input[base+1..base+k]
+ * and the sum of j*input[base+j] for j in 1..k, up to input[lastIdx].
+ * The SMA, WMA and TRIMA of the window (lo,hi] are then evaluated in
+ * O(1) for any period hi-lo.
+ *
+ * Used when many periods are evaluated over the same input, see
+ * TA_MAVP and TA_INT_MA_RIBBON. The prefix sums are compensated (see
+ * TA_COMPENSATED_ADD), so the difference of two of them is accurate
+ * even when the window is small compared to the prefix. 'prefix' holds
+ * 4 arrays of 'size' doubles: the sums, their compensations, the index
+ * weighted sums and their compensations. The users rebuild it for each
+ * block of max(TA_PREFIX_BLOCK_SIZE, largest period) outputs, with
+ * 'base' close to the start of the block, the error of the WMA and
+ * TRIMA still grows with the length of the block.
+ */
+#define TA_PREFIX_BLOCK_SIZE 1024
+
+#define TA_PREFIX_BUILD(prefix,size,input,base,lastIdx) { \
+   int k_; \
+   double sum_ = 0.0, sumComp_ = 0.0, idxSum_ = 0.0, idxSumComp_ = 0.0; \
+   prefix[0] = prefix[size] = prefix[2*(size)] = prefix[3*(size)] = 0.0; \
+   for( k_=1; (base)+k_ <= (lastIdx); k_++ ) \
+   { \
+      TA_COMPENSATED_ADD( sum_, sumComp_, input[(base)+k_] ); \
+      TA_COMPENSATED_ADD_PRODUCT( idxSum_, idxSumComp_, input[(base)+k_], k_ ); \
+      prefix[k_]            = sum_; \
+      prefix[(size)+k_]     = sumComp_; \
+      prefix[2*(size)+k_]   = idxSum_; \
+      prefix[3*(size)+k_]   = idxSumComp_; \
+   } }
+
+#define TA_PREFIX_SUM(prefix,size,lo,hi) \
+   ((prefix[hi]-prefix[lo])+(prefix[(size)+(hi)]-prefix[(size)+(lo)]))
+
+#define TA_PREFIX_IDX_SUM(prefix,size,lo,hi) \
+   ((prefix[2*(size)+(hi)]-prefix[2*(size)+(lo)])+(prefix[3*(size)+(hi)]-prefix[3*(size)+(lo)]))
+
+#define TA_PREFIX_SMA(out,prefix,size,lo,hi) { \
+   out = TA_PREFIX_SUM(prefix,size,lo,hi)/((hi)-(lo)); }
+
+/* The weight of input[base+k] is k-lo. */
+#define TA_PREFIX_WMA(out,prefix,size,lo,hi) { \
+   out = (TA_PREFIX_IDX_SUM(prefix,size,lo,hi)-(lo)*TA_PREFIX_SUM(prefix,size,lo,hi)) \
+         /(((hi)-(lo))*((hi)-(lo)+1.0)*0.5); }
+
+/* The weights are 1,2,..,mid-lo for k in (lo,mid] followed
+ * by hi+1-k for k in (mid,hi].
+ */
+#define TA_PREFIX_TRIMA(out,prefix,size,lo,hi) { \
+   int left_  = ((hi)-(lo)+1)>>1; \
+   int right_ = (hi)-(lo)-left_; \
+   int mid_   = (lo)+left_; \
+   out = ((TA_PREFIX_IDX_SUM(prefix,size,lo,mid_)-(lo)*TA_PREFIX_SUM(prefix,size,lo,mid_)) \
+          +(((hi)+1)*TA_PREFIX_SUM(prefix,size,mid_,hi)-TA_PREFIX_IDX_SUM(prefix,size,mid_,hi))) \
+         /((left_*(left_+1.0)+right_*(right_+1.0))*0.5); }
+
+/* Rolling moments of a window of 'n' values.
+ *
+ * The mean, the sum of the squared deviations (M2) and the
+ * sum of the products of the deviations (C) are updated in
+ * O(1) when the oldest value of the window is replaced by a
+ * new one (Welford update). Only the deviations from the mean
+ * are involved, so there is no catastrophic cancellation when
+ * the values are large compared to their spread, as it happens
+ * with the sums of x and x*x.
+ *
+ * The rounding errors still accumulate, so the users rebuild
+ * the moments from the window every TA_MOMENTS_RESUM_PERIOD
+ * values. The users also pass the values relative to one of
+ * the window at that time, otherwise the rounding of a large
+ * mean is carried to M2 and C.
+ */
+#define TA_MOMENTS_RESUM_PERIOD 1024
+
+#define TA_MOMENTS_REPLACE(n,mean,m2,newV,oldV) { \
+   double devNew_ = (newV)-(mean); \
+   double devOld_ = (oldV)-(mean); \
+   double diff_   = (newV)-(oldV); \
+   m2   += diff_*(devNew_+devOld_-diff_/(n)); \
+   mean += diff_/(n); }
+
+#define TA_COMOMENTS_REPLACE(n,meanX,meanY,m2X,m2Y,cXY,newX,newY,oldX,oldY) { \
+   double devNewX_ = (newX)-(meanX); \
+   double devOldX_ = (oldX)-(meanX); \
+   double diffX_   = (newX)-(oldX); \
+   double devNewY_ = (newY)-(meanY); \
+   double devOldY_ = (oldY)-(meanY); \
+   double diffY_   = (newY)-(oldY); \
+   m2X   += diffX_*(devNewX_+devOldX_-diffX_/(n)); \
+   m2Y   += diffY_*(devNewY_+devOldY_-diffY_/(n)); \
+   cXY   += devNewX_*devNewY_-devOldX_*devOldY_-diffX_*diffY_/(n); \
+   meanX += diffX_/(n); \
+   meanY += diffY_/(n); }
+
+/* Mean deviation of TA_AVGDEV and TA_CCI.
+ *
+ * The mean and the sum of the absolute deviations are still
+ * summed over the whole window for each output, in the same
+ * order as before, so the results are unchanged. But
+ * TA_MEANDEV_LANES consecutive outputs are evaluated together,
+ * each in its own accumulator: the additions of the lanes do
+ * not depend on each other, so they are pipelined or vectorized
+ * instead of waiting for the previous one. TA_CCI converts the
+ * prices to typical prices by blocks of TA_MEANDEV_BLOCK outputs.
+ */
+#define TA_MEANDEV_LANES 8
+#define TA_MEANDEV_BLOCK 1024
+
+/* The lanes are written out, so the compiler keeps them in
+ * registers. 'x' points on the values of the lanes, the _ALL
+ * versions add the same value to all of them.
+ */
+#define TA_MEANDEV_ADD(sum,x) { \
+   sum[0] += (x)[0]; sum[1] += (x)[1]; \
+   sum[2] += (x)[2]; sum[3] += (x)[3]; \
+   sum[4] += (x)[4]; sum[5] += (x)[5]; \
+   sum[6] += (x)[6]; sum[7] += (x)[7]; }
+
+#define TA_MEANDEV_ADD_DEV(dev,x,mean) { \
+   dev[0] += std_fabs((x)[0]-mean[0]); dev[1] += std_fabs((x)[1]-mean[1]); \
+   dev[2] += std_fabs((x)[2]-mean[2]); dev[3] += std_fabs((x)[3]-mean[3]); \
+   dev[4] += std_fabs((x)[4]-mean[4]); dev[5] += std_fabs((x)[5]-mean[5]); \
+   dev[6] += std_fabs((x)[6]-mean[6]); dev[7] += std_fabs((x)[7]-mean[7]); }
+
+#define TA_MEANDEV_ADD_ALL(sum,v) { \
+   sum[0] += (v); sum[1] += (v); sum[2] += (v); sum[3] += (v); \
+   sum[4] += (v); sum[5] += (v); sum[6] += (v); sum[7] += (v); }
+
+#define TA_MEANDEV_ADD_DEV_ALL(dev,v,mean) { \
+   dev[0] += std_fabs((v)-mean[0]); dev[1] += std_fabs((v)-mean[1]); \
+   dev[2] += std_fabs((v)-mean[2]); dev[3] += std_fabs((v)-mean[3]); \
+   dev[4] += std_fabs((v)-mean[4]); dev[5] += std_fabs((v)-mean[5]); \
+   dev[6] += std_fabs((v)-mean[6]); dev[7] += std_fabs((v)-mean[7]); }
+
+/* One EMA of the cascades of TA_DEMA, TA_TEMA and TA_TRIX, fed
+ * the values of the previous stage one at a time. 'count' is the
+ * number of values fed before and 'ema' starts at 0.0. The values
+ * are the same as TA_INT_EMA on a buffer of the fed values: the
+ * seed is the average of the first 'period' values, or the first
+ * value with the Metastock compatibility. Once 'count' reaches
+ * 'period', the stage is a plain EMA update, the kernels inline it
+ * in their main loop.
+ */
+#define TA_EMA_CASCADE_FEED(ema,count,value,period,k) { \
+   if( TA_GLOBALS_COMPATIBILITY != ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) ) \
+      ema = (count) == 0 ? (value) : (((value)-ema)*(k))+ema; \
+   else if( (count) >= (period) ) \
+      ema = (((value)-ema)*(k))+ema; \
+   else \
+   { \
+      ema += (value); \
+      if( (count) == (period)-1 ) \
+         ema /= (period); \
+   } \
+   (count)++; }
+
+/* Sliding window extrema (van Herk/Gil-Werman).
+ *
+ * The bars are split in blocks of 'size' bars from the first bar of
+ * the first window. At the offset 'j' of a block, the window is the
+ * end of the previous block after j and the start of the current
+ * block up to j. 'value' holds the suffix extrema of the previous
+ * block after j, and the values of the current block up to j whose
+ * extremum is 'running'. TA_WINDOW_END_BLOCK turns the values of the
+ * block into its suffix extrema once the block is complete. 'value'
+ * has size+1 elements, the last one is the latest value, so that the
+ * window extremum at the end of a block is 'running' without a test.
+ *
+ * It costs three comparisons per bar whatever the window size, and
+ * they compile to min/max instructions, where a rescan of the window
+ * when its extremum leaves it costs O(size) per bar on a trending
+ * series. The values are kept in 'value', the input is not read again.
+ */
+#define TA_WINDOW_PUSH(value,running,j,size,v,better) { \
+   (value)[j] = (v); \
+   (value)[size] = (v); \
+   running = ((v) better (running)) ? (v) : (running); \
+   if( (j) == 0 ) \
+      running = (v); }
+
+#define TA_WINDOW_GET(value,running,j,better) \
+   (((running) better (value)[(j)+1]) ? (running) : (value)[(j)+1])
+
+#define TA_WINDOW_END_BLOCK(value,size,better) { \
+   int i_; \
+   for( i_=(size)-2; i_ >= 0; i_-- ) \
+      (value)[i_] = ((value)[i_+1] better (value)[i_]) ? (value)[i_+1] : (value)[i_]; }
+
+/* One of the two smoothing MA of TA_INT_STOCH, fed the values of the
+ * previous stage one at a time. 'count' is the number of values fed
+ * before, 'ma' is valid once 'count' is beyond the lookback of the MA.
+ * The values are the same as TA_MA on a buffer of the fed values:
+ *  - TA_STOCH_STAGE_COPY, a period of 1 whatever the MA type.
+ *  - TA_STOCH_STAGE_SMA, the running 'sum' (and its compensation
+ *    'comp' in compensated precision) of the last 'period' values,
+ *    the oldest of them is taken out of 'ring' at 'ringIdx'.
+ *  - TA_STOCH_STAGE_EMA, see TA_EMA_CASCADE_FEED.
+ */
+#define TA_STOCH_STAGE_NONE 0
+#define TA_STOCH_STAGE_COPY 1
+#define TA_STOCH_STAGE_SMA  2
+#define TA_STOCH_STAGE_EMA  3
+
+#define TA_STOCH_STAGE_FEED(kind,ma,sum,comp,ring,ringIdx,count,value,period,k,isCompensated) { \
+   if( (kind) == TA_STOCH_STAGE_EMA ) \
+      TA_EMA_CASCADE_FEED(ma,count,value,period,k) \
+   else if( (kind) == TA_STOCH_STAGE_SMA ) \
+   { \
+      (ring)[ringIdx] = (value); \
+      if( ++(ringIdx) == (period) ) \
+         (ringIdx) = 0; \
+      if( isCompensated ) \
+      { \
+         TA_COMPENSATED_ADD( sum, comp, value ); \
+         if( (count) >= (period)-1 ) \
+         { \
+            ma = ((sum)+(comp))/(period); \
+            TA_COMPENSATED_ADD( sum, comp, -(ring)[ringIdx] ); \
+         } \
+      } \
+      else \
+      { \
+         sum += (value); \
+         if( (count) >= (period)-1 ) \
+         { \
+            ma = (sum)/(period); \
+            sum -= (ring)[ringIdx]; \
+         } \
+      } \
+      (count)++; \
+   } \
+   else \
+   { \
+      ma = (value); \
+      (count)++; \
+   } }
+
+/* Neumaier compensated summation.
+ *
+ * Used by the running sums when the precision is
+ * TA_PRECISION_COMPENSATED (see TA_SetPrecision).
+ * 'comp' accumulates the low order bits lost by 'sum',
+ * the compensated total is sum+comp.
+ */
+#define TA_COMPENSATED_ADD(sum,comp,value) { \
+   double value_ = (value); \
+   double total_ = (sum)+value_; \
+   if( std_fabs(sum) >= std_fabs(value_) ) \
+      comp += ((sum)-total_)+value_; \
+   else \
+      comp += (value_-total_)+(sum); \
+   sum = total_; }
+
+/* Add value*factor to a compensated sum, factor being an
+ * integer below 2^26. The value is split in two halves of
+ * 26 bits (Veltkamp) whose products with factor are exact,
+ * so the product does not add a rounding error either.
+ */
+#define TA_COMPENSATED_ADD_PRODUCT(sum,comp,value,factor) { \
+   double split_ = (value)*134217729.0; \
+   double high_  = split_-(split_-(value)); \
+   TA_COMPENSATED_ADD( sum, comp, high_*(factor) ); \
+   TA_COMPENSATED_ADD( sum, comp, ((value)-high_)*(factor) ); }
+
 /* A function to calculate a standard deviation.
  *
  * This function allows speed optimization when the
@@ -342,9 +852,9 @@ void TA_S_INT_stddev_using_precalc_ma( const float  *inReal,
    #define TA_CANDLEAVGPERIOD(SET) (this.candleSettings[CandleSettingType.SET.ordinal()].avgPeriod)
    #define TA_CANDLEFACTOR(SET)    (this.candleSettings[CandleSettingType.SET.ordinal()].factor)
 #else
-   #define TA_CANDLERANGETYPE(SET) (TA_Globals->candleSettings[TA_##SET].rangeType)
-   #define TA_CANDLEAVGPERIOD(SET) (TA_Globals->candleSettings[TA_##SET].avgPeriod)
-   #define TA_CANDLEFACTOR(SET)    (TA_Globals->candleSettings[TA_##SET].factor)
+   #define TA_CANDLERANGETYPE(SET) (TA_ThreadContext->candleSettings[TA_##SET].rangeType)
+   #define TA_CANDLEAVGPERIOD(SET) (TA_ThreadContext->candleSettings[TA_##SET].avgPeriod)
+   #define TA_CANDLEFACTOR(SET)    (TA_ThreadContext->candleSettings[TA_##SET].factor)
 #endif
 
 #define TA_CANDLERANGE(SET,IDX) \
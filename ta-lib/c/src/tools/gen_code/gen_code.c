@@ -3176,6 +3176,10 @@ static int createMSVCProjTemplate( FileHandle *in, FileHandle *out )
          fprintf( outFile, "\n");
          fprintf( outFile, "SOURCE=.." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH "src" TA_FS_SLASH "ta_func" TA_FS_SLASH "ta_utility.c\n");
          fprintf( outFile, "# End Source File\n");
+         fprintf( outFile, "# Begin Source File\n");
+         fprintf( outFile, "\n");
+         fprintf( outFile, "SOURCE=.." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH "src" TA_FS_SLASH "ta_func" TA_FS_SLASH "ta_candle.c\n");
+         fprintf( outFile, "# End Source File\n");
          fprintf( outFile, "# End Group\n");
          break;
       }
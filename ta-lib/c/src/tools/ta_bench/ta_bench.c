@@ -0,0 +1,1647 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Description:
+ *    Accuracy and speed benchmarks of the TA functions.
+ *
+ *    Each benchmark compares a TA function against a long double
+ *    reference and, when the algorithm of the function was replaced,
+ *    against the former algorithm kept in this file.
+ *
+ *    Usage: ta_bench [benchmark name...]
+ *           Without name, all the benchmarks are run.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include "ta_libc.h"
+#include "ta_utility.h"
+
+/**** Local declarations.              ****/
+#define NB_BARS 1000000
+
+typedef struct
+{
+   const char *name;
+   const double *inReal0;
+   const double *inReal1;
+} BenchSeries;
+
+typedef struct
+{
+   const char *name;
+   void (*run)( const BenchSeries *series, int nbSeries );
+} BenchEntry;
+
+/* A TA function with one input and a period, or the
+ * former algorithm of this function.
+ */
+typedef TA_RetCode (*Bench1InFunc)( int startIdx, int endIdx,
+                                    const double inReal[],
+                                    int optInTimePeriod,
+                                    int *outBegIdx, int *outNBElement,
+                                    double outReal[] );
+
+/* Same with two inputs. */
+typedef TA_RetCode (*Bench2InFunc)( int startIdx, int endIdx,
+                                    const double inReal0[],
+                                    const double inReal1[],
+                                    int optInTimePeriod,
+                                    int *outBegIdx, int *outNBElement,
+                                    double outReal[] );
+
+/**** Local functions declarations.    ****/
+static void bench_var( const BenchSeries *series, int nbSeries );
+static void bench_correl( const BenchSeries *series, int nbSeries );
+static void bench_beta( const BenchSeries *series, int nbSeries );
+static void bench_precision( const BenchSeries *series, int nbSeries );
+static void bench_mavp( const BenchSeries *series, int nbSeries );
+static void bench_ribbon( const BenchSeries *series, int nbSeries );
+static void bench_ht( const BenchSeries *series, int nbSeries );
+static void bench_dmi( const BenchSeries *series, int nbSeries );
+static void bench_cdl( const BenchSeries *series, int nbSeries );
+static void bench_meandev( const BenchSeries *series, int nbSeries );
+static void bench_cascade( const BenchSeries *series, int nbSeries );
+static void bench_stoch( const BenchSeries *series, int nbSeries );
+
+/**** Local variables definitions.     ****/
+static const BenchEntry benchTable[] =
+{
+   { "VAR",    bench_var },
+   { "CORREL", bench_correl },
+   { "BETA",   bench_beta },
+   { "PRECISION", bench_precision },
+   { "MAVP",   bench_mavp },
+   { "RIBBON", bench_ribbon },
+   { "HT",     bench_ht },
+   { "DMI",    bench_dmi },
+   { "CDL",    bench_cdl },
+   { "MEANDEV", bench_meandev },
+   { "CASCADE", bench_cascade },
+   { "STOCH",  bench_stoch }
+};
+
+#define NB_BENCH (sizeof(benchTable)/sizeof(BenchEntry))
+
+static const int benchPeriods[] = { 5, 20, 200 };
+
+#define NB_PERIODS (sizeof(benchPeriods)/sizeof(int))
+
+static double *gOut;
+static double *gRef;
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   double *walk, *offset, *index;
+   double level, noise;
+   BenchSeries series[2];
+   unsigned int seed;
+   int i, j, run;
+
+   if( TA_Initialize() != TA_SUCCESS )
+   {
+      printf( "TA_Initialize failed\n" );
+      return 1;
+   }
+
+   walk   = (double *)malloc( NB_BARS * sizeof(double) );
+   offset = (double *)malloc( NB_BARS * sizeof(double) );
+   index  = (double *)malloc( NB_BARS * sizeof(double) );
+   gOut   = (double *)malloc( NB_BARS * sizeof(double) );
+   gRef   = (double *)malloc( NB_BARS * sizeof(double) );
+   if( !walk || !offset || !index || !gOut || !gRef )
+   {
+      printf( "Not enough memory\n" );
+      return 1;
+   }
+   memset( gOut, 0, NB_BARS * sizeof(double) );
+   memset( gRef, 0, NB_BARS * sizeof(double) );
+
+   /* Deterministic random walks. 'offset' is a price around 1e5 with
+    * a tiny spread, which is the worst case of the sums of x and x*x.
+    */
+   seed = 12345;
+   level = 100.0;
+   for( i=0; i < NB_BARS; i++ )
+   {
+      seed = seed*1103515245u+12345u;
+      noise = ((double)((seed>>8)&0xFFFF)/65536.0)-0.5;
+      level += noise;
+      if( level < 1.0 )
+         level = 1.0;
+      walk[i]   = level;
+      offset[i] = 1.0e5+level*1.0e-3;
+      index[i]  = 1000.0+level*0.5+noise;
+   }
+
+   series[0].name = "walk";
+   series[0].inReal0 = walk;
+   series[0].inReal1 = index;
+   series[1].name = "offset";
+   series[1].inReal0 = offset;
+   series[1].inReal1 = index;
+
+   printf( "%-8s %-8s %6s %-11s %12s %10s %10s\n",
+           "FUNC", "SERIES", "PERIOD", "ALGO", "MAX REL ERR", "NEGATIVE", "SECONDS" );
+
+   for( j=0; j < (int)NB_BENCH; j++ )
+   {
+      run = (argc <= 1);
+      for( i=1; i < argc; i++ )
+      {
+         if( strcmp( argv[i], benchTable[j].name ) == 0 )
+            run = 1;
+      }
+      if( run )
+         benchTable[j].run( series, 2 );
+   }
+
+   free( walk );
+   free( offset );
+   free( index );
+   free( gOut );
+   free( gRef );
+   TA_Shutdown();
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static double elapsed( clock_t start )
+{
+   return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+static void print_result( const char *func, const char *series, int period, const char *algo,
+                          int nbElement, double seconds )
+{
+   double maxErr, err, scale;
+   int i, nbNegative;
+
+   /* The error is relative to the largest magnitude of the
+    * reference, a relative error on values close to zero
+    * is meaningless.
+    */
+   scale = 0.0;
+   for( i=0; i < nbElement; i++ )
+   {
+      if( fabs(gRef[i]) > scale )
+         scale = fabs(gRef[i]);
+   }
+   if( scale == 0.0 )
+      scale = 1.0;
+
+   maxErr = 0.0;
+   nbNegative = 0;
+   for( i=0; i < nbElement; i++ )
+   {
+      err = fabs(gOut[i]-gRef[i])/scale;
+      if( err > maxErr )
+         maxErr = err;
+      if( gOut[i] < 0.0 )
+         nbNegative++;
+   }
+
+   printf( "%-8s %-8s %6d %-11s %12.3e %10d %10.4f\n",
+           func, series, period, algo, maxErr, nbNegative, seconds );
+}
+
+static void bench_1in( const char *func, const BenchSeries *series, int period,
+                       Bench1InFunc newFunc, Bench1InFunc oldFunc )
+{
+   int outBegIdx, outNBElement;
+   clock_t start;
+
+   start = clock();
+   newFunc( 0, NB_BARS-1, series->inReal0, period, &outBegIdx, &outNBElement, gOut );
+   print_result( func, series->name, period, "rolling", outNBElement, elapsed(start) );
+
+   start = clock();
+   oldFunc( 0, NB_BARS-1, series->inReal0, period, &outBegIdx, &outNBElement, gOut );
+   print_result( func, series->name, period, "sums", outNBElement, elapsed(start) );
+}
+
+static void bench_2in( const char *func, const BenchSeries *series, int period,
+                       Bench2InFunc newFunc, Bench2InFunc oldFunc )
+{
+   int outBegIdx, outNBElement;
+   clock_t start;
+
+   start = clock();
+   newFunc( 0, NB_BARS-1, series->inReal0, series->inReal1, period, &outBegIdx, &outNBElement, gOut );
+   print_result( func, series->name, period, "rolling", outNBElement, elapsed(start) );
+
+   start = clock();
+   oldFunc( 0, NB_BARS-1, series->inReal0, series->inReal1, period, &outBegIdx, &outNBElement, gOut );
+   print_result( func, series->name, period, "sums", outNBElement, elapsed(start) );
+}
+
+/* VAR */
+static TA_RetCode new_var( int startIdx, int endIdx, const double inReal[], int optInTimePeriod,
+                           int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   return TA_VAR( startIdx, endIdx, inReal, optInTimePeriod, 1.0, outBegIdx, outNBElement, outReal );
+}
+
+/* The former TA_INT_VAR, sliding sums of x and x*x. */
+static TA_RetCode old_var( int startIdx, int endIdx, const double inReal[], int optInTimePeriod,
+                           int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double periodTotal1 = 0.0, periodTotal2 = 0.0, meanValue1, tempReal;
+   int i, outIdx = 0, trailingIdx;
+
+   startIdx = optInTimePeriod-1;
+   trailingIdx = 0;
+   for( i=0; i < startIdx; i++ )
+   {
+      periodTotal1 += inReal[i];
+      periodTotal2 += inReal[i]*inReal[i];
+   }
+   for( ; i <= endIdx; i++ )
+   {
+      periodTotal1 += inReal[i];
+      periodTotal2 += inReal[i]*inReal[i];
+      meanValue1 = periodTotal1/optInTimePeriod;
+      outReal[outIdx++] = periodTotal2/optInTimePeriod-meanValue1*meanValue1;
+      tempReal = inReal[trailingIdx++];
+      periodTotal1 -= tempReal;
+      periodTotal2 -= tempReal*tempReal;
+   }
+   *outBegIdx = startIdx;
+   *outNBElement = outIdx;
+   return TA_SUCCESS;
+}
+
+static void bench_var( const BenchSeries *series, int nbSeries )
+{
+   long double mean, sum, dev;
+   const double *in;
+   int s, p, i, k, period;
+
+   for( s=0; s < nbSeries; s++ )
+   {
+      in = series[s].inReal0;
+      for( p=0; p < (int)NB_PERIODS; p++ )
+      {
+         period = benchPeriods[p];
+         for( i=period-1; i < NB_BARS; i++ )
+         {
+            mean = 0.0L;
+            for( k=i-period+1; k <= i; k++ )
+               mean += in[k];
+            mean /= period;
+            sum = 0.0L;
+            for( k=i-period+1; k <= i; k++ )
+            {
+               dev = in[k]-mean;
+               sum += dev*dev;
+            }
+            gRef[i-period+1] = (double)(sum/period);
+         }
+         bench_1in( "VAR", &series[s], period, new_var, old_var );
+      }
+   }
+}
+
+/* CORREL */
+static TA_RetCode new_correl( int startIdx, int endIdx, const double inReal0[], const double inReal1[],
+                              int optInTimePeriod, int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   return TA_CORREL( startIdx, endIdx, inReal0, inReal1, optInTimePeriod, outBegIdx, outNBElement, outReal );
+}
+
+/* The former TA_CORREL, sliding sums of x, y, x*x, y*y and x*y. */
+static TA_RetCode old_correl( int startIdx, int endIdx, const double inReal0[], const double inReal1[],
+                              int optInTimePeriod, int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double sumXY = 0.0, sumX = 0.0, sumY = 0.0, sumX2 = 0.0, sumY2 = 0.0, x, y, tempReal;
+   int today, trailingIdx = 0, outIdx = 0;
+
+   startIdx = optInTimePeriod-1;
+   for( today=0; today <= endIdx; today++ )
+   {
+      x = inReal0[today];
+      y = inReal1[today];
+      sumX += x; sumX2 += x*x; sumY += y; sumY2 += y*y; sumXY += x*y;
+      if( today < startIdx )
+         continue;
+      tempReal = (sumX2-((sumX*sumX)/optInTimePeriod)) * (sumY2-((sumY*sumY)/optInTimePeriod));
+      if( tempReal > 0.0 )
+         outReal[outIdx++] = (sumXY-((sumX*sumY)/optInTimePeriod)) / sqrt(tempReal);
+      else
+         outReal[outIdx++] = 0.0;
+      x = inReal0[trailingIdx];
+      y = inReal1[trailingIdx++];
+      sumX -= x; sumX2 -= x*x; sumY -= y; sumY2 -= y*y; sumXY -= x*y;
+   }
+   *outBegIdx = startIdx;
+   *outNBElement = outIdx;
+   return TA_SUCCESS;
+}
+
+static void bench_correl( const BenchSeries *series, int nbSeries )
+{
+   long double meanX, meanY, sxx, syy, sxy, dx, dy;
+   const double *in0, *in1;
+   int s, p, i, k, period;
+
+   for( s=0; s < nbSeries; s++ )
+   {
+      in0 = series[s].inReal0;
+      in1 = series[s].inReal1;
+      for( p=0; p < (int)NB_PERIODS; p++ )
+      {
+         period = benchPeriods[p];
+         for( i=period-1; i < NB_BARS; i++ )
+         {
+            meanX = meanY = 0.0L;
+            for( k=i-period+1; k <= i; k++ )
+            {
+               meanX += in0[k];
+               meanY += in1[k];
+            }
+            meanX /= period;
+            meanY /= period;
+            sxx = syy = sxy = 0.0L;
+            for( k=i-period+1; k <= i; k++ )
+            {
+               dx = in0[k]-meanX;
+               dy = in1[k]-meanY;
+               sxx += dx*dx; syy += dy*dy; sxy += dx*dy;
+            }
+            /* Same guard as TA_CORREL. */
+            gRef[i-period+1] = (sxx*syy >= 1.0e-14L) ? (double)(sxy/sqrtl(sxx*syy)) : 0.0;
+         }
+         bench_2in( "CORREL", &series[s], period, new_correl, old_correl );
+      }
+   }
+}
+
+/* BETA */
+static TA_RetCode new_beta( int startIdx, int endIdx, const double inReal0[], const double inReal1[],
+                            int optInTimePeriod, int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   return TA_BETA( startIdx, endIdx, inReal0, inReal1, optInTimePeriod, outBegIdx, outNBElement, outReal );
+}
+
+/* The former TA_BETA, sliding sums of the changes x, y, x*x and x*y. */
+static TA_RetCode old_beta( int startIdx, int endIdx, const double inReal0[], const double inReal1[],
+                            int optInTimePeriod, int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double S_xx = 0.0, S_xy = 0.0, S_x = 0.0, S_y = 0.0, x, y, tmp_real, n;
+   int today, trailingIdx = 1, outIdx = 0;
+
+   startIdx = optInTimePeriod;
+   n = (double)optInTimePeriod;
+   for( today=1; today <= endIdx; today++ )
+   {
+      x = (inReal0[today]-inReal0[today-1])/inReal0[today-1];
+      y = (inReal1[today]-inReal1[today-1])/inReal1[today-1];
+      S_xx += x*x; S_xy += x*y; S_x += x; S_y += y;
+      if( today < startIdx )
+         continue;
+      tmp_real = (n*S_xx)-(S_x*S_x);
+      outReal[outIdx++] = (tmp_real != 0.0) ? ((n*S_xy)-(S_x*S_y))/tmp_real : 0.0;
+      x = (inReal0[trailingIdx]-inReal0[trailingIdx-1])/inReal0[trailingIdx-1];
+      y = (inReal1[trailingIdx]-inReal1[trailingIdx-1])/inReal1[trailingIdx-1];
+      trailingIdx++;
+      S_xx -= x*x; S_xy -= x*y; S_x -= x; S_y -= y;
+   }
+   *outBegIdx = startIdx;
+   *outNBElement = outIdx;
+   return TA_SUCCESS;
+}
+
+static void bench_beta( const BenchSeries *series, int nbSeries )
+{
+   long double meanX, meanY, sxx, sxy, dx, dy;
+   const double *in0, *in1;
+   int s, p, i, k, period;
+
+   for( s=0; s < nbSeries; s++ )
+   {
+      in0 = series[s].inReal0;
+      in1 = series[s].inReal1;
+      for( p=0; p < (int)NB_PERIODS; p++ )
+      {
+         period = benchPeriods[p];
+         for( i=period; i < NB_BARS; i++ )
+         {
+            meanX = meanY = 0.0L;
+            for( k=i-period+1; k <= i; k++ )
+            {
+               meanX += ((long double)in0[k]-in0[k-1])/in0[k-1];
+               meanY += ((long double)in1[k]-in1[k-1])/in1[k-1];
+            }
+            meanX /= period;
+            meanY /= period;
+            sxx = sxy = 0.0L;
+            for( k=i-period+1; k <= i; k++ )
+            {
+               dx = ((long double)in0[k]-in0[k-1])/in0[k-1]-meanX;
+               dy = ((long double)in1[k]-in1[k-1])/in1[k-1]-meanY;
+               sxx += dx*dx; sxy += dx*dy;
+            }
+            /* Same guard as TA_BETA. */
+            gRef[i-period] = (period*sxx >= 1.0e-14L) ? (double)(sxy/sxx) : 0.0;
+         }
+         bench_2in( "BETA", &series[s], period, new_beta, old_beta );
+      }
+   }
+}
+
+/* PRECISION
+ *
+ * The running sums of SUM, SMA, WMA and TRIMA over a long series, with
+ * the default and the compensated precision (see TA_SetPrecision).
+ * The reference is evaluated in long double at every LONG_SAMPLE bars.
+ */
+#define LONG_NB_BARS 20000000
+#define LONG_SAMPLE  997
+
+static long double weighted_ref( const double *in, int today, int period, int isTrima )
+{
+   long double sum, weights;
+   int k, w;
+
+   sum = weights = 0.0L;
+   for( k=0; k < period; k++ )
+   {
+      if( isTrima )
+         w = (k+1) < (period-k) ? (k+1) : (period-k);
+      else
+         w = k+1;
+      sum += (long double)in[today-period+1+k]*w;
+      weights += w;
+   }
+   return sum/weights;
+}
+
+static void bench_precision( const BenchSeries *series, int nbSeries )
+{
+   static const char *funcNames[] = { "SUM", "SMA", "WMA", "TRIMA" };
+   static const int precisions[] = { TA_PRECISION_DEFAULT, TA_PRECISION_COMPENSATED };
+   double *in, *out, level, noise, seconds, err, maxErr;
+   long double ref;
+   int outBegIdx, outNBElement, f, p, i, k, period;
+   unsigned int seed;
+   clock_t start;
+
+   (void)series;
+   (void)nbSeries;
+
+   in  = (double *)malloc( LONG_NB_BARS * sizeof(double) );
+   out = (double *)malloc( LONG_NB_BARS * sizeof(double) );
+   if( !in || !out )
+   {
+      printf( "Not enough memory for PRECISION\n" );
+      free( in );
+      free( out );
+      return;
+   }
+   memset( out, 0, LONG_NB_BARS * sizeof(double) );
+
+   /* A tick series around 1e4 with two decimals. */
+   seed = 54321;
+   level = 1.0e4;
+   for( i=0; i < LONG_NB_BARS; i++ )
+   {
+      seed = seed*1103515245u+12345u;
+      noise = ((double)((seed>>8)&0xFFFF)/65536.0)-0.5;
+      level += noise;
+      in[i] = floor(level*100.0+0.5)/100.0;
+   }
+
+   /* Warm up the caches and the clock rate. */
+   period = 30;
+   TA_SUM( 0, LONG_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out );
+
+   for( f=0; f < 4; f++ )
+   {
+      for( p=0; p < 2; p++ )
+      {
+         TA_SetPrecision( (TA_Precision)precisions[p] );
+         start = clock();
+         switch( f )
+         {
+         case 0: TA_SUM( 0, LONG_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out ); break;
+         case 1: TA_SMA( 0, LONG_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out ); break;
+         case 2: TA_WMA( 0, LONG_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out ); break;
+         default: TA_TRIMA( 0, LONG_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out ); break;
+         }
+         seconds = elapsed( start );
+
+         maxErr = 0.0;
+         for( i=0; i < outNBElement; i += LONG_SAMPLE )
+         {
+            if( f <= 1 )
+            {
+               ref = 0.0L;
+               for( k=outBegIdx+i-period+1; k <= outBegIdx+i; k++ )
+                  ref += in[k];
+               if( f == 1 )
+                  ref /= period;
+            }
+            else
+               ref = weighted_ref( in, outBegIdx+i, period, f == 3 );
+            err = (double)fabsl( (out[i]-ref)/ref );
+            if( err > maxErr )
+               maxErr = err;
+         }
+
+         printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+                 funcNames[f], "long", period,
+                 p == 0 ? "default" : "compensated", maxErr, "-", seconds );
+      }
+   }
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+
+   free( in );
+   free( out );
+}
+
+/* MAVP
+ *
+ * Adaptive periods from 2 to 200, against the former TA_MAVP
+ * which did a full MA for each distinct period.
+ */
+#define MAVP_MAX_PERIOD 200
+
+static TA_RetCode old_mavp( int startIdx, int endIdx, const double inReal[], const double inPeriods[],
+                            int optInMaxPeriod, TA_MAType optInMAType,
+                            int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double *localOutput;
+   int *localPeriod;
+   int i, j, outputSize, curPeriod, localBegIdx, localNbElement;
+
+   startIdx = TA_MA_Lookback( optInMaxPeriod, optInMAType );
+   outputSize = endIdx-startIdx+1;
+   localOutput = (double *)malloc( outputSize * sizeof(double) );
+   localPeriod = (int *)malloc( outputSize * sizeof(int) );
+   for( i=0; i < outputSize; i++ )
+      localPeriod[i] = (int)inPeriods[startIdx+i];
+
+   for( i=0; i < outputSize; i++ )
+   {
+      curPeriod = localPeriod[i];
+      if( curPeriod != 0 )
+      {
+         TA_MA( startIdx, endIdx, inReal, curPeriod, optInMAType,
+                &localBegIdx, &localNbElement, localOutput );
+         outReal[i] = localOutput[i];
+         for( j=i+1; j < outputSize; j++ )
+         {
+            if( localPeriod[j] == curPeriod )
+            {
+               localPeriod[j] = 0;
+               outReal[j] = localOutput[j];
+            }
+         }
+      }
+   }
+
+   free( localOutput );
+   free( localPeriod );
+   *outBegIdx = startIdx;
+   *outNBElement = outputSize;
+   return TA_SUCCESS;
+}
+
+static void bench_mavp( const BenchSeries *series, int nbSeries )
+{
+   static const char *funcNames[] = { "MAVP-SMA", "MAVP-WMA", "MAVP-TRI", "MAVP-EMA" };
+   static const TA_MAType maTypes[] = { TA_MAType_SMA, TA_MAType_WMA, TA_MAType_TRIMA, TA_MAType_EMA };
+   const double *in;
+   double *periods;
+   long double ref;
+   int outBegIdx, outNBElement, s, f, i, k, period;
+   unsigned int seed;
+   clock_t start;
+
+   periods = (double *)malloc( NB_BARS * sizeof(double) );
+   if( !periods )
+   {
+      printf( "Not enough memory for MAVP\n" );
+      return;
+   }
+
+   /* A period drifting over the whole 2..MAVP_MAX_PERIOD range. */
+   seed = 777;
+   period = 20;
+   for( i=0; i < NB_BARS; i++ )
+   {
+      seed = seed*1103515245u+12345u;
+      period += (int)((seed>>16)%5)-2;
+      if( period < 2 )
+         period = 2;
+      else if( period > MAVP_MAX_PERIOD )
+         period = MAVP_MAX_PERIOD;
+      periods[i] = period;
+   }
+
+   for( s=0; s < nbSeries; s++ )
+   {
+      in = series[s].inReal0;
+      for( f=0; f < 4; f++ )
+      {
+         /* The reference of the EMA is the former algorithm. */
+         if( f < 3 )
+         {
+            for( i=MAVP_MAX_PERIOD-1; i < NB_BARS; i++ )
+            {
+               period = (int)periods[i];
+               if( f == 0 )
+               {
+                  ref = 0.0L;
+                  for( k=i-period+1; k <= i; k++ )
+                     ref += in[k];
+                  ref /= period;
+               }
+               else
+                  ref = weighted_ref( in, i, period, f == 2 );
+               gRef[i-MAVP_MAX_PERIOD+1] = (double)ref;
+            }
+         }
+
+         start = clock();
+         old_mavp( 0, NB_BARS-1, in, periods, MAVP_MAX_PERIOD, maTypes[f],
+                   &outBegIdx, &outNBElement, f < 3 ? gOut : gRef );
+         if( f == 3 )
+            memcpy( gOut, gRef, outNBElement * sizeof(double) );
+         print_result( funcNames[f], series[s].name, MAVP_MAX_PERIOD, "per-period",
+                       outNBElement, elapsed(start) );
+
+         start = clock();
+         TA_MAVP( 0, NB_BARS-1, in, periods, 2, MAVP_MAX_PERIOD, maTypes[f],
+                  &outBegIdx, &outNBElement, gOut );
+         print_result( funcNames[f], series[s].name, MAVP_MAX_PERIOD, "engine",
+                       outNBElement, elapsed(start) );
+      }
+   }
+
+   free( periods );
+}
+
+/* RIBBON
+ *
+ * TA_INT_MA_RIBBON at RIBBON_NB_PERIOD periods against one TA_MA
+ * per period. The reference of the SMA and WMA is evaluated in long
+ * double at every LONG_SAMPLE bars, the one of the EMA is TA_EMA.
+ */
+#define RIBBON_NB_PERIOD 30
+
+static double ribbon_error( const double *in, const int *periods, TA_MAType maType,
+                            const double *matrix )
+{
+   long double ref;
+   double err, maxErr;
+   int begIdx, nbElement, r, i, k;
+
+   maxErr = 0.0;
+   for( r=0; r < RIBBON_NB_PERIOD; r++ )
+   {
+      if( maType == TA_MAType_EMA )
+      {
+         TA_EMA( 0, NB_BARS-1, in, periods[r], &begIdx, &nbElement, gRef );
+         for( i=begIdx; i < NB_BARS; i++ )
+         {
+            err = fabs( (matrix[(size_t)r*NB_BARS+i]-gRef[i-begIdx])/gRef[i-begIdx] );
+            if( err > maxErr )
+               maxErr = err;
+         }
+         continue;
+      }
+
+      for( i=periods[r]-1; i < NB_BARS; i += LONG_SAMPLE )
+      {
+         if( maType == TA_MAType_SMA )
+         {
+            ref = 0.0L;
+            for( k=i-periods[r]+1; k <= i; k++ )
+               ref += in[k];
+            ref /= periods[r];
+         }
+         else
+            ref = weighted_ref( in, i, periods[r], 0 );
+         err = (double)fabsl( (matrix[(size_t)r*NB_BARS+i]-ref)/ref );
+         if( err > maxErr )
+            maxErr = err;
+      }
+   }
+   return maxErr;
+}
+
+static void bench_ribbon( const BenchSeries *series, int nbSeries )
+{
+   static const char *funcNames[] = { "RIB-SMA", "RIB-EMA", "RIB-WMA" };
+   static const TA_MAType maTypes[] = { TA_MAType_SMA, TA_MAType_EMA, TA_MAType_WMA };
+   int periods[RIBBON_NB_PERIOD], outBegIdx[RIBBON_NB_PERIOD], outNBElement[RIBBON_NB_PERIOD];
+   double *matrix, seconds;
+   int begIdx, nbElement, s, f, r;
+   clock_t start;
+
+   matrix = (double *)malloc( (size_t)RIBBON_NB_PERIOD * NB_BARS * sizeof(double) );
+   if( !matrix )
+   {
+      printf( "Not enough memory for RIBBON\n" );
+      return;
+   }
+   memset( matrix, 0, (size_t)RIBBON_NB_PERIOD * NB_BARS * sizeof(double) );
+
+   for( r=0; r < RIBBON_NB_PERIOD; r++ )
+      periods[r] = 10*(r+1);
+
+   /* Warm up the caches and the clock rate. */
+   TA_INT_MA_RIBBON( 0, NB_BARS-1, series[0].inReal0, RIBBON_NB_PERIOD, periods, TA_MAType_SMA,
+                     outBegIdx, outNBElement, matrix );
+
+   for( s=0; s < nbSeries; s++ )
+   {
+      for( f=0; f < 3; f++ )
+      {
+         start = clock();
+         for( r=0; r < RIBBON_NB_PERIOD; r++ )
+         {
+            begIdx = TA_MA_Lookback( periods[r], maTypes[f] );
+            TA_MA( 0, NB_BARS-1, series[s].inReal0, periods[r], maTypes[f],
+                   &begIdx, &nbElement, matrix+(size_t)r*NB_BARS+begIdx );
+         }
+         seconds = elapsed( start );
+         printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+                 funcNames[f], series[s].name, periods[RIBBON_NB_PERIOD-1], "per-period",
+                 ribbon_error( series[s].inReal0, periods, maTypes[f], matrix ), "-", seconds );
+
+         start = clock();
+         TA_INT_MA_RIBBON( 0, NB_BARS-1, series[s].inReal0, RIBBON_NB_PERIOD, periods, maTypes[f],
+                           outBegIdx, outNBElement, matrix );
+         seconds = elapsed( start );
+         printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+                 funcNames[f], series[s].name, periods[RIBBON_NB_PERIOD-1], "ribbon",
+                 ribbon_error( series[s].inReal0, periods, maTypes[f], matrix ), "-", seconds );
+      }
+   }
+
+   free( matrix );
+}
+
+/* The HT_* functions one by one against TA_INT_HT, which
+ * evaluates them with one pass of each of the two Hilbert
+ * Transform pipelines. The error must be exactly zero.
+ */
+#define HT_NB_OUTPUT 8
+
+static double ht_error( double **fused, double **single, const int *fusedMode, const int *singleMode,
+                        const int *nbElement )
+{
+   double maxErr, err;
+   int o, i;
+
+   maxErr = 0.0;
+   for( o=0; o < HT_NB_OUTPUT-1; o++ )
+   {
+      for( i=0; i < nbElement[o]; i++ )
+      {
+         err = fabs(fused[o][i]-single[o][i]);
+         if( err > maxErr )
+            maxErr = err;
+      }
+   }
+   for( i=0; i < nbElement[HT_NB_OUTPUT-1]; i++ )
+   {
+      if( fusedMode[i] != singleMode[i] )
+         maxErr = 1.0;
+   }
+   return maxErr;
+}
+
+static void bench_ht( const BenchSeries *series, int nbSeries )
+{
+   double *fused[HT_NB_OUTPUT], *single[HT_NB_OUTPUT];
+   int *fusedMode, *singleMode;
+   int nbElement[HT_NB_OUTPUT];
+   int outBegIdx, outNBElement, s, o;
+   double seconds;
+   clock_t start;
+
+   for( o=0; o < HT_NB_OUTPUT; o++ )
+   {
+      fused[o]  = (double *)malloc( NB_BARS * sizeof(double) );
+      single[o] = (double *)malloc( NB_BARS * sizeof(double) );
+   }
+   for( o=0; o < HT_NB_OUTPUT; o++ )
+   {
+      if( !fused[o] || !single[o] )
+      {
+         printf( "Not enough memory for HT\n" );
+         for( o=0; o < HT_NB_OUTPUT; o++ )
+         {
+            free( fused[o] );
+            free( single[o] );
+         }
+         return;
+      }
+   }
+   fusedMode  = (int *)fused[HT_NB_OUTPUT-1];
+   singleMode = (int *)single[HT_NB_OUTPUT-1];
+
+   for( s=0; s < nbSeries; s++ )
+   {
+      start = clock();
+      TA_HT_DCPERIOD( 0, NB_BARS-1, series[s].inReal0, &outBegIdx, &nbElement[0], single[0] );
+      TA_HT_PHASOR( 0, NB_BARS-1, series[s].inReal0, &outBegIdx, &nbElement[1], single[1], single[2] );
+      TA_HT_DCPHASE( 0, NB_BARS-1, series[s].inReal0, &outBegIdx, &nbElement[3], single[3] );
+      TA_HT_SINE( 0, NB_BARS-1, series[s].inReal0, &outBegIdx, &nbElement[4], single[4], single[5] );
+      TA_HT_TRENDLINE( 0, NB_BARS-1, series[s].inReal0, &outBegIdx, &nbElement[6], single[6] );
+      TA_HT_TRENDMODE( 0, NB_BARS-1, series[s].inReal0, &outBegIdx, &nbElement[7], singleMode );
+      seconds = elapsed( start );
+      nbElement[2] = nbElement[1];
+      nbElement[5] = nbElement[4];
+      printf( "%-8s %-8s %6d %-11s %12s %10s %10.4f\n",
+              "HT_ALL", series[s].name, 63, "one-by-one", "-", "-", seconds );
+
+      start = clock();
+      TA_INT_HT( 0, NB_BARS-1, series[s].inReal0, 0, &outBegIdx, &outNBElement,
+                 fused[0], fused[1], fused[2], NULL, NULL, NULL, NULL, NULL );
+      TA_INT_HT( 0, NB_BARS-1, series[s].inReal0, 0, &outBegIdx, &outNBElement,
+                 NULL, NULL, NULL, fused[3], fused[4], fused[5], fused[6], fusedMode );
+      seconds = elapsed( start );
+      printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+              "HT_ALL", series[s].name, 63, "fused",
+              ht_error( fused, single, fusedMode, singleMode, nbElement ), "-", seconds );
+   }
+
+   for( o=0; o < HT_NB_OUTPUT; o++ )
+   {
+      free( fused[o] );
+      free( single[o] );
+   }
+}
+
+/* ADX, ADXR, DX, PLUS_DI, MINUS_DI, PLUS_DM, MINUS_DM and
+ * ATR one by one against TA_INT_DMI, on a high/low/close
+ * series of its own. The error must be exactly zero.
+ */
+#define DMI_NB_BARS 5000000
+
+static void bench_dmi( const BenchSeries *series, int nbSeries )
+{
+   double *high, *low, *close, *fused[TA_DMI_NB_OUTPUT], *single[TA_DMI_NB_OUTPUT];
+   double level, noise, seconds, err, maxErr;
+   int outBegIdx[TA_DMI_NB_OUTPUT], outNBElement[TA_DMI_NB_OUTPUT];
+   int begIdx, nbElement, period, i, o, ok;
+   unsigned int seed;
+   clock_t start;
+
+   (void)series;
+   (void)nbSeries;
+
+   high  = (double *)malloc( DMI_NB_BARS * sizeof(double) );
+   low   = (double *)malloc( DMI_NB_BARS * sizeof(double) );
+   close = (double *)malloc( DMI_NB_BARS * sizeof(double) );
+   ok = high && low && close;
+   for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+   {
+      fused[o]  = (double *)malloc( DMI_NB_BARS * sizeof(double) );
+      single[o] = (double *)malloc( DMI_NB_BARS * sizeof(double) );
+      ok = ok && fused[o] && single[o];
+   }
+
+   if( ok )
+   {
+      /* A random walk with a random range around the close. */
+      seed = 2468;
+      level = 100.0;
+      for( i=0; i < DMI_NB_BARS; i++ )
+      {
+         seed = seed*1103515245u+12345u;
+         noise = ((double)((seed>>8)&0xFFFF)/65536.0)-0.5;
+         level += noise;
+         if( level < 1.0 )
+            level = 1.0;
+         close[i] = level;
+         seed = seed*1103515245u+12345u;
+         high[i] = level+(double)((seed>>8)&0xFF)/256.0;
+         seed = seed*1103515245u+12345u;
+         low[i] = level-(double)((seed>>8)&0xFF)/256.0;
+      }
+
+      /* Touch the outputs and warm up the clock rate. */
+      for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+      {
+         memset( fused[o], 0, DMI_NB_BARS * sizeof(double) );
+         memset( single[o], 0, DMI_NB_BARS * sizeof(double) );
+      }
+      period = 14;
+      TA_ATR( 0, DMI_NB_BARS-1, high, low, close, period, &begIdx, &nbElement, single[7] );
+
+      start = clock();
+      TA_ADX( 0, DMI_NB_BARS-1, high, low, close, period, &begIdx, &nbElement, single[0] );
+      TA_ADXR( 0, DMI_NB_BARS-1, high, low, close, period, &begIdx, &nbElement, single[1] );
+      TA_DX( 0, DMI_NB_BARS-1, high, low, close, period, &begIdx, &nbElement, single[2] );
+      TA_PLUS_DI( 0, DMI_NB_BARS-1, high, low, close, period, &begIdx, &nbElement, single[3] );
+      TA_MINUS_DI( 0, DMI_NB_BARS-1, high, low, close, period, &begIdx, &nbElement, single[4] );
+      TA_PLUS_DM( 0, DMI_NB_BARS-1, high, low, period, &begIdx, &nbElement, single[5] );
+      TA_MINUS_DM( 0, DMI_NB_BARS-1, high, low, period, &begIdx, &nbElement, single[6] );
+      TA_ATR( 0, DMI_NB_BARS-1, high, low, close, period, &begIdx, &nbElement, single[7] );
+      seconds = elapsed( start );
+      printf( "%-8s %-8s %6d %-11s %12s %10s %10.4f\n",
+              "DMI", "ohlc", period, "one-by-one", "-", "-", seconds );
+
+      start = clock();
+      TA_INT_DMI( 0, DMI_NB_BARS-1, high, low, close, period, outBegIdx, outNBElement,
+                  fused[0], fused[1], fused[2], fused[3], fused[4], fused[5], fused[6], fused[7] );
+      seconds = elapsed( start );
+
+      maxErr = 0.0;
+      for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+      {
+         for( i=0; i < outNBElement[o]; i++ )
+         {
+            err = fabs(fused[o][i]-single[o][i]);
+            if( err > maxErr )
+               maxErr = err;
+         }
+      }
+      printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+              "DMI", "ohlc", period, "fused", maxErr, "-", seconds );
+   }
+   else
+      printf( "Not enough memory for DMI\n" );
+
+   free( high );
+   free( low );
+   free( close );
+   for( o=0; o < TA_DMI_NB_OUTPUT; o++ )
+   {
+      free( fused[o] );
+      free( single[o] );
+   }
+}
+
+/* The TA_CDL functions one by one, through the abstract interface,
+ * against TA_INT_CDL. The error is the number of bars where a
+ * pattern differs.
+ */
+#define CDL_NB_BARS 1000000
+
+static int compare_name( const void *a, const void *b )
+{
+   return strcmp( *(const char * const *)a, *(const char * const *)b );
+}
+
+static void bench_cdl( const BenchSeries *series, int nbSeries )
+{
+   double *open, *high, *low, *close;
+   double level, noise, seconds;
+   int *fused, *single;
+   const char *names[TA_CDL_NB_PATTERN];
+   int pattern[TA_CDL_NB_PATTERN], singleBegIdx[TA_CDL_NB_PATTERN];
+   TA_StringTable *table;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *params[TA_CDL_NB_PATTERN];
+   int begIdx, nbElement, i, p, nbPattern, nbDiff, ok;
+   unsigned int seed;
+   clock_t start;
+
+   (void)series;
+   (void)nbSeries;
+
+   if( TA_FuncTableAlloc( "Pattern Recognition", &table ) != TA_SUCCESS )
+      return;
+   nbPattern = 0;
+   for( i=0; i < (int)table->size && nbPattern < TA_CDL_NB_PATTERN; i++ )
+      names[nbPattern++] = table->string[i];
+   qsort( (void *)names, nbPattern, sizeof(const char *), compare_name );
+
+   open   = (double *)malloc( CDL_NB_BARS * sizeof(double) );
+   high   = (double *)malloc( CDL_NB_BARS * sizeof(double) );
+   low    = (double *)malloc( CDL_NB_BARS * sizeof(double) );
+   close  = (double *)malloc( CDL_NB_BARS * sizeof(double) );
+   fused  = (int *)malloc( (size_t)TA_CDL_NB_PATTERN * CDL_NB_BARS * sizeof(int) );
+   single = (int *)malloc( (size_t)TA_CDL_NB_PATTERN * CDL_NB_BARS * sizeof(int) );
+   ok = open && high && low && close && fused && single && (nbPattern == TA_CDL_NB_PATTERN);
+   for( p=0; p < nbPattern; p++ )
+   {
+      pattern[p] = p;
+      params[p] = NULL;
+      if( ok && (TA_GetFuncHandle( names[p], &handle ) == TA_SUCCESS) )
+         TA_ParamHolderAlloc( handle, &params[p] );
+      if( ok && params[p] )
+      {
+         TA_SetInputParamPricePtr( params[p], 0, open, high, low, close, NULL, NULL );
+         TA_SetOutputParamIntegerPtr( params[p], 0, single+(size_t)p*CDL_NB_BARS );
+      }
+      ok = ok && params[p];
+   }
+
+   if( ok )
+   {
+      /* A random walk on a 0.01 grid, with a gap between the close
+       * and the next open, some equal prices and some dojis.
+       */
+      seed = 1357;
+      level = 100.0;
+      for( i=0; i < CDL_NB_BARS; i++ )
+      {
+         seed = seed*1103515245u+12345u;
+         noise = ((double)((seed>>8)&0xFFFF)/65536.0)-0.5;
+         open[i] = floor( (level+((seed>>24)&3 ? 0.0 : noise))*100.0+0.5 )/100.0;
+         seed = seed*1103515245u+12345u;
+         noise = ((double)((seed>>8)&0xFFFF)/65536.0)-0.5;
+         close[i] = (seed>>28) < 3 ? open[i] : floor( (open[i]+2.0*noise)*100.0+0.5 )/100.0;
+         seed = seed*1103515245u+12345u;
+         high[i] = (close[i] > open[i] ? close[i] : open[i])+(double)((seed>>8)&0x3F)/100.0;
+         seed = seed*1103515245u+12345u;
+         low[i] = (close[i] < open[i] ? close[i] : open[i])-(double)((seed>>8)&0x3F)/100.0;
+         level = close[i] > 1.0 ? close[i] : 1.0;
+      }
+
+      /* Touch the outputs. */
+      memset( fused, 0, (size_t)TA_CDL_NB_PATTERN * CDL_NB_BARS * sizeof(int) );
+      memset( single, 0, (size_t)TA_CDL_NB_PATTERN * CDL_NB_BARS * sizeof(int) );
+
+      start = clock();
+      for( p=0; p < nbPattern; p++ )
+         TA_CallFunc( params[p], 0, CDL_NB_BARS-1, &singleBegIdx[p], &nbElement );
+      seconds = elapsed( start );
+      printf( "%-8s %-8s %6d %-11s %12s %10s %10.4f\n",
+              "CDL", "ohlc", nbPattern, "one-by-one", "-", "-", seconds );
+
+      start = clock();
+      TA_INT_CDL( 0, CDL_NB_BARS-1, open, high, low, close, nbPattern, pattern, TA_REAL_DEFAULT,
+                  &begIdx, &nbElement, fused );
+      seconds = elapsed( start );
+
+      /* The functions write their outputs from the first bar
+       * after their lookback.
+       */
+      nbDiff = 0;
+      for( p=0; p < nbPattern; p++ )
+      {
+         begIdx = singleBegIdx[p];
+         for( i=0; i < CDL_NB_BARS; i++ )
+         {
+            if( fused[(size_t)p*CDL_NB_BARS+i] != (i < begIdx ? 0 : single[(size_t)p*CDL_NB_BARS+i-begIdx]) )
+               nbDiff++;
+         }
+      }
+      printf( "%-8s %-8s %6d %-11s %12d %10s %10.4f\n",
+              "CDL", "ohlc", nbPattern, "fused", nbDiff, "-", seconds );
+   }
+   else
+      printf( "Not enough memory for CDL\n" );
+
+   for( p=0; p < nbPattern; p++ )
+      if( params[p] )
+         TA_ParamHolderFree( params[p] );
+   TA_FuncTableFree( table );
+   free( open );
+   free( high );
+   free( low );
+   free( close );
+   free( fused );
+   free( single );
+}
+
+/* AVGDEV and CCI against their former loops, one output at a
+ * time. The error is relative to each output of the former loop,
+ * it must be exactly zero.
+ */
+static TA_RetCode old_avgdev( int startIdx, int endIdx, const double inReal[], int optInTimePeriod,
+                              int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double todaySum, todayDev;
+   int today, outIdx, i;
+
+   today = startIdx < optInTimePeriod-1 ? optInTimePeriod-1 : startIdx;
+   *outBegIdx = today;
+   outIdx = 0;
+   for( ; today <= endIdx; today++ )
+   {
+      todaySum = 0.0;
+      for( i=0; i < optInTimePeriod; i++ )
+         todaySum += inReal[today-i];
+      todayDev = 0.0;
+      for( i=0; i < optInTimePeriod; i++ )
+         todayDev += fabs(inReal[today-i]-todaySum/optInTimePeriod);
+      outReal[outIdx++] = todayDev/optInTimePeriod;
+   }
+   *outNBElement = outIdx;
+   return TA_SUCCESS;
+}
+
+/* The former TA_CCI, with its circular buffer. */
+static TA_RetCode old_cci( int startIdx, int endIdx, const double inHigh[], const double inLow[],
+                           const double inClose[], int optInTimePeriod,
+                           int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double *circBuffer, tempReal, tempReal2, theAverage, lastValue;
+   int circIdx, i, j, outIdx;
+
+   if( startIdx < optInTimePeriod-1 )
+      startIdx = optInTimePeriod-1;
+   circBuffer = (double *)malloc( optInTimePeriod * sizeof(double) );
+   if( !circBuffer )
+      return TA_ALLOC_ERR;
+   circIdx = 0;
+   for( i=startIdx-optInTimePeriod+1; i < startIdx; i++ )
+   {
+      circBuffer[circIdx] = (inHigh[i]+inLow[i]+inClose[i])/3;
+      if( ++circIdx == optInTimePeriod )
+         circIdx = 0;
+   }
+   outIdx = 0;
+   for( ; i <= endIdx; i++ )
+   {
+      lastValue = (inHigh[i]+inLow[i]+inClose[i])/3;
+      circBuffer[circIdx] = lastValue;
+      theAverage = 0;
+      for( j=0; j < optInTimePeriod; j++ )
+         theAverage += circBuffer[j];
+      theAverage /= optInTimePeriod;
+      tempReal2 = 0;
+      for( j=0; j < optInTimePeriod; j++ )
+         tempReal2 += fabs(circBuffer[j]-theAverage);
+      tempReal = lastValue-theAverage;
+      if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+         outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+      else
+         outReal[outIdx++] = 0.0;
+      if( ++circIdx == optInTimePeriod )
+         circIdx = 0;
+   }
+   free( circBuffer );
+   *outBegIdx = startIdx;
+   *outNBElement = outIdx;
+   return TA_SUCCESS;
+}
+
+static void print_meandev( const char *func, const char *series, int period, int nbElement,
+                           double newSeconds, double oldSeconds )
+{
+   double maxErr, err;
+   int i;
+
+   maxErr = 0.0;
+   for( i=0; i < nbElement; i++ )
+   {
+      err = fabs(gOut[i]-gRef[i]);
+      if( gRef[i] != 0.0 )
+         err /= fabs(gRef[i]);
+      if( err > maxErr )
+         maxErr = err;
+   }
+   printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+           func, series, period, "lanes", maxErr, "-", newSeconds );
+   printf( "%-8s %-8s %6d %-11s %12s %10s %10.4f\n",
+           func, series, period, "window", "-", "-", oldSeconds );
+}
+
+static void bench_meandev( const BenchSeries *series, int nbSeries )
+{
+   const double *high, *low;
+   double newSeconds, oldSeconds;
+   int s, p, period, outBegIdx, outNBElement;
+   clock_t start;
+
+   for( s=0; s < nbSeries; s++ )
+   {
+      /* The two inputs are the high and the low, the close is
+       * the first one.
+       */
+      high = series[s].inReal0;
+      low  = series[s].inReal1;
+      for( p=0; p < (int)NB_PERIODS; p++ )
+      {
+         period = benchPeriods[p];
+
+         start = clock();
+         TA_AVGDEV( 0, NB_BARS-1, high, period, &outBegIdx, &outNBElement, gOut );
+         newSeconds = elapsed( start );
+         start = clock();
+         old_avgdev( 0, NB_BARS-1, high, period, &outBegIdx, &outNBElement, gRef );
+         oldSeconds = elapsed( start );
+         print_meandev( "AVGDEV", series[s].name, period, outNBElement, newSeconds, oldSeconds );
+
+         start = clock();
+         TA_CCI( 0, NB_BARS-1, high, low, high, period, &outBegIdx, &outNBElement, gOut );
+         newSeconds = elapsed( start );
+         start = clock();
+         old_cci( 0, NB_BARS-1, high, low, high, period, &outBegIdx, &outNBElement, gRef );
+         oldSeconds = elapsed( start );
+         print_meandev( "CCI", series[s].name, period, outNBElement, newSeconds, oldSeconds );
+      }
+   }
+}
+
+/* DEMA, TEMA and TRIX against their former evaluation, one
+ * EMA after the other through temporary buffers, on a series
+ * long enough for these buffers to spill out of the cache.
+ * The error must be exactly zero.
+ */
+#define CASCADE_NB_BARS 10000000
+
+static TA_RetCode old_dema( int endIdx, const double inReal[], int optInTimePeriod,
+                            int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double *firstEMA, *secondEMA;
+   int firstBegIdx, firstNBElement, secondBegIdx, secondNBElement, i;
+
+   firstEMA  = (double *)malloc( (endIdx+1) * sizeof(double) );
+   secondEMA = (double *)malloc( (endIdx+1) * sizeof(double) );
+   if( !firstEMA || !secondEMA )
+   {
+      free( firstEMA );
+      free( secondEMA );
+      return TA_ALLOC_ERR;
+   }
+   TA_EMA( 0, endIdx, inReal, optInTimePeriod, &firstBegIdx, &firstNBElement, firstEMA );
+   TA_EMA( 0, firstNBElement-1, firstEMA, optInTimePeriod, &secondBegIdx, &secondNBElement, secondEMA );
+   for( i=0; i < secondNBElement; i++ )
+      outReal[i] = (2.0*firstEMA[secondBegIdx+i]) - secondEMA[i];
+   free( firstEMA );
+   free( secondEMA );
+   *outBegIdx = firstBegIdx+secondBegIdx;
+   *outNBElement = secondNBElement;
+   return TA_SUCCESS;
+}
+
+static TA_RetCode old_tema( int endIdx, const double inReal[], int optInTimePeriod,
+                            int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double *firstEMA, *secondEMA, *thirdEMA;
+   int firstBegIdx, firstNBElement, secondBegIdx, secondNBElement;
+   int thirdBegIdx, thirdNBElement, i;
+
+   firstEMA  = (double *)malloc( (endIdx+1) * sizeof(double) );
+   secondEMA = (double *)malloc( (endIdx+1) * sizeof(double) );
+   thirdEMA  = (double *)malloc( (endIdx+1) * sizeof(double) );
+   if( !firstEMA || !secondEMA || !thirdEMA )
+   {
+      free( firstEMA );
+      free( secondEMA );
+      free( thirdEMA );
+      return TA_ALLOC_ERR;
+   }
+   TA_EMA( 0, endIdx, inReal, optInTimePeriod, &firstBegIdx, &firstNBElement, firstEMA );
+   TA_EMA( 0, firstNBElement-1, firstEMA, optInTimePeriod, &secondBegIdx, &secondNBElement, secondEMA );
+   TA_EMA( 0, secondNBElement-1, secondEMA, optInTimePeriod, &thirdBegIdx, &thirdNBElement, thirdEMA );
+   for( i=0; i < thirdNBElement; i++ )
+      outReal[i] = thirdEMA[i] + ((3.0*firstEMA[secondBegIdx+thirdBegIdx+i]) - (3.0*secondEMA[thirdBegIdx+i]));
+   free( firstEMA );
+   free( secondEMA );
+   free( thirdEMA );
+   *outBegIdx = firstBegIdx+secondBegIdx+thirdBegIdx;
+   *outNBElement = thirdNBElement;
+   return TA_SUCCESS;
+}
+
+/* The former TA_TRIX, the three EMA are done in place. */
+static TA_RetCode old_trix( int endIdx, const double inReal[], int optInTimePeriod,
+                            int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   double *tempBuffer;
+   int begIdx, nbElement, totalBegIdx, i;
+
+   tempBuffer = (double *)malloc( (endIdx+1) * sizeof(double) );
+   if( !tempBuffer )
+      return TA_ALLOC_ERR;
+   TA_EMA( 0, endIdx, inReal, optInTimePeriod, &totalBegIdx, &nbElement, tempBuffer );
+   for( i=0; i < 2; i++ )
+   {
+      TA_EMA( 0, nbElement-1, tempBuffer, optInTimePeriod, &begIdx, &nbElement, tempBuffer );
+      totalBegIdx += begIdx;
+   }
+   TA_ROC( 0, nbElement-1, tempBuffer, 1, &begIdx, outNBElement, outReal );
+   free( tempBuffer );
+   *outBegIdx = totalBegIdx+begIdx;
+   return TA_SUCCESS;
+}
+
+static void bench_cascade( const BenchSeries *series, int nbSeries )
+{
+   typedef TA_RetCode (*OldCascade)( int endIdx, const double inReal[], int optInTimePeriod,
+                                     int *outBegIdx, int *outNBElement, double outReal[] );
+   static const char *names[] = { "DEMA", "TEMA", "TRIX" };
+   static const OldCascade oldFuncs[] = { old_dema, old_tema, old_trix };
+   double *in, *out, *ref;
+   double level, noise, newSeconds, oldSeconds, err, maxErr;
+   int outBegIdx, outNBElement, refBegIdx, refNBElement, period, f, p, i;
+   unsigned int seed;
+   clock_t start;
+
+   (void)series;
+   (void)nbSeries;
+
+   in  = (double *)malloc( CASCADE_NB_BARS * sizeof(double) );
+   out = (double *)malloc( CASCADE_NB_BARS * sizeof(double) );
+   ref = (double *)malloc( CASCADE_NB_BARS * sizeof(double) );
+   if( in && out && ref )
+   {
+      /* A random walk. */
+      seed = 1357;
+      level = 100.0;
+      for( i=0; i < CASCADE_NB_BARS; i++ )
+      {
+         seed = seed*1103515245u+12345u;
+         noise = ((double)((seed>>8)&0xFFFF)/65536.0)-0.5;
+         level += noise;
+         if( level < 1.0 )
+            level = 1.0;
+         in[i] = level;
+      }
+      memset( out, 0, CASCADE_NB_BARS * sizeof(double) );
+      memset( ref, 0, CASCADE_NB_BARS * sizeof(double) );
+
+      for( f=0; f < 3; f++ )
+      {
+         for( p=0; p < (int)NB_PERIODS; p++ )
+         {
+            period = benchPeriods[p];
+
+            start = clock();
+            switch( f )
+            {
+            case 0: TA_DEMA( 0, CASCADE_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out ); break;
+            case 1: TA_TEMA( 0, CASCADE_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out ); break;
+            default: TA_TRIX( 0, CASCADE_NB_BARS-1, in, period, &outBegIdx, &outNBElement, out ); break;
+            }
+            newSeconds = elapsed( start );
+
+            start = clock();
+            oldFuncs[f]( CASCADE_NB_BARS-1, in, period, &refBegIdx, &refNBElement, ref );
+            oldSeconds = elapsed( start );
+
+            maxErr = (outBegIdx != refBegIdx || outNBElement != refNBElement) ? HUGE_VAL : 0.0;
+            for( i=0; i < outNBElement && i < refNBElement; i++ )
+            {
+               err = fabs(out[i]-ref[i]);
+               if( err > maxErr )
+                  maxErr = err;
+            }
+            printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+                    names[f], "walk", period, "single-pass", maxErr, "-", newSeconds );
+            printf( "%-8s %-8s %6d %-11s %12s %10s %10.4f\n",
+                    names[f], "walk", period, "buffers", "-", "-", oldSeconds );
+         }
+      }
+   }
+   else
+      printf( "Not enough memory for CASCADE\n" );
+
+   free( in );
+   free( out );
+   free( ref );
+}
+
+/* STOCH and STOCHRSI against their former evaluation: a rescan of
+ * the K window when its extremum leaves it, then the MA one after
+ * the other through a temporary buffer. The K are 5, 20 and 200
+ * bars, smoothed by SMA of 3 bars, on a random walk and on a series
+ * going down then up, where the rescan happens on every bar. The
+ * error must be exactly zero.
+ */
+#define STOCH_NB_BARS 2000000
+
+static void old_fastk( int today, int endIdx, const double inHigh[], const double inLow[],
+                       const double inClose[], int optInFastK_Period, double outReal[] )
+{
+   double lowest, highest, tmp, diff;
+   int lowestIdx, highestIdx, trailingIdx, outIdx, i;
+
+   trailingIdx = today-optInFastK_Period+1;
+   lowestIdx = highestIdx = -1;
+   diff = highest = lowest = 0.0;
+   outIdx = 0;
+   for( ; today <= endIdx; today++, trailingIdx++ )
+   {
+      tmp = inLow[today];
+      if( lowestIdx < trailingIdx )
+      {
+         lowestIdx = trailingIdx;
+         lowest = inLow[lowestIdx];
+         for( i=lowestIdx+1; i <= today; i++ )
+         {
+            if( inLow[i] < lowest )
+            {
+               lowestIdx = i;
+               lowest = inLow[i];
+            }
+         }
+         diff = (highest-lowest)/100.0;
+      }
+      else if( tmp <= lowest )
+      {
+         lowestIdx = today;
+         lowest = tmp;
+         diff = (highest-lowest)/100.0;
+      }
+
+      tmp = inHigh[today];
+      if( highestIdx < trailingIdx )
+      {
+         highestIdx = trailingIdx;
+         highest = inHigh[highestIdx];
+         for( i=highestIdx+1; i <= today; i++ )
+         {
+            if( inHigh[i] > highest )
+            {
+               highestIdx = i;
+               highest = inHigh[i];
+            }
+         }
+         diff = (highest-lowest)/100.0;
+      }
+      else if( tmp >= highest )
+      {
+         highestIdx = today;
+         highest = tmp;
+         diff = (highest-lowest)/100.0;
+      }
+
+      outReal[outIdx++] = diff != 0.0 ? (inClose[today]-lowest)/diff : 0.0;
+   }
+}
+
+static TA_RetCode old_stoch( int endIdx, const double inHigh[], const double inLow[],
+                             const double inClose[], int optInFastK_Period, double *buffer,
+                             int *outBegIdx, int *outNBElement, double outSlowK[], double outSlowD[] )
+{
+   int begIdx, nbElement;
+
+   old_fastk( optInFastK_Period-1, endIdx, inHigh, inLow, inClose, optInFastK_Period, buffer );
+   TA_MA( 0, endIdx-optInFastK_Period+1, buffer, 3, TA_MAType_SMA, &begIdx, &nbElement, buffer );
+   TA_MA( 0, nbElement-1, buffer, 3, TA_MAType_SMA, &begIdx, outNBElement, outSlowD );
+   memcpy( outSlowK, &buffer[2], *outNBElement * sizeof(double) );
+   *outBegIdx = optInFastK_Period+3;
+   return TA_SUCCESS;
+}
+
+static TA_RetCode old_stochrsi( int endIdx, const double inReal[], int optInFastK_Period,
+                                double *buffer, double *rsiBuffer,
+                                int *outBegIdx, int *outNBElement, double outFastK[], double outFastD[] )
+{
+   int rsiBegIdx, rsiNBElement;
+
+   TA_RSI( 0, endIdx, inReal, 14, &rsiBegIdx, &rsiNBElement, rsiBuffer );
+   old_fastk( optInFastK_Period-1, rsiNBElement-1, rsiBuffer, rsiBuffer, rsiBuffer,
+              optInFastK_Period, outFastK );
+   *outNBElement = rsiNBElement-optInFastK_Period+1;
+   memcpy( buffer, outFastK, *outNBElement * sizeof(double) );
+   TA_MA( 0, *outNBElement-1, buffer, 3, TA_MAType_SMA, outBegIdx, outNBElement, outFastD );
+   memmove( outFastK, &outFastK[2], *outNBElement * sizeof(double) );
+   *outBegIdx = rsiBegIdx+optInFastK_Period+1;
+   return TA_SUCCESS;
+}
+
+static double max_diff( const double *a, const double *b, int nbElement )
+{
+   double err, maxErr;
+   int i;
+
+   maxErr = 0.0;
+   for( i=0; i < nbElement; i++ )
+   {
+      err = fabs(a[i]-b[i]);
+      if( err > maxErr )
+         maxErr = err;
+   }
+   return maxErr;
+}
+
+static void bench_stoch( const BenchSeries *series, int nbSeries )
+{
+   static const char *names[] = { "walk", "trend" };
+   double *high, *low, *close, *outK, *outD, *refK, *refD, *buffer, *rsiBuffer;
+   double level, noise, spread, newSeconds, oldSeconds, maxErr;
+   int outBegIdx, outNBElement, refBegIdx, refNBElement, period, s, p, i;
+   unsigned int seed;
+   clock_t start;
+
+   (void)series;
+   (void)nbSeries;
+
+   high      = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   low       = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   close     = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   outK      = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   outD      = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   refK      = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   refD      = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   buffer    = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   rsiBuffer = (double *)malloc( STOCH_NB_BARS * sizeof(double) );
+   if( high && low && close && outK && outD && refK && refD && buffer && rsiBuffer )
+   {
+      memset( outK, 0, STOCH_NB_BARS * sizeof(double) );
+      memset( outD, 0, STOCH_NB_BARS * sizeof(double) );
+      memset( refK, 0, STOCH_NB_BARS * sizeof(double) );
+      memset( refD, 0, STOCH_NB_BARS * sizeof(double) );
+      memset( buffer, 0, STOCH_NB_BARS * sizeof(double) );
+      memset( rsiBuffer, 0, STOCH_NB_BARS * sizeof(double) );
+
+      for( s=0; s < 2; s++ )
+      {
+         /* A random walk, or a down then up series. */
+         seed = 97531;
+         level = 1000.0;
+         spread = s == 0 ? 1.0/1024.0 : 1.0e-6;
+         for( i=0; i < STOCH_NB_BARS; i++ )
+         {
+            seed = seed*1103515245u+12345u;
+            noise = ((double)((seed>>8)&0xFFFF)/65536.0)-0.5;
+            if( s == 0 )
+               level += noise;
+            else
+               level += (i < STOCH_NB_BARS/2 ? -0.0004 : 0.0004)+noise*1.0e-4;
+            close[i] = level;
+            seed = seed*1103515245u+12345u;
+            high[i] = level+(double)((seed>>8)&0xFF)*spread;
+            seed = seed*1103515245u+12345u;
+            low[i] = level-(double)((seed>>8)&0xFF)*spread;
+         }
+
+         for( p=0; p < (int)NB_PERIODS; p++ )
+         {
+            period = benchPeriods[p];
+
+            start = clock();
+            TA_STOCH( 0, STOCH_NB_BARS-1, high, low, close, period, 3, TA_MAType_SMA, 3, TA_MAType_SMA,
+                      &outBegIdx, &outNBElement, outK, outD );
+            newSeconds = elapsed( start );
+            start = clock();
+            old_stoch( STOCH_NB_BARS-1, high, low, close, period, buffer,
+                       &refBegIdx, &refNBElement, refK, refD );
+            oldSeconds = elapsed( start );
+            maxErr = (outBegIdx != refBegIdx || outNBElement != refNBElement) ? HUGE_VAL :
+                     max_diff( outK, refK, outNBElement )+max_diff( outD, refD, outNBElement );
+            printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+                    "STOCH", names[s], period, "single-pass", maxErr, "-", newSeconds );
+            printf( "%-8s %-8s %6d %-11s %12s %10s %10.4f\n",
+                    "STOCH", names[s], period, "rescan", "-", "-", oldSeconds );
+
+            start = clock();
+            TA_STOCHRSI( 0, STOCH_NB_BARS-1, close, 14, period, 3, TA_MAType_SMA,
+                         &outBegIdx, &outNBElement, outK, outD );
+            newSeconds = elapsed( start );
+            start = clock();
+            old_stochrsi( STOCH_NB_BARS-1, close, period, buffer, rsiBuffer,
+                          &refBegIdx, &refNBElement, refK, refD );
+            oldSeconds = elapsed( start );
+            maxErr = (outBegIdx != refBegIdx || outNBElement != refNBElement) ? HUGE_VAL :
+                     max_diff( outK, refK, outNBElement )+max_diff( outD, refD, outNBElement );
+            printf( "%-8s %-8s %6d %-11s %12.3e %10s %10.4f\n",
+                    "STOCHRSI", names[s], period, "single-pass", maxErr, "-", newSeconds );
+            printf( "%-8s %-8s %6d %-11s %12s %10s %10.4f\n",
+                    "STOCHRSI", names[s], period, "rescan", "-", "-", oldSeconds );
+         }
+      }
+   }
+   else
+      printf( "Not enough memory for STOCH\n" );
+
+   free( high );
+   free( low );
+   free( close );
+   free( outK );
+   free( outD );
+   free( refK );
+   free( refD );
+   free( buffer );
+   free( rsiBuffer );
+}
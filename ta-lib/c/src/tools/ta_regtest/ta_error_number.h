@@ -64,6 +64,7 @@ typedef enum
   TA_TEST_TFRR_NB_ELEMENT_OUT_OF_RANGE  = 139,
   TA_TEST_TFRR_BAD_MA_TYPE              = 140,
   TA_TEST_TFFR_BAD_MA_LOOKBACK          = 141,
+  TA_TEST_TFRR_OFFSET_PRECISION         = 142,
 
   TA_TESTUTIL_DRT_REF_FAILED            = 150,
   TA_TESTUTIL_DRT_ALLOC_ERR             = 151,
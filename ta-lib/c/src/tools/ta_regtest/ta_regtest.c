@@ -245,6 +245,7 @@ static ErrorNumber testTAFunction_ALL( void )
       fflush(stdout); \
       showFeedback(); \
       TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT ); \
+      TA_SetPrecision( TA_PRECISION_DEFAULT ); \
       retValue = func( &history ); \
       if( retValue != TA_TEST_PASS ) \
          return retValue; \
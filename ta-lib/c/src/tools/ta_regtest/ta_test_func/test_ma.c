@@ -363,41 +363,52 @@ static TA_Test tableTest[] =
 /**** Global functions definitions.   ****/
 ErrorNumber test_func_ma( TA_History *history )
 {
-   unsigned int i;
+   unsigned int i, j;
    ErrorNumber retValue;
 
    /* Re-initialize all the unstable period to zero. */
    TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
 
-   for( i=0; i < NB_TEST; i++ )
+   /* Do all the tests with the default precision, then
+    * with the compensated sums which must give the same
+    * results on this data.
+    */
+   for( j=0; j < 2; j++ )
    {
+      TA_SetPrecision( j == 0 ? TA_PRECISION_DEFAULT : TA_PRECISION_COMPENSATED );
 
-      if( (int)tableTest[i].expectedNbElement > (int)history->nbBars )
+      for( i=0; i < NB_TEST; i++ )
       {
-         printf( "TA_MA Failed Bad Parameter for Test #%d (%d,%d)\n",
-                 i, tableTest[i].expectedNbElement, history->nbBars );
-         return TA_TESTUTIL_TFRR_BAD_PARAM;
-      }
 
-      retValue = do_test_ma( history, &tableTest[i], 0 );
-      if( retValue != 0 )
-      {
-         printf( "TA_MA Failed Test #%d (Code=%d)\n", i, retValue );
-         return retValue;
-      }
+         if( (int)tableTest[i].expectedNbElement > (int)history->nbBars )
+         {
+            printf( "TA_MA Failed Bad Parameter for Test #%d (%d,%d)\n",
+                    i, tableTest[i].expectedNbElement, history->nbBars );
+            return TA_TESTUTIL_TFRR_BAD_PARAM;
+         }
 
-	  /* If TA_ANY_MA_TEST. repeat test with TA_MAVP */
-	  if( tableTest[i].id == TA_ANY_MA_TEST )
-	  {
-         retValue = do_test_ma( history, &tableTest[i], 1 );
+         retValue = do_test_ma( history, &tableTest[i], 0 );
          if( retValue != 0 )
          {
-            printf( "TA_MAVP Failed Test #%d (Code=%d)\n", i, retValue );
+            printf( "TA_MA Failed Test #%d (Code=%d)\n", i, retValue );
             return retValue;
-	     }
-	  }
+         }
+
+         /* If TA_ANY_MA_TEST. repeat test with TA_MAVP */
+         if( tableTest[i].id == TA_ANY_MA_TEST )
+         {
+            retValue = do_test_ma( history, &tableTest[i], 1 );
+            if( retValue != 0 )
+            {
+               printf( "TA_MAVP Failed Test #%d (Code=%d)\n", i, retValue );
+               return retValue;
+            }
+         }
+      }
    }
 
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+
    /* Re-initialize all the unstable period to zero. */
    TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
 
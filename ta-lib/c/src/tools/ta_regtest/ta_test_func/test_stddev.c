@@ -97,6 +97,8 @@ typedef struct
 static ErrorNumber do_test( const TA_History *history,
                             const TA_Test *test );
 
+static ErrorNumber do_test_offset( const TA_History *history );
+
 /**** Local variables definitions.     ****/
 
 static TA_Test tableTest[] =
@@ -139,6 +141,13 @@ ErrorNumber test_func_stddev( TA_History *history )
       }
    }
 
+   retValue = do_test_offset( history );
+   if( retValue != 0 )
+   {
+      printf( "%s Failed Offset Test (Code=%d)\n", __FILE__, retValue );
+      return retValue;
+   }
+
    /* All test succeed. */
    return TA_TEST_PASS; 
 }
@@ -263,3 +272,76 @@ static ErrorNumber do_test( const TA_History *history,
    return TA_TEST_PASS;
 }
 
+
+/* The standard deviation does not depend on an offset added to
+ * all the values. With an offset of 1e8 the sum of the squares
+ * of the values does not have enough precision anymore, the
+ * result must still be close to the one without the offset.
+ */
+static ErrorNumber do_test_offset( const TA_History *history )
+{
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement, i;
+   TA_Integer offsetBegIdx, offsetNbElement;
+
+   clearAllBuffers();
+   setInputBuffer( 0, history->close, history->nbBars );
+   setInputBuffer( 1, history->close, history->nbBars );
+   for( i=0; i < (int)history->nbBars; i++ )
+      gBuffer[1].in[i] += 1.0e8;
+
+   retCode = TA_STDDEV( 0, history->nbBars-1, gBuffer[0].in, 20, 1.0,
+                        &outBegIdx, &outNbElement, gBuffer[0].out0 );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+
+   retCode = TA_STDDEV( 0, history->nbBars-1, gBuffer[1].in, 20, 1.0,
+                        &offsetBegIdx, &offsetNbElement, gBuffer[1].out0 );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+
+   if( (offsetBegIdx != outBegIdx) || (offsetNbElement != outNbElement) )
+      return TA_TESTUTIL_TFRR_BAD_OUTNBELEMENT;
+
+   for( i=0; i < outNbElement; i++ )
+   {
+      if( !TA_REAL_EQ( gBuffer[1].out0[i], gBuffer[0].out0[i], 1.0e-6 ) )
+      {
+         printf( "Fail: STDDEV with offset [%d] %f != %f\n", i,
+                 gBuffer[1].out0[i], gBuffer[0].out0[i] );
+         return TA_TEST_TFRR_OFFSET_PRECISION;
+      }
+   }
+
+   /* Same with the bands, their SMA middle band is shifted by
+    * the offset.
+    */
+   retCode = TA_BBANDS( 0, history->nbBars-1, gBuffer[0].in, 20, 2.0, 2.0, TA_MAType_SMA,
+                        &outBegIdx, &outNbElement,
+                        gBuffer[0].out0, gBuffer[0].out1, gBuffer[0].out2 );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+
+   retCode = TA_BBANDS( 0, history->nbBars-1, gBuffer[1].in, 20, 2.0, 2.0, TA_MAType_SMA,
+                        &offsetBegIdx, &offsetNbElement,
+                        gBuffer[1].out0, gBuffer[1].out1, gBuffer[1].out2 );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+
+   if( (offsetBegIdx != outBegIdx) || (offsetNbElement != outNbElement) )
+      return TA_TESTUTIL_TFRR_BAD_OUTNBELEMENT;
+
+   for( i=0; i < outNbElement; i++ )
+   {
+      if( !TA_REAL_EQ( gBuffer[1].out0[i]-gBuffer[1].out1[i],
+                       gBuffer[0].out0[i]-gBuffer[0].out1[i], 1.0e-6 ) )
+      {
+         printf( "Fail: BBANDS with offset [%d] %f != %f\n", i,
+                 gBuffer[1].out0[i]-gBuffer[1].out1[i],
+                 gBuffer[0].out0[i]-gBuffer[0].out1[i] );
+         return TA_TEST_TFRR_OFFSET_PRECISION;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
@@ -0,0 +1,109 @@
+/*!
+ * The values of `BarStore.push` against a call of the TA functions over all
+ * the bars pushed.
+ */
+
+const assert = require('assert');
+const talib = require('..');
+
+const capacity = 20;
+const symbolCount = 8;
+const barCount = 300;
+
+let seed = 7;
+function random() {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+// The newest value of a call, NaN in the lookback.
+function last(values) {
+  return values.length > 0 ? values[values.length - 1] : NaN;
+}
+
+const store = new talib.BarStore(capacity, symbolCount);
+store.addIndicator('ema', 'EMA', ['close'], [10]);
+store.addIndicator('rsi', 'RSI', ['close'], [14]);
+// The streams do not need their lookback in the buffers.
+store.addIndicator('ema50', 'EMA', ['close'], [50]);
+store.addIndicator('atr', 'ATR', ['high', 'low', 'close'], [14]);
+store.addIndicator('sma', 'SMA', ['close'], [10]);
+// A windowed function of several moving averages, all of them SMAs.
+store.addIndicator('stoch', 'STOCH', ['high', 'low', 'close']);
+assert.deepStrictEqual(store.outputNames(), [
+  'ema', 'rsi', 'ema50', 'atr', 'sma', 'stoch.outSlowK', 'stoch.outSlowD',
+]);
+
+// The functions which depend on all the bars before are only evaluated by
+// the streams, their newest value is not the one of their lookback.
+for (const [name, inputs, optInputs] of [
+  ['CMO', ['close'], [14]],
+  ['PLUS_DI', ['high', 'low', 'close'], [14]],
+  ['MACD', ['close'], []],
+  ['OBV', ['close', 'volume'], []],
+  ['MA', ['close'], [10, talib.MATypes.EMA]],
+]) {
+  assert.throws(() => store.addIndicator('x', name, inputs, optInputs), new RegExp(name + ' depends on all the bars'));
+}
+store.addIndicator('wma', 'MA', ['close'], [10, talib.MATypes.WMA]);
+
+const histories = [];
+for (let s = 0; s < symbolCount; s++) {
+  histories.push({ open: [], high: [], low: [], close: [], price: 100 });
+}
+
+function pushBar(symbol) {
+  const history = histories[symbol];
+  const open = history.price;
+  history.price *= 1 + (random() - 0.5) * 0.02;
+  const bar = {
+    time: history.close.length,
+    open,
+    high: Math.max(open, history.price) * 1.001,
+    low: Math.min(open, history.price) * 0.999,
+    close: history.price,
+    volume: 1,
+  };
+  history.open.push(bar.open);
+  history.high.push(bar.high);
+  history.low.push(bar.low);
+  history.close.push(bar.close);
+  return store.push('S' + symbol, bar);
+}
+
+function expectSame(actual, expected, message) {
+  assert.ok(
+    Object.is(actual, expected) || Math.abs(actual - expected) <= 1e-12 * Math.abs(expected),
+    message + ': ' + actual + ' != ' + expected,
+  );
+}
+
+for (let b = 0; b < barCount; b++) {
+  for (let s = 0; s < symbolCount; s++) {
+    const values = pushBar(s);
+    const history = histories[s];
+    const at = ' at bar ' + b + ' of S' + s;
+    expectSame(values[0], last(talib.EMA(history.close, 10)), 'EMA' + at);
+    expectSame(values[1], last(talib.RSI(history.close, 14)), 'RSI' + at);
+    expectSame(values[2], last(talib.EMA(history.close, 50)), 'EMA(50)' + at);
+    expectSame(values[3], last(talib.ATR(history.high, history.low, history.close, 14)), 'ATR' + at);
+    expectSame(values[4], last(talib.SMA(history.close, 10)), 'SMA' + at);
+    const stoch = talib.STOCH(history.high, history.low, history.close);
+    expectSame(values[5], last(stoch[0]), 'STOCH.outSlowK' + at);
+    expectSame(values[6], last(stoch[1]), 'STOCH.outSlowD' + at);
+    expectSame(values[7], last(talib.WMA(history.close, 10)), 'MA(WMA)' + at);
+  }
+}
+
+// A stream added after some bars starts from the bars in the buffers.
+store.addIndicator('late', 'EMA', ['close'], [5]);
+for (let b = 0; b < 50; b++) {
+  const values = pushBar(0);
+  const closes = histories[0].close;
+  const window = closes.slice(barCount - capacity);
+  expectSame(values[8], last(talib.EMA(window, 5)), 'EMA added late at bar ' + b);
+}
+
+assert.throws(() => store.addIndicator('sma', 'SMA', ['close'], [capacity + 1]), /capacity/);
+
+console.log('bar-store: ok');
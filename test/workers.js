@@ -0,0 +1,105 @@
+/*!
+ * The binding loaded in several worker threads at once: each worker gets its
+ * own instance, the results are the ones of the main thread, whatever the
+ * other workers do, and a worker can be terminated in the middle of a call.
+ */
+
+const assert = require('assert');
+const { Worker, isMainThread, parentPort, workerData } = require('worker_threads');
+const talib = require('..');
+
+const workerCount = 8;
+const rounds = 5;
+
+function makeRecords(seed, length) {
+  const records = [];
+  let price = 100 + seed;
+  for (let i = 0; i < length; i++) {
+    const open = price;
+    price += Math.sin(i * 0.37 + seed) + Math.cos(i * 0.11) * 0.5;
+    records.push({
+      Open: open,
+      High: Math.max(open, price) + 0.5 + Math.abs(Math.sin(i)) * 0.3,
+      Low: Math.min(open, price) - 0.5 - Math.abs(Math.cos(i)) * 0.3,
+      Close: price,
+      Volume: 1000 + (i % 17),
+    });
+  }
+  return records;
+}
+
+// The work of a worker, it depends on `job` only: an encoding of the
+// patterns and of the trend mode, and a field of the records.
+function run(job) {
+  const records = makeRecords(job, 5000);
+  const column = field => Float64Array.from(records, record => record[field]);
+  const field = ['Open', 'High', 'Low', 'Close'][job % 4];
+  const options = { encoding: job % 3 };
+  const encode = value =>
+    value.index ? { index: Array.from(value.index), value: Array.from(value.value) } : Array.from(value);
+  return JSON.stringify({
+    ema: talib.EMA(records, field, 20),
+    atr: talib.ATR(records, 14),
+    engulfing: talib.CDLENGULFING(records),
+    patterns: encode(talib.CDL_ALL(column('Open'), column('High'), column('Low'), column('Close'),
+      ['CDLDOJI', 'CDLENGULFING', 'CDLHAMMER'], undefined, undefined, options)),
+    trendMode: encode(talib.HT_ALL(column(field), ['HT_TRENDMODE'], undefined, undefined, options)[7]),
+  });
+}
+
+// A worker which never returns, to be terminated.
+function spin() {
+  const records = makeRecords(0, 50000);
+  const columns = ['Open', 'High', 'Low', 'Close'].map(field => Float64Array.from(records, record => record[field]));
+  parentPort.postMessage('started');
+  for (;;) {
+    talib.CDL_ALL(columns[0], columns[1], columns[2], columns[3]);
+  }
+}
+
+function startWorker(job) {
+  return new Promise((resolve, reject) => {
+    const worker = new Worker(__filename, { workerData: job });
+    worker.on('message', resolve);
+    worker.on('error', reject);
+  });
+}
+
+function terminateWorker() {
+  return new Promise((resolve, reject) => {
+    const worker = new Worker(__filename, { workerData: 'spin' });
+    worker.on('error', reject);
+    worker.on('message', () => setTimeout(() => worker.terminate().then(resolve, reject), 20));
+  });
+}
+
+async function main() {
+  const expected = [];
+  for (let job = 0; job < workerCount; job++) {
+    expected.push(run(job));
+  }
+  for (let round = 0; round < rounds; round++) {
+    const jobs = [];
+    for (let job = 0; job < workerCount; job++) {
+      jobs.push(startWorker(job).then(result => assert.strictEqual(result, expected[job], 'worker ' + job)));
+    }
+    jobs.push(terminateWorker());
+    await Promise.all(jobs);
+  }
+  // The instance of the main thread is not affected by the workers.
+  for (let job = 0; job < workerCount; job++) {
+    assert.strictEqual(run(job), expected[job], 'main thread ' + job);
+  }
+  console.log('workers: ok');
+}
+
+if (isMainThread) {
+  main().catch(error => {
+    console.error(error);
+    process.exit(1);
+  });
+} else if (workerData === 'spin') {
+  spin();
+} else {
+  parentPort.postMessage(run(workerData));
+}